@@ -40,8 +40,16 @@ enum {
 	ARTNET_MAX_PORTS = 4
 };
 
+/**
+ * Art-Net 4 BindIndex pages, each page has ARTNET_MAX_PORTS ports.
+ * The bit mask of the changed ArtPollReply pages limits this to 32.
+ */
 enum {
+#if defined (__linux__)
+	ARTNET_MAX_PAGES = 32	///< Art-Net 4, 128 universes
+#else
 	ARTNET_MAX_PAGES = 8	///< Art-Net 4
+#endif
 };
 
 /**
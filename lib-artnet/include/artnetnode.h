@@ -32,12 +32,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <time.h>
+#include <assert.h>
 
 #include "artnet.h"
 #include "packets.h"
 
 #include "lightset.h"
 #include "ledblink.h"
+#include "dmxtransmit.h"
 
 #include "artnettimecode.h"
 #include "artnettimesync.h"
@@ -105,6 +107,9 @@ struct TArtNetNodeState {
 	uint8_t nActiveOutputPorts;
 	uint8_t nActiveInputPorts;
 	uint8_t Priority;					///< ArtPoll : Field 6 : The lowest priority of diagnostics message that should be sent.
+	bool IsPollReplyPending;			///< ArtPoll : The ArtPollReply is sent after a random delay
+	uint32_t nPollReplyMillis;			///< ArtPoll : Received time
+	uint32_t nPollReplyDelayMillis;		///< ArtPoll : Random delay for the ArtPollReply
 };
 
 struct TArtNetNode {
@@ -129,6 +134,19 @@ struct TGenericPort {
 	uint8_t nStatus;			///<
 };
 
+/*
+ * Counters since the start or the last ClearPortStats
+ */
+struct TArtNetPortStats {
+	uint32_t nReceived;			///< ArtDmx packets for the Port-Address of this port
+	uint32_t nSequenceLost;		///< Missing sequence numbers
+	uint32_t nOutOfOrder;		///< Sequence number older than the previous one
+	uint32_t nMerged;			///< Received while merging two sources
+	uint32_t nMergeTimeouts;	///< Sources dropped after the merge timeout
+	uint32_t nDiscarded;		///< More than two sources
+	uint32_t nUpdates;			///< Sent to the LightSet
+};
+
 struct TOutputPort {
 	uint8_t data[ARTNET_DMX_LENGTH];	///< Data sent
 	uint16_t nLength;					///< Length of sent DMX data
@@ -143,6 +161,9 @@ struct TOutputPort {
 	bool bIsEnabled;					///< Is the port enabled ?
 	TGenericPort port;					///< \ref TGenericPort
 	TPortProtocol tPortProtocol;		///< Art-Net 4
+	uint8_t nSequenceA;					///< The latest sequence number received from Port A
+	uint8_t nSequenceB;					///< The latest sequence number received from Port B
+	struct TArtNetPortStats tStats;		///< \ref TArtNetPortStats
 };
 
 struct TInputPort {
@@ -274,15 +295,67 @@ public:
 		return m_nDestinationIp;
 	}
 
+	/*
+	 * Input rate cap per port, 0 = no cap
+	 */
+	void SetInputMinInterval(uint32_t nMinIntervalMillis, uint8_t nPortIndex = 0) {
+		assert(nPortIndex < ARTNET_NODE_MAX_PORTS_INPUT);
+		m_pDmxTransmit[nPortIndex].SetMinInterval(nMinIntervalMillis);
+	}
+	uint32_t GetInputMinInterval(uint8_t nPortIndex = 0) const {
+		assert(nPortIndex < ARTNET_NODE_MAX_PORTS_INPUT);
+		return m_pDmxTransmit[nPortIndex].GetMinInterval();
+	}
+
+	/*
+	 * An ArtSync is sent after the ArtDmx packets of a DMX input pass
+	 */
+	void SetInputArtSync(bool bInputArtSync = true) {
+		m_bInputArtSync = bInputArtSync;
+	}
+	bool GetInputArtSync(void) {
+		return m_bInputArtSync;
+	}
+
 	void SetArtNet4Handler(ArtNet4Handler *pArtNet4Handler);
 
+	/*
+	 * The ArtPollReply is sent after a random delay of 0 to nMaxDelayMillis,
+	 * so that a large number of nodes do not answer an ArtPoll all at once.
+	 * 0 = reply immediately (default).
+	 */
+	void SetPollReplyMaxDelay(uint32_t nMaxDelayMillis);
+	uint32_t GetPollReplyMaxDelay(void) {
+		return m_nPollReplyMaxDelayMillis;
+	}
+
+	const struct TArtNetPortStats *GetPortStats(uint8_t nPortIndex) const {
+		assert(nPortIndex < ARTNET_NODE_MAX_PORTS_OUTPUT);
+		return &m_OutputPorts[nPortIndex].tStats;
+	}
+	void ClearPortStats(void);
+
+	/*
+	 * A summary of the port statistics is sent as ArtDiagData every nSeconds,
+	 * only when a controller has asked for diagnostics. 0 = disabled.
+	 */
+	void SetStatsInterval(uint32_t nSeconds) {
+		m_nStatsIntervalMillis = nSeconds * 1000;
+	}
+	uint32_t GetStatsInterval(void) {
+		return m_nStatsIntervalMillis / 1000;
+	}
+
 	void Print(void);
 
 private:
 	void FillPollReply(void);
-#if defined ( ENABLE_SENDDIAG )
+	void UpdatePollReply(uint32_t nPage);
+	void SetPollReplyChanged(uint32_t nPortIndex) {
+		m_nPollReplyChanged |= (1U << (nPortIndex / ARTNET_MAX_PORTS));
+	}
 	void FillDiagData(void);
-#endif
+	void SendDiagStats(void);
 
 	void GetType(void);
 
@@ -295,6 +368,16 @@ private:
 	void HandleTodRequest(void);
 	void HandleTodControl(void);
 	void HandleRdm(void);
+	void HandleRdmPending(void);
+	void SendRdmResponse(struct TArtRdm *pArtRdm, const uint8_t *pResponse, uint32_t nIPAddress);
+
+	/*
+	 * The LightSet of a port with queued RDM transactions is started between two
+	 * transactions for at least ARTNET_RDM_DMX_MILLIS, and when the queue is idle
+	 */
+	bool IsRdmPending(uint32_t nPortIndex) const {
+		return (nPortIndex < ARTNET_MAX_PORTS) && ((m_nRdmPortsPending & (1U << nPortIndex)) != 0);
+	}
 	void HandleIpProg(void);
 	void HandleDmxIn(void);
 	void HandleTrigger(void);
@@ -303,6 +386,7 @@ private:
 
 	bool IsMergedDmxDataChanged(uint8_t, const uint8_t *, uint16_t);
 	void CheckMergeTimeouts(uint8_t);
+	void UpdateSequence(struct TArtNetPortStats *pStats, uint8_t &nPrevious, uint8_t nSequence);
 	bool IsDmxDataChanged(uint8_t, const uint8_t *, uint16_t);
 
 	void SendPollRelply(bool);
@@ -330,12 +414,16 @@ private:
 	struct TArtNetNodeState m_State;
 
 	struct TArtNetPacket m_ArtNetPacket;
-	struct TArtPollReply m_PollReply;
-#if defined ( ENABLE_SENDDIAG )
+	struct TArtPollReply m_PollReply[ARTNET_MAX_PAGES];	///< Precomputed, one per BindIndex page
+	uint32_t m_nPollReplyChanged;						///< Bit mask of the pages with changed port configuration
+	uint32_t m_nPollReplyMaxDelayMillis;
+	uint32_t m_nPollReplyRandom;
 	struct TArtDiagData m_DiagData;
-#endif
+	uint32_t m_nStatsIntervalMillis;
+	uint32_t m_nStatsMillis;
 	struct TArtTimeCode *m_pTimeCodeData;
 	struct TArtTodData *m_pTodData;
+	struct TArtRdm *m_pRdmResponse;
 	struct TArtIpProgReply *m_pIpProgReply;
 
 	struct TOutputPort m_OutputPorts[ARTNET_NODE_MAX_PORTS_OUTPUT];
@@ -350,12 +438,18 @@ private:
 
 	bool m_IsLightSetRunning[ARTNET_NODE_MAX_PORTS_OUTPUT];
 	bool m_IsRdmResponder;
+	uint32_t m_nRdmPortsPending;	///< Bit mask of the ports with queued RDM transactions
+	uint32_t m_nRdmPortsDmx;		///< Bit mask of the pending ports with DMX output between two transactions
+	uint32_t m_nRdmDmxMillis[ARTNET_MAX_PORTS];
 
 	alignas(uint32_t) char m_aSysName[16];
 	alignas(uint32_t) char m_aDefaultNodeLongName[ARTNET_LONG_NAME_LENGTH];
 
 	uint32_t m_nDestinationIp;
 
+	DmxTransmit *m_pDmxTransmit;
+	bool m_bInputArtSync;
+
 public:
 	static ArtNetNode* Get(void) {
 		return s_pThis;
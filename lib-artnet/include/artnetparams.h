@@ -37,6 +37,9 @@
 
 #include "lightset.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TArtNetParams {
 	uint32_t nSetList;
 	uint8_t nNet;
@@ -61,6 +64,7 @@ struct TArtNetParams {
 	bool bEnableNoChangeUpdate;
 	uint8_t nDirection;
 	uint32_t nDestinationIp;
+	uint16_t nPollReplyDelay;
 };
 
 enum TArtnetParamsMask {
@@ -93,7 +97,9 @@ enum TArtnetParamsMask {
 	ARTNET_PARAMS_MASK_PROTOCOL_D = (1 << 26),
 	ARTNET_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT = (1 << 27),
 	ARTNET_PARAMS_MASK_DIRECTION = (1 << 28),
-	ARTNET_PARAMS_MASK_DESTINATION_IP = (1 << 29)
+	ARTNET_PARAMS_MASK_DESTINATION_IP = (1 << 29),
+	ARTNET_PARAMS_MASK_POLL_REPLY_DELAY = (1 << 30),
+	ARTNET_PARAMS_MASK_RDM_DISCOVERY = (1U << 31)
 };
 
 class ArtNetParamsStore {
@@ -180,6 +186,8 @@ public:
 public:
 	static void staticCallbackFunction(void *p, const char *s);
 
+	static const struct TPropertiesTable PROPERTIES_TABLE;
+
 private:
 	void callbackFunction(const char *pLine);
 	bool isMaskSet(uint32_t nMask) {
@@ -189,6 +197,7 @@ private:
 private:
 	ArtNetParamsStore *m_pArtNetParamsStore;
 	struct TArtNetParams m_tArtNetParams;
+	PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* ARTNETPARAMS_H_ */
@@ -52,6 +52,7 @@ public:
 	alignas(uint32_t) static const char PROTOCOL_PORT[ARTNET_MAX_PORTS][16];
 	alignas(uint32_t) static const char DIRECTION[];
 	alignas(uint32_t) static const char DESTINATION_IP[];
+	alignas(uint32_t) static const char POLL_REPLY_DELAY[];
 };
 
 #endif /* ARTNETPARAMSCONST_H_ */
@@ -40,6 +40,43 @@ public:
 	virtual void Copy(uint8_t nPort, uint8_t *)=0;
 
 	virtual const uint8_t *Handler(uint8_t nPort, const uint8_t *)=0;
+
+	/*
+	 * Optional non-blocking interface. When Queue returns false the blocking Handler is used.
+	 * Run is called from ArtNetNode::Run while the port is not idle, it returns
+	 * a response (including the start code) and the IP address of the requester.
+	 */
+	virtual bool Queue(uint8_t nPort, const uint8_t *pRdmData, uint32_t nIPAddressFrom) {
+		return false;
+	}
+
+	virtual const uint8_t *Run(uint8_t nPort, uint32_t &nIPAddressFrom) {
+		return 0;
+	}
+
+	virtual bool IsIdle(uint8_t nPort) {
+		return true;
+	}
+
+	/*
+	 * Optional, DMX output is resumed between two transactions: while no request
+	 * is waiting for a response, until the next Run sends a request.
+	 * The defaults keep the DMX output stopped until the queue is idle.
+	 */
+	virtual bool IsWaitingResponse(uint8_t nPort) {
+		return true;
+	}
+
+	virtual bool IsSendPending(uint8_t nPort) {
+		return true;
+	}
+
+	/*
+	 * Optional, a response (including the start code) answered from memory
+	 */
+	virtual const uint8_t *GetCachedResponse(uint8_t nPort, const uint8_t *pRdmData) {
+		return 0;
+	}
 };
 
 #endif /* ARTNETRDM_H_ */
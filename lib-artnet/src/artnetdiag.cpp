@@ -1,4 +1,3 @@
-#if defined ( ENABLE_SENDDIAG )
 /**
  * @file artnetdiag.cpp
  *
@@ -28,6 +27,7 @@
  */
 
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "artnetnode.h"
@@ -62,4 +62,28 @@ void ArtNetNode::SendDiag(const char *text, TPriorityCodes nPriority) {
 
 	Network::Get()->SendTo(m_nHandle, (const uint8_t *) &(m_DiagData), nSize, m_State.IPAddressDiagSend, (uint16_t) ARTNET_UDP_PORT);
 }
-#endif
+
+/*
+ * One message per enabled output port, the counters are since the start.
+ */
+void ArtNetNode::SendDiagStats(void) {
+	if (ARTNET_DP_MED < m_State.Priority) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < (ARTNET_MAX_PORTS * m_nPages); i++) {
+		if (!m_OutputPorts[i].bIsEnabled || (m_OutputPorts[i].tPortProtocol != PORT_ARTNET_ARTNET)) {
+			continue;
+		}
+
+		const struct TArtNetPortStats *pStats = &m_OutputPorts[i].tStats;
+		char aText[128];
+
+		snprintf(aText, sizeof(aText), "Port %u [0x%.4x] rx %u lost %u ooo %u merged %u timeout %u discarded %u updates %u",
+				(unsigned) i + 1, (unsigned) m_OutputPorts[i].port.nPortAddress,
+				(unsigned) pStats->nReceived, (unsigned) pStats->nSequenceLost, (unsigned) pStats->nOutOfOrder,
+				(unsigned) pStats->nMerged, (unsigned) pStats->nMergeTimeouts, (unsigned) pStats->nDiscarded, (unsigned) pStats->nUpdates);
+
+		SendDiag(aText, ARTNET_DP_MED);
+	}
+}
@@ -50,6 +50,8 @@
 #include "network.h"
 #include "ledblink.h"
 
+#include "trace.h"
+
 #include "artnetnode_internal.h"
 
 union uip {
@@ -76,9 +78,13 @@ static const uint8_t DEVICE_SOFTWARE_VERSION[] = { 1, 43 };
 #define ARTNET_MERGE_TIMEOUT_SECONDS	10
 
 #define NETWORK_DATA_LOSS_TIMEOUT		10	///< Seconds
+#define ARTNET_STATS_INTERVAL_SECONDS	10
 
 #define PORT_IN_STATUS_DISABLED_MASK	0x08
 
+#define ARTNET_INPUT_KEEP_ALIVE_MILLIS	1000	///< Art-Net 4, ArtDmx for unchanged data is repeated every 1 second
+#define ARTNET_INPUT_REPEATS			3
+
 ArtNetNode *ArtNetNode::s_pThis = 0;
 
 ArtNetNode::ArtNetNode(uint8_t nVersion, uint8_t nPages) :
@@ -95,21 +101,34 @@ ArtNetNode::ArtNetNode(uint8_t nVersion, uint8_t nPages) :
 	m_pArtNetDmx(0),
 	m_pArtNetTrigger(0),
 	m_pArtNet4Handler(0),
+	m_nPollReplyChanged(0),
+	m_nPollReplyMaxDelayMillis(0),
+	m_nPollReplyRandom(0),
+	m_nStatsIntervalMillis(ARTNET_STATS_INTERVAL_SECONDS * 1000),
+	m_nStatsMillis(0),
 	m_pTimeCodeData(0),
 	m_pTodData(0),
+	m_pRdmResponse(0),
 	m_pIpProgReply(0),
 	m_bDirectUpdate(false),
 	m_nCurrentPacketMillis(0),
 	m_nPreviousPacketMillis(0),
 	m_IsRdmResponder(false),
-	m_nDestinationIp(0)
+	m_nRdmPortsPending(0),
+	m_nRdmPortsDmx(0),
+	m_nDestinationIp(0),
+	m_pDmxTransmit(0),
+	m_bInputArtSync(false)
 {
 	assert(Hardware::Get() != 0);
 	assert(Network::Get() != 0);
 	assert(LedBlink::Get() != 0);
+	static_assert(ARTNET_MAX_PAGES <= 32, "m_nPollReplyChanged has a bit per page");
 
 	s_pThis = this;
 
+	memset(m_PollReply, 0, sizeof(m_PollReply));
+
 	memset(&m_Node, 0, sizeof (struct TArtNetNode));
 	m_Node.Status1 = STATUS1_INDICATOR_NORMAL_MODE | STATUS1_PAP_FRONT_PANEL;
 	m_Node.Status2 = STATUS2_PORT_ADDRESS_15BIT | (m_nVersion > 3 ? STATUS2_SACN_ABLE_TO_SWITCH : STATUS2_SACN_NO_SWITCH);
@@ -128,6 +147,13 @@ ArtNetNode::ArtNetNode(uint8_t nVersion, uint8_t nPages) :
 		memset(&m_InputPorts[i], 0 , sizeof(struct TInputPort));
 	}
 
+	m_pDmxTransmit = new DmxTransmit[ARTNET_NODE_MAX_PORTS_INPUT];
+	assert(m_pDmxTransmit != 0);
+
+	for (uint32_t i = 0; i < ARTNET_NODE_MAX_PORTS_INPUT; i++) {
+		m_pDmxTransmit[i].SetKeepAlive(ARTNET_INPUT_KEEP_ALIVE_MILLIS, ARTNET_INPUT_REPEATS);
+	}
+
 	SetShortName((const char *) NODE_DEFAULT_SHORT_NAME);
 
 	uint8_t nBoardNameLength;
@@ -151,6 +177,10 @@ ArtNetNode::~ArtNetNode(void) {
 		delete m_pTodData;
 	}
 
+	if (m_pRdmResponse != 0) {
+		delete m_pRdmResponse;
+	}
+
 	if (m_pIpProgReply != 0) {
 		delete m_pIpProgReply;
 	}
@@ -158,6 +188,9 @@ ArtNetNode::~ArtNetNode(void) {
 	if (m_pTimeCodeData != 0) {
 		delete m_pTimeCodeData;
 	}
+
+	delete [] m_pDmxTransmit;
+	m_pDmxTransmit = 0;
 }
 
 void ArtNetNode::Start(void) {
@@ -169,13 +202,15 @@ void ArtNetNode::Start(void) {
 
 	Network::Get()->MacAddressCopyTo(m_Node.MACAddressLocal);
 
+	for (uint32_t i = 0; i < ARTNET_MAC_SIZE; i++) {
+		m_nPollReplyRandom = (m_nPollReplyRandom << 5) + m_nPollReplyRandom + m_Node.MACAddressLocal[i];
+	}
+
 	m_Node.Status2 = (m_Node.Status2 & ~(STATUS2_IP_DHCP)) | (Network::Get()->IsDhcpUsed() ? STATUS2_IP_DHCP : STATUS2_IP_MANUALY);
 	m_Node.Status2 = (m_Node.Status2 & ~(STATUS2_DHCP_CAPABLE)) | (Network::Get()->IsDhcpCapable() ? STATUS2_DHCP_CAPABLE : 0);
 
 	FillPollReply();
-#if defined ( ENABLE_SENDDIAG )
 	FillDiagData();
-#endif
 
 	m_nHandle = Network::Get()->Begin(ARTNET_UDP_PORT);
 	assert(m_nHandle != -1);
@@ -189,6 +224,7 @@ void ArtNetNode::Start(void) {
 	if (m_pArtNetDmx != 0) {
 		for (uint32_t i = 0; i < ARTNET_MAX_PORTS; i++) {
 			if (m_InputPorts[i].bIsEnabled) {
+				m_pDmxTransmit[i].Reset();
 				m_pArtNetDmx->Start(i);
 			}
 		}
@@ -231,6 +267,8 @@ int ArtNetNode::SetUniverseSwitch(uint8_t nPortIndex, TArtNetPortDir dir, uint8_
 	assert(nPortIndex < (ARTNET_MAX_PORTS * m_nPages));
 	assert(dir <= ARTNET_DISABLE_PORT);
 
+	SetPollReplyChanged(nPortIndex);
+
 	if (dir == ARTNET_DISABLE_PORT) {
 
 		if (nPortIndex < ARTNET_NODE_MAX_PORTS_OUTPUT) {
@@ -326,6 +364,7 @@ void ArtNetNode::SetSubnetSwitch(uint8_t nAddress, uint8_t nPage) {
 	assert(nPage < ARTNET_MAX_PAGES);
 
 	m_Node.SubSwitch[nPage] = nAddress;
+	m_nPollReplyChanged |= (1U << nPage);
 
 	const uint32_t nPortIndexStart = nPage * ARTNET_MAX_PORTS;
 
@@ -350,6 +389,7 @@ void ArtNetNode::SetNetSwitch(uint8_t nAddress, uint8_t nPage) {
 	assert(nPage < ARTNET_MAX_PAGES);
 
 	m_Node.NetSwitch[nPage] = nAddress;
+	m_nPollReplyChanged |= (1U << nPage);
 
 	const uint32_t nPortIndexStart = nPage * ARTNET_MAX_PORTS;
 
@@ -461,7 +501,10 @@ void ArtNetNode::SetShortName(const char *pName) {
 	assert(pName != 0);
 
 	strncpy((char *) m_Node.ShortName, pName, ARTNET_SHORT_NAME_LENGTH - 1);
-	memcpy(m_PollReply.ShortName, m_Node.ShortName, ARTNET_SHORT_NAME_LENGTH);
+
+	for (uint32_t nPage = 0; nPage < m_nPages; nPage++) {
+		memcpy(m_PollReply[nPage].ShortName, m_Node.ShortName, ARTNET_SHORT_NAME_LENGTH);
+	}
 
 	if (m_State.status == ARTNET_ON) {
 		if (m_pArtNetStore != 0) {
@@ -477,7 +520,10 @@ void ArtNetNode::SetLongName(const char *pName) {
 	assert(pName != 0);
 
 	strncpy((char *) m_Node.LongName, pName, ARTNET_LONG_NAME_LENGTH - 1);
-	memcpy(m_PollReply.LongName, m_Node.LongName, ARTNET_LONG_NAME_LENGTH);
+
+	for (uint32_t nPage = 0; nPage < m_nPages; nPage++) {
+		memcpy(m_PollReply[nPage].LongName, m_Node.LongName, ARTNET_LONG_NAME_LENGTH);
+	}
 
 	if (m_State.status == ARTNET_ON) {
 		if (m_pArtNetStore != 0) {
@@ -496,48 +542,108 @@ void ArtNetNode::SetOemValue(const uint8_t *pOem) {
 	m_Node.Oem[1] = pOem[1];
 }
 
+void ArtNetNode::SetPollReplyMaxDelay(uint32_t nMaxDelayMillis) {
+	m_nPollReplyMaxDelayMillis = nMaxDelayMillis;
+
+	if (m_nPollReplyMaxDelayMillis == 0) {
+		m_State.IsPollReplyPending = false;
+	}
+}
+
+/*
+ * The common fields are the same for all the BindIndex pages.
+ */
 void ArtNetNode::FillPollReply(void) {
-	memset(&m_PollReply, 0, sizeof(struct TArtPollReply));
+	struct TArtPollReply *pPollReply = &m_PollReply[0];
 
-	memcpy(m_PollReply.Id, (const char *) NODE_ID, sizeof m_PollReply.Id);
+	memset(pPollReply, 0, sizeof(struct TArtPollReply));
 
-	m_PollReply.OpCode = OP_POLLREPLY;
+	memcpy(pPollReply->Id, (const char *) NODE_ID, sizeof pPollReply->Id);
+
+	pPollReply->OpCode = OP_POLLREPLY;
 
 	ip.u32 = m_Node.IPAddressLocal;
-	memcpy(m_PollReply.IPAddress, ip.u8, sizeof m_PollReply.IPAddress);
+	memcpy(pPollReply->IPAddress, ip.u8, sizeof pPollReply->IPAddress);
 
-	m_PollReply.Port = ARTNET_UDP_PORT;
+	pPollReply->Port = ARTNET_UDP_PORT;
 
-	m_PollReply.VersInfoH = DEVICE_SOFTWARE_VERSION[0];
-	m_PollReply.VersInfoL = DEVICE_SOFTWARE_VERSION[1];
+	pPollReply->VersInfoH = DEVICE_SOFTWARE_VERSION[0];
+	pPollReply->VersInfoL = DEVICE_SOFTWARE_VERSION[1];
 
-	m_PollReply.OemHi = m_Node.Oem[0];
-	m_PollReply.Oem = m_Node.Oem[1];
+	pPollReply->OemHi = m_Node.Oem[0];
+	pPollReply->Oem = m_Node.Oem[1];
 
-	m_PollReply.Status1 = m_Node.Status1;
+	pPollReply->Status1 = m_Node.Status1;
 
-	m_PollReply.EstaMan[0] = ArtNetConst::ESTA_ID[1];
-	m_PollReply.EstaMan[1] = ArtNetConst::ESTA_ID[0];
+	pPollReply->EstaMan[0] = ArtNetConst::ESTA_ID[1];
+	pPollReply->EstaMan[1] = ArtNetConst::ESTA_ID[0];
 
-	memcpy(m_PollReply.ShortName, m_Node.ShortName, sizeof m_PollReply.ShortName);
-	memcpy(m_PollReply.LongName, m_Node.LongName, sizeof m_PollReply.LongName);
+	memcpy(pPollReply->ShortName, m_Node.ShortName, sizeof pPollReply->ShortName);
+	memcpy(pPollReply->LongName, m_Node.LongName, sizeof pPollReply->LongName);
 
 	// Disable all input
 	for (uint32_t i = 0; i < ARTNET_MAX_PORTS; i++) {
-		m_PollReply.GoodInput[i] = PORT_IN_STATUS_DISABLED_MASK;
+		pPollReply->GoodInput[i] = PORT_IN_STATUS_DISABLED_MASK;
 	}
 
-	m_PollReply.Style = ARTNET_ST_NODE;
+	pPollReply->Style = ARTNET_ST_NODE;
 
-	memcpy(m_PollReply.MAC, m_Node.MACAddressLocal, sizeof m_PollReply.MAC);
+	memcpy(pPollReply->MAC, m_Node.MACAddressLocal, sizeof pPollReply->MAC);
 
 	if (m_nVersion > 3) {
-		memcpy(m_PollReply.BindIp, ip.u8, sizeof m_PollReply.BindIp);
+		memcpy(pPollReply->BindIp, ip.u8, sizeof pPollReply->BindIp);
+	}
+
+	pPollReply->Status2 = m_Node.Status2;
+
+	for (uint32_t nPage = 1; nPage < m_nPages; nPage++) {
+		memcpy(&m_PollReply[nPage], pPollReply, sizeof(struct TArtPollReply));
+	}
+
+	for (uint32_t nPage = 0; nPage < m_nPages; nPage++) {
+		m_PollReply[nPage].BindIndex = nPage + 1;
 	}
 
-	m_PollReply.Status2 = m_Node.Status2;
+	m_nPollReplyChanged = 0xFFFFFFFF;
+}
+
+/*
+ * The port configuration fields of a page, only updated when changed.
+ */
+void ArtNetNode::UpdatePollReply(uint32_t nPage) {
+	struct TArtPollReply *pPollReply = &m_PollReply[nPage];
+
+	pPollReply->NetSwitch = m_Node.NetSwitch[nPage];
+	pPollReply->SubSwitch = m_Node.SubSwitch[nPage];
+
+	const uint32_t nPortIndexStart = nPage * ARTNET_MAX_PORTS;
+
+	uint8_t NumPortsLo = 0;
+
+	for (uint32_t i = 0; i < ARTNET_MAX_PORTS; i++) {
+		const uint32_t nPortIndex = nPortIndexStart + i;
+
+		pPollReply->PortTypes[i] = 0;
+
+		if (m_OutputPorts[nPortIndex].bIsEnabled) {
+			pPollReply->PortTypes[i] = ARTNET_ENABLE_OUTPUT | ARTNET_PORT_DMX;
+			NumPortsLo++;
+		}
+
+		pPollReply->SwOut[i] = m_OutputPorts[nPortIndex].port.nDefaultAddress;
+
+		if (nPortIndex < ARTNET_MAX_PORTS) {
+			if (m_InputPorts[nPortIndex].bIsEnabled) {
+				pPollReply->PortTypes[i] |= ARTNET_ENABLE_INPUT | ARTNET_PORT_DMX;
+				NumPortsLo++;
+			}
+
+			pPollReply->SwIn[i] = m_InputPorts[nPortIndex].port.nDefaultAddress;
+		}
+	}
 
-	m_PollReply.NumPortsLo = 4; // Default
+	pPollReply->NumPortsLo = NumPortsLo;
+	assert(NumPortsLo <= 4);
 }
 
 void ArtNetNode::SendPollRelply(bool bResponse) {
@@ -545,19 +651,18 @@ void ArtNetNode::SendPollRelply(bool bResponse) {
 		m_State.ArtPollReplyCount++;
 	}
 
-	m_PollReply.Status1 = m_Node.Status1;
+	alignas(uint32_t) uint8_t aNodeReport[ARTNET_REPORT_LENGTH];
+	snprintf((char *) aNodeReport, ARTNET_REPORT_LENGTH, "%04x [%04d] %s AvV", (int) m_State.reportCode, (int) m_State.ArtPollReplyCount, m_aSysName);
 
 	for (uint32_t nPage = 0; nPage < m_nPages; nPage++) {
+		struct TArtPollReply *pPollReply = &m_PollReply[nPage];
 
-		m_PollReply.NetSwitch = m_Node.NetSwitch[nPage];
-		m_PollReply.SubSwitch = m_Node.SubSwitch[nPage];
-
-		m_PollReply.BindIndex = nPage + 1;
+		if ((m_nPollReplyChanged & (1U << nPage)) != 0) {
+			UpdatePollReply(nPage);
+		}
 
 		const uint32_t nPortIndexStart = nPage * ARTNET_MAX_PORTS;
 
-		uint8_t NumPortsLo = 0;
-
 		for (uint32_t nPortIndex = nPortIndexStart; nPortIndex < (nPortIndexStart + ARTNET_MAX_PORTS); nPortIndex++) {
 
 			if (m_OutputPorts[nPortIndex].tPortProtocol == PORT_ARTNET_SACN) {
@@ -577,34 +682,27 @@ void ArtNetNode::SendPollRelply(bool bResponse) {
 				}
 			}
 
-			if (m_OutputPorts[nPortIndex].bIsEnabled) {
-				m_PollReply.PortTypes[nPortIndex - nPortIndexStart] = ARTNET_ENABLE_OUTPUT | ARTNET_PORT_DMX;
-				NumPortsLo++;
-			}
-
-			m_PollReply.GoodOutput[nPortIndex - nPortIndexStart] = m_OutputPorts[nPortIndex].port.nStatus;
-			m_PollReply.SwOut[nPortIndex - nPortIndexStart] = m_OutputPorts[nPortIndex].port.nDefaultAddress;
+			pPollReply->GoodOutput[nPortIndex - nPortIndexStart] = m_OutputPorts[nPortIndex].port.nStatus;
 
 			if (nPortIndex < ARTNET_MAX_PORTS) {
-				if (m_InputPorts[nPortIndex].bIsEnabled) {
-					m_PollReply.PortTypes[nPortIndex - nPortIndexStart] |= ARTNET_ENABLE_INPUT | ARTNET_PORT_DMX;
-					NumPortsLo++;
-				}
-
-				m_PollReply.GoodInput[nPortIndex - nPortIndexStart] = m_InputPorts[nPortIndex].port.nStatus;
-				m_PollReply.SwIn[nPortIndex - nPortIndexStart] = m_InputPorts[nPortIndex].port.nDefaultAddress;
+				pPollReply->GoodInput[nPortIndex - nPortIndexStart] = m_InputPorts[nPortIndex].port.nStatus;
 			}
+		}
 
+		// Pages without ports are not reported, except for the first one
+		if ((nPage != 0) && (pPollReply->NumPortsLo == 0)) {
+			continue;
 		}
 
-		m_PollReply.NumPortsLo = NumPortsLo;
-		assert(NumPortsLo <= 4);
+		pPollReply->Status1 = m_Node.Status1;
+		pPollReply->Status2 = m_Node.Status2;
 
-		snprintf((char *) m_PollReply.NodeReport, ARTNET_REPORT_LENGTH, "%04x [%04d] %s AvV", (int) m_State.reportCode, (int) m_State.ArtPollReplyCount, m_aSysName);
+		memcpy(pPollReply->NodeReport, aNodeReport, ARTNET_REPORT_LENGTH);
 
-		Network::Get()->SendTo(m_nHandle, (const uint8_t *) &(m_PollReply), (uint16_t) sizeof(struct TArtPollReply), m_Node.IPAddressBroadcast, (uint16_t) ARTNET_UDP_PORT);
+		Network::Get()->SendTo(m_nHandle, (const uint8_t *) pPollReply, (uint16_t) sizeof(struct TArtPollReply), m_Node.IPAddressBroadcast, (uint16_t) ARTNET_UDP_PORT);
 	}
 
+	m_nPollReplyChanged = 0;
 	m_State.IsChanged = false;
 }
 
@@ -674,6 +772,9 @@ void ArtNetNode::CheckMergeTimeouts(uint8_t nPortId) {
 	const uint32_t nTimeOutAMillis = m_nCurrentPacketMillis - m_OutputPorts[nPortId].nMillisA;
 
 	if (nTimeOutAMillis > (uint32_t) (ARTNET_MERGE_TIMEOUT_SECONDS * 1000)) {
+		if (m_OutputPorts[nPortId].ipA != 0) {
+			m_OutputPorts[nPortId].tStats.nMergeTimeouts++;
+		}
 		m_OutputPorts[nPortId].ipA = 0;
 		m_OutputPorts[nPortId].port.nStatus &= (~GO_OUTPUT_IS_MERGING);
 	}
@@ -681,6 +782,9 @@ void ArtNetNode::CheckMergeTimeouts(uint8_t nPortId) {
 	const uint32_t nTimeOutBMillis = m_nCurrentPacketMillis - m_OutputPorts[nPortId].nMillisB;
 
 	if (nTimeOutBMillis > (uint32_t) (ARTNET_MERGE_TIMEOUT_SECONDS * 1000)) {
+		if (m_OutputPorts[nPortId].ipB != 0) {
+			m_OutputPorts[nPortId].tStats.nMergeTimeouts++;
+		}
 		m_OutputPorts[nPortId].ipB = 0;
 		m_OutputPorts[nPortId].port.nStatus &= (~GO_OUTPUT_IS_MERGING);
 	}
@@ -700,6 +804,38 @@ void ArtNetNode::CheckMergeTimeouts(uint8_t nPortId) {
 	}
 }
 
+/*
+ * The Art-Net sequence numbers are 1..255, 0 disables the sequence feature.
+ * The packets are only counted, an out of order packet is still used.
+ */
+void ArtNetNode::UpdateSequence(struct TArtNetPortStats *pStats, uint8_t &nPrevious, uint8_t nSequence) {
+	if ((nSequence == 0) || (nPrevious == 0)) {
+		nPrevious = nSequence;
+		return;
+	}
+
+	int32_t nDiff = (int8_t) (nSequence - nPrevious);
+
+	// Wrapped from 255 to 1, skipping the 0
+	if (nSequence < nPrevious) {
+		nDiff--;
+	}
+
+	if (nDiff <= 0) {
+		pStats->nOutOfOrder++;
+	} else if (nDiff > 1) {
+		pStats->nSequenceLost += (uint32_t) (nDiff - 1);
+	}
+
+	nPrevious = nSequence;
+}
+
+void ArtNetNode::ClearPortStats(void) {
+	for (uint32_t i = 0; i < ARTNET_NODE_MAX_PORTS_OUTPUT; i++) {
+		memset(&m_OutputPorts[i].tStats, 0, sizeof(struct TArtNetPortStats));
+	}
+}
+
 void ArtNetNode::HandlePoll(void) {
 	const struct TArtPoll *packet = (struct TArtPoll *)&(m_ArtNetPacket.ArtPacket.ArtPoll);
 
@@ -739,7 +875,19 @@ void ArtNetNode::HandlePoll(void) {
 		m_State.IPAddressDiagSend = 0;
 	}
 
-	SendPollRelply(true);
+	if (m_nPollReplyMaxDelayMillis == 0) {
+		SendPollRelply(true);
+		return;
+	}
+
+	// A pending reply already answers this ArtPoll
+	if (!m_State.IsPollReplyPending) {
+		m_nPollReplyRandom = (m_nPollReplyRandom * 1103515245) + 12345 + Hardware::Get()->Micros();
+
+		m_State.IsPollReplyPending = true;
+		m_State.nPollReplyMillis = m_nCurrentPacketMillis;
+		m_State.nPollReplyDelayMillis = (m_nPollReplyRandom >> 16) % (m_nPollReplyMaxDelayMillis + 1);
+	}
 }
 
 void ArtNetNode::HandleDmx(void) {
@@ -755,10 +903,14 @@ void ArtNetNode::HandleDmx(void) {
 			uint32_t ipA = m_OutputPorts[i].ipA;
 			uint32_t ipB = m_OutputPorts[i].ipB;
 
+			struct TArtNetPortStats *pStats = &m_OutputPorts[i].tStats;
+
 			bool sendNewData = false;
 
 			m_OutputPorts[i].port.nStatus = m_OutputPorts[i].port.nStatus | GO_DATA_IS_BEING_TRANSMITTED;
 
+			pStats->nReceived++;
+
 			if (m_State.IsMergeMode) {
 				if (__builtin_expect((!m_State.bDisableMergeTimeout), 1)) {
 					CheckMergeTimeouts(i);
@@ -770,6 +922,7 @@ void ArtNetNode::HandleDmx(void) {
 				SendDiag("1. first packet recv on this port", ARTNET_DP_LOW);
 #endif
 				m_OutputPorts[i].ipA = m_ArtNetPacket.IPAddressFrom;
+				m_OutputPorts[i].nSequenceA = packet->Sequence;
 				m_OutputPorts[i].nMillisA = m_nCurrentPacketMillis;
 				memcpy(&m_OutputPorts[i].dataA, packet->Data, data_length);
 				sendNewData = IsDmxDataChanged(i, packet->Data, data_length);
@@ -777,6 +930,7 @@ void ArtNetNode::HandleDmx(void) {
 #if defined ( ENABLE_SENDDIAG )
 				SendDiag("2. continued transmission from the same ip (source A)", ARTNET_DP_LOW);
 #endif
+				UpdateSequence(pStats, m_OutputPorts[i].nSequenceA, packet->Sequence);
 				m_OutputPorts[i].nMillisA = m_nCurrentPacketMillis;
 				memcpy(&m_OutputPorts[i].dataA, packet->Data, data_length);
 				sendNewData = IsDmxDataChanged(i, packet->Data, data_length);
@@ -784,6 +938,7 @@ void ArtNetNode::HandleDmx(void) {
 #if defined ( ENABLE_SENDDIAG )
 				SendDiag("3. continued transmission from the same ip (source B)", ARTNET_DP_LOW);
 #endif
+				UpdateSequence(pStats, m_OutputPorts[i].nSequenceB, packet->Sequence);
 				m_OutputPorts[i].nMillisB = m_nCurrentPacketMillis;
 				memcpy(&m_OutputPorts[i].dataB, packet->Data, data_length);
 				sendNewData = IsDmxDataChanged(i, packet->Data, data_length);
@@ -792,6 +947,8 @@ void ArtNetNode::HandleDmx(void) {
 				SendDiag("4. new source, start the merge", ARTNET_DP_LOW);
 #endif
 				m_OutputPorts[i].ipB = m_ArtNetPacket.IPAddressFrom;
+				m_OutputPorts[i].nSequenceB = packet->Sequence;
+				pStats->nMerged++;
 				m_OutputPorts[i].nMillisB = m_nCurrentPacketMillis;
 				memcpy(&m_OutputPorts[i].dataB, packet->Data, data_length);
 				sendNewData = IsMergedDmxDataChanged(i, m_OutputPorts[i].dataB, data_length);
@@ -800,6 +957,8 @@ void ArtNetNode::HandleDmx(void) {
 				SendDiag("5. new source, start the merge", ARTNET_DP_LOW);
 #endif
 				m_OutputPorts[i].ipA = m_ArtNetPacket.IPAddressFrom;
+				m_OutputPorts[i].nSequenceA = packet->Sequence;
+				pStats->nMerged++;
 				m_OutputPorts[i].nMillisA = m_nCurrentPacketMillis;
 				memcpy(&m_OutputPorts[i].dataA, packet->Data, data_length);
 				sendNewData = IsMergedDmxDataChanged(i, m_OutputPorts[i].dataA, data_length);
@@ -807,6 +966,8 @@ void ArtNetNode::HandleDmx(void) {
 #if defined ( ENABLE_SENDDIAG )
 				SendDiag("6. continue merge", ARTNET_DP_LOW);
 #endif
+				UpdateSequence(pStats, m_OutputPorts[i].nSequenceA, packet->Sequence);
+				pStats->nMerged++;
 				m_OutputPorts[i].nMillisA = m_nCurrentPacketMillis;
 				memcpy(&m_OutputPorts[i].dataA, packet->Data, data_length);
 				sendNewData = IsMergedDmxDataChanged(i, m_OutputPorts[i].dataA, data_length);
@@ -814,6 +975,8 @@ void ArtNetNode::HandleDmx(void) {
 #if defined ( ENABLE_SENDDIAG )
 				SendDiag("7. continue merge", ARTNET_DP_LOW);
 #endif
+				UpdateSequence(pStats, m_OutputPorts[i].nSequenceB, packet->Sequence);
+				pStats->nMerged++;
 				m_OutputPorts[i].nMillisB = m_nCurrentPacketMillis;
 				memcpy(&m_OutputPorts[i].dataB, packet->Data, data_length);
 				sendNewData = IsMergedDmxDataChanged(i, m_OutputPorts[i].dataB, data_length);
@@ -821,11 +984,13 @@ void ArtNetNode::HandleDmx(void) {
 #if defined ( ENABLE_SENDDIAG )
 				SendDiag("8. Source matches both buffers, this shouldn't be happening!", ARTNET_DP_LOW);
 #endif
+				pStats->nDiscarded++;
 				return;
 			} else if (ipA != m_ArtNetPacket.IPAddressFrom && ipB != m_ArtNetPacket.IPAddressFrom) {
 #if defined ( ENABLE_SENDDIAG )
 				SendDiag("9. More than two sources, discarding data", ARTNET_DP_LOW);
 #endif
+				pStats->nDiscarded++;
 				return;
 			} else {
 #if defined ( ENABLE_SENDDIAG )
@@ -839,10 +1004,15 @@ void ArtNetNode::HandleDmx(void) {
 #if defined ( ENABLE_SENDDIAG )
 					SendDiag("Send new data", ARTNET_DP_LOW);
 #endif
+					TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_BEGIN, i);
 					m_pLightSet->SetData(i, m_OutputPorts[i].data, m_OutputPorts[i].nLength);
+					TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_END, i);
+					pStats->nUpdates++;
 
 					if(!m_IsLightSetRunning[i]) {
-						m_pLightSet->Start(i);
+						if (!IsRdmPending(i)) {
+							m_pLightSet->Start(i);
+						}
 						m_State.IsChanged |= (!m_IsLightSetRunning[i]);
 						m_IsLightSetRunning[i] = true;
 					}
@@ -865,23 +1035,32 @@ void ArtNetNode::HandleDmx(void) {
 
 void ArtNetNode::HandleSync(void) {
 	m_State.IsSynchronousMode = true;
-	m_State.nArtSyncMillis = Hardware::Get()->Millis();
+	m_State.nArtSyncMillis = m_nCurrentPacketMillis;
+
+	m_pLightSet->BeginFrame();
 
 	for (uint32_t i = 0; i < (m_nPages * ARTNET_MAX_PORTS); i++) {
 		if  ((m_OutputPorts[i].tPortProtocol == PORT_ARTNET_ARTNET) &&  ((m_OutputPorts[i].IsDataPending) || (m_OutputPorts[i].bIsEnabled && m_bDirectUpdate) )) {
 #if defined ( ENABLE_SENDDIAG )
 			SendDiag("Send pending data", ARTNET_DP_LOW);
 #endif
+			TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_BEGIN, i);
 			m_pLightSet->SetData(i, m_OutputPorts[i].data, 	m_OutputPorts[i].nLength);
+			TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_END, i);
+			m_OutputPorts[i].tStats.nUpdates++;
 
 			if(!m_IsLightSetRunning[i]) {
-				m_pLightSet->Start(i);
+				if (!IsRdmPending(i)) {
+					m_pLightSet->Start(i);
+				}
 				m_IsLightSetRunning[i] = true;
 			}
 
 			m_OutputPorts[i].IsDataPending = false;
 		}
 	}
+
+	m_pLightSet->CommitFrame();
 }
 
 void ArtNetNode::HandleAddress(void) {
@@ -988,7 +1167,9 @@ void ArtNetNode::HandleAddress(void) {
 		}
 		m_OutputPorts[nPort].nLength = ARTNET_DMX_LENGTH;
 		if (m_OutputPorts[nPort].tPortProtocol == PORT_ARTNET_ARTNET) {
+			TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_BEGIN, nPort);
 			m_pLightSet->SetData(nPort, m_OutputPorts[nPort].data, m_OutputPorts[nPort].nLength);
+			TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_END, nPort);
 		}
 		break;
 
@@ -997,7 +1178,9 @@ void ArtNetNode::HandleAddress(void) {
 	}
 
 	if ((nPort < ARTNET_MAX_PORTS) && (m_OutputPorts[nPort].tPortProtocol == PORT_ARTNET_ARTNET) && !m_IsLightSetRunning[nPort]) {
-		m_pLightSet->Start(nPort);
+		if (!IsRdmPending(nPort)) {
+			m_pLightSet->Start(nPort);
+		}
 		m_IsLightSetRunning[nPort] = true;
 		m_OutputPorts[nPort].port.nStatus |= GO_DATA_IS_BEING_TRANSMITTED;
 	}
@@ -1054,6 +1237,17 @@ void ArtNetNode::Run(void) {
 
 	m_nCurrentPacketMillis = Hardware::Get()->Millis();
 
+	if (__builtin_expect((m_nRdmPortsPending != 0), 0)) {
+		HandleRdmPending();
+	}
+
+	if (__builtin_expect(m_State.IsPollReplyPending, 0)) {
+		if ((m_nCurrentPacketMillis - m_State.nPollReplyMillis) >= m_State.nPollReplyDelayMillis) {
+			m_State.IsPollReplyPending = false;
+			SendPollRelply(true);
+		}
+	}
+
 	if (__builtin_expect((nBytesReceived == 0), 1)) {
 		if ((m_State.nNetworkDataLossTimeoutMillis != 0) && ((m_nCurrentPacketMillis - m_nPreviousPacketMillis) >= m_State.nNetworkDataLossTimeoutMillis)) {
 			SetNetworkDataLossCondition();
@@ -1069,6 +1263,11 @@ void ArtNetNode::Run(void) {
 			}
 		}
 
+		if ((m_nStatsIntervalMillis != 0) && m_State.SendArtDiagData && ((m_nCurrentPacketMillis - m_nStatsMillis) >= m_nStatsIntervalMillis)) {
+			m_nStatsMillis = m_nCurrentPacketMillis;
+			SendDiagStats();
+		}
+
 		if ((m_nCurrentPacketMillis - m_nPreviousPacketMillis) >= (1 * 1000)) {
 			if (((m_Node.Status1 & STATUS1_INDICATOR_MASK) == STATUS1_INDICATOR_NORMAL_MODE)) {
 				LedBlink::Get()->SetMode(LEDBLINK_MODE_NORMAL);
@@ -1096,6 +1295,8 @@ void ArtNetNode::Run(void) {
 
 	GetType();
 
+	TRACE_ARTNET_EVENT(TRACE_ARTNET_PACKET_BEGIN, m_ArtNetPacket.OpCode);
+
 	if (m_State.IsSynchronousMode) {
 		if (m_nCurrentPacketMillis - m_State.nArtSyncMillis >= (4 * 1000)) {
 			m_State.IsSynchronousMode = false;
@@ -1108,7 +1309,9 @@ void ArtNetNode::Run(void) {
 		break;
 	case OP_DMX:
 		if (m_pLightSet != 0) {
+			TRACE_ARTNET_EVENT(TRACE_ARTNET_DMX_BEGIN, m_ArtNetPacket.OpCode);
 			HandleDmx();
+			TRACE_ARTNET_EVENT(TRACE_ARTNET_DMX_END, m_ArtNetPacket.OpCode);
 		}
 		break;
 	case OP_SYNC:
@@ -1173,4 +1376,5 @@ void ArtNetNode::Run(void) {
 		}
 	}
 
+	TRACE_ARTNET_EVENT(TRACE_ARTNET_PACKET_END, m_ArtNetPacket.OpCode);
 }
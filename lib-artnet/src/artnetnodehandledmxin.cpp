@@ -45,14 +45,19 @@ void ArtNetNode::SetDestinationIp(uint32_t nDestinationIp) {
 	DEBUG_PRINTF("m_nDestinationIp=" IPSTR ", Netmask=" IPSTR, IP2STR(m_nDestinationIp), IP2STR(Network::Get()->GetNetmask()));
 }
 
+/*
+ * Only changed frames are sent, the unchanged data is repeated as keep-alive.
+ */
 void ArtNetNode::HandleDmxIn(void) {
 	struct TArtDmx  artDmx;
 
-	memcpy((void *)artDmx.Id, (const char *) NODE_ID, sizeof m_PollReply.Id);
+	memcpy((void *)artDmx.Id, (const char *) NODE_ID, sizeof m_PollReply[0].Id);
 	artDmx.OpCode = OP_DMX;
 	artDmx.ProtVerHi = 0;
 	artDmx.ProtVerLo = ARTNET_PROTOCOL_REVISION;
 
+	bool bIsSent = false;
+
 	for (uint32_t i = 0; i < ARTNET_MAX_PORTS; i++) {
 		uint32_t nUpdatesPerSecond;
 
@@ -61,27 +66,50 @@ void ArtNetNode::HandleDmxIn(void) {
 			const uint8_t *pDmxData = m_pArtNetDmx->Handler(i, nLength, nUpdatesPerSecond);
 
 			if (pDmxData != 0) {
-				artDmx.Sequence = m_InputPorts[i].nSequence++;
-				artDmx.Physical = i;
-				artDmx.PortAddress = m_InputPorts[i].port.nPortAddress;
-				artDmx.LengthHi = (nLength & 0xFF00) >> 8;
-				artDmx.Length = (nLength & 0xFF);
-
-				memcpy(artDmx.Data, pDmxData, nLength);
-
 				m_InputPorts[i].port.nStatus = GI_DATA_RECIEVED;
-
-				Network::Get()->SendTo(m_nHandle, (const uint8_t *) &(artDmx), (uint16_t) sizeof(struct TArtDmx), m_nDestinationIp, (uint16_t) ARTNET_UDP_PORT);
-
 				m_State.bIsReceivingDmx = true;
 			} else {
-				if ((m_InputPorts[i].port.nStatus & GO_DATA_IS_BEING_TRANSMITTED) == GO_DATA_IS_BEING_TRANSMITTED) {
-					if (nUpdatesPerSecond == 0) {
+				nLength = 0;
+
+				if (nUpdatesPerSecond == 0) {
+					m_pDmxTransmit[i].Reset();
+
+					if ((m_InputPorts[i].port.nStatus & GO_DATA_IS_BEING_TRANSMITTED) == GO_DATA_IS_BEING_TRANSMITTED) {
 						m_InputPorts[i].port.nStatus = m_InputPorts[i].port.nStatus & ~GI_DATA_RECIEVED;
 						m_State.bIsReceivingDmx = false;
 					}
 				}
 			}
+
+			uint32_t nSendLength;
+			const uint8_t *pSendData = m_pDmxTransmit[i].Handler(m_nCurrentPacketMillis, pDmxData, nLength, nSendLength);
+
+			if (pSendData != 0) {
+				assert(nSendLength <= ARTNET_DMX_LENGTH);
+
+				artDmx.Sequence = m_InputPorts[i].nSequence++;
+				artDmx.Physical = i;
+				artDmx.PortAddress = m_InputPorts[i].port.nPortAddress;
+				artDmx.LengthHi = (nSendLength & 0xFF00) >> 8;
+				artDmx.Length = (nSendLength & 0xFF);
+
+				memcpy(artDmx.Data, pSendData, nSendLength);
+
+				Network::Get()->SendTo(m_nHandle, (const uint8_t *) &(artDmx), (uint16_t) sizeof(struct TArtDmx), m_nDestinationIp, (uint16_t) ARTNET_UDP_PORT);
+
+				bIsSent = true;
+			}
 		}
 	}
+
+	if (bIsSent && m_bInputArtSync) {
+		struct TArtSync artSync;
+
+		memset((void *) &artSync, 0, sizeof(struct TArtSync));
+		memcpy((void *) artSync.Id, (const char *) NODE_ID, sizeof artSync.Id);
+		artSync.OpCode = OP_SYNC;
+		artSync.ProtVerLo = (uint8_t) ARTNET_PROTOCOL_REVISION;
+
+		Network::Get()->SendTo(m_nHandle, (const uint8_t *) &(artSync), (uint16_t) sizeof(struct TArtSync), m_nDestinationIp, (uint16_t) ARTNET_UDP_PORT);
+	}
 }
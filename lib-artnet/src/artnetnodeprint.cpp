@@ -44,6 +44,10 @@ void ArtNetNode::Print(void) {
 	printf(" Short name : %s\n", m_Node.ShortName);
 	printf(" Long name  : %s\n", m_Node.LongName);
 
+	if (m_nPollReplyMaxDelayMillis != 0) {
+		printf(" ArtPollReply delay : 0-%d ms\n", (int) m_nPollReplyMaxDelayMillis);
+	}
+
 	if (m_State.nActiveOutputPorts != 0) {
 		printf(" Output\n");
 
@@ -70,7 +74,7 @@ void ArtNetNode::Print(void) {
 	if (m_State.nActiveInputPorts != 0) {
 		printf(" Input\n");
 		const uint32_t nDestinationIp = (m_nDestinationIp == 0 ? Network::Get()->GetBroadcastIp() : m_nDestinationIp);
-		printf("  Destination " IPSTR "\n", IP2STR(nDestinationIp));
+		printf("  Destination " IPSTR "%s\n", IP2STR(nDestinationIp), m_bInputArtSync ? " [ArtSync]" : "");
 
 		for (uint32_t i = 0; i < (ARTNET_MAX_PORTS); i++) {
 			uint8_t nAddress;
@@ -52,6 +52,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #include "propertiesbuilder.h"
 
@@ -59,7 +60,72 @@
 #define MERGEMODE2STRING(m)		(m == ARTNET_MERGE_HTP) ? "HTP" : "LTP"
 #define PROTOCOL2STRING(p)		(p == PORT_ARTNET_ARTNET) ? "Art-Net" : "sACN"
 
-ArtNetParams::ArtNetParams(ArtNetParamsStore *pArtNetParamsStore): m_pArtNetParamsStore(pArtNetParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TArtNetParams, f)
+
+enum TArtNetParamsKey {
+	KEY_TIMECODE,
+	KEY_TIMESYNC,
+	KEY_RDM,
+	KEY_RDM_DISCOVERY,
+	KEY_SHORT_NAME,
+	KEY_LONG_NAME,
+	KEY_OEM_VALUE,
+	KEY_NETWORK_DATA_LOSS_TIMEOUT,
+	KEY_DISABLE_MERGE_TIMEOUT,
+	KEY_NET,
+	KEY_SUBNET,
+	KEY_UNIVERSE,
+	KEY_MERGE_MODE,
+	KEY_PROTOCOL,
+	KEY_ENABLE_NO_CHANGE_UPDATE,
+	KEY_DIRECTION,
+	KEY_DESTINATION_IP,
+	KEY_POLL_REPLY_DELAY,
+	KEY_UNIVERSE_PORT_A,
+	KEY_MERGE_MODE_PORT_A = KEY_UNIVERSE_PORT_A + ARTNET_MAX_PORTS,
+	KEY_PROTOCOL_PORT_A = KEY_MERGE_MODE_PORT_A + ARTNET_MAX_PORTS
+};
+
+// Must be in the order of TArtNetParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ ArtNetParamsConst::TIMECODE, OFFSET(bUseTimeCode), PROPERTIES_TYPE_BOOL, ARTNET_PARAMS_MASK_TIMECODE, 0, 0 },
+	{ ArtNetParamsConst::TIMESYNC, OFFSET(bUseTimeSync), PROPERTIES_TYPE_BOOL, ARTNET_PARAMS_MASK_TIMESYNC, 0, 0 },
+	{ ArtNetParamsConst::RDM, OFFSET(bEnableRdm), PROPERTIES_TYPE_BOOL, ARTNET_PARAMS_MASK_RDM, 0, 0 },
+	{ ArtNetParamsConst::RDM_DISCOVERY, OFFSET(bRdmDiscovery), PROPERTIES_TYPE_BOOL, ARTNET_PARAMS_MASK_RDM_DISCOVERY, 0, 0 },
+	{ ArtNetParamsConst::NODE_SHORT_NAME, OFFSET(aShortName), PROPERTIES_TYPE_CHAR, ARTNET_PARAMS_MASK_SHORT_NAME, 0, ARTNET_SHORT_NAME_LENGTH },
+	{ ArtNetParamsConst::NODE_LONG_NAME, OFFSET(aLongName), PROPERTIES_TYPE_CHAR, ARTNET_PARAMS_MASK_LONG_NAME, 0, ARTNET_LONG_NAME_LENGTH },
+	{ ArtNetParamsConst::NODE_OEM_VALUE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::NODE_NETWORK_DATA_LOSS_TIMEOUT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::NODE_DISABLE_MERGE_TIMEOUT, OFFSET(bDisableMergeTimeout), PROPERTIES_TYPE_BOOL, ARTNET_PARAMS_MASK_MERGE_TIMEOUT, 0, 0 },
+	{ ArtNetParamsConst::NET, OFFSET(nNet), PROPERTIES_TYPE_UINT8, ARTNET_PARAMS_MASK_NET, 0, 0xFF },
+	{ ArtNetParamsConst::SUBNET, OFFSET(nSubnet), PROPERTIES_TYPE_UINT8, ARTNET_PARAMS_MASK_SUBNET, 0, 0xFF },
+	{ LightSetConst::PARAMS_UNIVERSE, OFFSET(nUniverse), PROPERTIES_TYPE_UINT8, ARTNET_PARAMS_MASK_UNIVERSE, 0, 0xF },
+	{ ArtNetParamsConst::MERGE_MODE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::PROTOCOL, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE, OFFSET(bEnableNoChangeUpdate), PROPERTIES_TYPE_BOOL, ARTNET_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT, 0, 0 },
+	{ ArtNetParamsConst::DIRECTION, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::DESTINATION_IP, OFFSET(nDestinationIp), PROPERTIES_TYPE_IP_ADDRESS, ARTNET_PARAMS_MASK_DESTINATION_IP, 0, 0 },
+	{ ArtNetParamsConst::POLL_REPLY_DELAY, OFFSET(nPollReplyDelay), PROPERTIES_TYPE_UINT16, ARTNET_PARAMS_MASK_POLL_REPLY_DELAY, 0, 1000 },
+	{ ArtNetParamsConst::UNIVERSE_PORT[0], OFFSET(nUniversePort) + 0, PROPERTIES_TYPE_UINT8, ARTNET_PARAMS_MASK_UNIVERSE_A, 0, 0xFF },
+	{ ArtNetParamsConst::UNIVERSE_PORT[1], OFFSET(nUniversePort) + 1, PROPERTIES_TYPE_UINT8, ARTNET_PARAMS_MASK_UNIVERSE_B, 0, 0xFF },
+	{ ArtNetParamsConst::UNIVERSE_PORT[2], OFFSET(nUniversePort) + 2, PROPERTIES_TYPE_UINT8, ARTNET_PARAMS_MASK_UNIVERSE_C, 0, 0xFF },
+	{ ArtNetParamsConst::UNIVERSE_PORT[3], OFFSET(nUniversePort) + 3, PROPERTIES_TYPE_UINT8, ARTNET_PARAMS_MASK_UNIVERSE_D, 0, 0xFF },
+	{ ArtNetParamsConst::MERGE_MODE_PORT[0], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::MERGE_MODE_PORT[1], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::MERGE_MODE_PORT[2], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::MERGE_MODE_PORT[3], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::PROTOCOL_PORT[0], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::PROTOCOL_PORT[1], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::PROTOCOL_PORT[2], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ArtNetParamsConst::PROTOCOL_PORT[3], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == (KEY_PROTOCOL_PORT_A + ARTNET_MAX_PORTS), "s_Keys does not match TArtNetParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable ArtNetParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 7, 0x9E3779BF };
+
+ArtNetParams::ArtNetParams(ArtNetParamsStore *pArtNetParamsStore): m_pArtNetParamsStore(pArtNetParamsStore), m_pPropertiesParser(0) {
 	uint8_t *p = (uint8_t *) &m_tArtNetParams;
 
 	for (uint32_t i = 0; i < sizeof(struct TArtNetParams); i++) {
@@ -84,9 +150,16 @@ ArtNetParams::~ArtNetParams(void) {
 bool ArtNetParams::Load(void) {
 	m_tArtNetParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tArtNetParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(ArtNetParams::staticCallbackFunction, this);
 
-	if (configfile.Read(ArtNetParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(ArtNetParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pArtNetParamsStore != 0) {
 			m_pArtNetParamsStore->Update(&m_tArtNetParams);
@@ -111,128 +184,31 @@ void ArtNetParams::Load(const char* pBuffer, uint32_t nLength) {
 
 	m_tArtNetParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tArtNetParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(ArtNetParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pArtNetParamsStore->Update(&m_tArtNetParams);
 }
 
 void ArtNetParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
-	char value[128];
+	char value[8];
 	uint8_t nLength;
 	uint8_t nValue8;
 	uint16_t nValue16;
-	uint32_t nValue32;
-
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::TIMECODE, &nValue8) == SSCAN_OK) {
-		m_tArtNetParams.bUseTimeCode = (nValue8 != 0);
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_TIMECODE;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::TIMESYNC, &nValue8) == SSCAN_OK) {
-		m_tArtNetParams.bUseTimeSync = (nValue8 != 0);
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_TIMESYNC;
-		return;
-	}
 
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::RDM, &nValue8) == SSCAN_OK) {
-		m_tArtNetParams.bEnableRdm = (nValue8 != 0);
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_RDM;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::RDM_DISCOVERY, &nValue8) == SSCAN_OK) {
-		m_tArtNetParams.bRdmDiscovery = (nValue8 != 0);
-		//FIXME Missing m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_RDM_DISCOVERY
-		return;
-	}
+	const int32_t nKey = m_pPropertiesParser->Parse(pLine);
 
-	nLength = ARTNET_SHORT_NAME_LENGTH - 1;
-	if (Sscan::Char(pLine, ArtNetParamsConst::NODE_SHORT_NAME, (char *) m_tArtNetParams.aShortName, &nLength) == SSCAN_OK) {
-		m_tArtNetParams.aShortName[nLength] = '\0';
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_SHORT_NAME;
-		return;
-	}
-
-	nLength = ARTNET_LONG_NAME_LENGTH - 1;
-	if (Sscan::Char(pLine, ArtNetParamsConst::NODE_LONG_NAME, (char *)m_tArtNetParams.aLongName, &nLength) == SSCAN_OK) {
-		m_tArtNetParams.aLongName[nLength] = '\0';
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_LONG_NAME;
-		return;
-	}
-
-	if (Sscan::HexUint16(pLine, ArtNetParamsConst::NODE_OEM_VALUE, &nValue16) == SSCAN_OK) {
-		m_tArtNetParams.aOemValue[0] = (uint8_t) (nValue16 >> 8);
-		m_tArtNetParams.aOemValue[1] = (uint8_t) (nValue16 & 0xFF);
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_OEM_VALUE;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::NODE_NETWORK_DATA_LOSS_TIMEOUT, &nValue8) == SSCAN_OK) {
-		m_tArtNetParams.nNetworkTimeout = (time_t) nValue8;
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_NETWORK_TIMEOUT;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::NODE_DISABLE_MERGE_TIMEOUT, &nValue8) == SSCAN_OK) {
-		m_tArtNetParams.bDisableMergeTimeout = (nValue8 != 0);
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_MERGE_TIMEOUT;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::NET, &nValue8) == SSCAN_OK) {
-		m_tArtNetParams.nNet = nValue8;
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_NET;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, ArtNetParamsConst::SUBNET, &nValue8) == SSCAN_OK) {
-		m_tArtNetParams.nSubnet = nValue8;
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_SUBNET;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_UNIVERSE, &nValue8) == SSCAN_OK) {
-		if (nValue8 <= 0xF) {
-			m_tArtNetParams.nUniverse = nValue8;
-			m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_UNIVERSE;
-		}
-		return;
-	}
-
-	nLength = 3;
-	if (Sscan::Char(pLine, ArtNetParamsConst::MERGE_MODE, value, &nLength) == SSCAN_OK) {
-		if (memcmp(value, "ltp", 3) == 0) {
-			m_tArtNetParams.nMergeMode = ARTNET_MERGE_LTP;
-			m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_MERGE_MODE;
-		} else if (memcmp(value, "htp", 3) == 0) {
-			m_tArtNetParams.nMergeMode = ARTNET_MERGE_HTP;
-			m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_MERGE_MODE;
-		}
-		return;
-	}
-
-	nLength = 4;
-	if (Sscan::Char(pLine, ArtNetParamsConst::PROTOCOL, value, &nLength) == SSCAN_OK) {
-		if(memcmp(value, "sacn", 4) == 0) {
-			m_tArtNetParams.nProtocol = PORT_ARTNET_SACN;
-			m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_PROTOCOL;
-		} else {
-			m_tArtNetParams.nProtocol = PORT_ARTNET_ARTNET;
-		}
-		return;
-	}
-
-	for (unsigned i = 0; i < ARTNET_MAX_PORTS; i++) {
-		if (Sscan::Uint8(pLine, ArtNetParamsConst::UNIVERSE_PORT[i], &nValue8) == SSCAN_OK) {
-			m_tArtNetParams.nUniversePort[i] = nValue8;
-			m_tArtNetParams.nSetList |= (ARTNET_PARAMS_MASK_UNIVERSE_A << i);
-			return;
-		}
+	if ((nKey >= KEY_MERGE_MODE_PORT_A) && (nKey < (KEY_MERGE_MODE_PORT_A + ARTNET_MAX_PORTS))) {
+		const uint32_t i = (uint32_t) (nKey - KEY_MERGE_MODE_PORT_A);
 
 		nLength = 3;
 		if (Sscan::Char(pLine, ArtNetParamsConst::MERGE_MODE_PORT[i], value, &nLength) == SSCAN_OK) {
@@ -243,8 +219,12 @@ void ArtNetParams::callbackFunction(const char *pLine) {
 				m_tArtNetParams.nMergeModePort[i] = ARTNET_MERGE_HTP;
 				m_tArtNetParams.nSetList |= (ARTNET_PARAMS_MASK_MERGE_MODE_A << i);
 			}
-			return;
 		}
+		return;
+	}
+
+	if ((nKey >= KEY_PROTOCOL_PORT_A) && (nKey < (KEY_PROTOCOL_PORT_A + ARTNET_MAX_PORTS))) {
+		const uint32_t i = (uint32_t) (nKey - KEY_PROTOCOL_PORT_A);
 
 		nLength = 4;
 		if (Sscan::Char(pLine, ArtNetParamsConst::PROTOCOL_PORT[i], value, &nLength) == SSCAN_OK) {
@@ -254,38 +234,61 @@ void ArtNetParams::callbackFunction(const char *pLine) {
 			} else {
 				m_tArtNetParams.nProtocolPort[i] = PORT_ARTNET_ARTNET;
 			}
-			return;
 		}
-	}
-
-	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE, &nValue8) == SSCAN_OK) {
-		m_tArtNetParams.bEnableNoChangeUpdate = (nValue8 != 0);
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT;
 		return;
 	}
 
-	nLength = 5;
-	if (Sscan::Char(pLine, ArtNetParamsConst::DIRECTION, value, &nLength) == SSCAN_OK) {
-		if (memcmp(value, "input", 5) == 0) {
-			m_tArtNetParams.nDirection = (uint8_t) ARTNET_INPUT_PORT;
-			m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_DIRECTION;
+	switch (nKey) {
+	case KEY_OEM_VALUE:
+		if (Sscan::HexUint16(pLine, ArtNetParamsConst::NODE_OEM_VALUE, &nValue16) == SSCAN_OK) {
+			m_tArtNetParams.aOemValue[0] = (uint8_t) (nValue16 >> 8);
+			m_tArtNetParams.aOemValue[1] = (uint8_t) (nValue16 & 0xFF);
+			m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_OEM_VALUE;
 		}
-		return;
-	}
-
-	nLength = 6;
-	if (Sscan::Char(pLine, ArtNetParamsConst::DIRECTION, value, &nLength) == SSCAN_OK) {
-		if (memcmp(value, "output", 6) == 0) {
-			m_tArtNetParams.nDirection = (uint8_t) ARTNET_OUTPUT_PORT;
-			m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_DIRECTION;
+		break;
+	case KEY_NETWORK_DATA_LOSS_TIMEOUT:
+		if (Sscan::Uint8(pLine, ArtNetParamsConst::NODE_NETWORK_DATA_LOSS_TIMEOUT, &nValue8) == SSCAN_OK) {
+			m_tArtNetParams.nNetworkTimeout = (time_t) nValue8;
+			m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_NETWORK_TIMEOUT;
 		}
-		return;
-	}
-
-	if (Sscan::IpAddress(pLine, ArtNetParamsConst::DESTINATION_IP, &nValue32) == SSCAN_OK) {
-		m_tArtNetParams.nDestinationIp = nValue32;
-		m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_DESTINATION_IP;
-		return;
+		break;
+	case KEY_MERGE_MODE:
+		nLength = 3;
+		if (Sscan::Char(pLine, ArtNetParamsConst::MERGE_MODE, value, &nLength) == SSCAN_OK) {
+			if (memcmp(value, "ltp", 3) == 0) {
+				m_tArtNetParams.nMergeMode = ARTNET_MERGE_LTP;
+				m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_MERGE_MODE;
+			} else if (memcmp(value, "htp", 3) == 0) {
+				m_tArtNetParams.nMergeMode = ARTNET_MERGE_HTP;
+				m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_MERGE_MODE;
+			}
+		}
+		break;
+	case KEY_PROTOCOL:
+		nLength = 4;
+		if (Sscan::Char(pLine, ArtNetParamsConst::PROTOCOL, value, &nLength) == SSCAN_OK) {
+			if (memcmp(value, "sacn", 4) == 0) {
+				m_tArtNetParams.nProtocol = PORT_ARTNET_SACN;
+				m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_PROTOCOL;
+			} else {
+				m_tArtNetParams.nProtocol = PORT_ARTNET_ARTNET;
+			}
+		}
+		break;
+	case KEY_DIRECTION:
+		nLength = 6;
+		if (Sscan::Char(pLine, ArtNetParamsConst::DIRECTION, value, &nLength) == SSCAN_OK) {
+			if ((nLength == 5) && (memcmp(value, "input", 5) == 0)) {
+				m_tArtNetParams.nDirection = (uint8_t) ARTNET_INPUT_PORT;
+				m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_DIRECTION;
+			} else if ((nLength == 6) && (memcmp(value, "output", 6) == 0)) {
+				m_tArtNetParams.nDirection = (uint8_t) ARTNET_OUTPUT_PORT;
+				m_tArtNetParams.nSetList |= ARTNET_PARAMS_MASK_DIRECTION;
+			}
+		}
+		break;
+	default:
+		break;
 	}
 }
 
@@ -319,7 +322,7 @@ void ArtNetParams::Dump(void) {
 
 	if (isMaskSet(ARTNET_PARAMS_MASK_RDM)) {
 		printf(" %s=%d [%s]\n", ArtNetParamsConst::RDM, (int) m_tArtNetParams.bEnableRdm, BOOL2STRING(m_tArtNetParams.bEnableRdm));
-		if (m_tArtNetParams.bEnableRdm) {
+		if (isMaskSet(ARTNET_PARAMS_MASK_RDM_DISCOVERY)) {
 			printf("  %s=%d [%s]\n", ArtNetParamsConst::RDM_DISCOVERY, (int) m_tArtNetParams.bRdmDiscovery, BOOL2STRING(m_tArtNetParams.bRdmDiscovery));
 		}
 	}
@@ -377,6 +380,10 @@ void ArtNetParams::Dump(void) {
 	if (isMaskSet(ARTNET_PARAMS_MASK_DESTINATION_IP)) {
 		printf(" %s=" IPSTR "\n", ArtNetParamsConst::DESTINATION_IP, IP2STR(m_tArtNetParams.nDestinationIp));
 	}
+
+	if (isMaskSet(ARTNET_PARAMS_MASK_POLL_REPLY_DELAY)) {
+		printf(" %s=%d [ms]\n", ArtNetParamsConst::POLL_REPLY_DELAY, (int) m_tArtNetParams.nPollReplyDelay);
+	}
 #endif
 }
 
@@ -69,6 +69,7 @@ void ArtNetParams::Builder(const struct TArtNetParams *pArtNetParams, uint8_t *p
 	builder.AddHex16(ArtNetParamsConst::NODE_OEM_VALUE, m_tArtNetParams.aOemValue, isMaskSet(ARTNET_PARAMS_MASK_OEM_VALUE));
 
 	builder.Add(ArtNetParamsConst::RDM, m_tArtNetParams.bEnableRdm, isMaskSet(ARTNET_PARAMS_MASK_RDM));
+	builder.Add(ArtNetParamsConst::RDM_DISCOVERY, m_tArtNetParams.bRdmDiscovery, isMaskSet(ARTNET_PARAMS_MASK_RDM_DISCOVERY));
 	builder.Add(ArtNetParamsConst::TIMECODE, m_tArtNetParams.bUseTimeCode, isMaskSet(ARTNET_PARAMS_MASK_TIMECODE));
 	builder.Add(ArtNetParamsConst::TIMESYNC, m_tArtNetParams.bUseTimeSync, isMaskSet(ARTNET_PARAMS_MASK_TIMESYNC));
 
@@ -94,6 +95,9 @@ void ArtNetParams::Builder(const struct TArtNetParams *pArtNetParams, uint8_t *p
 	}
 	builder.AddIpAddress(ArtNetParamsConst::DESTINATION_IP, m_tArtNetParams.nDestinationIp, isMaskSet(ARTNET_PARAMS_MASK_DESTINATION_IP));
 
+	builder.AddComment("ArtPollReply random delay [ms]");
+	builder.Add(ArtNetParamsConst::POLL_REPLY_DELAY, (uint32_t) m_tArtNetParams.nPollReplyDelay, isMaskSet(ARTNET_PARAMS_MASK_POLL_REPLY_DELAY));
+
 	nSize = builder.GetSize();
 
 	DEBUG_PRINTF("nSize=%d", nSize);
@@ -94,4 +94,8 @@ void ArtNetParams::Set(ArtNetNode *pArtNetNode) {
 	if (isMaskSet(ARTNET_PARAMS_MASK_DESTINATION_IP)) {
 		pArtNetNode->SetDestinationIp(m_tArtNetParams.nDestinationIp);
 	}
+
+	if (isMaskSet(ARTNET_PARAMS_MASK_POLL_REPLY_DELAY)) {
+		pArtNetNode->SetPollReplyMaxDelay(m_tArtNetParams.nPollReplyDelay);
+	}
 }
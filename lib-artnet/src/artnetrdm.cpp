@@ -36,6 +36,8 @@
 
 #include "artnetnode_internal.h"
 
+#define ARTNET_RDM_DMX_MILLIS	25	///< DMX output between two RDM transactions, a frame of 512 slots is 22.7 ms
+
 void ArtNetNode::HandleTodControl(void) {
 	const struct TArtTodControl *packet = (struct TArtTodControl *) &(m_ArtNetPacket.ArtPacket.ArtTodControl);
 	const uint16_t portAddress = (uint16_t)(packet->Net << 8) | (uint16_t)(packet->Address);
@@ -111,6 +113,17 @@ void ArtNetNode::SetRdmHandler(ArtNetRdm *pArtNetTRdm, bool IsResponder) {
 			m_pTodData->ProtVerLo = ARTNET_PROTOCOL_REVISION;
 			m_pTodData->RdmVer = 0x01; // Devices that support RDM STANDARD V1.0 set field to 0x01.
 		}
+
+		m_pRdmResponse = new TArtRdm;
+		assert(m_pRdmResponse != 0);
+
+		if (m_pRdmResponse != 0) {
+			memset(m_pRdmResponse, 0, sizeof(struct TArtRdm));
+
+			memcpy(m_pRdmResponse->Id, (const char *) NODE_ID, sizeof(m_pRdmResponse->Id));
+			m_pRdmResponse->OpCode = OP_RDM;
+			m_pRdmResponse->ProtVerLo = ARTNET_PROTOCOL_REVISION;
+		}
 	}
 }
 
@@ -121,7 +134,14 @@ void ArtNetNode::HandleRdm(void) {
 	for (uint32_t i = 0; i < ARTNET_MAX_PORTS; i++) {
 		if ((portAddress == m_OutputPorts[i].port.nPortAddress) && m_OutputPorts[i].bIsEnabled) {
 
-			if (!m_IsRdmResponder) {
+			const uint8_t *pCached = m_pArtNetRdm->GetCachedResponse(i, packet->RdmPacket);
+
+			if (pCached != 0) {
+				SendRdmResponse(packet, pCached, m_ArtNetPacket.IPAddressFrom); // DMX is not interrupted
+				continue;
+			}
+
+			if (!m_IsRdmResponder && !IsRdmPending(i)) {
 				if ((m_OutputPorts[i].tPortProtocol == PORT_ARTNET_SACN) && (m_pArtNet4Handler != 0)) {
 					const uint8_t nMask = GO_OUTPUT_IS_MERGING | GO_DATA_IS_BEING_TRANSMITTED | GO_OUTPUT_IS_SACN;
 					m_IsLightSetRunning[i] = (m_pArtNet4Handler->GetStatus(i) & nMask) != 0;
@@ -132,17 +152,15 @@ void ArtNetNode::HandleRdm(void) {
 				}
 			}
 
+			if (m_pArtNetRdm->Queue(i, packet->RdmPacket, m_ArtNetPacket.IPAddressFrom)) {
+				m_nRdmPortsPending |= (1U << i); // The response is sent from HandleRdmPending
+				continue;
+			}
+
 			const uint8_t *response = (uint8_t *) m_pArtNetRdm->Handler(i, packet->RdmPacket);
 
 			if (response != 0) {
-				packet->RdmVer = 0x01;
-
-				const uint8_t nMessageLength = response[2] + 1;
-				memcpy((uint8_t *) packet->RdmPacket, &response[1], nMessageLength);
-
-				const uint16_t nLength = (uint16_t) sizeof(struct TArtRdm) - (uint16_t) sizeof(packet->RdmPacket) + nMessageLength;
-
-				Network::Get()->SendTo(m_nHandle, (const uint8_t *) packet, (const uint16_t) nLength, m_ArtNetPacket.IPAddressFrom, (uint16_t) ARTNET_UDP_PORT);
+				SendRdmResponse(packet, response, m_ArtNetPacket.IPAddressFrom);
 			} else {
 				//printf("\n==> No response <==\n");
 			}
@@ -153,3 +171,63 @@ void ArtNetNode::HandleRdm(void) {
 		}
 	}
 }
+
+/*
+ * Called from Run for every main loop iteration while there are queued RDM transactions.
+ * The DMX output of a port is restarted between two transactions, so that a controller
+ * sending RDM requests back to back does not stop the DMX output. The next request
+ * is sent after at least ARTNET_RDM_DMX_MILLIS (one DMX frame of 512 slots).
+ */
+void ArtNetNode::HandleRdmPending(void) {
+	for (uint32_t i = 0; i < ARTNET_MAX_PORTS; i++) {
+		if (!IsRdmPending(i)) {
+			continue;
+		}
+
+		const uint32_t nPortMask = (1U << i);
+
+		if ((m_nRdmPortsDmx & nPortMask) != 0) {
+			if (((m_nCurrentPacketMillis - m_nRdmDmxMillis[i]) < ARTNET_RDM_DMX_MILLIS) || !m_pArtNetRdm->IsSendPending(i)) {
+				continue;
+			}
+
+			m_nRdmPortsDmx &= ~nPortMask;
+			m_pLightSet->Stop(i);
+		}
+
+		uint32_t nIPAddressFrom;
+		const uint8_t *pResponse = m_pArtNetRdm->Run(i, nIPAddressFrom);
+
+		if (pResponse != 0) {
+			m_pRdmResponse->Net = (uint8_t) (m_OutputPorts[i].port.nPortAddress >> 8);
+			m_pRdmResponse->Address = (uint8_t) (m_OutputPorts[i].port.nPortAddress & 0xFF);
+
+			SendRdmResponse(m_pRdmResponse, pResponse, nIPAddressFrom);
+		}
+
+		const bool bIsDmxRunning = m_IsLightSetRunning[i] && (!m_IsRdmResponder);
+
+		if (m_pArtNetRdm->IsIdle(i)) {
+			m_nRdmPortsPending &= ~nPortMask;
+
+			if (bIsDmxRunning) {
+				m_pLightSet->Start(i); // Start DMX if was running
+			}
+		} else if (bIsDmxRunning && !m_pArtNetRdm->IsWaitingResponse(i)) {
+			m_nRdmPortsDmx |= nPortMask;
+			m_nRdmDmxMillis[i] = m_nCurrentPacketMillis;
+			m_pLightSet->Start(i); // DMX between two transactions
+		}
+	}
+}
+
+void ArtNetNode::SendRdmResponse(struct TArtRdm *pArtRdm, const uint8_t *pResponse, uint32_t nIPAddress) {
+	pArtRdm->RdmVer = 0x01;
+
+	const uint8_t nMessageLength = pResponse[2] + 1;
+	memcpy((uint8_t *) pArtRdm->RdmPacket, &pResponse[1], nMessageLength);
+
+	const uint16_t nLength = (uint16_t) sizeof(struct TArtRdm) - (uint16_t) sizeof(pArtRdm->RdmPacket) + nMessageLength;
+
+	Network::Get()->SendTo(m_nHandle, (const uint8_t *) pArtRdm, (const uint16_t) nLength, nIPAddress, (uint16_t) ARTNET_UDP_PORT);
+}
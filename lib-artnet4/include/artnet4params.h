@@ -35,13 +35,20 @@
 #include "artnetparams.h"
 #include "artnet4node.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TArtNet4Params {
 	uint32_t nSetList;
 	bool bMapUniverse0;
+	bool bInputArtSync;
+	uint16_t nInputMinInterval;
 };
 
 enum TArtNet4ParamsMask {
-	ARTNET4_PARAMS_MASK_MAP_UNIVERSE0 = (1 << 0)
+	ARTNET4_PARAMS_MASK_MAP_UNIVERSE0 = (1 << 0),
+	ARTNET4_PARAMS_MASK_INPUT_ARTSYNC = (1 << 1),
+	ARTNET4_PARAMS_MASK_INPUT_MIN_INTERVAL = (1 << 2)
 };
 
 class ArtNet4ParamsStore {
@@ -73,6 +80,7 @@ public:
 
 public:
 	static void staticCallbackFunction(void *p, const char *s);
+	static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
 	void callbackFunction(const char *pLine);
@@ -83,6 +91,7 @@ private:
 private:
 	ArtNet4ParamsStore *m_pArtNet4ParamsStore;
 	struct TArtNet4Params m_tArtNet4Params;
+	PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* ARTNET4PARAMS_H_ */
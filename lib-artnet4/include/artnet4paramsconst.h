@@ -31,6 +31,8 @@
 class ArtNet4ParamsConst {
 public:
 	alignas(uint32_t) static const char MAP_UNIVERSE0[];
+	alignas(uint32_t) static const char INPUT_ARTSYNC[];
+	alignas(uint32_t) static const char INPUT_MIN_INTERVAL[];
 };
 
 #endif /* ARTNET4PARAMSCONST_H_ */
@@ -40,7 +40,7 @@
 #include "artnetparamsconst.h"
 
 #include "readconfigfile.h"
-#include "sscan.h"
+#include "propertiesparser.h"
 
 #if defined (H3) || defined (RASPPI)
  #include "spiflashstore.h"
@@ -48,14 +48,28 @@
 
 #define BOOL2STRING(b)				(b) ? "Yes" : "No"
 
+#define OFFSET(f)	__builtin_offsetof(struct TArtNet4Params, f)
+
+static const struct TPropertiesKey s_Keys[] = {
+	{ ArtNet4ParamsConst::MAP_UNIVERSE0, OFFSET(bMapUniverse0), PROPERTIES_TYPE_BOOL, ARTNET4_PARAMS_MASK_MAP_UNIVERSE0, 0, 0 },
+	{ ArtNet4ParamsConst::INPUT_ARTSYNC, OFFSET(bInputArtSync), PROPERTIES_TYPE_BOOL, ARTNET4_PARAMS_MASK_INPUT_ARTSYNC, 0, 0 },
+	{ ArtNet4ParamsConst::INPUT_MIN_INTERVAL, OFFSET(nInputMinInterval), PROPERTIES_TYPE_UINT16, ARTNET4_PARAMS_MASK_INPUT_MIN_INTERVAL, 0, 0xFFFF }
+};
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable ArtNet4Params::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 4, 0x9E3779B1 };
+
 ArtNet4Params::ArtNet4Params(ArtNet4ParamsStore* pArtNet4ParamsStore):
 #if defined (H3) || defined (RASPPI)
 	ArtNetParams(pArtNet4ParamsStore == 0 ? 0 : (ArtNetParamsStore *)SpiFlashStore::Get()->GetStoreArtNet()),
 #endif
-	m_pArtNet4ParamsStore(pArtNet4ParamsStore)
+	m_pArtNet4ParamsStore(pArtNet4ParamsStore),
+	m_pPropertiesParser(0)
 {
 	m_tArtNet4Params.nSetList = 0;
 	m_tArtNet4Params.bMapUniverse0 = false;
+	m_tArtNet4Params.bInputArtSync = false;
+	m_tArtNet4Params.nInputMinInterval = 0;
 }
 
 ArtNet4Params::~ArtNet4Params(void) {
@@ -69,9 +83,16 @@ bool ArtNet4Params::Load(void) {
 
 	m_tArtNet4Params.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tArtNet4Params);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(ArtNet4Params::staticCallbackFunction, this);
 
-	if (configfile.Read(ArtNetParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(ArtNetParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pArtNet4ParamsStore != 0) {
 			m_pArtNet4ParamsStore->Update(&m_tArtNet4Params);
@@ -102,10 +123,15 @@ void ArtNet4Params::Load(const char* pBuffer, uint32_t nLength) {
 
 	m_tArtNet4Params.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tArtNet4Params);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(ArtNet4Params::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pArtNet4ParamsStore->Update(&m_tArtNet4Params);
 
 	DEBUG_EXIT
@@ -113,14 +139,9 @@ void ArtNet4Params::Load(const char* pBuffer, uint32_t nLength) {
 
 void ArtNet4Params::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
-	uint8_t value8;
-
-	if (Sscan::Uint8(pLine, ArtNet4ParamsConst::MAP_UNIVERSE0, &value8) == SSCAN_OK) {
-		m_tArtNet4Params.bMapUniverse0 = (value8 != 0);
-		m_tArtNet4Params.nSetList |= ARTNET4_PARAMS_MASK_MAP_UNIVERSE0;
-		return;
-	}
+	m_pPropertiesParser->Parse(pLine);
 }
 
 void ArtNet4Params::Dump(void) {
@@ -132,6 +153,14 @@ void ArtNet4Params::Dump(void) {
 	if(isMaskSet(ARTNET4_PARAMS_MASK_MAP_UNIVERSE0)) {
 		printf(" %s=%d [%s]\n", ArtNet4ParamsConst::MAP_UNIVERSE0, (int) m_tArtNet4Params.bMapUniverse0, BOOL2STRING(m_tArtNet4Params.bMapUniverse0));
 	}
+
+	if(isMaskSet(ARTNET4_PARAMS_MASK_INPUT_ARTSYNC)) {
+		printf(" %s=%d [%s]\n", ArtNet4ParamsConst::INPUT_ARTSYNC, (int) m_tArtNet4Params.bInputArtSync, BOOL2STRING(m_tArtNet4Params.bInputArtSync));
+	}
+
+	if(isMaskSet(ARTNET4_PARAMS_MASK_INPUT_MIN_INTERVAL)) {
+		printf(" %s=%d [ms]\n", ArtNet4ParamsConst::INPUT_MIN_INTERVAL, (int) m_tArtNet4Params.nInputMinInterval);
+	}
 #endif
 }
 
@@ -28,3 +28,5 @@
 #include "artnet4paramsconst.h"
 
 alignas(uint32_t) const char ArtNet4ParamsConst::MAP_UNIVERSE0[] = "map_universe0";
+alignas(uint32_t) const char ArtNet4ParamsConst::INPUT_ARTSYNC[] = "input_artsync";
+alignas(uint32_t) const char ArtNet4ParamsConst::INPUT_MIN_INTERVAL[] = "input_min_interval";
@@ -50,6 +50,10 @@ void ArtNet4Params::Builder(const struct TArtNet4Params *pArtNet4Params, uint8_t
 
 	builder.Add(ArtNet4ParamsConst::MAP_UNIVERSE0, m_tArtNet4Params.bMapUniverse0, isMaskSet(ARTNET4_PARAMS_MASK_MAP_UNIVERSE0));
 
+	builder.AddComment("DMX Input");
+	builder.Add(ArtNet4ParamsConst::INPUT_ARTSYNC, m_tArtNet4Params.bInputArtSync, isMaskSet(ARTNET4_PARAMS_MASK_INPUT_ARTSYNC));
+	builder.Add(ArtNet4ParamsConst::INPUT_MIN_INTERVAL, m_tArtNet4Params.nInputMinInterval, isMaskSet(ARTNET4_PARAMS_MASK_INPUT_MIN_INTERVAL));
+
 	nSize = builder.GetSize();
 
 	DEBUG_PRINTF("nSize=%d", nSize);
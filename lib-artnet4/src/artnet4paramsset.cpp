@@ -41,6 +41,16 @@ void ArtNet4Params::Set(ArtNet4Node* pArtNet4Node) {
 		pArtNet4Node->SetMapUniverse0(m_tArtNet4Params.bMapUniverse0);
 	}
 
+	if(isMaskSet(ARTNET4_PARAMS_MASK_INPUT_ARTSYNC)) {
+		pArtNet4Node->SetInputArtSync(m_tArtNet4Params.bInputArtSync);
+	}
+
+	if(isMaskSet(ARTNET4_PARAMS_MASK_INPUT_MIN_INTERVAL)) {
+		for (uint32_t i = 0; i < ARTNET_NODE_MAX_PORTS_INPUT; i++) {
+			pArtNet4Node->SetInputMinInterval(m_tArtNet4Params.nInputMinInterval, i);
+		}
+	}
+
 	ArtNetParams::Set((ArtNetNode *)pArtNet4Node);
 
 	DEBUG_EXIT
@@ -31,6 +31,7 @@
 #include "device_info.h"
 
 #define HTU21D_I2C_DEFAULT_SLAVE_ADDRESS	0x40
+#define HTU21D_CONVERSION_MILLIS		80	///< The datasheet says 50ms
 
 #ifdef __cplusplus
 extern "C" {
@@ -39,6 +40,13 @@ extern "C" {
 extern bool htu21d_start(device_info_t *);
 extern float htu21d_get_temperature(const device_info_t *);
 extern float htu21d_get_humidity(const device_info_t *);
+/*
+ * Non-blocking measurement, the read is done HTU21D_CONVERSION_MILLIS after the start
+ */
+extern void htu21d_start_temperature(const device_info_t *);
+extern void htu21d_start_humidity(const device_info_t *);
+extern float htu21d_read_temperature(const device_info_t *);
+extern float htu21d_read_humidity(const device_info_t *);
 
 #ifdef __cplusplus
 }
@@ -31,6 +31,7 @@
 #include "device_info.h"
 
 #define SI7021_I2C_DEFAULT_SLAVE_ADDRESS	0x40
+#define SI7021_CONVERSION_MILLIS		80	///< The datasheet says 50ms
 
 #ifdef __cplusplus
 extern "C" {
@@ -39,6 +40,13 @@ extern "C" {
 extern bool si7021_start(device_info_t *);
 extern float si7021_get_temperature(const device_info_t *);
 extern float si7021_get_humidity(const device_info_t *);
+/*
+ * Non-blocking measurement, the read is done SI7021_CONVERSION_MILLIS after the start
+ */
+extern void si7021_start_temperature(const device_info_t *);
+extern void si7021_start_humidity(const device_info_t *);
+extern float si7021_read_temperature(const device_info_t *);
+extern float si7021_read_humidity(const device_info_t *);
 
 #ifdef __cplusplus
 }
@@ -88,41 +88,62 @@ bool htu21d_start(device_info_t *device_info) {
 	return true;
 }
 
-static uint16_t get_raw_value(uint8_t cmd) {
+static uint16_t read_raw_value(void) {
 	char buffer[3];
 
-	i2c_write(cmd);
-
-	udelay(80 * 1000);	// datasheet says 50ms
-
 	(void) i2c_read(buffer, 3);
 
 	return (((uint16_t) buffer[0] << 8) | ((uint16_t) buffer[1])) & (uint16_t) 0xFFFC;
 }
 
-float htu21d_get_temperature(const device_info_t *device_info) {
+void htu21d_start_temperature(const device_info_t *device_info) {
+	i2c_setup(device_info);
+	i2c_write(HTU21D_TEMP);
+}
+
+void htu21d_start_humidity(const device_info_t *device_info) {
+	i2c_setup(device_info);
+	i2c_write(HTU21D_HUMID);
+}
+
+float htu21d_read_temperature(const device_info_t *device_info) {
 	uint16_t value;
 	float temp;
 
 	i2c_setup(device_info);
 
-	value = get_raw_value(HTU21D_TEMP);
+	value = read_raw_value();
 
 	temp = (float) value / 65536.0;
 
 	return -46.85 + (175.72 * temp);
 }
 
-float htu21d_get_humidity(const device_info_t *device_info) {
+float htu21d_read_humidity(const device_info_t *device_info) {
 	uint16_t value;
 	float humid;
 
 	i2c_setup(device_info);
 
-	value = get_raw_value(HTU21D_HUMID);
+	value = read_raw_value();
 
 	humid = (float) value / 65536.0;
 
 	return -6.0 + (125.0 * humid);
 }
 
+float htu21d_get_temperature(const device_info_t *device_info) {
+	htu21d_start_temperature(device_info);
+
+	udelay(HTU21D_CONVERSION_MILLIS * 1000);
+
+	return htu21d_read_temperature(device_info);
+}
+
+float htu21d_get_humidity(const device_info_t *device_info) {
+	htu21d_start_humidity(device_info);
+
+	udelay(HTU21D_CONVERSION_MILLIS * 1000);
+
+	return htu21d_read_humidity(device_info);
+}
@@ -92,40 +92,62 @@ bool si7021_start(device_info_t *device_info) {
 	return true;
 }
 
-static const uint16_t get_raw_value(uint8_t cmd) {
+static uint16_t read_raw_value(void) {
 	char buffer[3];
 
-	i2c_write(cmd);
-
-	udelay(80 * 1000);	// datasheet says 50ms
-
 	(void) i2c_read(buffer, 3);
 
 	return (((uint16_t) buffer[0] << 8) | ((uint16_t) buffer[1])) & (uint16_t) 0xFFFC;
 }
 
-float si7021_get_temperature(const device_info_t *device_info) {
+void si7021_start_temperature(const device_info_t *device_info) {
+	i2c_setup(device_info);
+	i2c_write(SI7021_TEMP);
+}
+
+void si7021_start_humidity(const device_info_t *device_info) {
+	i2c_setup(device_info);
+	i2c_write(SI7021_HUMID);
+}
+
+float si7021_read_temperature(const device_info_t *device_info) {
 	uint16_t value;
 	float temp;
 
 	i2c_setup(device_info);
 
-	value = get_raw_value(SI7021_TEMP);
+	value = read_raw_value();
 
 	temp = (float) value / 65536.0;
 
 	return -46.85 + (175.72 * temp);
 }
 
-float si7021_get_humidity(const device_info_t *device_info) {
+float si7021_read_humidity(const device_info_t *device_info) {
 	uint16_t value;
 	float humid;
 
 	i2c_setup(device_info);
 
-	value = get_raw_value(SI7021_HUMID);
+	value = read_raw_value();
 
 	humid = (float) value / 65536.0;
 
 	return -6.0 + (125.0 * humid);
 }
+
+float si7021_get_temperature(const device_info_t *device_info) {
+	si7021_start_temperature(device_info);
+
+	udelay(SI7021_CONVERSION_MILLIS * 1000);
+
+	return si7021_read_temperature(device_info);
+}
+
+float si7021_get_humidity(const device_info_t *device_info) {
+	si7021_start_humidity(device_info);
+
+	udelay(SI7021_CONVERSION_MILLIS * 1000);
+
+	return si7021_read_humidity(device_info);
+}
@@ -0,0 +1,141 @@
+/**
+ * @file trace.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdint.h>
+
+/*
+ * Tracing is enabled per subsystem with the defines
+ * TRACE_NET, TRACE_ARTNET, TRACE_E131 and TRACE_LIGHTSET.
+ * The instrumented source file must include "hardware.h".
+ */
+
+#if defined (TRACE_NET) || defined (TRACE_ARTNET) || defined (TRACE_E131) || defined (TRACE_LIGHTSET)
+ #define ENABLE_TRACE
+#endif
+
+#define TRACE_ENTRIES		1024	///< Must be a power of 2
+#define TRACE_EXPORT_MAGIC	"TRC1"
+
+/*
+ * An END event is always the BEGIN event + 1
+ */
+enum TTraceEvent {
+	TRACE_EVENT_NONE = 0x00,
+	TRACE_NET_RECV_BEGIN = 0x10,		///< Value is the packet length
+	TRACE_NET_RECV_END,
+	TRACE_NET_SEND_BEGIN,
+	TRACE_NET_SEND_END,
+	TRACE_ARTNET_PACKET_BEGIN = 0x20,	///< Value is the OpCode
+	TRACE_ARTNET_PACKET_END,
+	TRACE_ARTNET_DMX_BEGIN,
+	TRACE_ARTNET_DMX_END,
+	TRACE_E131_PACKET_BEGIN = 0x30,		///< Value is the packet length
+	TRACE_E131_PACKET_END,
+	TRACE_E131_DMX_BEGIN,
+	TRACE_E131_DMX_END,
+	TRACE_LIGHTSET_SETDATA_BEGIN = 0x40,	///< Value is the port
+	TRACE_LIGHTSET_SETDATA_END
+};
+
+struct TTraceEntry {
+	uint32_t nMicros;
+	uint16_t nEvent;
+	uint16_t nValue;
+};
+
+/*
+ * Each exported page is a header followed by nEntries entries,
+ * the entries are in chronological order over all pages.
+ */
+struct TTraceExport {
+	char aMagic[4];
+	uint16_t nPage;
+	uint16_t nPages;
+	uint32_t nIndex;	///< Total number of events traced
+	uint16_t nEntries;
+	uint16_t nReserved;
+}__attribute__((packed));
+
+class Trace {
+public:
+	static void Event(uint32_t nMicros, uint16_t nEvent, uint16_t nValue) {
+		if (__builtin_expect(s_bFreeze, 0)) {
+			return;
+		}
+
+		struct TTraceEntry *pEntry = &s_aEntries[__atomic_fetch_add(&s_nIndex, 1, __ATOMIC_RELAXED) & (TRACE_ENTRIES - 1)];
+
+		pEntry->nMicros = nMicros;
+		pEntry->nEvent = nEvent;
+		pEntry->nValue = nValue;
+	}
+
+	static void SetFreeze(bool bFreeze) {
+		s_bFreeze = bFreeze;
+	}
+
+	static void Clear(void);
+
+	static uint32_t GetPages(uint32_t nSize);
+	static uint32_t Export(uint32_t nPage, uint8_t *pBuffer, uint32_t nSize);
+
+private:
+	static struct TTraceEntry s_aEntries[TRACE_ENTRIES];
+	static uint32_t s_nIndex;
+	static bool s_bFreeze;
+};
+
+#if defined (TRACE_NET)
+ #define TRACE_NET_MARK(t)				const uint32_t t = Hardware::Get()->Micros()
+ #define TRACE_NET_EVENT(e, v)			Trace::Event(Hardware::Get()->Micros(), (e), (uint16_t) (v))
+ #define TRACE_NET_EVENT_AT(t, e, v)	Trace::Event((t), (e), (uint16_t) (v))
+#else
+ #define TRACE_NET_MARK(t)
+ #define TRACE_NET_EVENT(e, v)			((void)0)
+ #define TRACE_NET_EVENT_AT(t, e, v)	((void)0)
+#endif
+
+#if defined (TRACE_ARTNET)
+ #define TRACE_ARTNET_EVENT(e, v)		Trace::Event(Hardware::Get()->Micros(), (e), (uint16_t) (v))
+#else
+ #define TRACE_ARTNET_EVENT(e, v)		((void)0)
+#endif
+
+#if defined (TRACE_E131)
+ #define TRACE_E131_EVENT(e, v)			Trace::Event(Hardware::Get()->Micros(), (e), (uint16_t) (v))
+#else
+ #define TRACE_E131_EVENT(e, v)			((void)0)
+#endif
+
+#if defined (TRACE_LIGHTSET)
+ #define TRACE_LIGHTSET_EVENT(e, v)		Trace::Event(Hardware::Get()->Micros(), (e), (uint16_t) (v))
+#else
+ #define TRACE_LIGHTSET_EVENT(e, v)		((void)0)
+#endif
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,79 @@
+/**
+ * @file trace.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "trace.h"
+
+struct TTraceEntry Trace::s_aEntries[TRACE_ENTRIES];
+uint32_t Trace::s_nIndex = 0;
+bool Trace::s_bFreeze = false;
+
+void Trace::Clear(void) {
+	s_nIndex = 0;
+}
+
+uint32_t Trace::GetPages(uint32_t nSize) {
+	assert(nSize > sizeof(struct TTraceExport) + sizeof(struct TTraceEntry));
+
+	const uint32_t nEntriesPerPage = (nSize - sizeof(struct TTraceExport)) / sizeof(struct TTraceEntry);
+	const uint32_t nEntries = (s_nIndex < TRACE_ENTRIES) ? s_nIndex : TRACE_ENTRIES;
+
+	return (nEntries + nEntriesPerPage - 1) / nEntriesPerPage;
+}
+
+/*
+ * Call with the trace frozen, otherwise the pages are not consistent.
+ */
+uint32_t Trace::Export(uint32_t nPage, uint8_t *pBuffer, uint32_t nSize) {
+	assert(pBuffer != 0);
+	assert(nSize > sizeof(struct TTraceExport) + sizeof(struct TTraceEntry));
+
+	const uint32_t nEntriesPerPage = (nSize - sizeof(struct TTraceExport)) / sizeof(struct TTraceEntry);
+	const uint32_t nIndex = s_nIndex;
+	const uint32_t nEntries = (nIndex < TRACE_ENTRIES) ? nIndex : TRACE_ENTRIES;
+	const uint32_t nOldest = nIndex - nEntries;
+	const uint32_t nFirst = nPage * nEntriesPerPage;
+
+	struct TTraceExport *pExport = (struct TTraceExport *) pBuffer;
+
+	memcpy(pExport->aMagic, TRACE_EXPORT_MAGIC, sizeof(pExport->aMagic));
+	pExport->nPage = (uint16_t) nPage;
+	pExport->nPages = (uint16_t) GetPages(nSize);
+	pExport->nIndex = nIndex;
+	pExport->nEntries = 0;
+	pExport->nReserved = 0;
+
+	struct TTraceEntry *pEntry = (struct TTraceEntry *) (pBuffer + sizeof(struct TTraceExport));
+
+	for (uint32_t i = nFirst; (i < nEntries) && (i < (nFirst + nEntriesPerPage)); i++) {
+		memcpy(pEntry++, &s_aEntries[(nOldest + i) & (TRACE_ENTRIES - 1)], sizeof(struct TTraceEntry));
+		pExport->nEntries++;
+	}
+
+	return sizeof(struct TTraceExport) + pExport->nEntries * sizeof(struct TTraceEntry);
+}
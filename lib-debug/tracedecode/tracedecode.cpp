@@ -0,0 +1,353 @@
+/**
+ * @file tracedecode.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "trace.h"
+
+#define REMOTE_CONFIG_UDP_PORT	0x2905
+#define UDP_BUFFER_SIZE			1024
+#define MAX_EVENTS				0x50
+#define HISTOGRAM_BUCKETS		18	///< 1us .. 64ms, log2
+
+struct TStage {
+	const char *pName;
+	uint32_t nSamples;
+	uint32_t aSamples[TRACE_ENTRIES];
+};
+
+static struct TTraceEntry s_aEntries[TRACE_ENTRIES];
+static uint32_t s_nEntries;
+
+static struct TStage s_aStages[MAX_EVENTS];
+static struct TStage s_RecvInterval = { "net.recv interval", 0, { 0 } };
+
+static const char *GetName(uint32_t nEvent) {
+	switch (nEvent) {
+	case TRACE_NET_RECV_BEGIN:
+		return "net.recv";
+	case TRACE_NET_SEND_BEGIN:
+		return "net.send";
+	case TRACE_ARTNET_PACKET_BEGIN:
+		return "artnet.packet";
+	case TRACE_ARTNET_DMX_BEGIN:
+		return "artnet.dmx";
+	case TRACE_E131_PACKET_BEGIN:
+		return "e131.packet";
+	case TRACE_E131_DMX_BEGIN:
+		return "e131.dmx";
+	case TRACE_LIGHTSET_SETDATA_BEGIN:
+		return "lightset.setdata";
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static int Compare(const void *a, const void *b) {
+	const uint32_t nA = *(const uint32_t *) a;
+	const uint32_t nB = *(const uint32_t *) b;
+
+	return (nA > nB) - (nA < nB);
+}
+
+static void Print(struct TStage *pStage) {
+	if (pStage->nSamples == 0) {
+		return;
+	}
+
+	qsort(pStage->aSamples, pStage->nSamples, sizeof(uint32_t), Compare);
+
+	uint64_t nSum = 0;
+	uint32_t aHistogram[HISTOGRAM_BUCKETS];
+	memset(aHistogram, 0, sizeof(aHistogram));
+
+	for (uint32_t i = 0; i < pStage->nSamples; i++) {
+		const uint32_t nValue = pStage->aSamples[i];
+		uint32_t nBucket = 0;
+
+		nSum += nValue;
+
+		while ((nBucket < (HISTOGRAM_BUCKETS - 1)) && (nValue >= (2U << nBucket))) {
+			nBucket++;
+		}
+
+		aHistogram[nBucket]++;
+	}
+
+	const uint32_t n = pStage->nSamples;
+
+	printf("%s : %u samples, us min %u avg %u p50 %u p90 %u p99 %u max %u\n", pStage->pName, n,
+			pStage->aSamples[0], (uint32_t) (nSum / n), pStage->aSamples[n / 2], pStage->aSamples[(n * 90) / 100],
+			pStage->aSamples[(n * 99) / 100], pStage->aSamples[n - 1]);
+
+	uint32_t nMax = 0;
+
+	for (uint32_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		if (aHistogram[i] > nMax) {
+			nMax = aHistogram[i];
+		}
+	}
+
+	for (uint32_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		if (aHistogram[i] == 0) {
+			continue;
+		}
+
+		const uint32_t nBar = (aHistogram[i] * 40 + nMax - 1) / nMax;
+
+		printf("  < %6u us %6u ", 2U << i, aHistogram[i]);
+
+		for (uint32_t j = 0; j < nBar; j++) {
+			putchar('#');
+		}
+
+		putchar('\n');
+	}
+
+	putchar('\n');
+}
+
+static void Decode(void) {
+	uint32_t aBegin[MAX_EVENTS];
+	bool aIsPending[MAX_EVENTS];
+	uint32_t nLastRecv = 0;
+	bool bIsLastRecv = false;
+
+	memset(aIsPending, 0, sizeof(aIsPending));
+
+	for (uint32_t i = 0; i < MAX_EVENTS; i++) {
+		s_aStages[i].pName = GetName(i);
+		s_aStages[i].nSamples = 0;
+	}
+
+	for (uint32_t i = 0; i < s_nEntries; i++) {
+		const struct TTraceEntry *pEntry = &s_aEntries[i];
+		const uint32_t nEvent = pEntry->nEvent;
+
+		if ((nEvent == TRACE_EVENT_NONE) || (nEvent >= MAX_EVENTS)) {
+			continue;
+		}
+
+		if ((nEvent & 1) == 0) {
+			// A BEGIN without an END (early return) is replaced by the next BEGIN
+			aBegin[nEvent] = pEntry->nMicros;
+			aIsPending[nEvent] = true;
+
+			if (nEvent == TRACE_NET_RECV_BEGIN) {
+				if (bIsLastRecv) {
+					s_RecvInterval.aSamples[s_RecvInterval.nSamples++] = pEntry->nMicros - nLastRecv;
+				}
+				nLastRecv = pEntry->nMicros;
+				bIsLastRecv = true;
+			}
+		} else if (aIsPending[nEvent - 1]) {
+			struct TStage *pStage = &s_aStages[nEvent - 1];
+			pStage->aSamples[pStage->nSamples++] = pEntry->nMicros - aBegin[nEvent - 1];
+			aIsPending[nEvent - 1] = false;
+		}
+	}
+
+	printf("%u events, %u us\n\n", s_nEntries, (s_nEntries == 0) ? 0 : (s_aEntries[s_nEntries - 1].nMicros - s_aEntries[0].nMicros));
+
+	for (uint32_t i = 0; i < MAX_EVENTS; i++) {
+		if (s_aStages[i].pName != 0) {
+			Print(&s_aStages[i]);
+		}
+	}
+
+	Print(&s_RecvInterval);
+}
+
+static bool AddPage(const uint8_t *pBuffer, uint32_t nLength, uint32_t &nPages) {
+	const struct TTraceExport *pExport = (const struct TTraceExport *) pBuffer;
+
+	if ((nLength < sizeof(struct TTraceExport)) || (memcmp(pExport->aMagic, TRACE_EXPORT_MAGIC, 4) != 0)) {
+		return false;
+	}
+
+	nPages = (pExport->nPages == 0) ? 1 : pExport->nPages;
+
+	const uint32_t nEntries = (nLength - sizeof(struct TTraceExport)) / sizeof(struct TTraceEntry);
+	const uint32_t nEntriesPerPage = (UDP_BUFFER_SIZE - sizeof(struct TTraceExport)) / sizeof(struct TTraceEntry);
+	const uint32_t nFirst = pExport->nPage * nEntriesPerPage;
+
+	if ((nEntries != pExport->nEntries) || ((nFirst + nEntries) > TRACE_ENTRIES)) {
+		return false;
+	}
+
+	memcpy(&s_aEntries[nFirst], pBuffer + sizeof(struct TTraceExport), nEntries * sizeof(struct TTraceEntry));
+
+	if ((nFirst + nEntries) > s_nEntries) {
+		s_nEntries = nFirst + nEntries;
+	}
+
+	return true;
+}
+
+static int Request(const char *pIpAddress, bool bClear, FILE *pFile) {
+	const int nSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+	if (nSocket < 0) {
+		perror("socket");
+		return -1;
+	}
+
+	int nTrue = 1;
+	setsockopt(nSocket, SOL_SOCKET, SO_REUSEADDR, &nTrue, sizeof(nTrue));
+
+	struct timeval tv;
+	tv.tv_sec = 1;
+	tv.tv_usec = 0;
+	setsockopt(nSocket, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+	struct sockaddr_in si;
+	memset(&si, 0, sizeof(si));
+	si.sin_family = AF_INET;
+	si.sin_port = htons(REMOTE_CONFIG_UDP_PORT);
+	si.sin_addr.s_addr = htonl(INADDR_ANY);
+
+	if (bind(nSocket, (struct sockaddr *) &si, sizeof(si)) < 0) {
+		perror("bind");
+		close(nSocket);
+		return -1;
+	}
+
+	si.sin_addr.s_addr = inet_addr(pIpAddress);
+
+	const char *pRequest = bClear ? "?trace#clear" : "?trace#";
+
+	if (sendto(nSocket, pRequest, strlen(pRequest), 0, (struct sockaddr *) &si, sizeof(si)) < 0) {
+		perror("sendto");
+		close(nSocket);
+		return -1;
+	}
+
+	uint8_t aBuffer[UDP_BUFFER_SIZE];
+	uint32_t nPages = 1;
+	uint32_t nReceived = 0;
+
+	while (nReceived < nPages) {
+		const int nLength = recv(nSocket, aBuffer, sizeof(aBuffer), 0);
+
+		if (nLength < 0) {
+			fprintf(stderr, "Timeout, %u of %u pages received\n", nReceived, nPages);
+			break;
+		}
+
+		if (AddPage(aBuffer, (uint32_t) nLength, nPages)) {
+			nReceived++;
+
+			if (pFile != 0) {
+				fwrite(aBuffer, 1, (size_t) nLength, pFile);
+			}
+		}
+	}
+
+	close(nSocket);
+	return 0;
+}
+
+static int Read(FILE *pFile) {
+	uint8_t aBuffer[UDP_BUFFER_SIZE];
+	uint32_t nPages;
+
+	while (fread(aBuffer, sizeof(struct TTraceExport), 1, pFile) == 1) {
+		const struct TTraceExport *pExport = (const struct TTraceExport *) aBuffer;
+		const uint32_t nLength = pExport->nEntries * sizeof(struct TTraceEntry);
+
+		if ((sizeof(struct TTraceExport) + nLength) > sizeof(aBuffer)) {
+			fprintf(stderr, "Invalid file\n");
+			return -1;
+		}
+
+		if (fread(aBuffer + sizeof(struct TTraceExport), 1, nLength, pFile) != nLength) {
+			break;
+		}
+
+		if (!AddPage(aBuffer, sizeof(struct TTraceExport) + nLength, nPages)) {
+			fprintf(stderr, "Invalid page\n");
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		printf("Usage: %s ip_address [-c] [-w file]\n", argv[0]);
+		printf("       %s -r file\n", argv[0]);
+		printf("  -c  clear the trace after reading\n");
+		return -1;
+	}
+
+	const char *pFileName = 0;
+	bool bClear = false;
+	bool bRead = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-c") == 0) {
+			bClear = true;
+		} else if ((strcmp(argv[i], "-w") == 0) && (i + 1 < argc)) {
+			pFileName = argv[++i];
+		} else if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc)) {
+			pFileName = argv[++i];
+			bRead = true;
+		}
+	}
+
+	FILE *pFile = 0;
+
+	if (pFileName != 0) {
+		if ((pFile = fopen(pFileName, bRead ? "rb" : "wb")) == 0) {
+			perror(pFileName);
+			return -1;
+		}
+	}
+
+	const int nResult = bRead ? Read(pFile) : Request(argv[1], bClear, pFile);
+
+	if (pFile != 0) {
+		fclose(pFile);
+	}
+
+	if (nResult != 0) {
+		return nResult;
+	}
+
+	Decode();
+
+	return 0;
+}
@@ -35,6 +35,7 @@
 #include "display7segment.h"
 
 #define DISPLAY_SLEEP_TIMEOUT_DEFAULT	5
+#define DISPLAY_FLUSH_CHARS_MAX			2	///< Per Run, an SSD1306 character is 7 bytes of I2C data
 
 enum TDisplayTypes {
 	DISPLAY_BW_UI_1602 = 0,
@@ -51,7 +52,14 @@ public:
 	Display(TDisplayTypes tDisplayType = DISPLAY_SSD1306);
 	~Display(void);
 
+	/*
+	 * The text is kept in a shadow buffer, only the characters that differ
+	 * from what is on the display are sent. From the first call of Run, which
+	 * is in the main loop, the text is sent at most DISPLAY_FLUSH_CHARS_MAX
+	 * characters per Run. Cls and TextStatus are always sent at once.
+	 */
 	void Run(void);
+	void Flush(void);
 
 	void Cls(void);
 	void ClearLine(uint8_t nLine);
@@ -113,6 +121,9 @@ public:
 
 private:
 	void Detect(uint8_t nCols, uint8_t nRows);
+	void InitText(void);
+	void SetText(const char *pText, uint32_t nLength);
+	void Flush(uint32_t nMaxChars);
 	void Init7Segment(void);
 	TDisplay7SegmentCharacters Get7SegmentData(uint8_t nValue);
 
@@ -125,6 +136,14 @@ private:
 	bool m_bHave7Segment;
 	uint32_t m_nMillis;
 	uint32_t m_nSleepTimeout;
+	char *m_pText;			///< What should be on the display
+	char *m_pTextSent;		///< What is on the display
+	uint8_t *m_pDirtyBegin;	///< Per row, the first column that might differ
+	uint8_t *m_pDirtyEnd;	///< Per row, past the last column that might differ
+	uint8_t m_nCursorCol;
+	uint8_t m_nCursorRow;
+	TCursorMode m_tCursorMode;
+	bool m_bIsDeferred;
 
 	static Display *s_pThis;
 };
@@ -25,6 +25,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "displayset.h"
 #include "display.h"
@@ -52,7 +53,15 @@ Display::Display(uint8_t nCols, uint8_t nRows):
 	m_bIsSleep(false),
 	m_bHave7Segment(false),
 	m_nMillis(Hardware::Get()->Millis()),
-	m_nSleepTimeout(1000 * 60 * DISPLAY_SLEEP_TIMEOUT_DEFAULT)
+	m_nSleepTimeout(1000 * 60 * DISPLAY_SLEEP_TIMEOUT_DEFAULT),
+	m_pText(0),
+	m_pTextSent(0),
+	m_pDirtyBegin(0),
+	m_pDirtyEnd(0),
+	m_nCursorCol(0),
+	m_nCursorRow(0),
+	m_tCursorMode(SET_CURSOR_OFF),
+	m_bIsDeferred(false)
 {
 	s_pThis = this;
 
@@ -69,7 +78,15 @@ Display::Display(TDisplayTypes tDisplayType):
 #if !defined(RASPPI)
 	m_nMillis(Hardware::Get()->Millis()),
 #endif
-	m_nSleepTimeout(1000 * 60 * DISPLAY_SLEEP_TIMEOUT_DEFAULT)
+	m_nSleepTimeout(1000 * 60 * DISPLAY_SLEEP_TIMEOUT_DEFAULT),
+	m_pText(0),
+	m_pTextSent(0),
+	m_pDirtyBegin(0),
+	m_pDirtyEnd(0),
+	m_nCursorCol(0),
+	m_nCursorRow(0),
+	m_tCursorMode(SET_CURSOR_OFF),
+	m_bIsDeferred(false)
 {
 	s_pThis = this;
 	m_tType = tDisplayType;
@@ -177,25 +194,155 @@ void Display::Detect(uint8_t nCols, uint8_t nRows) {
 Display::~Display(void) {
 	s_pThis = 0;
 	delete m_LcdDisplay;
+
+	delete[] m_pDirtyEnd;
+	delete[] m_pDirtyBegin;
+	delete[] m_pTextSent;
+	delete[] m_pText;
+}
+
+/*
+ * The display is cleared by the driver Start
+ */
+void Display::InitText(void) {
+	m_nCols = m_LcdDisplay->GetColumns();
+	m_nRows = m_LcdDisplay->GetRows();
+
+	const uint32_t nSize = m_nCols * m_nRows;
+
+	m_pText = new char[nSize];
+	m_pTextSent = new char[nSize];
+	m_pDirtyBegin = new uint8_t[m_nRows];
+	m_pDirtyEnd = new uint8_t[m_nRows];
+
+	memset(m_pText, ' ', nSize);
+	memset(m_pTextSent, ' ', nSize);
+	memset(m_pDirtyBegin, m_nCols, m_nRows);
+	memset(m_pDirtyEnd, 0, m_nRows);
+}
+
+/*
+ * Writes at the cursor, the cursor wraps as it does on the display
+ */
+void Display::SetText(const char *pText, uint32_t nLength) {
+	if (__builtin_expect((m_pText == 0), 0)) {
+		InitText();
+	}
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		if (m_nCursorCol >= m_nCols) {
+			m_nCursorCol = 0;
+			m_nCursorRow = (m_nCursorRow + 1 < m_nRows) ? m_nCursorRow + 1 : 0;
+		}
+
+		m_pText[m_nCursorRow * m_nCols + m_nCursorCol] = pText[i];
+
+		if (m_nCursorCol < m_pDirtyBegin[m_nCursorRow]) {
+			m_pDirtyBegin[m_nCursorRow] = m_nCursorCol;
+		}
+
+		m_nCursorCol++;
+
+		if (m_nCursorCol > m_pDirtyEnd[m_nCursorRow]) {
+			m_pDirtyEnd[m_nCursorRow] = m_nCursorCol;
+		}
+	}
+}
+
+/*
+ * Sends at most nMaxChars characters that differ from what is on the display.
+ * The row spans that are left are flushed with the next call.
+ */
+void Display::Flush(uint32_t nMaxChars) {
+	for (uint32_t nRow = 0; nRow < m_nRows; nRow++) {
+		const uint32_t nEnd = m_pDirtyEnd[nRow];
+		char *pText = &m_pText[nRow * m_nCols];
+		char *pTextSent = &m_pTextSent[nRow * m_nCols];
+		uint32_t nCol = m_pDirtyBegin[nRow];
+
+		while (nCol < nEnd) {
+			if (pText[nCol] == pTextSent[nCol]) {
+				nCol++;
+				continue;
+			}
+
+			if (nMaxChars == 0) {
+				m_pDirtyBegin[nRow] = nCol;
+				return;
+			}
+
+			m_LcdDisplay->SetCursorPos(nCol, nRow);
+
+			while ((nCol < nEnd) && (nMaxChars != 0) && (pText[nCol] != pTextSent[nCol])) {
+				m_LcdDisplay->PutChar((int) pText[nCol]);
+				pTextSent[nCol] = pText[nCol];
+				nCol++;
+				nMaxChars--;
+			}
+		}
+
+		m_pDirtyBegin[nRow] = m_nCols;
+		m_pDirtyEnd[nRow] = 0;
+	}
+}
+
+void Display::Flush(void) {
+	if (m_pText == 0) {
+		return;
+	}
+
+	Flush((uint32_t) ~0);
+
+	if (m_tCursorMode != SET_CURSOR_OFF) {
+		m_LcdDisplay->SetCursorPos(m_nCursorCol, m_nCursorRow);
+	}
 }
 
 void Display::Cls(void) {
 	if (m_LcdDisplay == 0) {
 		return;
 	}
+
 	m_LcdDisplay->Cls();
+
+	if (m_pText != 0) {
+		memset(m_pText, ' ', m_nCols * m_nRows);
+		memset(m_pTextSent, ' ', m_nCols * m_nRows);
+		memset(m_pDirtyBegin, m_nCols, m_nRows);
+		memset(m_pDirtyEnd, 0, m_nRows);
+	}
+
+	m_nCursorCol = 0;
+	m_nCursorRow = 0;
 }
 
 void Display::TextLine(uint8_t nLine, const char *pText, uint8_t nLength) {
 	if (m_LcdDisplay == 0) {
 		return;
 	}
-	m_LcdDisplay->TextLine(nLine, pText, nLength);
+
+	if ((nLine == 0) || (nLine > m_LcdDisplay->GetRows())) {
+		return;
+	}
+
+	if (nLength > m_LcdDisplay->GetColumns()) {
+		nLength = m_LcdDisplay->GetColumns();
+	}
+
+	m_nCursorCol = 0;
+	m_nCursorRow = nLine - 1;
+
+	SetText(pText, nLength);
+
+	if (!m_bIsDeferred) {
+		Flush();
+	}
 }
 
 void Display::TextStatus(const char *pText) {
 	ClearLine(m_nRows);
 	Write(m_nRows, pText);
+	Flush();
 }
 
 uint8_t Display::Printf(uint8_t nLine, const char *format, ...) {
@@ -214,7 +361,11 @@ uint8_t Display::Printf(uint8_t nLine, const char *format, ...) {
 
 	va_end(arp);
 
-	m_LcdDisplay->TextLine(nLine, buffer, i);
+	if (i > (int) (sizeof(buffer) - 1)) {
+		i = sizeof(buffer) - 1;
+	}
+
+	TextLine(nLine, buffer, i);
 
 	return i;
 }
@@ -232,7 +383,7 @@ uint8_t Display::Write(uint8_t nLine, const char *pText) {
 
 	const size_t nLength =  (size_t) (p - pText);
 
-	m_LcdDisplay->TextLine(nLine, pText, nLength);
+	TextLine(nLine, pText, nLength);
 
 	return nLength;
 }
@@ -241,6 +392,11 @@ void Display::SetCursor(TCursorMode constEnumTCursorOnOff) {
 	if (m_LcdDisplay == 0) {
 		return;
 	}
+
+	Flush();
+
+	m_tCursorMode = constEnumTCursorOnOff;
+	m_LcdDisplay->SetCursorPos(m_nCursorCol, m_nCursorRow);
 	m_LcdDisplay->SetCursor(constEnumTCursorOnOff);
 }
 
@@ -248,28 +404,63 @@ void Display::SetCursorPos(uint8_t nCol, uint8_t nRow) {
 	if (m_LcdDisplay == 0) {
 		return;
 	}
-	m_LcdDisplay->SetCursorPos(nCol, nRow);
+
+	m_nCursorCol = nCol;
+	m_nCursorRow = nRow;
+
+	if (m_tCursorMode != SET_CURSOR_OFF) {
+		Flush();
+	}
 }
 
 void Display::PutChar(int c) {
 	if (m_LcdDisplay == 0) {
 		return;
 	}
-	m_LcdDisplay->PutChar(c);
+
+	const char ch = (char) c;
+
+	SetText(&ch, 1);
+
+	if (!m_bIsDeferred) {
+		Flush();
+	}
 }
 
 void Display::PutString(const char *pText) {
 	if (m_LcdDisplay == 0) {
 		return;
 	}
-	m_LcdDisplay->PutString(pText);
+
+	SetText(pText, strlen(pText));
+
+	if (!m_bIsDeferred) {
+		Flush();
+	}
 }
 
 void Display::ClearLine(uint8_t nLine) {
 	if (m_LcdDisplay == 0) {
 		return;
 	}
-	m_LcdDisplay->ClearLine(nLine);
+
+	if ((nLine == 0) || (nLine > m_LcdDisplay->GetRows())) {
+		return;
+	}
+
+	m_nCursorCol = 0;
+	m_nCursorRow = nLine - 1;
+
+	for (uint32_t i = 0; i < m_LcdDisplay->GetColumns(); i++) {
+		SetText(" ", 1);
+	}
+
+	m_nCursorCol = 0;
+	m_nCursorRow = nLine - 1;
+
+	if (!m_bIsDeferred) {
+		Flush();
+	}
 }
 
 void Display::SetSleep(bool bSleep) {
@@ -391,6 +582,12 @@ void Display::TextStatus(const char *pText, uint8_t nValue, bool bHex) {
 }
 
 void Display::Run(void) {
+	m_bIsDeferred = true;
+
+	if (m_pText != 0) {
+		Flush(DISPLAY_FLUSH_CHARS_MAX);
+	}
+
 	if (m_nSleepTimeout == 0) {
 		return;
 	}
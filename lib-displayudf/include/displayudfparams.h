@@ -31,6 +31,9 @@
 
 #include "displayudf.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 #define DISPLAYUDF_PARAMS_SLEEP_TIMEOUT_DEFAULT		5
 
 struct TDisplayUdfParams {
@@ -77,6 +80,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -89,6 +93,7 @@ private:
 private:
     DisplayUdfParamsStore *m_pDisplayUdfParamsStore;
     struct TDisplayUdfParams m_tDisplayUdfParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* DISPLAYUDFPARAMS_H_ */
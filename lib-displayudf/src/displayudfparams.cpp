@@ -43,7 +43,7 @@
 #include "artnetparamsconst.h"
 
 #include "readconfigfile.h"
-#include "sscan.h"
+#include "propertiesparser.h"
 
 #include "propertiesbuilder.h"
 
@@ -53,26 +53,35 @@
 
 #include "debug.h"
 
-static const char *pArray[DISPLAY_UDF_LABEL_UNKNOWN] = {
-		DisplayUdfParamsConst::TITLE,
-		DisplayUdfParamsConst::BOARD_NAME,
-		NetworkConst::PARAMS_IP_ADDRESS,
-		DisplayUdfParamsConst::VERSION,
-		LightSetConst::PARAMS_UNIVERSE,
-		DisplayUdfParamsConst::ACTIVE_PORTS,
-		ArtNetParamsConst::NODE_SHORT_NAME,
-		NetworkConst::PARAMS_HOSTNAME,
-		ArtNetParamsConst::UNIVERSE_PORT[0],
-		ArtNetParamsConst::UNIVERSE_PORT[1],
-		ArtNetParamsConst::UNIVERSE_PORT[2],
-		ArtNetParamsConst::UNIVERSE_PORT[3],
-		NetworkConst::PARAMS_NET_MASK,
-		LightSetConst::PARAMS_DMX_START_ADDRESS,
-		ArtNetParamsConst::DESTINATION_IP
+#define OFFSET(f)	__builtin_offsetof(struct TDisplayUdfParams, f)
+#define LABEL(l, n)	{ n, OFFSET(nLabelIndex) + l, PROPERTIES_TYPE_UINT8, (1U << l), 0, 0xFF }
+
+// The label keys are in the order of TDisplayUdfLabels, followed by the sleep timeout
+static const struct TPropertiesKey s_Keys[] = {
+	LABEL(DISPLAY_UDF_LABEL_TITLE, DisplayUdfParamsConst::TITLE),
+	LABEL(DISPLAY_UDF_LABEL_BOARDNAME, DisplayUdfParamsConst::BOARD_NAME),
+	LABEL(DISPLAY_UDF_LABEL_IP, NetworkConst::PARAMS_IP_ADDRESS),
+	LABEL(DISPLAY_UDF_LABEL_VERSION, DisplayUdfParamsConst::VERSION),
+	LABEL(DISPLAY_UDF_LABEL_UNIVERSE, LightSetConst::PARAMS_UNIVERSE),
+	LABEL(DISPLAY_UDF_LABEL_AP, DisplayUdfParamsConst::ACTIVE_PORTS),
+	LABEL(DISPLAY_UDF_LABEL_NODE_NAME, ArtNetParamsConst::NODE_SHORT_NAME),
+	LABEL(DISPLAY_UDF_LABEL_HOSTNAME, NetworkConst::PARAMS_HOSTNAME),
+	LABEL(DISPLAY_UDF_LABEL_UNIVERSE_PORT_A, ArtNetParamsConst::UNIVERSE_PORT[0]),
+	LABEL(DISPLAY_UDF_LABEL_UNIVERSE_PORT_B, ArtNetParamsConst::UNIVERSE_PORT[1]),
+	LABEL(DISPLAY_UDF_LABEL_UNIVERSE_PORT_C, ArtNetParamsConst::UNIVERSE_PORT[2]),
+	LABEL(DISPLAY_UDF_LABEL_UNIVERSE_PORT_D, ArtNetParamsConst::UNIVERSE_PORT[3]),
+	LABEL(DISPLAY_UDF_LABEL_NETMASK, NetworkConst::PARAMS_NET_MASK),
+	LABEL(DISPLAY_UDF_LABEL_DMX_START_ADDRESS, LightSetConst::PARAMS_DMX_START_ADDRESS),
+	LABEL(DISPLAY_UDF_LABEL_DESTINATION_IP, ArtNetParamsConst::DESTINATION_IP),
+	{ DisplayUdfParamsConst::SLEEP_TIMEOUT, OFFSET(nSleepTimeout), PROPERTIES_TYPE_UINT8, DISPLAY_UDF_PARAMS_MASK_SLEEP_TIMEOUT, 0, 0xFF }
 };
 
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == (DISPLAY_UDF_LABEL_UNKNOWN + 1), "s_Keys does not match TDisplayUdfLabels");
 
-DisplayUdfParams::DisplayUdfParams(DisplayUdfParamsStore *pDisplayUdfParamsStore): m_pDisplayUdfParamsStore(pDisplayUdfParamsStore) {
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable DisplayUdfParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 6, 0x9E3779B9 };
+
+DisplayUdfParams::DisplayUdfParams(DisplayUdfParamsStore *pDisplayUdfParamsStore): m_pDisplayUdfParamsStore(pDisplayUdfParamsStore), m_pPropertiesParser(0) {
 	DEBUG_ENTRY
 
 	uint8_t *p = (uint8_t *) &m_tDisplayUdfParams;
@@ -95,9 +104,16 @@ DisplayUdfParams::~DisplayUdfParams(void) {
 bool DisplayUdfParams::Load(void) {
 	m_tDisplayUdfParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tDisplayUdfParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(DisplayUdfParams::staticCallbackFunction, this);
 
-	if (configfile.Read(DisplayUdfParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(DisplayUdfParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pDisplayUdfParamsStore != 0) {
 			m_pDisplayUdfParamsStore->Update(&m_tDisplayUdfParams);
@@ -123,30 +139,23 @@ void DisplayUdfParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tDisplayUdfParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tDisplayUdfParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(DisplayUdfParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pDisplayUdfParamsStore->Update(&m_tDisplayUdfParams);
 }
 
 void DisplayUdfParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
-	uint8_t value8;
+	assert(m_pPropertiesParser != 0);
 
-	if (Sscan::Uint8(pLine, DisplayUdfParamsConst::SLEEP_TIMEOUT, &value8) == SSCAN_OK) {
-		m_tDisplayUdfParams.nSleepTimeout = value8;
-		m_tDisplayUdfParams.nSetList |= DISPLAY_UDF_PARAMS_MASK_SLEEP_TIMEOUT;
-		return;
-	}
-
-	for (uint32_t i = 0; i < DISPLAY_UDF_LABEL_UNKNOWN; i++) {
-		if (Sscan::Uint8(pLine, pArray[i], &value8) == SSCAN_OK) {
-			m_tDisplayUdfParams.nLabelIndex[i] = value8;
-			m_tDisplayUdfParams.nSetList |= (1 << i);
-			return;
-		}
-	}
+	m_pPropertiesParser->Parse(pLine);
 }
 
 void DisplayUdfParams::Builder(const struct TDisplayUdfParams *ptDisplayUdfParams, uint8_t *pBuffer, uint32_t nLength, uint32_t &nSize) {
@@ -168,7 +177,7 @@ void DisplayUdfParams::Builder(const struct TDisplayUdfParams *ptDisplayUdfParam
 		if (!isMaskSet(1 << i)) {
 			m_tDisplayUdfParams.nLabelIndex[i] = DisplayUdf::Get()->GetLabel(i);
 		}
-		builder.Add(pArray[i], m_tDisplayUdfParams.nLabelIndex[i] , isMaskSet(1 << i));
+		builder.Add(s_Keys[i].pName, m_tDisplayUdfParams.nLabelIndex[i] , isMaskSet(1 << i));
 	}
 
 	nSize = builder.GetSize();
@@ -214,7 +223,7 @@ void DisplayUdfParams::Dump(void) {
 
 	for (uint32_t i = 0; i < DISPLAY_UDF_LABEL_UNKNOWN; i++) {
 		if (isMaskSet(1 << i)) {
-			printf(" %s=%d\n", pArray[i], m_tDisplayUdfParams.nLabelIndex[i]);
+			printf(" %s=%d\n", s_Keys[i].pName, m_tDisplayUdfParams.nLabelIndex[i]);
 		}
 	}
 
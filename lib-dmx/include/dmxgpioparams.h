@@ -30,6 +30,9 @@
 
 #include "dmx.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 class DmxGpioParams {
 public:
 	DmxGpioParams(void);
@@ -43,6 +46,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -52,6 +56,7 @@ private:
     uint32_t m_nSetList;
     uint8_t m_nDmxDataDirection;
     uint8_t m_nDmxDataDirectionOut[DMX_MAX_OUT];
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* DMXGPIOPARAMS_H_ */
@@ -47,6 +47,12 @@ extern uint32_t dmx_multi_get_output_period(void);
 
 extern const uint8_t *dmx_multi_rdm_get_available(uint8_t uart);
 
+extern const uint8_t *dmx_multi_get_available(uint8_t uart);
+extern const uint8_t *dmx_multi_get_current_data(uint8_t uart);
+extern uint32_t dmx_multi_get_updates_per_seconde(uint8_t uart);
+extern const volatile struct _total_statistics *dmx_multi_get_total_statistics(uint8_t uart);
+extern void dmx_multi_reset_total_statistics(uint8_t uart);
+
 #ifdef __cplusplus
 }
 #endif
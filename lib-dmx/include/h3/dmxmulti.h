@@ -61,6 +61,12 @@ public:
 	const uint8_t *RdmReceive(uint8_t nPort);
 	const uint8_t *RdmReceiveTimeOut(uint8_t nPort, uint32_t nTimeOut);
 
+public: // DMX input
+	const uint8_t *GetDmxAvailable(uint8_t nPort);
+	const uint8_t *GetDmxCurrentData(uint8_t nPort);
+	uint32_t GetUpdatesPerSecond(uint8_t nPort);
+	const volatile struct _total_statistics *GetTotalStatistics(uint8_t nPort);
+
 private:
 };
 
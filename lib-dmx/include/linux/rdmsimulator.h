@@ -0,0 +1,148 @@
+/**
+ * @file rdmsimulator.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LINUX_RDMSIMULATOR_H_
+#define LINUX_RDMSIMULATOR_H_
+
+#include <stdint.h>
+
+#include "rdm.h"
+
+#define RDM_SIMULATOR_RESPONDERS_MAX		512
+#define RDM_SIMULATOR_SLOT_TIME				44		///< Microseconds, 11 bits at 250 kbit/s
+#define RDM_SIMULATOR_TURNAROUND_MIN		176		///< 3.2.2 Responder Packet spacing
+#define RDM_SIMULATOR_TURNAROUND_MAX		2000	///< 3.2.2 Responder Packet spacing
+#define RDM_SIMULATOR_CONTROLLER_SPACING	176		///< 3.2.1 Controller Packet spacing, after a response
+
+struct TRdmSimulatorResponder {
+	uint8_t aUid[RDM_UID_SIZE];
+	uint16_t nTurnaround;	///< Microseconds, from the end of the request to the start of the response
+	bool bIsMuted;
+};
+
+struct TRdmSimulatorStatistics {
+	uint32_t nRequests;
+	uint32_t nDiscUniqueBranch;
+	uint32_t nCollisions;		///< DISC_UNIQUE_BRANCH answered by more than one responder
+	uint32_t nMute;
+	uint32_t nUnMute;
+	uint32_t nResponses;
+	uint32_t nTimeOuts;			///< ReceiveTimeOut without a response
+	uint32_t nInvalid;			///< Requests with a bad checksum or length
+};
+
+/*
+ * GET and SET commands are passed on to the handler, pUid is the virtual responder addressed.
+ * The returned response includes the start code and the checksum, 0 is no response.
+ */
+class RDMSimulatorHandler {
+public:
+	virtual ~RDMSimulatorHandler(void) {
+	}
+
+	virtual const uint8_t *Handler(const uint8_t *pUid, const uint8_t *pRdmDataNoSC)= 0;
+};
+
+/*
+ * A single RDM line with virtual responders, used by the Linux Rdm class.
+ * Time is virtual: the bus time is accounted for every slot sent and for the
+ * turnaround of each responder, a ReceiveTimeOut without a response costs the full time-out.
+ * Responders answering a DISC_UNIQUE_BRANCH at the same time collide, the controller
+ * receives the wired-AND of the frames.
+ */
+class RDMSimulator {
+public:
+	RDMSimulator(uint32_t nSeed = 1);
+	~RDMSimulator(void);
+
+	bool AddResponder(const uint8_t *pUid, uint16_t nTurnaround = RDM_SIMULATOR_TURNAROUND_MIN);
+	uint32_t AddResponders(uint16_t nManufacturerId, uint32_t nCount, uint16_t nTurnaroundMin = RDM_SIMULATOR_TURNAROUND_MIN, uint16_t nTurnaroundMax = RDM_SIMULATOR_TURNAROUND_MAX);
+	void Clear(void);
+
+	uint32_t GetResponders(void) const {
+		return m_nResponders;
+	}
+
+	const struct TRdmSimulatorResponder *GetResponder(uint32_t nIndex) const {
+		return &m_pResponders[nIndex];
+	}
+
+	bool Exist(const uint8_t *pUid) const {
+		return Find(pUid) >= 0;
+	}
+
+	void SetHandler(RDMSimulatorHandler *pHandler) {
+		m_pHandler = pHandler;
+	}
+
+	// The bus, as seen by the controller
+	void Send(const uint8_t *pRdmData, uint16_t nLength);
+	const uint8_t *Receive(void);
+	const uint8_t *ReceiveTimeOut(uint32_t nTimeOut);
+	void Delay(uint32_t nMicros) {
+		m_nMicros += nMicros;
+	}
+
+	uint64_t GetMicros(void) const {
+		return m_nMicros;
+	}
+
+	const struct TRdmSimulatorStatistics *GetStatistics(void) const {
+		return &m_tStatistics;
+	}
+	void ResetStatistics(void);
+
+	void Print(void);
+
+	static RDMSimulator *Get(void) {
+		return s_pThis;
+	}
+
+private:
+	int32_t Find(const uint8_t *pUid) const;
+	uint32_t LowerBound(const uint8_t *pUid) const;
+	uint32_t Random(void);
+
+	void HandleDiscovery(const struct TRdmMessage *pRequest, bool bIsBroadcast, int32_t nIndex);
+	void HandleDiscUniqueBranch(const struct TRdmMessage *pRequest);
+	void HandleCommand(const struct TRdmMessage *pRequest, bool bIsBroadcast, int32_t nIndex);
+	void Respond(const struct TRdmSimulatorResponder *pResponder, const uint8_t *pResponse);
+
+private:
+	struct TRdmSimulatorResponder *m_pResponders;	///< Sorted on UID
+	uint32_t m_nResponders;
+	RDMSimulatorHandler *m_pHandler;
+	uint32_t m_nRandom;
+	uint64_t m_nMicros;			///< Virtual bus time
+	uint64_t m_nIdleMicros;		///< End of the last response on the bus
+	uint64_t m_nResponseMicros;	///< Pending response is completely received at
+	bool m_bIsResponse;
+	struct TRdmSimulatorStatistics m_tStatistics;
+	alignas(uint32_t) uint8_t m_aResponse[sizeof(struct TRdmMessage) + RDM_MESSAGE_CHECKSUM_SIZE];
+
+	static RDMSimulator *s_pThis;
+};
+
+#endif /* LINUX_RDMSIMULATOR_H_ */
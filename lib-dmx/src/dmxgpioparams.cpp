@@ -39,6 +39,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #include "gpio.h"
 
@@ -57,9 +58,29 @@ static const char PARAMS_DATA_DIRECTION[] ALIGNED = "data_direction";
 static const char PARAMS_DATA_DIRECTION_OUT[4][21] ALIGNED = {
 		"data_direction_out_a", "data_direction_out_b", "data_direction_out_c", "data_direction_out_d" };
 
+enum TDmxGpioParamsKey {
+	KEY_DATA_DIRECTION,
+	KEY_DATA_DIRECTION_OUT_A
+};
+
+// There is no params struct, all keys are handled in callbackFunction
+static const struct TPropertiesKey s_Keys[] = {
+	{ PARAMS_DATA_DIRECTION, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_DATA_DIRECTION_OUT[0], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_DATA_DIRECTION_OUT[1], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_DATA_DIRECTION_OUT[2], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_DATA_DIRECTION_OUT[3], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == (KEY_DATA_DIRECTION_OUT_A + DMX_MAX_OUT), "s_Keys does not match TDmxGpioParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable DmxGpioParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B1 };
+
 DmxGpioParams::DmxGpioParams(void):
 		m_nSetList(0),
-		m_nDmxDataDirection(GPIO_DMX_DATA_DIRECTION)
+		m_nDmxDataDirection(GPIO_DMX_DATA_DIRECTION),
+		m_pPropertiesParser(0)
 {
 #if defined(H3)
  #if defined(ORANGE_PI_ONE)
@@ -82,28 +103,40 @@ DmxGpioParams::~DmxGpioParams(void) {
 bool DmxGpioParams::Load(void) {
 	m_nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, 0);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(DmxGpioParams::staticCallbackFunction, this);
-	return configfile.Read(PARAMS_FILE_NAME);
+
+	const bool bHaveFile = configfile.Read(PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	return bHaveFile;
 }
 
 void DmxGpioParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t value8;
 
-	if (Sscan::Uint8(pLine, PARAMS_DATA_DIRECTION, &value8) == SSCAN_OK) {
-		if (value8 < 32) {
+	const int32_t nKey = m_pPropertiesParser->Parse(pLine);
+
+	if (nKey == KEY_DATA_DIRECTION) {
+		if ((Sscan::Uint8(pLine, PARAMS_DATA_DIRECTION, &value8) == SSCAN_OK) && (value8 < 32)) {
 			m_nDmxDataDirection = value8;
 			m_nSetList |= DATA_DIRECTION_MASK;
 		}
 		return;
 	}
 
-	for (unsigned i = 0; i < 4; i++) {
+	if ((nKey >= KEY_DATA_DIRECTION_OUT_A) && (nKey < (KEY_DATA_DIRECTION_OUT_A + DMX_MAX_OUT))) {
+		const uint32_t i = (uint32_t) (nKey - KEY_DATA_DIRECTION_OUT_A);
+
 		if (Sscan::Uint8(pLine, PARAMS_DATA_DIRECTION_OUT[i], &value8) == SSCAN_OK) {
 			m_nDmxDataDirectionOut[i] = value8;
 			m_nSetList |= (DATA_DIRECTION_OUT_A_MASK << i);
-			return;
 		}
 	}
 }
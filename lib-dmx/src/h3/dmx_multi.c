@@ -61,6 +61,10 @@ extern int console_error(const char *);
 
 #define DMX_DATA_OUT_INDEX	(1 << 2)
 
+#define DMX_DATA_IN_INDEX_ENTRIES	(1 << 2)
+#define DMX_DATA_IN_INDEX_MASK		(DMX_DATA_IN_INDEX_ENTRIES - 1)
+#define DMX_DATA_IN_IDLE_TIMEOUT	1000	///< us, a packet shorter than 512 slots without a following BREAK is completed after this idle time
+
 typedef enum {
 	IDLE = 0,
 	PRE_BREAK,
@@ -118,10 +122,24 @@ static uint8_t dmx_data_direction_gpio_pin[DMX_MAX_OUT] ALIGNED;
 
 static struct _rdm_multi_data rdm_data[DMX_MAX_OUT][RDM_DATA_BUFFER_INDEX_ENTRIES] ALIGNED;
 static struct _rdm_multi_data *rdm_data_current[DMX_MAX_OUT] ALIGNED;
-static volatile _tx_rx_state rdm_receive_state[DMX_MAX_OUT] ALIGNED = { IDLE, };
+static volatile _tx_rx_state receive_state[DMX_MAX_OUT] ALIGNED = { IDLE, };
 static volatile uint32_t rdm_data_write_index[DMX_MAX_OUT] ALIGNED = { 0, };
 static volatile uint32_t rdm_data_read_index[DMX_MAX_OUT] ALIGNED = { 0, };
 
+static struct _dmx_data dmx_data_in[DMX_MAX_OUT][DMX_DATA_IN_INDEX_ENTRIES] ALIGNED;
+static volatile uint32_t dmx_data_in_write_index[DMX_MAX_OUT] ALIGNED = { 0, };
+static volatile uint32_t dmx_data_in_read_index[DMX_MAX_OUT] ALIGNED = { 0, };
+static volatile uint32_t dmx_data_in_slot_index[DMX_MAX_OUT] ALIGNED;
+static volatile uint32_t dmx_data_in_break_micros[DMX_MAX_OUT] ALIGNED;
+static volatile uint32_t dmx_data_in_break_micros_previous[DMX_MAX_OUT] ALIGNED;
+static volatile uint32_t dmx_data_in_start_micros[DMX_MAX_OUT] ALIGNED;
+static volatile uint32_t dmx_data_in_slot_micros[DMX_MAX_OUT] ALIGNED;
+static volatile bool dmx_data_in_is_previous_break_dmx[DMX_MAX_OUT] ALIGNED;
+
+static volatile struct _total_statistics total_statistics[DMX_MAX_OUT] ALIGNED;
+static volatile uint32_t dmx_updates_per_seconde[DMX_MAX_OUT] ALIGNED;
+static uint32_t dmx_packets_previous[DMX_MAX_OUT] ALIGNED;
+
 static volatile _uart_state uart_state[DMX_MAX_OUT] ALIGNED;
 static volatile uint32_t uarts_sending = 0;
 
@@ -298,45 +316,123 @@ static void irq_timer0_dmx_multi_sender(uint32_t clo) {
 #endif
 }
 
-static void fiq_rdm_in_handler(uint8_t uart, const H3_UART_TypeDef *u) {
+/**
+ * Timer 1 interrupt DMX Receiver
+ * Statistics
+ */
+static void irq_timer1_dmx_multi_statistics(uint32_t clo) {
+	uint32_t i;
+
+	dmb();
+
+	for (i = 0; i < DMX_MAX_OUT; i++) {
+		dmx_updates_per_seconde[i] = total_statistics[i].dmx_packets - dmx_packets_previous[i];
+		dmx_packets_previous[i] = total_statistics[i].dmx_packets;
+	}
+}
+
+/*
+ * A DMX512 packet is completed on the last slot, on the next BREAK, or by
+ * dmx_multi_get_available after DMX_DATA_IN_IDLE_TIMEOUT.
+ */
+static void dmx_multi_data_in_end(uint8_t uart) {
+	struct _dmx_data *p = &dmx_data_in[uart][dmx_data_in_write_index[uart]];
+	const uint32_t slots = dmx_data_in_slot_index[uart] - 1;
+
+	p->statistics.slots_in_packet = slots;
+	p->statistics.slot_to_slot = (slots > 1) ? (dmx_data_in_slot_micros[uart] - dmx_data_in_start_micros[uart]) / (slots - 1) : 0;
+
+	const uint32_t next = (dmx_data_in_write_index[uart] + 1) & DMX_DATA_IN_INDEX_MASK;
+
+	// When the ring buffer is full, the packet is overwritten by the next one
+	if (next != dmx_data_in_read_index[uart]) {
+		dmx_data_in_write_index[uart] = next;
+	}
+
+	receive_state[uart] = IDLE;
+	dmb();
+}
+
+/*
+ * The RX FIFO is drained on each interrupt. The BREAK is received as a 0x00
+ * with UART_LSR_BI set. The timestamps are per interrupt, so the slot to slot
+ * time is the average over the packet.
+ */
+static void fiq_in_handler(uint8_t uart, const H3_UART_TypeDef *u) {
+	const uint32_t micros = h3_hs_timer_lo_us();
+	uint32_t lsr;
 	uint16_t index;
 
 	isb();
 
-	if (u->LSR & UART_LSR_BI) {
-		rdm_receive_state[uart] = PRE_BREAK;
-	} else {
+	while ((lsr = u->LSR) & UART_LSR_DR) {
 		const uint8_t data = u->O00.RBR;
 
-		switch (rdm_receive_state[uart]) {
+		if (lsr & UART_LSR_BI) {
+			if (receive_state[uart] == DMXDATA) {
+				dmx_multi_data_in_end(uart);
+			}
+
+			dmx_data_in_break_micros[uart] = micros;
+			receive_state[uart] = BREAK;
+			continue;
+		}
+
+		switch (receive_state[uart]) {
 		case IDLE:
 			if (data == 0xFE) {
 				rdm_data_current[uart]->data[0] = 0xFE;
 				rdm_data_current[uart]->index = 1;
 
-				rdm_receive_state[uart] = RDMDISCFE;
+				receive_state[uart] = RDMDISCFE;
 			}
 			break;
-		case PRE_BREAK:
-			rdm_receive_state[uart] = BREAK;
-			break;
 		case BREAK:
 			switch (data) {
+			case DMX512_START_CODE:
+				dmx_data_in[uart][dmx_data_in_write_index[uart]].data[0] = DMX512_START_CODE;
+				dmx_data_in_slot_index[uart] = 1;
+				dmx_data_in_start_micros[uart] = micros;
+				total_statistics[uart].dmx_packets = total_statistics[uart].dmx_packets + 1;
+
+				if (dmx_data_in_is_previous_break_dmx[uart]) {
+					dmx_data_in[uart][dmx_data_in_write_index[uart]].statistics.break_to_break = dmx_data_in_break_micros[uart] - dmx_data_in_break_micros_previous[uart];
+				} else {
+					dmx_data_in_is_previous_break_dmx[uart] = true;
+				}
+
+				dmx_data_in_break_micros_previous[uart] = dmx_data_in_break_micros[uart];
+
+				receive_state[uart] = DMXDATA;
+				break;
 			case E120_SC_RDM:
 				rdm_data_current[uart]->data[0] = E120_SC_RDM;
 				rdm_data_current[uart]->checksum = E120_SC_RDM;
 				rdm_data_current[uart]->index = 1;
+				total_statistics[uart].rdm_packets = total_statistics[uart].rdm_packets + 1;
+				dmx_data_in_is_previous_break_dmx[uart] = false;
 
-				rdm_receive_state[uart] = RDMDATA;
+				receive_state[uart] = RDMDATA;
 				break;
 			default:
-				rdm_receive_state[uart] = IDLE;
+				dmx_data_in_is_previous_break_dmx[uart] = false;
+				receive_state[uart] = IDLE;
 				break;
 			}
 			break;
+		case DMXDATA:
+			index = (uint16_t) dmx_data_in_slot_index[uart];
+			dmx_data_in[uart][dmx_data_in_write_index[uart]].data[index] = data;
+			dmx_data_in_slot_index[uart] = index + 1;
+			dmx_data_in_slot_micros[uart] = micros;
+
+			if (index == DMX_MAX_CHANNELS) {
+				dmx_multi_data_in_end(uart);
+			}
+			break;
 		case RDMDATA:
 			if (rdm_data_current[uart]->index > RDM_DATA_BUFFER_SIZE) {
-				rdm_receive_state[uart] = IDLE;
+				receive_state[uart] = IDLE;
 			} else {
 				index = rdm_data_current[uart]->index;
 				rdm_data_current[uart]->data[index] = data;
@@ -347,7 +443,7 @@ static void fiq_rdm_in_handler(uint8_t uart, const H3_UART_TypeDef *u) {
 				const struct _rdm_command *p = (struct _rdm_command *)(&rdm_data_current[uart]->data[0]);
 
 				if (rdm_data_current[uart]->index == p->message_length) {
-					rdm_receive_state[uart] = CHECKSUMH;
+					receive_state[uart] = CHECKSUMH;
 				}
 			}
 			break;
@@ -358,7 +454,7 @@ static void fiq_rdm_in_handler(uint8_t uart, const H3_UART_TypeDef *u) {
 
 			rdm_data_current[uart]->checksum -= data << 8;
 
-			rdm_receive_state[uart] = CHECKSUML;
+			receive_state[uart] = CHECKSUML;
 			break;
 		case CHECKSUML:
 			index = rdm_data_current[uart]->index;
@@ -375,7 +471,7 @@ static void fiq_rdm_in_handler(uint8_t uart, const H3_UART_TypeDef *u) {
 				rdm_data_current[uart] = &rdm_data[uart][rdm_data_write_index[uart]];
 			}
 
-			rdm_receive_state[uart] = IDLE;
+			receive_state[uart] = IDLE;
 			break;
 		case RDMDISCFE:
 			index = rdm_data_current[uart]->index;
@@ -385,7 +481,7 @@ static void fiq_rdm_in_handler(uint8_t uart, const H3_UART_TypeDef *u) {
 			if ((data == 0xAA) || (rdm_data_current[uart]->index == 9)) {
 				rdm_data_current[uart]->disc_index = 0;
 
-				rdm_receive_state[uart] = RDMDISCEUID;
+				receive_state[uart] = RDMDISCEUID;
 			}
 			break;
 		case RDMDISCEUID:
@@ -398,7 +494,7 @@ static void fiq_rdm_in_handler(uint8_t uart, const H3_UART_TypeDef *u) {
 			if (rdm_data_current[uart]->disc_index == 2 * RDM_UID_SIZE) {
 				rdm_data_current[uart]->disc_index = 0;
 
-				rdm_receive_state[uart] = RDMDISCECS;
+				receive_state[uart] = RDMDISCECS;
 			}
 			break;
 		case RDMDISCECS:
@@ -413,12 +509,12 @@ static void fiq_rdm_in_handler(uint8_t uart, const H3_UART_TypeDef *u) {
 				dmb();
 				rdm_data_current[uart] = &rdm_data[uart][rdm_data_write_index[uart]];
 
-				rdm_receive_state[uart] = IDLE;
+				receive_state[uart] = IDLE;
 			}
 
 			break;
 		default:
-			rdm_receive_state[uart] = IDLE;
+			receive_state[uart] = IDLE;
 			break;
 		}
 	}
@@ -465,27 +561,32 @@ static void __attribute__((interrupt("FIQ"))) fiq_dmx_multi(void) {
 		}
 	}
 
-	// Single 'threaded', there is just a single RDM process
+	// All the input ports can receive at the same time, each RX FIFO is drained
 
 	if (H3_UART1->O08.IIR & UART_IIR_IID_RD) {
-		fiq_rdm_in_handler(1, (H3_UART_TypeDef *) H3_UART1_BASE);
+		fiq_in_handler(1, (H3_UART_TypeDef *) H3_UART1_BASE);
 		H3_GIC_CPUIF->EOI = H3_UART1_IRQn;
 		gic_unpend(H3_UART1_IRQn);
-	} else if (H3_UART2->O08.IIR & UART_IIR_IID_RD) {
-		fiq_rdm_in_handler(2, (H3_UART_TypeDef *) H3_UART2_BASE);
+	}
+
+	if (H3_UART2->O08.IIR & UART_IIR_IID_RD) {
+		fiq_in_handler(2, (H3_UART_TypeDef *) H3_UART2_BASE);
 		H3_GIC_CPUIF->EOI = H3_UART2_IRQn;
 		gic_unpend(H3_UART2_IRQn);
 	}
 #if defined (ORANGE_PI_ONE)
-	else if (H3_UART3->O08.IIR & UART_IIR_IID_RD) {
-		fiq_rdm_in_handler(3, (H3_UART_TypeDef *) H3_UART3_BASE);
+	if (H3_UART3->O08.IIR & UART_IIR_IID_RD) {
+		fiq_in_handler(3, (H3_UART_TypeDef *) H3_UART3_BASE);
 		H3_GIC_CPUIF->EOI = H3_UART3_IRQn;
 		gic_unpend(H3_UART3_IRQn);
-	} else if (H3_UART0->O08.IIR & UART_IIR_IID_RD) {
-		fiq_rdm_in_handler(0, (H3_UART_TypeDef *) H3_UART0_BASE);
+	}
+ #ifndef DO_NOT_USE_UART0
+	if (H3_UART0->O08.IIR & UART_IIR_IID_RD) {
+		fiq_in_handler(0, (H3_UART_TypeDef *) H3_UART0_BASE);
 		H3_GIC_CPUIF->EOI = H3_UART0_IRQn;
 		gic_unpend(H3_UART0_IRQn);
 	}
+ #endif
 #endif
 
 #ifdef LOGIC_ANALYZER
@@ -504,12 +605,13 @@ static void uart_enable_fifo(uint8_t uart) {	// DMX TX
 	isb();
 }
 
-static void uart_disable_fifo(uint8_t uart) {	// RDM RX
+static void uart_enable_rx_fifo(uint8_t uart) {	// DMX/RDM RX
 	H3_UART_TypeDef *p = _get_uart(uart);
 
 	assert(p != 0);
 
-	p->O08.FCR = 0;
+	// Interrupt at 1/4 full or on character time-out
+	p->O08.FCR = UART_FCR_EFIFO | UART_FCR_RRESET | UART_FCR_TRIG1;
 	p->O04.IER = UART_IER_ERBFI;
 	isb();
 }
@@ -599,7 +701,8 @@ static void dmx_multi_start_data(uint8_t uart) {
 		uart_state[uart] = UART_STATE_TX;
 		break;
 	case DMX_PORT_DIRECTION_INP:
-		rdm_receive_state[uart] = IDLE;
+		receive_state[uart] = IDLE;
+		dmx_data_in_is_previous_break_dmx[uart] = false;
 
 		H3_UART_TypeDef *p = _get_uart(uart);
 
@@ -607,7 +710,7 @@ static void dmx_multi_start_data(uint8_t uart) {
 			(void) p->O00.RBR;
 		}
 
-		uart_disable_fifo(uart);
+		uart_enable_rx_fifo(uart);
 		dmb();
 		uart_state[uart] = UART_STATE_RX;
 		break;
@@ -701,6 +804,47 @@ const uint8_t *dmx_multi_rdm_get_available(uint8_t uart)  {
 	}
 }
 
+const uint8_t *dmx_multi_get_available(uint8_t uart)  {
+	dmb();
+
+	if (receive_state[uart] == DMXDATA) {
+		__disable_fiq();
+
+		if ((receive_state[uart] == DMXDATA) && ((h3_hs_timer_lo_us() - dmx_data_in_slot_micros[uart]) > DMX_DATA_IN_IDLE_TIMEOUT)) {
+			dmx_multi_data_in_end(uart);
+		}
+
+		__enable_fiq();
+	}
+
+	if (dmx_data_in_write_index[uart] == dmx_data_in_read_index[uart]) {
+		return NULL;
+	} else {
+		const uint8_t *p = dmx_data_in[uart][dmx_data_in_read_index[uart]].data;
+		dmx_data_in_read_index[uart] = (dmx_data_in_read_index[uart] + 1) & DMX_DATA_IN_INDEX_MASK;
+		return p;
+	}
+}
+
+const uint8_t *dmx_multi_get_current_data(uint8_t uart) {
+	return dmx_data_in[uart][dmx_data_in_read_index[uart]].data;
+}
+
+uint32_t dmx_multi_get_updates_per_seconde(uint8_t uart) {
+	dmb();
+	return dmx_updates_per_seconde[uart];
+}
+
+const volatile struct _total_statistics *dmx_multi_get_total_statistics(uint8_t uart) {
+	return &total_statistics[uart];
+}
+
+void dmx_multi_reset_total_statistics(uint8_t uart) {
+	total_statistics[uart].dmx_packets = 0;
+	total_statistics[uart].rdm_packets = 0;
+	dmx_packets_previous[uart] = 0;
+}
+
 uint32_t dmx_multi_get_output_break_time(void) {
 	return dmx_output_break_time;
 }
@@ -764,7 +908,18 @@ void dmx_multi_init(void) {
 		rdm_data_write_index[i] = 0;
 		rdm_data_read_index[i] = 0;
 		rdm_data_current[i] = &rdm_data[i][0];
-		rdm_receive_state[i] = IDLE;
+		receive_state[i] = IDLE;
+		// DMX RX
+		dmx_data_in_write_index[i] = 0;
+		dmx_data_in_read_index[i] = 0;
+		dmx_data_in_slot_index[i] = 0;
+		dmx_data_in_is_previous_break_dmx[i] = false;
+		memset(dmx_data_in[i], 0, sizeof(dmx_data_in[i]));
+		// Statistics
+		total_statistics[i].dmx_packets = 0;
+		total_statistics[i].rdm_packets = 0;
+		dmx_updates_per_seconde[i] = 0;
+		dmx_packets_previous[i] = 0;
 	}
 
 	/*
@@ -840,6 +995,11 @@ void dmx_multi_init(void) {
 	H3_TIMER->TMR0_INTV = 12000; // Wait 1ms
 	H3_TIMER->TMR0_CTRL |= (TIMER_CTRL_EN_START | TIMER_CTRL_RELOAD); // 0x3;
 
+	irq_timer_set(IRQ_TIMER_1, irq_timer1_dmx_multi_statistics);
+	H3_TIMER->TMR1_INTV = 0xB71B00; // 1 second
+	H3_TIMER->TMR1_CTRL &= ~(TIMER_CTRL_SINGLE_MODE);
+	H3_TIMER->TMR1_CTRL |= (TIMER_CTRL_EN_START | TIMER_CTRL_RELOAD); // 0x3;
+
 	H3_CCU->BUS_SOFT_RESET0 |= CCU_BUS_SOFT_RESET0_DMA;
 	H3_CCU->BUS_CLK_GATING0 |= CCU_BUS_CLK_GATING0_DMA;
 
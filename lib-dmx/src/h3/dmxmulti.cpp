@@ -107,3 +107,27 @@ const uint8_t* DmxMulti::RdmReceiveTimeOut(uint8_t nPort, uint32_t nTimeOut) {
 
 	return (const uint8_t *) p;
 }
+
+const uint8_t *DmxMulti::GetDmxAvailable(uint8_t nPort) {
+	assert(nPort < DMX_MAX_OUT);
+
+	return dmx_multi_get_available(_port_to_uart(nPort));
+}
+
+const uint8_t *DmxMulti::GetDmxCurrentData(uint8_t nPort) {
+	assert(nPort < DMX_MAX_OUT);
+
+	return dmx_multi_get_current_data(_port_to_uart(nPort));
+}
+
+uint32_t DmxMulti::GetUpdatesPerSecond(uint8_t nPort) {
+	assert(nPort < DMX_MAX_OUT);
+
+	return dmx_multi_get_updates_per_seconde(_port_to_uart(nPort));
+}
+
+const volatile struct _total_statistics *DmxMulti::GetTotalStatistics(uint8_t nPort) {
+	assert(nPort < DMX_MAX_OUT);
+
+	return dmx_multi_get_total_statistics(_port_to_uart(nPort));
+}
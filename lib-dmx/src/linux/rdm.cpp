@@ -0,0 +1,87 @@
+/**
+ * @file rdm.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <assert.h>
+
+#include "rdm.h"
+
+#include "dmx_uarts.h"
+
+#include "linux/rdmsimulator.h"
+
+/*
+ * All ports share the one simulated line
+ */
+
+uint8_t Rdm::m_TransactionNumber = 0;
+
+Rdm::Rdm(void) {
+	assert(RDMSimulator::Get() != 0);
+}
+
+Rdm::~Rdm(void) {
+
+}
+
+const uint8_t *Rdm::Receive(uint8_t nPort) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	return RDMSimulator::Get()->Receive();
+}
+
+const uint8_t *Rdm::ReceiveTimeOut(uint8_t nPort, uint32_t nTimeOut) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	return RDMSimulator::Get()->ReceiveTimeOut(nTimeOut);
+}
+
+void Rdm::Send(uint8_t nPort, struct TRdmMessage *pRdmCommand) {
+	assert(pRdmCommand != 0);
+
+	pRdmCommand->transaction_number = m_TransactionNumber;
+
+	Checksum((uint8_t *) pRdmCommand);
+
+	SendRaw(nPort, (const uint8_t *)pRdmCommand, pRdmCommand->message_length + RDM_MESSAGE_CHECKSUM_SIZE);
+
+	m_TransactionNumber++;
+}
+
+void Rdm::SendRaw(uint8_t nPort, const uint8_t *pRdmData, uint16_t nLength) {
+	assert(nPort < DMX_MAX_UARTS);
+	assert(pRdmData != 0);
+	assert(nLength != 0);
+
+	RDMSimulator::Get()->Send(pRdmData, nLength);
+}
+
+void Rdm::SendRawRespondMessage(uint8_t nPort, const uint8_t *pRdmData, uint16_t nLength) {
+	SendRaw(nPort, pRdmData, nLength);
+}
+
+void Rdm::SendDiscoveryRespondMessage(const uint8_t *pRdmData, uint16_t nLength) {
+	SendRaw(0, pRdmData, nLength);
+}
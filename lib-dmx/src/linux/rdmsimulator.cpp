@@ -0,0 +1,483 @@
+/**
+ * @file rdmsimulator.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "linux/rdmsimulator.h"
+
+#include "rdm.h"
+#include "rdm_e120.h"
+
+#include "debug.h"
+
+#define DISCOVERY_RESPONSE_SIZE		(sizeof(struct TRdmDiscoveryMsg))
+
+RDMSimulator *RDMSimulator::s_pThis = 0;
+
+static bool is_valid(const uint8_t *pRdmData, uint16_t nLength) {
+	const uint32_t nMessageLength = ((const struct TRdmMessage *) pRdmData)->message_length;
+
+	if ((nMessageLength < RDM_MESSAGE_MINIMUM_SIZE) || (nLength < (nMessageLength + RDM_MESSAGE_CHECKSUM_SIZE))) {
+		return false;
+	}
+
+	if (((const struct TRdmMessage *) pRdmData)->param_data_length != (nMessageLength - RDM_MESSAGE_MINIMUM_SIZE)) {
+		return false;
+	}
+
+	uint16_t nChecksum = 0;
+
+	for (uint32_t i = 0; i < nMessageLength; i++) {
+		nChecksum += pRdmData[i];
+	}
+
+	return (pRdmData[nMessageLength] == (uint8_t) (nChecksum >> 8)) && (pRdmData[nMessageLength + 1] == (uint8_t) (nChecksum & 0xFF));
+}
+
+/*
+ * 7.5 Discovery Unique Branch Message, the response is sent without a break
+ */
+static void encode_discovery_response(const uint8_t *pUid, struct TRdmDiscoveryMsg *p) {
+	uint16_t nChecksum = 6 * 0xFF;
+
+	for (uint32_t i = 0; i < sizeof(p->header_FE); i++) {
+		p->header_FE[i] = 0xFE;
+	}
+
+	p->header_AA = 0xAA;
+
+	for (uint32_t i = 0; i < RDM_UID_SIZE; i++) {
+		p->masked_device_id[i + i] = pUid[i] | 0xAA;
+		p->masked_device_id[i + i + 1] = pUid[i] | 0x55;
+		nChecksum += pUid[i];
+	}
+
+	p->checksum[0] = (uint8_t) (nChecksum >> 8) | 0xAA;
+	p->checksum[1] = (uint8_t) (nChecksum >> 8) | 0x55;
+	p->checksum[2] = (uint8_t) (nChecksum & 0xFF) | 0xAA;
+	p->checksum[3] = (uint8_t) (nChecksum & 0xFF) | 0x55;
+}
+
+RDMSimulator::RDMSimulator(uint32_t nSeed):
+	m_pResponders(0),
+	m_nResponders(0),
+	m_pHandler(0),
+	m_nRandom(nSeed == 0 ? 1 : nSeed),
+	m_nMicros(0),
+	m_nIdleMicros(0),
+	m_nResponseMicros(0),
+	m_bIsResponse(false)
+{
+	DEBUG_ENTRY
+
+	assert(s_pThis == 0);
+	s_pThis = this;
+
+	m_pResponders = new struct TRdmSimulatorResponder[RDM_SIMULATOR_RESPONDERS_MAX];
+	assert(m_pResponders != 0);
+
+	ResetStatistics();
+
+	DEBUG_EXIT
+}
+
+RDMSimulator::~RDMSimulator(void) {
+	DEBUG_ENTRY
+
+	delete [] m_pResponders;
+	m_pResponders = 0;
+
+	s_pThis = 0;
+
+	DEBUG_EXIT
+}
+
+bool RDMSimulator::AddResponder(const uint8_t *pUid, uint16_t nTurnaround) {
+	assert(pUid != 0);
+
+	if (m_nResponders == RDM_SIMULATOR_RESPONDERS_MAX) {
+		return false;
+	}
+
+	if (memcmp(&pUid[2], &UID_ALL[2], RDM_UID_SIZE - 2) == 0) {
+		return false;
+	}
+
+	const uint32_t nIndex = LowerBound(pUid);
+
+	if ((nIndex < m_nResponders) && (memcmp(m_pResponders[nIndex].aUid, pUid, RDM_UID_SIZE) == 0)) {
+		return false;
+	}
+
+	memmove(&m_pResponders[nIndex + 1], &m_pResponders[nIndex], (m_nResponders - nIndex) * sizeof(struct TRdmSimulatorResponder));
+
+	memcpy(m_pResponders[nIndex].aUid, pUid, RDM_UID_SIZE);
+	m_pResponders[nIndex].nTurnaround = nTurnaround;
+	m_pResponders[nIndex].bIsMuted = false;
+
+	m_nResponders++;
+
+	return true;
+}
+
+uint32_t RDMSimulator::AddResponders(uint16_t nManufacturerId, uint32_t nCount, uint16_t nTurnaroundMin, uint16_t nTurnaroundMax) {
+	assert(nTurnaroundMin <= nTurnaroundMax);
+
+	uint32_t nAdded = 0;
+
+	while ((nAdded < nCount) && (m_nResponders < RDM_SIMULATOR_RESPONDERS_MAX)) {
+		const uint32_t nDeviceId = Random();
+		const uint8_t aUid[RDM_UID_SIZE] = {
+				(uint8_t) (nManufacturerId >> 8), (uint8_t) nManufacturerId,
+				(uint8_t) (nDeviceId >> 24), (uint8_t) (nDeviceId >> 16), (uint8_t) (nDeviceId >> 8), (uint8_t) nDeviceId };
+		const uint16_t nTurnaround = nTurnaroundMin + (uint16_t) (Random() % (uint32_t) (nTurnaroundMax - nTurnaroundMin + 1));
+
+		if (AddResponder(aUid, nTurnaround)) {
+			nAdded++;
+		}
+	}
+
+	return nAdded;
+}
+
+void RDMSimulator::Clear(void) {
+	m_nResponders = 0;
+	m_bIsResponse = false;
+}
+
+void RDMSimulator::ResetStatistics(void) {
+	memset(&m_tStatistics, 0, sizeof(struct TRdmSimulatorStatistics));
+}
+
+void RDMSimulator::Send(const uint8_t *pRdmData, uint16_t nLength) {
+	assert(pRdmData != 0);
+
+	// A new request, a late response is lost
+	m_bIsResponse = false;
+
+	// 3.2.1 Controller Packet spacing
+	if (m_nMicros < (m_nIdleMicros + RDM_SIMULATOR_CONTROLLER_SPACING)) {
+		m_nMicros = m_nIdleMicros + RDM_SIMULATOR_CONTROLLER_SPACING;
+	}
+
+	m_nMicros += RDM_TRANSMIT_BREAK_TIME + RDM_TRANSMIT_MAB_TIME + (uint64_t) nLength * RDM_SIMULATOR_SLOT_TIME;
+	m_nIdleMicros = m_nMicros;
+
+	if ((nLength < (RDM_MESSAGE_MINIMUM_SIZE + RDM_MESSAGE_CHECKSUM_SIZE)) || (pRdmData[0] != E120_SC_RDM) || (pRdmData[1] != E120_SC_SUB_MESSAGE)) {
+		return;
+	}
+
+	if (!is_valid(pRdmData, nLength)) {
+		m_tStatistics.nInvalid++;
+		return;
+	}
+
+	const struct TRdmMessage *pRequest = (const struct TRdmMessage *) pRdmData;
+
+	// Responses from other controllers or responders on the line are ignored
+	if ((pRequest->command_class != E120_DISCOVERY_COMMAND) && (pRequest->command_class != E120_GET_COMMAND) && (pRequest->command_class != E120_SET_COMMAND)) {
+		return;
+	}
+
+	m_tStatistics.nRequests++;
+
+	const bool bIsBroadcast = (memcmp(&pRequest->destination_uid[2], &UID_ALL[2], RDM_UID_SIZE - 2) == 0);
+	int32_t nIndex = -1;
+
+	if (!bIsBroadcast) {
+		if ((nIndex = Find(pRequest->destination_uid)) < 0) {
+			return;
+		}
+	}
+
+	if (pRequest->command_class == E120_DISCOVERY_COMMAND) {
+		HandleDiscovery(pRequest, bIsBroadcast, nIndex);
+	} else {
+		HandleCommand(pRequest, bIsBroadcast, nIndex);
+	}
+}
+
+/*
+ * The controller is assumed to wait for a pending response, the virtual time advances to its end
+ */
+const uint8_t *RDMSimulator::Receive(void) {
+	if (!m_bIsResponse) {
+		return 0;
+	}
+
+	if (m_nMicros < m_nResponseMicros) {
+		m_nMicros = m_nResponseMicros;
+	}
+
+	m_bIsResponse = false;
+	m_tStatistics.nResponses++;
+
+	return m_aResponse;
+}
+
+const uint8_t *RDMSimulator::ReceiveTimeOut(uint32_t nTimeOut) {
+	if (m_bIsResponse && (m_nResponseMicros <= (m_nMicros + nTimeOut))) {
+		return Receive();
+	}
+
+	m_nMicros += nTimeOut;
+	m_tStatistics.nTimeOuts++;
+
+	return 0;
+}
+
+void RDMSimulator::HandleDiscovery(const struct TRdmMessage *pRequest, bool bIsBroadcast, int32_t nIndex) {
+	const uint16_t nParamId = (uint16_t) ((pRequest->param_id[0] << 8) | pRequest->param_id[1]);
+
+	if (nParamId == E120_DISC_UNIQUE_BRANCH) {
+		if (bIsBroadcast && (pRequest->param_data_length == 2 * RDM_UID_SIZE)) {
+			HandleDiscUniqueBranch(pRequest);
+		}
+		return;
+	}
+
+	if (((nParamId != E120_DISC_MUTE) && (nParamId != E120_DISC_UN_MUTE)) || (pRequest->param_data_length != 0)) {
+		return;
+	}
+
+	const bool bIsMuted = (nParamId == E120_DISC_MUTE);
+
+	if (bIsMuted) {
+		m_tStatistics.nMute++;
+	} else {
+		m_tStatistics.nUnMute++;
+	}
+
+	if (bIsBroadcast) {
+		const bool bIsVendorcast = (memcmp(pRequest->destination_uid, UID_ALL, 2) != 0);
+
+		for (uint32_t i = 0; i < m_nResponders; i++) {
+			if (!bIsVendorcast || (memcmp(m_pResponders[i].aUid, pRequest->destination_uid, 2) == 0)) {
+				m_pResponders[i].bIsMuted = bIsMuted;
+			}
+		}
+
+		return;
+	}
+
+	struct TRdmSimulatorResponder *pResponder = &m_pResponders[nIndex];
+	struct TRdmMessage *pResponse = (struct TRdmMessage *) m_aResponse;
+
+	pResponder->bIsMuted = bIsMuted;
+
+	pResponse->start_code = E120_SC_RDM;
+	pResponse->sub_start_code = E120_SC_SUB_MESSAGE;
+	pResponse->message_length = RDM_MESSAGE_MINIMUM_SIZE + 2;
+	memcpy(pResponse->destination_uid, pRequest->source_uid, RDM_UID_SIZE);
+	memcpy(pResponse->source_uid, pResponder->aUid, RDM_UID_SIZE);
+	pResponse->transaction_number = pRequest->transaction_number;
+	pResponse->slot16.response_type = E120_RESPONSE_TYPE_ACK;
+	pResponse->message_count = 0;
+	pResponse->sub_device[0] = 0;
+	pResponse->sub_device[1] = 0;
+	pResponse->command_class = E120_DISCOVERY_COMMAND_RESPONSE;
+	pResponse->param_id[0] = pRequest->param_id[0];
+	pResponse->param_id[1] = pRequest->param_id[1];
+	pResponse->param_data_length = 2;
+	pResponse->param_data[0] = 0x00;	// Control Field
+	pResponse->param_data[1] = 0x00;	// Control Field
+
+	Rdm::Checksum(m_aResponse);
+
+	Respond(pResponder, m_aResponse);
+}
+
+void RDMSimulator::HandleDiscUniqueBranch(const struct TRdmMessage *pRequest) {
+	const uint8_t *pLower = pRequest->param_data;
+	const uint8_t *pUpper = pRequest->param_data + RDM_UID_SIZE;
+	struct TRdmDiscoveryMsg *pResponse = (struct TRdmDiscoveryMsg *) m_aResponse;
+	struct TRdmDiscoveryMsg tFrame;
+	uint32_t nCount = 0;
+	uint16_t nTurnaroundMax = 0;
+
+	m_tStatistics.nDiscUniqueBranch++;
+
+	for (uint32_t i = LowerBound(pLower); (i < m_nResponders) && (memcmp(m_pResponders[i].aUid, pUpper, RDM_UID_SIZE) <= 0); i++) {
+		const struct TRdmSimulatorResponder *pResponder = &m_pResponders[i];
+
+		if (pResponder->bIsMuted) {
+			continue;
+		}
+
+		if (nCount++ == 0) {
+			encode_discovery_response(pResponder->aUid, pResponse);
+		} else {
+			encode_discovery_response(pResponder->aUid, &tFrame);
+
+			for (uint32_t j = 0; j < DISCOVERY_RESPONSE_SIZE; j++) {
+				m_aResponse[j] &= ((const uint8_t *) &tFrame)[j];
+			}
+		}
+
+		if (pResponder->nTurnaround > nTurnaroundMax) {
+			nTurnaroundMax = pResponder->nTurnaround;
+		}
+	}
+
+	if (nCount == 0) {
+		return;
+	}
+
+	if (nCount > 1) {
+		m_tStatistics.nCollisions++;
+	}
+
+	// The line is busy until the slowest responder has finished
+	m_nResponseMicros = m_nMicros + nTurnaroundMax + DISCOVERY_RESPONSE_SIZE * RDM_SIMULATOR_SLOT_TIME;
+	m_nIdleMicros = m_nResponseMicros;
+	m_bIsResponse = true;
+}
+
+void RDMSimulator::HandleCommand(const struct TRdmMessage *pRequest, bool bIsBroadcast, int32_t nIndex) {
+	const uint8_t *pRdmDataNoSC = (const uint8_t *) pRequest + 1;
+
+	if (bIsBroadcast) {
+		if (m_pHandler == 0) {
+			return;
+		}
+
+		const bool bIsVendorcast = (memcmp(pRequest->destination_uid, UID_ALL, 2) != 0);
+
+		for (uint32_t i = 0; i < m_nResponders; i++) {
+			if (!bIsVendorcast || (memcmp(m_pResponders[i].aUid, pRequest->destination_uid, 2) == 0)) {
+				m_pHandler->Handler(m_pResponders[i].aUid, pRdmDataNoSC);
+			}
+		}
+
+		return;
+	}
+
+	const struct TRdmSimulatorResponder *pResponder = &m_pResponders[nIndex];
+
+	if (m_pHandler != 0) {
+		const uint8_t *pResponse = m_pHandler->Handler(pResponder->aUid, pRdmDataNoSC);
+
+		if (pResponse != 0) {
+			Respond(pResponder, pResponse);
+		}
+
+		return;
+	}
+
+	struct TRdmMessage *pResponse = (struct TRdmMessage *) m_aResponse;
+
+	pResponse->start_code = E120_SC_RDM;
+	pResponse->sub_start_code = E120_SC_SUB_MESSAGE;
+	pResponse->message_length = RDM_MESSAGE_MINIMUM_SIZE + 2;
+	memcpy(pResponse->destination_uid, pRequest->source_uid, RDM_UID_SIZE);
+	memcpy(pResponse->source_uid, pResponder->aUid, RDM_UID_SIZE);
+	pResponse->transaction_number = pRequest->transaction_number;
+	pResponse->slot16.response_type = E120_RESPONSE_TYPE_NACK_REASON;
+	pResponse->message_count = 0;
+	pResponse->sub_device[0] = pRequest->sub_device[0];
+	pResponse->sub_device[1] = pRequest->sub_device[1];
+	pResponse->command_class = pRequest->command_class + 1;
+	pResponse->param_id[0] = pRequest->param_id[0];
+	pResponse->param_id[1] = pRequest->param_id[1];
+	pResponse->param_data_length = 2;
+	pResponse->param_data[0] = (uint8_t) (E120_NR_UNKNOWN_PID >> 8);
+	pResponse->param_data[1] = (uint8_t) E120_NR_UNKNOWN_PID;
+
+	Rdm::Checksum(m_aResponse);
+
+	Respond(pResponder, m_aResponse);
+}
+
+void RDMSimulator::Respond(const struct TRdmSimulatorResponder *pResponder, const uint8_t *pResponse) {
+	const uint32_t nLength = ((const struct TRdmMessage *) pResponse)->message_length + RDM_MESSAGE_CHECKSUM_SIZE;
+
+	if (pResponse != m_aResponse) {
+		memcpy(m_aResponse, pResponse, nLength);
+	}
+
+	m_nResponseMicros = m_nMicros + pResponder->nTurnaround + RDM_TRANSMIT_BREAK_TIME + RDM_TRANSMIT_MAB_TIME + nLength * RDM_SIMULATOR_SLOT_TIME;
+	m_nIdleMicros = m_nResponseMicros;
+	m_bIsResponse = true;
+}
+
+uint32_t RDMSimulator::LowerBound(const uint8_t *pUid) const {
+	uint32_t nLow = 0;
+	uint32_t nHigh = m_nResponders;
+
+	// The UID is big endian, memcmp gives the numerical order
+	while (nLow < nHigh) {
+		const uint32_t nMiddle = (nLow + nHigh) / 2;
+
+		if (memcmp(m_pResponders[nMiddle].aUid, pUid, RDM_UID_SIZE) < 0) {
+			nLow = nMiddle + 1;
+		} else {
+			nHigh = nMiddle;
+		}
+	}
+
+	return nLow;
+}
+
+int32_t RDMSimulator::Find(const uint8_t *pUid) const {
+	const uint32_t nIndex = LowerBound(pUid);
+
+	if ((nIndex < m_nResponders) && (memcmp(m_pResponders[nIndex].aUid, pUid, RDM_UID_SIZE) == 0)) {
+		return (int32_t) nIndex;
+	}
+
+	return -1;
+}
+
+/*
+ * xorshift32, the same seed gives the same responders
+ */
+uint32_t RDMSimulator::Random(void) {
+	m_nRandom ^= m_nRandom << 13;
+	m_nRandom ^= m_nRandom >> 17;
+	m_nRandom ^= m_nRandom << 5;
+
+	return m_nRandom;
+}
+
+void RDMSimulator::Print(void) {
+	uint32_t nMuted = 0;
+
+	for (uint32_t i = 0; i < m_nResponders; i++) {
+		nMuted += m_pResponders[i].bIsMuted ? 1 : 0;
+	}
+
+	printf("RDM simulator\n");
+	printf(" Responders  : %u (%u muted)\n", (unsigned) m_nResponders, (unsigned) nMuted);
+	printf(" Bus time    : %.3f s\n", (double) m_nMicros / 1000000.0);
+	printf(" Requests    : %u\n", (unsigned) m_tStatistics.nRequests);
+	printf(" DUB         : %u (%u collisions)\n", (unsigned) m_tStatistics.nDiscUniqueBranch, (unsigned) m_tStatistics.nCollisions);
+	printf(" Mute/UnMute : %u/%u\n", (unsigned) m_tStatistics.nMute, (unsigned) m_tStatistics.nUnMute);
+	printf(" Responses   : %u\n", (unsigned) m_tStatistics.nResponses);
+	printf(" Time-outs   : %u\n", (unsigned) m_tStatistics.nTimeOuts);
+	printf(" Invalid     : %u\n", (unsigned) m_tStatistics.nInvalid);
+}
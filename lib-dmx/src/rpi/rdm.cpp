@@ -65,18 +65,9 @@ const uint8_t *Rdm::ReceiveTimeOut(uint8_t nPort, uint32_t nTimeOut) {
 void Rdm::Send(uint8_t nPort, struct TRdmMessage *pRdmCommand) {
 	assert(pRdmCommand != 0);
 
-	uint8_t *rdm_data = (uint8_t *)pRdmCommand;
-	uint32_t i;
-	uint16_t rdm_checksum = 0;
-
 	pRdmCommand->transaction_number = m_TransactionNumber;
 
-	for (i = 0; i < pRdmCommand->message_length; i++) {
-		rdm_checksum += rdm_data[i];
-	}
-
-	rdm_data[i++] = rdm_checksum >> 8;
-	rdm_data[i] = rdm_checksum & 0XFF;
+	Checksum((uint8_t *) pRdmCommand);
 
 	SendRaw(0, (const uint8_t *)pRdmCommand, pRdmCommand->message_length + RDM_MESSAGE_CHECKSUM_SIZE);
 
@@ -2,7 +2,7 @@
  * @file dmxmonitor.h
  *
  */
-/* Copyright (C) 2016-2019 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+/* Copyright (C) 2016-2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -33,6 +33,9 @@
 
 #if defined (__linux__) || defined (__CYGWIN__) || defined(__APPLE__)
  #define DMXMONITOR_MAX_PORTS	4
+
+class DMXRecorder;
+class DMXStatistics;
 #endif
 
 enum TDMXMonitorFormat {
@@ -69,6 +72,12 @@ public:
 #if defined (__linux__) || defined (__CYGWIN__) || defined(__APPLE__)
 	void SetMaxDmxChannels(uint16_t nMaxChannels);
 
+	/*
+	 * When recording or showing statistics, the frames are no longer printed.
+	 */
+	bool SetRecord(const char *pFileName);
+	bool SetStatistics(uint32_t nRefreshMillis);
+
 private:
 	void DisplayDateTime(uint8_t nPortId, const char *pString);
 #endif
@@ -83,6 +92,8 @@ private:
 	bool m_bIsStarted[DMXMONITOR_MAX_PORTS];
 	uint16_t m_nDmxStartAddress;
 	uint16_t m_nMaxChannels;
+	DMXRecorder *m_pRecorder;
+	DMXStatistics *m_pStatistics;
 #else
 	bool m_bIsStarted;
 	alignas(uint32_t) uint8_t m_Data[512];
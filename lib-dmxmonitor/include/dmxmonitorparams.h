@@ -30,11 +30,18 @@
 
 #include "dmxmonitor.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
+#define DMX_MONITOR_RECORD_FILE_LENGTH	64
+
 struct TDMXMonitorParams {
     uint32_t nSetList;
     uint16_t nDmxStartAddress;
     uint16_t nDmxMaxChannels;
     TDMXMonitorFormat tFormat;
+    uint16_t nStatisticsRefresh;
+    char aRecordFile[DMX_MONITOR_RECORD_FILE_LENGTH];
 };
 
 class DMXMonitorParamsStore {
@@ -58,6 +65,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -68,6 +76,7 @@ private:
 private:
     DMXMonitorParamsStore *m_pDMXMonitorParamsStore;
     struct TDMXMonitorParams m_tDMXMonitorParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* DMXMONITORPARAMS_H_ */
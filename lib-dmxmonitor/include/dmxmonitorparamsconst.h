@@ -34,6 +34,8 @@ public:
 
 	alignas(uint32_t) static const char DMX_MAX_CHANNELS[];
 	alignas(uint32_t) static const char FORMAT[];
+	alignas(uint32_t) static const char RECORD[];
+	alignas(uint32_t) static const char STATISTICS[];
 };
 
 #endif /* DMXMONITORPARAMSCONST_H_ */
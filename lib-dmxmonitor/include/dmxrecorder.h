@@ -0,0 +1,108 @@
+/**
+ * @file dmxrecorder.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef DMXRECORDER_H_
+#define DMXRECORDER_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+
+#define DMX_RECORDER_VERSION		1
+#define DMX_RECORDER_BUFFER_SIZE	(1U << 20)	///< Must be a power of 2
+
+/*
+ * Capture file layout, little endian:
+ *  struct TDMXRecorderHeader
+ *  { struct TDMXRecorderFrame, uint8_t aSlots[nLength] } ...
+ * The frame time is relative to the wall clock time in the header.
+ */
+struct TDMXRecorderHeader {
+	char aMagic[6];			///< "DMXREC"
+	uint16_t nVersion;
+	uint32_t nSeconds;
+	uint32_t nMicros;
+}__attribute__((packed));
+
+struct TDMXRecorderFrame {
+	uint32_t nSeconds;
+	uint32_t nMicros;
+	uint8_t nPortId;
+	uint8_t nReserved;
+	uint16_t nLength;
+}__attribute__((packed));
+
+/*
+ * The frames are copied into a ring buffer, a background thread writes the
+ * buffer to the file. When the buffer is full the frame is dropped, the
+ * caller is never blocked by the file system.
+ */
+class DMXRecorder {
+public:
+	DMXRecorder(uint32_t nBufferSize = DMX_RECORDER_BUFFER_SIZE);
+	~DMXRecorder(void);
+
+	bool Start(const char *pFileName);
+	void Stop(void);
+
+	bool IsStarted(void) {
+		return m_pFile != 0;
+	}
+
+	void Record(uint8_t nPortId, const uint8_t *pData, uint16_t nLength, const struct timespec *pTimestamp);
+
+	uint32_t GetFrames(void) {
+		return m_nFrames;
+	}
+
+	uint32_t GetDropped(void) {
+		return m_nDropped;
+	}
+
+	void Print(void);
+
+private:
+	void Copy(const void *pData, uint32_t nLength);
+	void Write(void);
+	static void *Writer(void *p);
+
+private:
+	uint8_t *m_pBuffer;
+	uint32_t m_nBufferMask;
+	uint32_t m_nHead;
+	uint32_t m_nTail;
+	FILE *m_pFile;
+	struct timespec m_Start;
+	uint32_t m_nFrames;
+	uint32_t m_nDropped;
+	uint64_t m_nBytesWritten;
+	bool m_bStop;
+	pthread_t m_Thread;
+	pthread_mutex_t m_Mutex;
+	pthread_cond_t m_Cond;
+};
+
+#endif /* DMXRECORDER_H_ */
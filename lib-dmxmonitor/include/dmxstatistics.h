@@ -0,0 +1,82 @@
+/**
+ * @file dmxstatistics.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef DMXSTATISTICS_H_
+#define DMXSTATISTICS_H_
+
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+
+#define DMX_STATISTICS_MAX_PORTS			4
+#define DMX_STATISTICS_JITTER_BUCKETS		8
+#define DMX_STATISTICS_REFRESH_DEFAULT		1000	///< Milliseconds
+
+struct TDMXStatisticsPort {
+	uint64_t nLastMicros;
+	uint32_t nLastInterval;
+	uint32_t nIntervalMin;
+	uint32_t nIntervalMax;
+	uint32_t nFrames;			///< Since the last refresh
+	uint32_t nChangedFrames;	///< Since the last refresh
+	uint32_t nChangedSlots;		///< Since the last refresh
+	uint32_t nFramesTotal;
+	uint32_t aJitter[DMX_STATISTICS_JITTER_BUCKETS];	///< Since the start
+	uint16_t nLength;
+	uint8_t aData[512];
+};
+
+/*
+ * Update is called for every frame and only does the counting, a background
+ * thread prints the statistics at a fixed rate.
+ * The jitter is the difference between two successive inter-frame intervals.
+ */
+class DMXStatistics {
+public:
+	DMXStatistics(uint32_t nRefreshMillis = DMX_STATISTICS_REFRESH_DEFAULT);
+	~DMXStatistics(void);
+
+	bool Start(void);
+	void Stop(void);
+
+	void Update(uint8_t nPortId, const uint8_t *pData, uint16_t nLength, const struct timespec *pTimestamp);
+
+private:
+	void Print(uint32_t nElapsedMillis);
+	static void *Refresh(void *p);
+
+private:
+	uint32_t m_nRefreshMillis;
+	bool m_bIsStarted;
+	bool m_bStop;
+	bool m_bIsTerminal;
+	pthread_t m_Thread;
+	pthread_mutex_t m_Mutex;
+	pthread_cond_t m_Cond;
+	struct TDMXStatisticsPort m_tPort[DMX_STATISTICS_MAX_PORTS];
+	struct TDMXStatisticsPort m_tSnapshot[DMX_STATISTICS_MAX_PORTS];
+};
+
+#endif /* DMXSTATISTICS_H_ */
@@ -43,16 +43,46 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #define SET_DMX_START_ADDRESS		(1 << 0)
 #define SET_DMX_MAX_CHANNELS		(1 << 1)
 #define SET_FORMAT					(1 << 2)
-
-DMXMonitorParams::DMXMonitorParams(DMXMonitorParamsStore* pDMXMonitorParamsStore): m_pDMXMonitorParamsStore(pDMXMonitorParamsStore) {
+#define SET_RECORD					(1 << 3)
+#define SET_STATISTICS				(1 << 4)
+
+#define OFFSET(f)	__builtin_offsetof(struct TDMXMonitorParams, f)
+
+enum TDMXMonitorParamsKey {
+	KEY_DMX_START_ADDRESS,
+	KEY_DMX_MAX_CHANNELS,
+	KEY_FORMAT,
+	KEY_RECORD,
+	KEY_STATISTICS,
+	KEY_LAST
+};
+
+// Must be in the order of TDMXMonitorParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ LightSetConst::PARAMS_DMX_START_ADDRESS, OFFSET(nDmxStartAddress), PROPERTIES_TYPE_UINT16, SET_DMX_START_ADDRESS, 1, 512 },
+	{ DMXMonitorParamsConst::DMX_MAX_CHANNELS, OFFSET(nDmxMaxChannels), PROPERTIES_TYPE_UINT16, SET_DMX_MAX_CHANNELS, 1, 512 },
+	{ DMXMonitorParamsConst::FORMAT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DMXMonitorParamsConst::RECORD, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DMXMonitorParamsConst::STATISTICS, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TDMXMonitorParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable DMXMonitorParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B5 };
+
+DMXMonitorParams::DMXMonitorParams(DMXMonitorParamsStore* pDMXMonitorParamsStore): m_pDMXMonitorParamsStore(pDMXMonitorParamsStore), m_pPropertiesParser(0) {
 	m_tDMXMonitorParams.nSetList = 0;
 	m_tDMXMonitorParams.nDmxStartAddress = DMX_START_ADDRESS_DEFAULT;
 	m_tDMXMonitorParams.nDmxMaxChannels = DMX_UNIVERSE_SIZE;
 	m_tDMXMonitorParams.tFormat = DMX_MONITOR_FORMAT_HEX;
+	m_tDMXMonitorParams.nStatisticsRefresh = 0;
+	m_tDMXMonitorParams.aRecordFile[0] = '\0';
 }
 
 DMXMonitorParams::~DMXMonitorParams(void) {
@@ -61,9 +91,16 @@ DMXMonitorParams::~DMXMonitorParams(void) {
 bool DMXMonitorParams::Load(void) {
 	m_tDMXMonitorParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tDMXMonitorParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(DMXMonitorParams::staticCallbackFunction, this);
 
-	if (configfile.Read(DMXMonitorParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(DMXMonitorParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pDMXMonitorParamsStore != 0) {
 			m_pDMXMonitorParamsStore->Update(&m_tDMXMonitorParams);
@@ -93,42 +130,65 @@ void DMXMonitorParams::Set(DMXMonitor* pDMXMonitor) {
 	if (isMaskSet(SET_FORMAT)) {
 		pDMXMonitor->SetFormat(m_tDMXMonitorParams.tFormat);
 	}
+
+#if defined (__linux__) || defined (__CYGWIN__) || defined(__APPLE__)
+	if (isMaskSet(SET_RECORD)) {
+		pDMXMonitor->SetRecord(m_tDMXMonitorParams.aRecordFile);
+	}
+
+	if (isMaskSet(SET_STATISTICS)) {
+		pDMXMonitor->SetStatistics(m_tDMXMonitorParams.nStatisticsRefresh);
+	}
+#endif
 }
 
 void DMXMonitorParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint16_t value16;
 	char value[8];
 	uint8_t len;
 
-	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &value16) == SSCAN_OK) {
-		if (value16 != 0 && value16 <= 512) {
-			m_tDMXMonitorParams.nDmxStartAddress = value16;
-			m_tDMXMonitorParams.nSetList |= SET_DMX_START_ADDRESS;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_FORMAT:
+		len = 3;
+		if (Sscan::Char(pLine, DMXMonitorParamsConst::FORMAT, value, &len) == SSCAN_OK) {
+			if (memcmp(value, "pct", 3) == 0) {
+				m_tDMXMonitorParams.tFormat = DMX_MONITOR_FORMAT_PCT;
+			} else if (memcmp(value, "dec", 3) == 0) {
+				m_tDMXMonitorParams.tFormat = DMX_MONITOR_FORMAT_DEC;
+			} else {
+				m_tDMXMonitorParams.tFormat = DMX_MONITOR_FORMAT_HEX;
+			}
+			m_tDMXMonitorParams.nSetList |= SET_FORMAT;
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, DMXMonitorParamsConst::DMX_MAX_CHANNELS, &value16) == SSCAN_OK) {
-		if (value16 != 0 && value16 <= 512) {
-			m_tDMXMonitorParams.nDmxMaxChannels = value16;
-			m_tDMXMonitorParams.nSetList |= SET_DMX_MAX_CHANNELS;
+		break;
+	case KEY_RECORD:
+		len = DMX_MONITOR_RECORD_FILE_LENGTH - 1;
+		if (Sscan::Char(pLine, DMXMonitorParamsConst::RECORD, m_tDMXMonitorParams.aRecordFile, &len) == SSCAN_OK) {
+			m_tDMXMonitorParams.aRecordFile[len] = '\0';
+
+			if (len != 0) {
+				m_tDMXMonitorParams.nSetList |= SET_RECORD;
+			} else {
+				m_tDMXMonitorParams.nSetList &= ~SET_RECORD;
+			}
 		}
-		return;
-	}
-
-	len = 3;
-	if (Sscan::Char(pLine, DMXMonitorParamsConst::FORMAT, value, &len) == SSCAN_OK) {
-		if (memcmp(value, "pct", 3) == 0) {
-			m_tDMXMonitorParams.tFormat = DMX_MONITOR_FORMAT_PCT;
-		} else if (memcmp(value, "dec", 3) == 0) {
-			m_tDMXMonitorParams.tFormat = DMX_MONITOR_FORMAT_DEC;
-		} else {
-			m_tDMXMonitorParams.tFormat = DMX_MONITOR_FORMAT_HEX;
+		break;
+	case KEY_STATISTICS:
+		if (Sscan::Uint16(pLine, DMXMonitorParamsConst::STATISTICS, &value16) == SSCAN_OK) {
+			m_tDMXMonitorParams.nStatisticsRefresh = value16;
+
+			if (value16 != 0) {
+				m_tDMXMonitorParams.nSetList |= SET_STATISTICS;
+			} else {
+				m_tDMXMonitorParams.nSetList &= ~SET_STATISTICS;
+			}
 		}
-		m_tDMXMonitorParams.nSetList |= SET_FORMAT;
-		return;
+		break;
+	default:
+		break;
 	}
 }
 
@@ -151,6 +211,14 @@ void DMXMonitorParams::Dump(void) {
 	if (isMaskSet(SET_FORMAT)) {
 		printf(" %s=%d [%s]\n", DMXMonitorParamsConst::FORMAT, (int) m_tDMXMonitorParams.tFormat, m_tDMXMonitorParams.tFormat == DMX_MONITOR_FORMAT_PCT ? "pct" : (m_tDMXMonitorParams.tFormat == DMX_MONITOR_FORMAT_DEC ? "dec" : "hex"));
 	}
+
+	if (isMaskSet(SET_RECORD)) {
+		printf(" %s=%s\n", DMXMonitorParamsConst::RECORD, m_tDMXMonitorParams.aRecordFile);
+	}
+
+	if (isMaskSet(SET_STATISTICS)) {
+		printf(" %s=%d\n", DMXMonitorParamsConst::STATISTICS, (int) m_tDMXMonitorParams.nStatisticsRefresh);
+	}
 #endif
 }
 
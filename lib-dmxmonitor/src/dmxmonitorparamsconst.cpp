@@ -31,3 +31,5 @@ alignas(uint32_t) const char DMXMonitorParamsConst::FILE_NAME[] = "mon.txt";
 
 alignas(uint32_t) const char DMXMonitorParamsConst::DMX_MAX_CHANNELS[] = "dmx_max_channels";
 alignas(uint32_t) const char DMXMonitorParamsConst::FORMAT[] = "format";
+alignas(uint32_t) const char DMXMonitorParamsConst::RECORD[] = "record";
+alignas(uint32_t) const char DMXMonitorParamsConst::STATISTICS[] = "statistics";
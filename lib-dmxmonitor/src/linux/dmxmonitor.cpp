@@ -2,7 +2,7 @@
  * @file dmxmonitor.cpp
  *
  */
-/* Copyright (C) 2016-2019 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+/* Copyright (C) 2016-2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -26,11 +26,14 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 #include <sys/time.h>
 #include <assert.h>
 
 #include "dmxmonitor.h"
+#include "dmxrecorder.h"
+#include "dmxstatistics.h"
 
 enum {
 	DMX_DEFAULT_MAX_CHANNELS = 32,
@@ -41,7 +44,9 @@ DMXMonitor::DMXMonitor(void) :
 		m_tFormat(DMX_MONITOR_FORMAT_HEX),
 		m_nSlots(0),
 		m_nDmxStartAddress(DMX_DEFAULT_START_ADDRESS),
-		m_nMaxChannels(DMX_DEFAULT_MAX_CHANNELS)
+		m_nMaxChannels(DMX_DEFAULT_MAX_CHANNELS),
+		m_pRecorder(0),
+		m_pStatistics(0)
 
 {
 	for (uint32_t i = 0; i < DMXMONITOR_MAX_PORTS; i++) {
@@ -56,6 +61,12 @@ DMXMonitor::~DMXMonitor(void) {
 			m_bIsStarted[i] = false;
 		}
 	}
+
+	delete m_pStatistics;
+	m_pStatistics = 0;
+
+	delete m_pRecorder;
+	m_pRecorder = 0;
 }
 
 void DMXMonitor::DisplayDateTime(uint8_t nPortId, const char *pString) {
@@ -72,6 +83,41 @@ void DMXMonitor::SetMaxDmxChannels(uint16_t nMaxChannels) {
 	m_nMaxChannels = nMaxChannels;
 }
 
+bool DMXMonitor::SetRecord(const char *pFileName) {
+	assert(pFileName != 0);
+
+	if (m_pRecorder == 0) {
+		m_pRecorder = new DMXRecorder;
+		assert(m_pRecorder != 0);
+	}
+
+	m_pRecorder->Stop();
+
+	if (!m_pRecorder->Start(pFileName)) {
+		delete m_pRecorder;
+		m_pRecorder = 0;
+		return false;
+	}
+
+	printf("Recording to \'%s\'\n", pFileName);
+	return true;
+}
+
+bool DMXMonitor::SetStatistics(uint32_t nRefreshMillis) {
+	delete m_pStatistics;
+
+	m_pStatistics = new DMXStatistics(nRefreshMillis);
+	assert(m_pStatistics != 0);
+
+	if (!m_pStatistics->Start()) {
+		delete m_pStatistics;
+		m_pStatistics = 0;
+		return false;
+	}
+
+	return true;
+}
+
 uint16_t DMXMonitor::GetDmxFootprint(void) {
 	return m_nMaxChannels;
 }
@@ -114,32 +160,59 @@ void DMXMonitor::Stop(uint8_t nPort) {
 void DMXMonitor::SetData(uint8_t nPortId, const uint8_t *pData, uint16_t nLength) {
 	assert(nPortId < DMXMONITOR_MAX_PORTS);
 
+	if ((m_pRecorder != 0) || (m_pStatistics != 0)) {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+
+		if (m_pRecorder != 0) {
+			m_pRecorder->Record(nPortId, pData, nLength, &ts);
+		}
+
+		if (m_pStatistics != 0) {
+			m_pStatistics->Update(nPortId, pData, nLength, &ts);
+		}
+
+		return;
+	}
+
+	static const char aHex[] = "0123456789abcdef";
+	char aLine[128 + 4 * 512];
 	struct timeval tv;
 	uint32_t i, j;
 
 	gettimeofday(&tv, NULL);
 	struct tm tm = *localtime(&tv.tv_sec);
 
-	printf("%.2d-%.2d-%.4d %.2d:%.2d:%.2d.%.6d DMX:%c %d:%d:%d ", tm.tm_mday, tm.tm_mon + 1, tm.tm_year + 1900, tm.tm_hour, tm.tm_min, tm.tm_sec, (int) tv.tv_usec, (char) nPortId + 'A', (int) nLength, (int) m_nMaxChannels, (int) m_nDmxStartAddress);
+	char *p = aLine + snprintf(aLine, 128, "%.2d-%.2d-%.4d %.2d:%.2d:%.2d.%.6d DMX:%c %d:%d:%d ", tm.tm_mday, tm.tm_mon + 1, tm.tm_year + 1900, tm.tm_hour, tm.tm_min, tm.tm_sec, (int) tv.tv_usec, (char) nPortId + 'A', (int) nLength, (int) m_nMaxChannels, (int) m_nDmxStartAddress);
 
+	// One write per frame instead of one printf per slot
 	for (i = m_nDmxStartAddress - 1, j = 0; (i < nLength) && (j < m_nMaxChannels); i++, j++) {
+		uint32_t nValue = pData[i];
+
 		switch (m_tFormat) {
 			case DMX_MONITOR_FORMAT_PCT:
-				printf("%3d ", (int) (pData[i] * 100) / 255);
-				break;
+				nValue = (nValue * 100) / 255;
+				/* no break */
 			case DMX_MONITOR_FORMAT_DEC:
-				printf("%3d ", pData[i]);
+				*p++ = (nValue >= 100) ? (char) ('0' + nValue / 100) : ' ';
+				*p++ = (nValue >= 10) ? (char) ('0' + (nValue / 10) % 10) : ' ';
+				*p++ = (char) ('0' + nValue % 10);
 				break;
 			default:
-				printf("%.2x ", pData[i]);
+				*p++ = aHex[nValue >> 4];
+				*p++ = aHex[nValue & 0xF];
 				break;
 		}
+
+		*p++ = ' ';
 	}
 
 	for (; j < m_nMaxChannels; j++) {
-		printf("-- ");
+		memcpy(p, "-- ", 3);
+		p += 3;
 	}
 
-	printf("\n");
-}
+	*p++ = '\n';
 
+	fwrite(aLine, 1, (size_t) (p - aLine), stdout);
+}
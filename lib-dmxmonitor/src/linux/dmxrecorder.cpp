@@ -0,0 +1,284 @@
+/**
+ * @file dmxrecorder.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <assert.h>
+
+#include "dmxrecorder.h"
+
+#include "debug.h"
+
+#define WRITER_TIMEOUT_MILLIS	100
+
+DMXRecorder::DMXRecorder(uint32_t nBufferSize):
+	m_pBuffer(0),
+	m_nBufferMask(nBufferSize - 1),
+	m_nHead(0),
+	m_nTail(0),
+	m_pFile(0),
+	m_nFrames(0),
+	m_nDropped(0),
+	m_nBytesWritten(0),
+	m_bStop(false)
+{
+	DEBUG_ENTRY;
+
+	assert((nBufferSize & (nBufferSize - 1)) == 0);
+
+	m_pBuffer = new uint8_t[nBufferSize];
+	assert(m_pBuffer != 0);
+
+	memset(&m_Start, 0, sizeof(struct timespec));
+
+	pthread_mutex_init(&m_Mutex, 0);
+	pthread_cond_init(&m_Cond, 0);
+
+	DEBUG_EXIT;
+}
+
+DMXRecorder::~DMXRecorder(void) {
+	DEBUG_ENTRY;
+
+	Stop();
+
+	pthread_cond_destroy(&m_Cond);
+	pthread_mutex_destroy(&m_Mutex);
+
+	delete [] m_pBuffer;
+	m_pBuffer = 0;
+
+	DEBUG_EXIT;
+}
+
+bool DMXRecorder::Start(const char *pFileName) {
+	DEBUG_ENTRY;
+	assert(pFileName != 0);
+
+	if (m_pFile != 0) {
+		DEBUG_EXIT;
+		return false;
+	}
+
+	if ((m_pFile = fopen(pFileName, "wb")) == 0) {
+		perror(pFileName);
+		DEBUG_EXIT;
+		return false;
+	}
+
+	struct timespec tsRealTime;
+	clock_gettime(CLOCK_REALTIME, &tsRealTime);
+	clock_gettime(CLOCK_MONOTONIC, &m_Start);
+
+	struct TDMXRecorderHeader tHeader;
+	memcpy(tHeader.aMagic, "DMXREC", sizeof(tHeader.aMagic));
+	tHeader.nVersion = DMX_RECORDER_VERSION;
+	tHeader.nSeconds = (uint32_t) tsRealTime.tv_sec;
+	tHeader.nMicros = (uint32_t) (tsRealTime.tv_nsec / 1000);
+
+	fwrite(&tHeader, sizeof(struct TDMXRecorderHeader), 1, m_pFile);
+
+	m_nHead = 0;
+	m_nTail = 0;
+	m_nFrames = 0;
+	m_nDropped = 0;
+	m_nBytesWritten = sizeof(struct TDMXRecorderHeader);
+	m_bStop = false;
+
+	if (pthread_create(&m_Thread, 0, DMXRecorder::Writer, this) != 0) {
+		perror("pthread_create");
+		fclose(m_pFile);
+		m_pFile = 0;
+		DEBUG_EXIT;
+		return false;
+	}
+
+	DEBUG_EXIT;
+	return true;
+}
+
+void DMXRecorder::Stop(void) {
+	DEBUG_ENTRY;
+
+	if (m_pFile == 0) {
+		DEBUG_EXIT;
+		return;
+	}
+
+	pthread_mutex_lock(&m_Mutex);
+	m_bStop = true;
+	pthread_cond_signal(&m_Cond);
+	pthread_mutex_unlock(&m_Mutex);
+
+	pthread_join(m_Thread, 0);
+
+	fclose(m_pFile);
+	m_pFile = 0;
+
+	Print();
+
+	DEBUG_EXIT;
+}
+
+void DMXRecorder::Copy(const void *pData, uint32_t nLength) {
+	const uint32_t nOffset = m_nHead & m_nBufferMask;
+	const uint32_t nFirst = (nLength < (m_nBufferMask + 1 - nOffset)) ? nLength : (m_nBufferMask + 1 - nOffset);
+
+	memcpy(&m_pBuffer[nOffset], pData, nFirst);
+	memcpy(m_pBuffer, (const uint8_t *) pData + nFirst, nLength - nFirst);
+
+	m_nHead += nLength;
+}
+
+void DMXRecorder::Record(uint8_t nPortId, const uint8_t *pData, uint16_t nLength, const struct timespec *pTimestamp) {
+	assert(pData != 0);
+	assert(pTimestamp != 0);
+
+	if (__builtin_expect((m_pFile == 0), 0)) {
+		return;
+	}
+
+	struct TDMXRecorderFrame tFrame;
+
+	int32_t nSeconds = (int32_t) (pTimestamp->tv_sec - m_Start.tv_sec);
+	int32_t nNanos = (int32_t) (pTimestamp->tv_nsec - m_Start.tv_nsec);
+
+	if (nNanos < 0) {
+		nSeconds--;
+		nNanos += 1000000000;
+	}
+
+	tFrame.nSeconds = (uint32_t) nSeconds;
+	tFrame.nMicros = (uint32_t) nNanos / 1000;
+	tFrame.nPortId = nPortId;
+	tFrame.nReserved = 0;
+	tFrame.nLength = nLength;
+
+	const uint32_t nSize = sizeof(struct TDMXRecorderFrame) + nLength;
+
+	pthread_mutex_lock(&m_Mutex);
+
+	const uint32_t nUsed = m_nHead - m_nTail;
+
+	if (__builtin_expect(((m_nBufferMask + 1 - nUsed) < nSize), 0)) {
+		m_nDropped++;
+		pthread_mutex_unlock(&m_Mutex);
+		return;
+	}
+
+	Copy(&tFrame, sizeof(struct TDMXRecorderFrame));
+	Copy(pData, nLength);
+
+	m_nFrames++;
+
+	// Wake up the writer early when the buffer is filling up
+	if ((nUsed + nSize) >= ((m_nBufferMask + 1) / 4)) {
+		pthread_cond_signal(&m_Cond);
+	}
+
+	pthread_mutex_unlock(&m_Mutex);
+}
+
+void DMXRecorder::Write(void) {
+	pthread_mutex_lock(&m_Mutex);
+
+	for (;;) {
+		const uint32_t nUsed = m_nHead - m_nTail;
+
+		if (m_bStop || (nUsed >= ((m_nBufferMask + 1) / 4))) {
+			break;
+		}
+
+		struct timespec ts;
+		clock_gettime(CLOCK_REALTIME, &ts);
+		ts.tv_nsec += WRITER_TIMEOUT_MILLIS * 1000000;
+
+		if (ts.tv_nsec >= 1000000000) {
+			ts.tv_sec++;
+			ts.tv_nsec -= 1000000000;
+		}
+
+		if (pthread_cond_timedwait(&m_Cond, &m_Mutex, &ts) != 0) {
+			break;
+		}
+	}
+
+	const uint32_t nHead = m_nHead;
+	const uint32_t nTail = m_nTail;
+
+	pthread_mutex_unlock(&m_Mutex);
+
+	if (nHead == nTail) {
+		return;
+	}
+
+	// The producer only writes in the free part of the buffer, no lock needed
+	const uint32_t nLength = nHead - nTail;
+	const uint32_t nOffset = nTail & m_nBufferMask;
+	const uint32_t nFirst = (nLength < (m_nBufferMask + 1 - nOffset)) ? nLength : (m_nBufferMask + 1 - nOffset);
+
+	fwrite(&m_pBuffer[nOffset], 1, nFirst, m_pFile);
+
+	if (nLength != nFirst) {
+		fwrite(m_pBuffer, 1, nLength - nFirst, m_pFile);
+	}
+
+	fflush(m_pFile);
+
+	pthread_mutex_lock(&m_Mutex);
+	m_nTail = nHead;
+	m_nBytesWritten += nLength;
+	pthread_mutex_unlock(&m_Mutex);
+}
+
+void *DMXRecorder::Writer(void *p) {
+	assert(p != 0);
+
+	DMXRecorder *pThis = (DMXRecorder *) p;
+
+	for (;;) {
+		pThis->Write();
+
+		pthread_mutex_lock(&pThis->m_Mutex);
+		const bool bDone = pThis->m_bStop && (pThis->m_nHead == pThis->m_nTail);
+		pthread_mutex_unlock(&pThis->m_Mutex);
+
+		if (bDone) {
+			break;
+		}
+	}
+
+	return 0;
+}
+
+void DMXRecorder::Print(void) {
+	printf("DMX Recorder\n");
+	printf(" Frames  : %u\n", (unsigned) m_nFrames);
+	printf(" Dropped : %u\n", (unsigned) m_nDropped);
+	printf(" Written : %llu bytes\n", (unsigned long long) m_nBytesWritten);
+}
@@ -0,0 +1,275 @@
+/**
+ * @file dmxstatistics.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <assert.h>
+
+#include "dmxstatistics.h"
+
+#include "debug.h"
+
+static const uint32_t s_aJitterLimit[DMX_STATISTICS_JITTER_BUCKETS - 1] = { 100, 250, 500, 1000, 2500, 5000, 10000 }; // Microseconds
+static const char s_aJitterLabel[DMX_STATISTICS_JITTER_BUCKETS][6] = { "<0.1", "<0.25", "<0.5", "<1", "<2.5", "<5", "<10", ">=10" };
+
+DMXStatistics::DMXStatistics(uint32_t nRefreshMillis):
+	m_nRefreshMillis(nRefreshMillis),
+	m_bIsStarted(false),
+	m_bStop(false),
+	m_bIsTerminal(false)
+{
+	DEBUG_ENTRY;
+
+	assert(nRefreshMillis != 0);
+
+	memset(m_tPort, 0, sizeof(m_tPort));
+
+	for (uint32_t i = 0; i < DMX_STATISTICS_MAX_PORTS; i++) {
+		m_tPort[i].nIntervalMin = UINT32_MAX;
+	}
+
+	pthread_mutex_init(&m_Mutex, 0);
+	pthread_cond_init(&m_Cond, 0);
+
+	DEBUG_EXIT;
+}
+
+DMXStatistics::~DMXStatistics(void) {
+	DEBUG_ENTRY;
+
+	Stop();
+
+	pthread_cond_destroy(&m_Cond);
+	pthread_mutex_destroy(&m_Mutex);
+
+	DEBUG_EXIT;
+}
+
+bool DMXStatistics::Start(void) {
+	DEBUG_ENTRY;
+
+	if (m_bIsStarted) {
+		DEBUG_EXIT;
+		return false;
+	}
+
+	m_bIsTerminal = (isatty(fileno(stdout)) != 0);
+	m_bStop = false;
+
+	if (pthread_create(&m_Thread, 0, DMXStatistics::Refresh, this) != 0) {
+		perror("pthread_create");
+		DEBUG_EXIT;
+		return false;
+	}
+
+	m_bIsStarted = true;
+
+	DEBUG_EXIT;
+	return true;
+}
+
+void DMXStatistics::Stop(void) {
+	DEBUG_ENTRY;
+
+	if (!m_bIsStarted) {
+		DEBUG_EXIT;
+		return;
+	}
+
+	pthread_mutex_lock(&m_Mutex);
+	m_bStop = true;
+	pthread_cond_signal(&m_Cond);
+	pthread_mutex_unlock(&m_Mutex);
+
+	pthread_join(m_Thread, 0);
+
+	m_bIsStarted = false;
+
+	DEBUG_EXIT;
+}
+
+void DMXStatistics::Update(uint8_t nPortId, const uint8_t *pData, uint16_t nLength, const struct timespec *pTimestamp) {
+	assert(nPortId < DMX_STATISTICS_MAX_PORTS);
+	assert(pData != 0);
+	assert(nLength <= 512);
+	assert(pTimestamp != 0);
+
+	const uint64_t nMicros = (uint64_t) pTimestamp->tv_sec * 1000000 + (uint64_t) (pTimestamp->tv_nsec / 1000);
+
+	pthread_mutex_lock(&m_Mutex);
+
+	struct TDMXStatisticsPort *pPort = &m_tPort[nPortId];
+
+	if (pPort->nFramesTotal != 0) {
+		const uint32_t nInterval = (uint32_t) (nMicros - pPort->nLastMicros);
+
+		if (nInterval < pPort->nIntervalMin) {
+			pPort->nIntervalMin = nInterval;
+		}
+
+		if (nInterval > pPort->nIntervalMax) {
+			pPort->nIntervalMax = nInterval;
+		}
+
+		if (pPort->nFramesTotal > 1) {
+			const uint32_t nJitter = (nInterval > pPort->nLastInterval) ? (nInterval - pPort->nLastInterval) : (pPort->nLastInterval - nInterval);
+			uint32_t nBucket;
+
+			for (nBucket = 0; nBucket < (DMX_STATISTICS_JITTER_BUCKETS - 1); nBucket++) {
+				if (nJitter < s_aJitterLimit[nBucket]) {
+					break;
+				}
+			}
+
+			pPort->aJitter[nBucket]++;
+		}
+
+		pPort->nLastInterval = nInterval;
+	}
+
+	pPort->nLastMicros = nMicros;
+
+	const uint32_t nCompare = (nLength < pPort->nLength) ? nLength : pPort->nLength;
+	uint32_t nChangedSlots = (nLength > pPort->nLength) ? (nLength - pPort->nLength) : (pPort->nLength - nLength);
+
+	if (memcmp(pPort->aData, pData, nCompare) != 0) {
+		for (uint32_t i = 0; i < nCompare; i++) {
+			nChangedSlots += (pPort->aData[i] != pData[i]);
+		}
+	}
+
+	if (nChangedSlots != 0) {
+		memcpy(pPort->aData, pData, nLength);
+		pPort->nLength = nLength;
+		pPort->nChangedFrames++;
+		pPort->nChangedSlots += nChangedSlots;
+	}
+
+	pPort->nFrames++;
+	pPort->nFramesTotal++;
+
+	pthread_mutex_unlock(&m_Mutex);
+}
+
+void DMXStatistics::Print(uint32_t nElapsedMillis) {
+	if (m_bIsTerminal) {
+		printf("\033[H\033[2J");
+	}
+
+	printf("DMX Statistics, refresh %u ms\n", (unsigned) m_nRefreshMillis);
+	printf("Port     fps  interval ms min/max  changed frames/slots  jitter ms");
+
+	for (uint32_t i = 0; i < DMX_STATISTICS_JITTER_BUCKETS; i++) {
+		printf(" %7s", s_aJitterLabel[i]);
+	}
+
+	printf("\n");
+
+	for (uint32_t nPortId = 0; nPortId < DMX_STATISTICS_MAX_PORTS; nPortId++) {
+		const struct TDMXStatisticsPort *pPort = &m_tSnapshot[nPortId];
+
+		if (pPort->nFramesTotal == 0) {
+			continue;
+		}
+
+		const float fFps = (float) pPort->nFrames * 1000.0f / (float) nElapsedMillis;
+		const float fMin = (pPort->nIntervalMin == UINT32_MAX) ? 0.0f : (float) pPort->nIntervalMin / 1000.0f;
+		const float fMax = (float) pPort->nIntervalMax / 1000.0f;
+
+		printf("   %c  %6.1f     %7.2f/%7.2f       %6u/%7u           ", (char) nPortId + 'A', fFps, fMin, fMax, (unsigned) pPort->nChangedFrames, (unsigned) pPort->nChangedSlots);
+
+		for (uint32_t i = 0; i < DMX_STATISTICS_JITTER_BUCKETS; i++) {
+			printf(" %7u", (unsigned) pPort->aJitter[i]);
+		}
+
+		printf("\n");
+	}
+
+	fflush(stdout);
+}
+
+void *DMXStatistics::Refresh(void *p) {
+	assert(p != 0);
+
+	DMXStatistics *pThis = (DMXStatistics *) p;
+
+	struct timespec tsLast;
+	clock_gettime(CLOCK_MONOTONIC, &tsLast);
+
+	pthread_mutex_lock(&pThis->m_Mutex);
+
+	while (!pThis->m_bStop) {
+		struct timespec ts;
+		clock_gettime(CLOCK_REALTIME, &ts);
+		ts.tv_sec += pThis->m_nRefreshMillis / 1000;
+		ts.tv_nsec += (pThis->m_nRefreshMillis % 1000) * 1000000;
+
+		if (ts.tv_nsec >= 1000000000) {
+			ts.tv_sec++;
+			ts.tv_nsec -= 1000000000;
+		}
+
+		pthread_cond_timedwait(&pThis->m_Cond, &pThis->m_Mutex, &ts);
+
+		if (pThis->m_bStop) {
+			break;
+		}
+
+		struct timespec tsNow;
+		clock_gettime(CLOCK_MONOTONIC, &tsNow);
+
+		uint32_t nElapsedMillis = (uint32_t) ((tsNow.tv_sec - tsLast.tv_sec) * 1000 + (tsNow.tv_nsec - tsLast.tv_nsec) / 1000000);
+
+		if (nElapsedMillis == 0) {
+			nElapsedMillis = 1;
+		}
+
+		tsLast = tsNow;
+
+		memcpy(pThis->m_tSnapshot, pThis->m_tPort, sizeof(pThis->m_tSnapshot));
+
+		for (uint32_t i = 0; i < DMX_STATISTICS_MAX_PORTS; i++) {
+			pThis->m_tPort[i].nFrames = 0;
+			pThis->m_tPort[i].nChangedFrames = 0;
+			pThis->m_tPort[i].nChangedSlots = 0;
+			pThis->m_tPort[i].nIntervalMin = UINT32_MAX;
+			pThis->m_tPort[i].nIntervalMax = 0;
+		}
+
+		pthread_mutex_unlock(&pThis->m_Mutex);
+
+		pThis->Print(nElapsedMillis);
+
+		pthread_mutex_lock(&pThis->m_Mutex);
+	}
+
+	pthread_mutex_unlock(&pThis->m_Mutex);
+
+	return 0;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file dmxreceivermulti.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H3_DMXRECEIVERMULTI_H_
+#define H3_DMXRECEIVERMULTI_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "h3/dmxmulti.h"
+
+#include "e131dmx.h"
+#include "artnetdmx.h"
+
+enum TDMXReceiverMultiSrc {
+	DMXRECEIVERMULTI_SRC_ARTNET,	///< Data without START Code
+	DMXRECEIVERMULTI_SRC_E131		///< Data with START Code
+};
+
+class DMXReceiverMulti: public DmxMulti, public E131Dmx, public ArtNetDmx {
+public:
+	DMXReceiverMulti(TDMXReceiverMultiSrc tSrc);
+	~DMXReceiverMulti(void);
+
+	void Start(uint8_t nPort);
+	void Stop(uint8_t nPort);
+
+	const uint8_t *Handler(uint8_t nPort, uint16_t &nLength, uint32_t &nUpdatesPerSecond);
+
+	void Print(void);
+
+private:
+	TDMXReceiverMultiSrc m_tSrc;
+	bool m_bIsStarted[DMX_MAX_OUT];
+};
+
+#endif /* H3_DMXRECEIVERMULTI_H_ */
@@ -0,0 +1,131 @@
+/**
+ * @file dmxreceivermulti.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "h3/dmxreceivermulti.h"
+#include "h3/dmx_multi.h"
+
+#include "debug.h"
+
+#define MAX_PORTS (sizeof(m_bIsStarted) / sizeof(m_bIsStarted[0]))
+
+DMXReceiverMulti::DMXReceiverMulti(TDMXReceiverMultiSrc tSrc): m_tSrc(tSrc) {
+	DEBUG_ENTRY
+
+	for (uint32_t i = 0; i < MAX_PORTS ; i++) {
+		m_bIsStarted[i] = false;
+	}
+
+	DEBUG_EXIT
+}
+
+DMXReceiverMulti::~DMXReceiverMulti(void) {
+	DEBUG_ENTRY
+
+	for (uint32_t i = 0; i < MAX_PORTS ; i++) {
+		Stop(i);
+	}
+
+	DEBUG_EXIT
+}
+
+void DMXReceiverMulti::Start(uint8_t nPort) {
+	DEBUG_ENTRY
+
+	assert(nPort < MAX_PORTS);
+
+	DEBUG_PRINTF("nPort=%d", nPort);
+
+	if (m_bIsStarted[nPort]) {
+		DEBUG_EXIT
+		return;
+	}
+
+	m_bIsStarted[nPort] = true;
+
+	SetPortDirection(nPort, DMXRDM_PORT_DIRECTION_INP, true);
+
+	DEBUG_EXIT
+}
+
+void DMXReceiverMulti::Stop(uint8_t nPort) {
+	DEBUG_ENTRY
+
+	assert(nPort < MAX_PORTS);
+
+	DEBUG_PRINTF("nPort=%d", nPort);
+
+	if (!m_bIsStarted[nPort]) {
+		DEBUG_EXIT
+		return;
+	}
+
+	m_bIsStarted[nPort] = false;
+
+	SetPortDirection(nPort, DMXRDM_PORT_DIRECTION_INP, false);
+
+	DEBUG_EXIT
+}
+
+/*
+ * The packets are taken from the per port ring buffer, the change detection
+ * is done by the bridge.
+ */
+const uint8_t *DMXReceiverMulti::Handler(uint8_t nPort, uint16_t &nLength, uint32_t &nUpdatesPerSecond) {
+	assert(nPort < MAX_PORTS);
+
+	nUpdatesPerSecond = GetUpdatesPerSecond(nPort);
+
+	const uint8_t *pDmx = GetDmxAvailable(nPort);
+
+	if (pDmx == 0) {
+		nLength = 0;
+		return 0;
+	}
+
+	const struct TDmxData *pDmxData = (const struct TDmxData *) pDmx;
+
+	if (m_tSrc == DMXRECEIVERMULTI_SRC_E131) {
+		nLength = (uint16_t) (1 + pDmxData->Statistics.SlotsInPacket); // Add 1 for SC
+		return pDmx;
+	}
+
+	nLength = (uint16_t) (pDmxData->Statistics.SlotsInPacket);
+	return (pDmx + 1);
+}
+
+void DMXReceiverMulti::Print(void) {
+	printf("DMX Receiver Multi\n");
+
+	for (uint32_t i = 0; i < MAX_PORTS ; i++) {
+		if (m_bIsStarted[i]) {
+			const volatile struct _total_statistics *pStatistics = GetTotalStatistics(i);
+			printf(" Port %d : %u packets/s, DMX %u, RDM %u\n", (int) i, (unsigned) GetUpdatesPerSecond(i), (unsigned) pStatistics->dmx_packets, (unsigned) pStatistics->rdm_packets);
+		}
+	}
+}
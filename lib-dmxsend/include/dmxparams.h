@@ -37,6 +37,9 @@
  #endif
 #endif
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TDMXParams {
     uint32_t nSetList;
 	uint8_t nBreakTime;		///< DMX output break time in 10.67 microsecond units. Valid range is 9 to 127.
@@ -90,6 +93,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -100,6 +104,7 @@ private:
 private:
     DMXParamsStore *m_pDMXParamsStore;
     struct TDMXParams m_tDMXParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* DMXPARAMS_H_ */
@@ -39,7 +39,7 @@
 #include "dmxsendconst.h"
 
 #include "readconfigfile.h"
-#include "sscan.h"
+#include "propertiesparser.h"
 
 #define DMX_PARAMS_MIN_BREAK_TIME		9
 #define DMX_PARAMS_DEFAULT_BREAK_TIME	9
@@ -51,7 +51,18 @@
 
 #define DMX_PARAMS_DEFAULT_REFRESH_RATE	40
 
-DMXParams::DMXParams(DMXParamsStore *pDMXParamsStore) : m_pDMXParamsStore(pDMXParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TDMXParams, f)
+
+static const struct TPropertiesKey s_Keys[] = {
+	{ DMXSendConst::PARAMS_BREAK_TIME, OFFSET(nBreakTime), PROPERTIES_TYPE_UINT8, DMX_SEND_PARAMS_MASK_BREAK_TIME, DMX_PARAMS_MIN_BREAK_TIME, DMX_PARAMS_MAX_BREAK_TIME },
+	{ DMXSendConst::PARAMS_MAB_TIME, OFFSET(nMabTime), PROPERTIES_TYPE_UINT8, DMX_SEND_PARAMS_MASK_MAB_TIME, DMX_PARAMS_MIN_MAB_TIME, DMX_PARAMS_MAX_MAB_TIME },
+	{ DMXSendConst::PARAMS_REFRESH_RATE, OFFSET(nRefreshRate), PROPERTIES_TYPE_UINT8, DMX_SEND_PARAMS_MASK_REFRESH_RATE, 0, 0xFF }
+};
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable DMXParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 4, 0x9E3779B1 };
+
+DMXParams::DMXParams(DMXParamsStore *pDMXParamsStore) : m_pDMXParamsStore(pDMXParamsStore), m_pPropertiesParser(0) {
 	m_tDMXParams.nSetList = 0;
 	m_tDMXParams.nBreakTime = DMX_PARAMS_DEFAULT_BREAK_TIME;
 	m_tDMXParams.nMabTime = DMX_PARAMS_DEFAULT_MAB_TIME;
@@ -65,9 +76,16 @@ DMXParams::~DMXParams(void) {
 bool DMXParams::Load(void) {
 	m_tDMXParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tDMXParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(DMXParams::staticCallbackFunction, this);
 
-	if (configfile.Read(DMXSendConst::PARAMS_FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(DMXSendConst::PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pDMXParamsStore != 0) {
 			m_pDMXParamsStore->Update(&m_tDMXParams);
@@ -92,32 +110,23 @@ void DMXParams::Load(const char* pBuffer, uint32_t nLength) {
 
 	m_tDMXParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tDMXParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(DMXParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pDMXParamsStore->Update(&m_tDMXParams);
 }
 
 void DMXParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
-	uint8_t value8;
-
-	if (Sscan::Uint8(pLine, DMXSendConst::PARAMS_BREAK_TIME, &value8) == SSCAN_OK) {
-		if ((value8 >= (uint8_t) DMX_PARAMS_MIN_BREAK_TIME) && (value8 <= (uint8_t) DMX_PARAMS_MAX_BREAK_TIME)) {
-			m_tDMXParams.nBreakTime = value8;
-			m_tDMXParams.nSetList |= DMX_SEND_PARAMS_MASK_BREAK_TIME;
-		}
-	} else if (Sscan::Uint8(pLine, DMXSendConst::PARAMS_MAB_TIME, &value8) == SSCAN_OK) {
-		if ((value8 >= (uint8_t) DMX_PARAMS_MIN_MAB_TIME) && (value8 <= (uint8_t) DMX_PARAMS_MAX_MAB_TIME)) {
-			m_tDMXParams.nMabTime = value8;
-			m_tDMXParams.nSetList |= DMX_SEND_PARAMS_MASK_MAB_TIME;
-		}
-	} else if (Sscan::Uint8(pLine, DMXSendConst::PARAMS_REFRESH_RATE, &value8) == SSCAN_OK) {
-		m_tDMXParams.nRefreshRate = value8;
-		m_tDMXParams.nSetList |= DMX_SEND_PARAMS_MASK_REFRESH_RATE;
-	}
+	m_pPropertiesParser->Parse(pLine);
 }
 
 void DMXParams::Dump(void) {
@@ -33,6 +33,9 @@
 #include "e131packets.h"
 
 #include "e131dmx.h"
+#include "e131discovery.h"
+
+#include "dmxtransmit.h"
 
 #include "lightset.h"
 
@@ -69,6 +72,19 @@ struct TSource {
 	uint8_t sequenceNumberData;
 };
 
+/*
+ * Counters since the start or the last ClearPortStats
+ */
+struct TE131PortStats {
+	uint32_t nReceived;			///< Data packets for the universe of this port
+	uint32_t nSequenceLost;		///< Missing sequence numbers
+	uint32_t nOutOfOrder;		///< Discarded, out of sequence
+	uint32_t nMerged;			///< Received while merging two sources
+	uint32_t nMergeTimeouts;	///< Sources dropped after the merge timeout
+	uint32_t nDiscarded;		///< Preview data, lower priority or more than two sources
+	uint32_t nUpdates;			///< Sent to the LightSet
+};
+
 struct TE131OutputPort {
 	uint8_t data[E131_DMX_LENGTH];
 	uint16_t length;
@@ -78,8 +94,10 @@ struct TE131OutputPort {
 	bool bIsEnabled;
 	bool IsTransmitting;
 	bool IsMerging;
+	bool IsJoined;
 	struct TSource sourceA;
 	struct TSource sourceB;
+	struct TE131PortStats tStats;
 };
 
 struct TE131InputPort {
@@ -156,6 +174,25 @@ public:
 		return m_Cid;
 	}
 
+	void SetEnableDiscovery(bool bEnable = true);
+	bool GetEnableDiscovery(void) {
+		return m_pE131Discovery != 0;
+	}
+
+	/*
+	 * Only the multicast groups of the output universes announced by a source
+	 * in the discovery directory are joined. Sources that do not send
+	 * Universe Discovery packets can then only be received with unicast.
+	 */
+	void SetDiscoveryJoin(bool bDiscoveryJoin = true);
+	bool GetDiscoveryJoin(void) {
+		return m_bDiscoveryJoin;
+	}
+
+	E131Discovery *GetDiscovery(void) {
+		return m_pE131Discovery;
+	}
+
 	void SetSourceName(const char *pSourceName);
 	const char *GetSourceName(void) {
 		return m_SourceName;
@@ -172,8 +209,34 @@ public:
 		return m_InputPort[nPortIndex].nPriority;
 	}
 
+	/*
+	 * Input rate cap per universe, 0 = no cap
+	 */
+	void SetInputMinInterval(uint32_t nMinIntervalMillis, uint8_t nPortIndex = 0) {
+		assert(nPortIndex < E131_MAX_UARTS);
+		m_pDmxTransmit[nPortIndex].SetMinInterval(nMinIntervalMillis);
+	}
+	uint32_t GetInputMinInterval(uint8_t nPortIndex = 0) const {
+		assert(nPortIndex < E131_MAX_UARTS);
+		return m_pDmxTransmit[nPortIndex].GetMinInterval();
+	}
+
+	/*
+	 * Input synchronization universe, 0 = no E1.31 Synchronization Packets
+	 */
+	void SetInputSynchronizationAddress(uint16_t nUniverse);
+	uint16_t GetInputSynchronizationAddress(void) {
+		return m_nSynchronizationAddress;
+	}
+
 	void Clear(uint8_t nPortIndex);
 
+	const struct TE131PortStats *GetPortStats(uint8_t nPortIndex) const {
+		assert(nPortIndex < E131_MAX_PORTS);
+		return &m_OutputPort[nPortIndex].tStats;
+	}
+	void ClearPortStats(void);
+
 	void Start(void);
 	void Stop(void);
 
@@ -197,6 +260,10 @@ private:
 
 	void HandleDmx(void);
 	void HandleSynchronization(void);
+	void HandleDiscovery(uint32_t nLength);
+
+	void RunDiscovery(void);
+	void UpdateDiscoveryJoin(void);
 
 	uint32_t UniverseToMulticastIp(uint16_t nUniverse) const;
 	void LeaveUniverse(uint8_t nPortIndex, uint16_t nUniverse);
@@ -204,6 +271,8 @@ private:
 	// Input
 	void HandleDmxIn(void);
 	void FillDataPacket(void);
+	void FillSynchronizationPacket(void);
+	void SendSynchronizationPacket(void);
 	void FillDiscoveryPacket(void);
 	void SendDiscoveryPacket(void);
 
@@ -226,11 +295,19 @@ private:
 	// Input
 	E131Dmx *m_pE131DmxIn;
 	TE131DataPacket *m_pE131DataPacket;
+	TE131SynchronizationPacket *m_pE131SynchronizationPacket;
+	DmxTransmit *m_pDmxTransmit;
+	uint16_t m_nSynchronizationAddress;
+	uint8_t m_nSynchronizationSequence;
 	TE131DiscoveryPacket *m_pE131DiscoveryPacket;
 	uint32_t m_DiscoveryIpAddress;
 	uint8_t m_Cid[E131_CID_LENGTH];
 	char m_SourceName[E131_SOURCE_NAME_LENGTH];
 
+	// Universe discovery receiver
+	E131Discovery *m_pE131Discovery;
+	bool m_bDiscoveryJoin;
+
 public:
 	static E131Bridge* Get(void) {
 		return s_pThis;
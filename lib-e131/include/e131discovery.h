@@ -0,0 +1,104 @@
+/**
+ * @file e131discovery.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef E131DISCOVERY_H_
+#define E131DISCOVERY_H_
+
+#include <stdint.h>
+
+#include "e131.h"
+#include "e131packets.h"
+
+#define E131_DISCOVERY_SOURCES_MAX		16
+#define E131_DISCOVERY_PAGES_MAX		2		///< A page holds up to 512 universes
+#define E131_DISCOVERY_TIMEOUT_SECONDS	(E131_UNIVERSE_DISCOVERY_INTERVAL_SECONDS * 5 / 2)
+
+struct TE131DiscoveryPage {
+	uint16_t nUniverses;
+	uint16_t aUniverses[512];		///< Sorted, as received
+};
+
+struct TE131DiscoverySource {
+	uint8_t Cid[E131_CID_LENGTH];
+	char SourceName[E131_SOURCE_NAME_LENGTH];
+	uint32_t nIp;
+	uint32_t nMillis;
+	uint8_t nLastPage;
+	bool bIsActive;
+	struct TE131DiscoveryPage Pages[E131_DISCOVERY_PAGES_MAX];
+};
+
+/*
+ * Source -> universe directory, built from the E1.31 Universe Discovery
+ * packets (Section 8). The pages of a source are stored as received, a
+ * source is removed when no discovery packet is received within
+ * E131_DISCOVERY_TIMEOUT_SECONDS.
+ */
+class E131Discovery {
+public:
+	E131Discovery(void);
+	~E131Discovery(void);
+
+	void Handle(const struct TE131DiscoveryPacket *pPacket, uint32_t nLength, uint32_t nIp, uint32_t nMillis);
+
+	/*
+	 * Returns true when the directory has changed, but not before a full
+	 * timeout period has passed since the start, so that all sources have
+	 * been seen.
+	 */
+	bool Run(uint32_t nMillis);
+
+	bool IsUniversePresent(uint16_t nUniverse) const;
+
+	uint32_t GetActiveSources(void) const;
+	const struct TE131DiscoverySource *GetActiveSource(uint32_t nIndex) const;
+
+	/*
+	 * Text export of directory page nPage (one page per active source),
+	 * used by the remote configuration.
+	 */
+	uint32_t Export(uint32_t nPage, char *pBuffer, uint32_t nLength) const;
+
+	void Print(void);
+
+	static E131Discovery* Get(void) {
+		return s_pThis;
+	}
+
+private:
+	struct TE131DiscoverySource *FindSource(const uint8_t *pCid);
+	bool UpdatePage(struct TE131DiscoveryPage *pPage, const uint8_t *pUniverses, uint32_t nUniverses);
+
+private:
+	struct TE131DiscoverySource *m_pSources;
+	uint32_t m_nStartMillis;
+	uint32_t m_nCheckMillis;
+	bool m_bIsSettled;
+	bool m_bIsChanged;
+
+	static E131Discovery *s_pThis;
+};
+
+#endif /* E131DISCOVERY_H_ */
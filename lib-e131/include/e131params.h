@@ -34,6 +34,9 @@
 
 #include "lightset.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 #define E131_PARAMS_MAX_PORTS	4
 
 struct TE131Params {
@@ -48,6 +51,10 @@ struct TE131Params {
 	bool bEnableNoChangeUpdate;
 	uint8_t nDirection;
 	uint8_t nPriority;
+	bool bEnableDiscovery;
+	bool bDiscoveryJoin;
+	uint16_t nInputMinInterval;
+	uint16_t nSynchronizationAddress;
 };
 
 enum TE131ParamsMask {
@@ -67,7 +74,11 @@ enum TE131ParamsMask {
 	E131_PARAMS_MASK_MERGE_TIMEOUT = (1 << 13),
 	E131_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT = (1 << 14),
 	E131_PARAMS_MASK_DIRECTION = (1 << 15),
-	E131_PARAMS_MASK_PRIORITY = (1 << 16)
+	E131_PARAMS_MASK_PRIORITY = (1 << 16),
+	E131_PARAMS_MASK_ENABLE_DISCOVERY = (1 << 17),
+	E131_PARAMS_MASK_DISCOVERY_JOIN = (1 << 18),
+	E131_PARAMS_MASK_INPUT_MIN_INTERVAL = (1 << 19),
+	E131_PARAMS_MASK_SYNCHRONIZATION_ADDRESS = (1 << 20)
 };
 
 class E131ParamsStore {
@@ -120,6 +131,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -130,6 +142,7 @@ private:
 private:
     E131ParamsStore *m_pE131ParamsStore;
     struct TE131Params m_tE131Params;
+    PropertiesParser *m_pPropertiesParser;
     uuid_t m_uuid;
 };
 
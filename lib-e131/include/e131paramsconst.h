@@ -38,6 +38,10 @@ public:
 	alignas(uint32_t) static const char DISABLE_MERGE_TIMEOUT[];
 	alignas(uint32_t) static const char DIRECTION[];
 	alignas(uint32_t) static const char PRIORITY[];
+	alignas(uint32_t) static const char ENABLE_DISCOVERY[];
+	alignas(uint32_t) static const char DISCOVERY_JOIN[];
+	alignas(uint32_t) static const char INPUT_MIN_INTERVAL[];
+	alignas(uint32_t) static const char SYNCHRONIZATION_ADDRESS[];
 };
 
 #endif /* E131PARAMSCONST_H_ */
@@ -49,6 +49,8 @@
 #include "network.h"
 #include "ledblink.h"
 
+#include "trace.h"
+
 static const uint8_t DEVICE_SOFTWARE_VERSION[] = { 1, 16 };
 static const uint8_t ACN_PACKET_IDENTIFIER[E131_PACKET_IDENTIFIER_LENGTH] = { 0x41, 0x53, 0x43, 0x2d, 0x45, 0x31, 0x2e, 0x31, 0x37, 0x00, 0x00, 0x00 }; ///< 5.3 ACN Packet Identifier
 
@@ -63,8 +65,14 @@ E131Bridge::E131Bridge(void) :
 	m_nPreviousPacketMillis(0),
 	m_pE131DmxIn(0),
 	m_pE131DataPacket(0),
+	m_pE131SynchronizationPacket(0),
+	m_pDmxTransmit(0),
+	m_nSynchronizationAddress(0),
+	m_nSynchronizationSequence(0),
 	m_pE131DiscoveryPacket(0),
-	m_DiscoveryIpAddress(0)
+	m_DiscoveryIpAddress(0),
+	m_pE131Discovery(0),
+	m_bDiscoveryJoin(false)
 {
 	assert(Hardware::Get() != 0);
 	assert(Network::Get() != 0);
@@ -83,6 +91,9 @@ E131Bridge::E131Bridge(void) :
 		m_InputPort[i].nPriority = 100;
 	}
 
+	m_pDmxTransmit = new DmxTransmit[E131_MAX_UARTS];
+	assert(m_pDmxTransmit != 0);
+
 	memset(&m_State, 0, sizeof(struct TE131BridgeState));
 	m_State.nPriority = E131_PRIORITY_LOWEST;
 
@@ -100,6 +111,16 @@ E131Bridge::E131Bridge(void) :
 
 E131Bridge::~E131Bridge(void) {
 	Stop();
+
+	SetEnableDiscovery(false);
+
+	delete [] m_pDmxTransmit;
+	m_pDmxTransmit = 0;
+
+	if (m_pE131SynchronizationPacket != 0) {
+		delete m_pE131SynchronizationPacket;
+		m_pE131SynchronizationPacket = 0;
+	}
 }
 
 void E131Bridge::Start(void) {
@@ -121,6 +142,7 @@ void E131Bridge::Start(void) {
 		}
 		for (uint32_t nPortIndex = 0; nPortIndex < E131_MAX_UARTS; nPortIndex++) {
 			if (m_InputPort[nPortIndex].bIsEnabled) {
+				m_pDmxTransmit[nPortIndex].Reset();
 				m_pE131DmxIn->Start(nPortIndex);
 			}
 		}
@@ -227,7 +249,10 @@ void E131Bridge::LeaveUniverse(uint8_t nPortIndex, uint16_t nUniverse) {
 		}
 	}
 
-	Network::Get()->LeaveGroup(m_nHandle, UniverseToMulticastIp(nUniverse));
+	if (m_OutputPort[nPortIndex].IsJoined) {
+		Network::Get()->LeaveGroup(m_nHandle, UniverseToMulticastIp(nUniverse));
+		m_OutputPort[nPortIndex].IsJoined = false;
+	}
 
 	DEBUG_EXIT
 }
@@ -290,6 +315,7 @@ void E131Bridge::SetUniverse(uint8_t nPortIndex, TE131PortDir dir, uint16_t nUni
 	Network::Get()->JoinGroup(m_nHandle, UniverseToMulticastIp(nUniverse));
 
 	m_OutputPort[nPortIndex].nUniverse = nUniverse;
+	m_OutputPort[nPortIndex].IsJoined = true;
 }
 
 bool E131Bridge::GetUniverse(uint8_t nPortIndex, uint16_t &nUniverse, TE131PortDir tDir) const {
@@ -396,12 +422,18 @@ void E131Bridge::CheckMergeTimeouts(uint8_t nPortIndex) {
 	const uint32_t timeOutB = m_nCurrentPacketMillis - m_OutputPort[nPortIndex].sourceB.time;
 
 	if (timeOutA > (uint32_t) (E131_MERGE_TIMEOUT_SECONDS * 1000)) {
+		if (m_OutputPort[nPortIndex].sourceA.ip != 0) {
+			m_OutputPort[nPortIndex].tStats.nMergeTimeouts++;
+		}
 		m_OutputPort[nPortIndex].sourceA.ip = 0;
 		memset(m_OutputPort[nPortIndex].sourceA.cid, 0, E131_CID_LENGTH);
 		m_OutputPort[nPortIndex].IsMerging = false;
 	}
 
 	if (timeOutB > (uint32_t) (E131_MERGE_TIMEOUT_SECONDS * 1000)) {
+		if (m_OutputPort[nPortIndex].sourceB.ip != 0) {
+			m_OutputPort[nPortIndex].tStats.nMergeTimeouts++;
+		}
 		m_OutputPort[nPortIndex].sourceB.ip = 0;
 		memset(m_OutputPort[nPortIndex].sourceB.cid, 0, E131_CID_LENGTH);
 		m_OutputPort[nPortIndex].IsMerging = false;
@@ -483,8 +515,12 @@ void E131Bridge::HandleDmx(void) {
 		const bool isSourceA = isIpCidMatch(pSourceA);
 		const bool isSourceB = isIpCidMatch(pSourceB);
 
+		struct TE131PortStats *pStats = &m_OutputPort[i].tStats;
+
 		bool sendNewData = false;
 
+		pStats->nReceived++;
+
 		// 6.9.2 Sequence Numbering
 		// Having first received a packet with sequence number A, a second packet with sequence number B
 		// arrives. If, using signed 8-bit binary arithmetic, B – A is less than or equal to 0, but greater than -20 then
@@ -493,19 +529,28 @@ void E131Bridge::HandleDmx(void) {
 			const int8_t diff = (int8_t) (m_E131.E131Packet.Data.FrameLayer.SequenceNumber - pSourceA->sequenceNumberData);
 			pSourceA->sequenceNumberData = m_E131.E131Packet.Data.FrameLayer.SequenceNumber;
 			if ((diff <= (int8_t) 0) && (diff > (int8_t) -20)) {
+				pStats->nOutOfOrder++;
 				continue;
 			}
+			if (diff > (int8_t) 1) {
+				pStats->nSequenceLost += (uint32_t) (diff - 1);
+			}
 		} else if (isSourceB) {
 			const int8_t diff = (int8_t) (m_E131.E131Packet.Data.FrameLayer.SequenceNumber - pSourceB->sequenceNumberData);
 			pSourceB->sequenceNumberData = m_E131.E131Packet.Data.FrameLayer.SequenceNumber;
 			if ((diff <= (int8_t) 0) && (diff > (int8_t) -20)) {
+				pStats->nOutOfOrder++;
 				continue;
 			}
+			if (diff > (int8_t) 1) {
+				pStats->nSequenceLost += (uint32_t) (diff - 1);
+			}
 		}
 
 		// This bit, when set to 1, indicates that the data in this packet is intended for use in visualization or media
 		// server preview applications and shall not be used to generate live output.
 		if ((m_E131.E131Packet.Data.FrameLayer.Options & E131_OPTIONS_MASK_PREVIEW_DATA) != 0) {
+			pStats->nDiscarded++;
 			continue;
 		}
 
@@ -526,6 +571,7 @@ void E131Bridge::HandleDmx(void) {
 
 		if (m_E131.E131Packet.Data.FrameLayer.Priority < m_State.nPriority ){
 			if (!IsPriorityTimeOut(i)) {
+				pStats->nDiscarded++;
 				continue;
 			}
 			m_State.nPriority = m_E131.E131Packet.Data.FrameLayer.Priority;
@@ -561,6 +607,7 @@ void E131Bridge::HandleDmx(void) {
 
 		} else if (!isSourceA && (ipB == 0)) {
 			//printf("4. New ip, start merging\n");
+			pStats->nMerged++;
 			pSourceB->ip = m_E131.IPAddressFrom;
 			pSourceB->sequenceNumberData = m_E131.E131Packet.Data.FrameLayer.SequenceNumber;
 			memcpy(pSourceB->cid, m_E131.E131Packet.Data.RootLayer.Cid, 16);
@@ -570,6 +617,7 @@ void E131Bridge::HandleDmx(void) {
 
 		} else if ((ipA == 0) && !isSourceB) {
 			//printf("5. New ip, start merging\n");
+			pStats->nMerged++;
 			pSourceA->ip = m_E131.IPAddressFrom;
 			pSourceA->sequenceNumberData = m_E131.E131Packet.Data.FrameLayer.SequenceNumber;
 			memcpy(pSourceA->cid, m_E131.E131Packet.Data.RootLayer.Cid, 16);
@@ -579,6 +627,7 @@ void E131Bridge::HandleDmx(void) {
 
 		} else if (isSourceA && !isSourceB) {
 			//printf("6. Continue merging\n");
+			pStats->nMerged++;
 			pSourceA->sequenceNumberData = m_E131.E131Packet.Data.FrameLayer.SequenceNumber;
 			pSourceA->time = m_nCurrentPacketMillis;
 			memcpy((void *)pSourceA->data, (const void *)p, slots);
@@ -586,6 +635,7 @@ void E131Bridge::HandleDmx(void) {
 
 		} else if (!isSourceA && isSourceB) {
 			//printf("7. Continue merging\n");
+			pStats->nMerged++;
 			pSourceB->sequenceNumberData = m_E131.E131Packet.Data.FrameLayer.SequenceNumber;
 			pSourceB->time = m_nCurrentPacketMillis;
 			memcpy((void *)pSourceB->data, (const void *)p, slots);
@@ -597,6 +647,7 @@ void E131Bridge::HandleDmx(void) {
 			return;
 
 		} else if (!isSourceA && !isSourceB) {
+			pStats->nDiscarded++;
 			printf("9. More than two sources, discarding data\n");
 			assert(0);
 			return;
@@ -636,7 +687,10 @@ void E131Bridge::HandleDmx(void) {
 		if (sendNewData || m_bDirectUpdate) {
 			if (!m_State.IsSynchronized) {
 
+				TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_BEGIN, i);
 				m_pLightSet->SetData(i, m_OutputPort[i].data, m_OutputPort[i].length);
+				TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_END, i);
+				pStats->nUpdates++;
 
 				if (!m_OutputPort[i].IsTransmitting) {
 					m_pLightSet->Start(i);
@@ -663,6 +717,12 @@ void E131Bridge::HandleSynchronization(void) {
 
 	const uint16_t nSynchronizationAddress = __builtin_bswap16(m_E131.E131Packet.Synchronization.FrameLayer.UniverseNumber);
 
+	// 6.3.3 The Synchronization Address is in the range 1 to 63999
+	if ((nSynchronizationAddress == 0) || (nSynchronizationAddress > E131_UNIVERSE_MAX)) {
+		DEBUG_PUTS("Invalid Synchronization Address");
+		return;
+	}
+
 	if ((nSynchronizationAddress != m_State.nSynchronizationAddressSourceA) && (nSynchronizationAddress != m_State.nSynchronizationAddressSourceB)) {
 		DEBUG_PUTS("");
 		return;
@@ -670,10 +730,19 @@ void E131Bridge::HandleSynchronization(void) {
 
 	m_State.SynchronizationTime = m_nCurrentPacketMillis;
 
+	if (m_pLightSet == 0) {
+		return;
+	}
+
+	m_pLightSet->BeginFrame();
+
 	for (uint32_t i = 0; i < E131_MAX_PORTS; i++) {
 		if ((m_OutputPort[i].IsDataPending) || (m_OutputPort[i].bIsEnabled && m_bDirectUpdate)){
 
+			TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_BEGIN, i);
 			m_pLightSet->SetData(i, m_OutputPort[i].data, m_OutputPort[i].length);
+			TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_END, i);
+			m_OutputPort[i].tStats.nUpdates++;
 
 			if (!m_OutputPort[i].IsTransmitting) {
 				m_pLightSet->Start(i);
@@ -683,6 +752,8 @@ void E131Bridge::HandleSynchronization(void) {
 			m_OutputPort[i].IsDataPending = false;
 		}
 	}
+
+	m_pLightSet->CommitFrame();
 }
 
 void E131Bridge::SetNetworkDataLossCondition(bool bSourceA, bool bSourceB) {
@@ -771,7 +842,9 @@ void E131Bridge::Clear(uint8_t nPortIndex) {
 
 	m_OutputPort[nPortIndex].length = E131_DMX_LENGTH;
 
+	TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_BEGIN, nPortIndex);
 	m_pLightSet->SetData(nPortIndex, m_OutputPort[nPortIndex].data, m_OutputPort[nPortIndex].length);
+	TRACE_LIGHTSET_EVENT(TRACE_LIGHTSET_SETDATA_END, nPortIndex);
 
 	if (m_OutputPort[nPortIndex].bIsEnabled && !m_OutputPort[nPortIndex].IsTransmitting) {
 		m_pLightSet->Start(nPortIndex);
@@ -781,6 +854,12 @@ void E131Bridge::Clear(uint8_t nPortIndex) {
 	m_State.IsNetworkDataLoss = false; // Force timeout
 }
 
+void E131Bridge::ClearPortStats(void) {
+	for (uint32_t i = 0; i < E131_MAX_PORTS; i++) {
+		memset(&m_OutputPort[i].tStats, 0, sizeof(struct TE131PortStats));
+	}
+}
+
 bool E131Bridge::IsValidRoot(void) {
 	// 5 E1.31 use of the ACN Root Layer Protocol
 	// Receivers shall discard the packet if the ACN Packet Identifier is not valid.
@@ -850,6 +929,10 @@ void E131Bridge::Run(void) {
 			}
 		}
 
+		if (m_pE131Discovery != 0) {
+			RunDiscovery();
+		}
+
 		if (m_pE131DmxIn != 0) {
 			HandleDmxIn();
 			SendDiscoveryPacket();
@@ -871,6 +954,18 @@ void E131Bridge::Run(void) {
 		return;
 	}
 
+	const uint32_t nRootVector = __builtin_bswap32(m_E131.E131Packet.Raw.RootLayer.Vector);
+
+	// Discovery packets are not DMX data, the network data loss timing is not changed
+	if ((nRootVector == E131_VECTOR_ROOT_EXTENDED) && (m_E131.E131Packet.Raw.FrameLayer.Vector == __builtin_bswap32(E131_VECTOR_EXTENDED_DISCOVERY))) {
+		if (m_pE131Discovery != 0) {
+			HandleDiscovery(nBytesReceived);
+		}
+		return;
+	}
+
+	TRACE_E131_EVENT(TRACE_E131_PACKET_BEGIN, nBytesReceived);
+
 	m_State.IsNetworkDataLoss = false;
 	m_nPreviousPacketMillis = m_nCurrentPacketMillis;
 
@@ -880,11 +975,11 @@ void E131Bridge::Run(void) {
 		}
 	}
 
-	const uint32_t nRootVector = __builtin_bswap32(m_E131.E131Packet.Raw.RootLayer.Vector);
-
 	if (nRootVector == E131_VECTOR_ROOT_DATA) {
 		if (IsValidDataPacket()) {
+			TRACE_E131_EVENT(TRACE_E131_DMX_BEGIN, nBytesReceived);
 			HandleDmx();
+			TRACE_E131_EVENT(TRACE_E131_DMX_END, nBytesReceived);
 		}
 	} else if (nRootVector == E131_VECTOR_ROOT_EXTENDED) {
 		const uint32_t nFramingVector = __builtin_bswap32(m_E131.E131Packet.Raw.FrameLayer.Vector);
@@ -895,6 +990,9 @@ void E131Bridge::Run(void) {
 		DEBUG_PRINTF("Not supported Root Vector : 0x%x", nRootVector);
 	}
 
+	if (m_pE131Discovery != 0) {
+		RunDiscovery();
+	}
 
 	if (m_pE131DmxIn != 0) {
 		HandleDmxIn();
@@ -910,5 +1008,5 @@ void E131Bridge::Run(void) {
 		}
 	}
 
-	return;
+	TRACE_E131_EVENT(TRACE_E131_PACKET_END, nBytesReceived);
 }
@@ -0,0 +1,133 @@
+/**
+ * @file e131bridgediscovery.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "e131bridge.h"
+#include "e131discovery.h"
+
+#include "network.h"
+
+#include "debug.h"
+
+void E131Bridge::SetEnableDiscovery(bool bEnable) {
+	DEBUG_ENTRY
+
+	if (bEnable && (m_pE131Discovery == 0)) {
+		m_pE131Discovery = new E131Discovery;
+		assert(m_pE131Discovery != 0);
+
+		Network::Get()->JoinGroup(m_nHandle, UniverseToMulticastIp(E131_UNIVERSE_DISCOVERY));
+	} else if (!bEnable && (m_pE131Discovery != 0)) {
+		Network::Get()->LeaveGroup(m_nHandle, UniverseToMulticastIp(E131_UNIVERSE_DISCOVERY));
+
+		delete m_pE131Discovery;
+		m_pE131Discovery = 0;
+
+		SetDiscoveryJoin(false);
+	}
+
+	DEBUG_EXIT
+}
+
+void E131Bridge::SetDiscoveryJoin(bool bDiscoveryJoin) {
+	DEBUG_ENTRY
+
+	if (bDiscoveryJoin) {
+		SetEnableDiscovery(true);
+	}
+
+	m_bDiscoveryJoin = bDiscoveryJoin;
+
+	if (!m_bDiscoveryJoin) {
+		// Back to joining all the output universes
+		for (uint32_t i = 0; i < E131_MAX_PORTS; i++) {
+			if (m_OutputPort[i].bIsEnabled && !m_OutputPort[i].IsJoined) {
+				Network::Get()->JoinGroup(m_nHandle, UniverseToMulticastIp(m_OutputPort[i].nUniverse));
+				m_OutputPort[i].IsJoined = true;
+			}
+		}
+	}
+
+	DEBUG_EXIT
+}
+
+void E131Bridge::HandleDiscovery(uint32_t nLength) {
+	// Our own discovery packets when there are input ports
+	if (memcmp(m_E131.E131Packet.Discovery.RootLayer.Cid, m_Cid, E131_CID_LENGTH) == 0) {
+		return;
+	}
+
+	m_pE131Discovery->Handle(&m_E131.E131Packet.Discovery, nLength, m_E131.IPAddressFrom, m_nCurrentPacketMillis);
+}
+
+void E131Bridge::RunDiscovery(void) {
+	if (m_pE131Discovery->Run(m_nCurrentPacketMillis) && m_bDiscoveryJoin) {
+		UpdateDiscoveryJoin();
+	}
+}
+
+void E131Bridge::UpdateDiscoveryJoin(void) {
+	DEBUG_ENTRY
+
+	for (uint32_t i = 0; i < E131_MAX_PORTS; i++) {
+		if (!m_OutputPort[i].bIsEnabled) {
+			continue;
+		}
+
+		const uint16_t nUniverse = m_OutputPort[i].nUniverse;
+		const bool bIsPresent = m_pE131Discovery->IsUniversePresent(nUniverse);
+
+		if (bIsPresent == m_OutputPort[i].IsJoined) {
+			continue;
+		}
+
+		// The group is shared by the ports with the same universe
+		bool bIsShared = false;
+
+		for (uint32_t j = 0; j < i; j++) {
+			if (m_OutputPort[j].bIsEnabled && (m_OutputPort[j].nUniverse == nUniverse)) {
+				bIsShared = true;
+				break;
+			}
+		}
+
+		if (!bIsShared) {
+			if (bIsPresent) {
+				Network::Get()->JoinGroup(m_nHandle, UniverseToMulticastIp(nUniverse));
+			} else {
+				Network::Get()->LeaveGroup(m_nHandle, UniverseToMulticastIp(nUniverse));
+			}
+		}
+
+		DEBUG_PRINTF("Port %d, Universe %d -> %s", i, nUniverse, bIsPresent ? "Join" : "Leave");
+
+		m_OutputPort[i].IsJoined = bIsPresent;
+	}
+
+	DEBUG_EXIT
+}
@@ -47,7 +47,7 @@ void E131Bridge::FillDataPacket(void) {
 	// E1.31 Framing Layer (See Section 6)
 	m_pE131DataPacket->FrameLayer.Vector = __builtin_bswap32(E131_VECTOR_DATA_PACKET);
 	memcpy(m_pE131DataPacket->FrameLayer.SourceName, m_SourceName, E131_SOURCE_NAME_LENGTH);
-	m_pE131DataPacket->FrameLayer.SynchronizationAddress = __builtin_bswap16(0); // Currently not supported
+	m_pE131DataPacket->FrameLayer.SynchronizationAddress = __builtin_bswap16(m_nSynchronizationAddress);
 	m_pE131DataPacket->FrameLayer.Options = 0;
 	// Data Layer
 	m_pE131DataPacket->DMPLayer.Vector = (uint8_t) E131_VECTOR_DMP_SET_PROPERTY;
@@ -56,9 +56,60 @@ void E131Bridge::FillDataPacket(void) {
 	m_pE131DataPacket->DMPLayer.AddressIncrement = __builtin_bswap16(0x0001);
 }
 
+void E131Bridge::FillSynchronizationPacket(void) {
+	memset(m_pE131SynchronizationPacket, 0, sizeof(struct TE131SynchronizationPacket));
+
+	// Root Layer (See Section 4.2)
+	m_pE131SynchronizationPacket->RootLayer.PreAmbleSize = __builtin_bswap16(0x10);
+	memcpy(m_pE131SynchronizationPacket->RootLayer.ACNPacketIdentifier, E117Const::ACN_PACKET_IDENTIFIER, E117_PACKET_IDENTIFIER_LENGTH);
+	m_pE131SynchronizationPacket->RootLayer.FlagsLength = __builtin_bswap16((0x07 << 12) | (SYNCHRONIZATION_ROOT_LAYER_LENGTH));
+	m_pE131SynchronizationPacket->RootLayer.Vector = __builtin_bswap32(E131_VECTOR_ROOT_EXTENDED);
+	memcpy(m_pE131SynchronizationPacket->RootLayer.Cid, m_Cid, E131_CID_LENGTH);
+
+	// E1.31 Framing Layer (See Section 6)
+	m_pE131SynchronizationPacket->FrameLayer.FLagsLength = __builtin_bswap16((0x07 << 12) | (SYNCHRONIZATION_LAYER_LENGTH) );
+	m_pE131SynchronizationPacket->FrameLayer.Vector = __builtin_bswap32(E131_VECTOR_EXTENDED_SYNCHRONIZATION);
+	m_pE131SynchronizationPacket->FrameLayer.UniverseNumber = __builtin_bswap16(m_nSynchronizationAddress);
+}
+
+void E131Bridge::SendSynchronizationPacket(void) {
+	assert(m_pE131SynchronizationPacket != 0);
+
+	m_pE131SynchronizationPacket->FrameLayer.SequenceNumber = m_nSynchronizationSequence++;
+
+	Network::Get()->SendTo(m_nHandle, (const uint8_t *) m_pE131SynchronizationPacket, SYNCHRONIZATION_PACKET_SIZE, UniverseToMulticastIp(m_nSynchronizationAddress), E131_DEFAULT_PORT);
+}
+
+void E131Bridge::SetInputSynchronizationAddress(uint16_t nUniverse) {
+	assert(nUniverse <= E131_UNIVERSE_MAX);
+
+	m_nSynchronizationAddress = nUniverse;
+
+	if (m_pE131DataPacket != 0) {
+		m_pE131DataPacket->FrameLayer.SynchronizationAddress = __builtin_bswap16(nUniverse);
+	}
+
+	if (nUniverse == 0) {
+		return;
+	}
+
+	if (m_pE131SynchronizationPacket == 0) {
+		m_pE131SynchronizationPacket = new struct TE131SynchronizationPacket;
+		assert(m_pE131SynchronizationPacket != 0);
+	}
+
+	FillSynchronizationPacket();
+}
+
+/*
+ * Only changed frames are sent, the unchanged data is repeated as keep-alive.
+ * E1.31 6.6.1: 3 repeats, then at least every 800ms.
+ */
 void E131Bridge::HandleDmxIn(void) {
 	assert(m_pE131DataPacket != 0);
 
+	bool bIsSent = false;
+
 	for (uint32_t i = 0 ; i < E131_MAX_UARTS; i++) {
 		uint32_t nUpdatesPerSecond;
 
@@ -67,27 +118,40 @@ void E131Bridge::HandleDmxIn(void) {
 			const uint8_t *pDmxData = m_pE131DmxIn->Handler(i, nLength, nUpdatesPerSecond);
 
 			if (pDmxData != 0) {
+				m_State.bIsReceivingDmx = true;
+			} else {
+				nLength = 0;
+
+				if (nUpdatesPerSecond == 0) {
+					m_State.bIsReceivingDmx = false;
+					m_pDmxTransmit[i].Reset();
+				}
+			}
+
+			uint32_t nSendLength;
+			const uint8_t *pSendData = m_pDmxTransmit[i].Handler(m_nCurrentPacketMillis, pDmxData, nLength, nSendLength);
+
+			if (pSendData != 0) {
 				// Root Layer (See Section 5)
-				m_pE131DataPacket->RootLayer.FlagsLength = __builtin_bswap16((0x07 << 12) | ((uint16_t) DATA_ROOT_LAYER_LENGTH(nLength)));
+				m_pE131DataPacket->RootLayer.FlagsLength = __builtin_bswap16((0x07 << 12) | ((uint16_t) DATA_ROOT_LAYER_LENGTH(nSendLength)));
 				// E1.31 Framing Layer (See Section 6)
-				m_pE131DataPacket->FrameLayer.FLagsLength = __builtin_bswap16((0x07 << 12) | (uint16_t) (DATA_FRAME_LAYER_LENGTH(nLength)));
+				m_pE131DataPacket->FrameLayer.FLagsLength = __builtin_bswap16((0x07 << 12) | (uint16_t) (DATA_FRAME_LAYER_LENGTH(nSendLength)));
 				m_pE131DataPacket->FrameLayer.Priority = m_InputPort[i].nPriority;
 				m_pE131DataPacket->FrameLayer.SequenceNumber = m_InputPort[i].nSequenceNumber++;
 				m_pE131DataPacket->FrameLayer.Universe = __builtin_bswap16(m_InputPort[i].nUniverse);
 				// Data Layer
-				m_pE131DataPacket->DMPLayer.FlagsLength = __builtin_bswap16((0x07 << 12) | (uint16_t) (DATA_LAYER_LENGTH(nLength)));
-				memcpy((void *) m_pE131DataPacket->DMPLayer.PropertyValues, (const void *) pDmxData, nLength);
-				m_pE131DataPacket->DMPLayer.PropertyValueCount = __builtin_bswap16(nLength);
+				m_pE131DataPacket->DMPLayer.FlagsLength = __builtin_bswap16((0x07 << 12) | (uint16_t) (DATA_LAYER_LENGTH(nSendLength)));
+				memcpy((void *) m_pE131DataPacket->DMPLayer.PropertyValues, (const void *) pSendData, nSendLength);
+				m_pE131DataPacket->DMPLayer.PropertyValueCount = __builtin_bswap16((uint16_t) nSendLength);
 
-				Network::Get()->SendTo(m_nHandle, (const uint8_t *)m_pE131DataPacket, DATA_PACKET_SIZE(nLength), m_InputPort[i].nMulticastIp, E131_DEFAULT_PORT);
+				Network::Get()->SendTo(m_nHandle, (const uint8_t *)m_pE131DataPacket, DATA_PACKET_SIZE(nSendLength), m_InputPort[i].nMulticastIp, E131_DEFAULT_PORT);
 
-				m_State.bIsReceivingDmx = true;
-			} else {
-				if (nUpdatesPerSecond == 0) {
-					m_State.bIsReceivingDmx = false;
-				}
+				bIsSent = true;
 			}
 		}
 	}
-}
 
+	if (bIsSent && (m_nSynchronizationAddress != 0)) {
+		SendSynchronizationPacket();
+	}
+}
@@ -62,9 +62,18 @@ void E131Bridge::Print(void) {
 				printf("  Port %2d Universe %-3d [%d]\n", (int) i, nUniverse, GetPriority(i));
 			}
 		}
+
+		if (m_nSynchronizationAddress != 0) {
+			printf(" Synchronization Universe : %d\n", m_nSynchronizationAddress);
+		}
 	}
 
 	if (m_bDirectUpdate) {
 		printf(" Direct update : Yes\n");
 	}
+
+	if (m_pE131Discovery != 0) {
+		printf(" Discovery : Yes%s\n", m_bDiscoveryJoin ? " [Join]" : "");
+		m_pE131Discovery->Print();
+	}
 }
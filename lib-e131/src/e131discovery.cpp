@@ -0,0 +1,259 @@
+/**
+ * @file e131discovery.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "e131discovery.h"
+#include "e131.h"
+#include "e131packets.h"
+
+#include "hardware.h"
+
+#include "debug.h"
+
+E131Discovery *E131Discovery::s_pThis = 0;
+
+E131Discovery::E131Discovery(void):
+	m_pSources(0),
+	m_nStartMillis(Hardware::Get()->Millis()),
+	m_nCheckMillis(0),
+	m_bIsSettled(false),
+	m_bIsChanged(true)
+{
+	DEBUG_ENTRY
+
+	s_pThis = this;
+
+	m_pSources = new struct TE131DiscoverySource[E131_DISCOVERY_SOURCES_MAX];
+	assert(m_pSources != 0);
+
+	for (uint32_t i = 0; i < E131_DISCOVERY_SOURCES_MAX; i++) {
+		m_pSources[i].bIsActive = false;
+	}
+
+	DEBUG_EXIT
+}
+
+E131Discovery::~E131Discovery(void) {
+	delete [] m_pSources;
+	m_pSources = 0;
+
+	s_pThis = 0;
+}
+
+struct TE131DiscoverySource *E131Discovery::FindSource(const uint8_t *pCid) {
+	struct TE131DiscoverySource *pFree = 0;
+
+	for (uint32_t i = 0; i < E131_DISCOVERY_SOURCES_MAX; i++) {
+		if (m_pSources[i].bIsActive) {
+			if (memcmp(m_pSources[i].Cid, pCid, E131_CID_LENGTH) == 0) {
+				return &m_pSources[i];
+			}
+		} else if (pFree == 0) {
+			pFree = &m_pSources[i];
+		}
+	}
+
+	if (pFree != 0) {
+		memcpy(pFree->Cid, pCid, E131_CID_LENGTH);
+		pFree->nLastPage = 0;
+		pFree->bIsActive = true;
+
+		for (uint32_t i = 0; i < E131_DISCOVERY_PAGES_MAX; i++) {
+			pFree->Pages[i].nUniverses = 0;
+		}
+
+		m_bIsChanged = true;
+	}
+
+	return pFree;
+}
+
+bool E131Discovery::UpdatePage(struct TE131DiscoveryPage *pPage, const uint8_t *pUniverses, uint32_t nUniverses) {
+	bool bIsChanged = (pPage->nUniverses != nUniverses);
+
+	for (uint32_t i = 0; i < nUniverses; i++) {
+		uint16_t nUniverse;
+		memcpy(&nUniverse, &pUniverses[i * 2], sizeof(uint16_t));
+		nUniverse = __builtin_bswap16(nUniverse);
+
+		if (pPage->aUniverses[i] != nUniverse) {
+			pPage->aUniverses[i] = nUniverse;
+			bIsChanged = true;
+		}
+	}
+
+	pPage->nUniverses = nUniverses;
+
+	return bIsChanged;
+}
+
+void E131Discovery::Handle(const struct TE131DiscoveryPacket *pPacket, uint32_t nLength, uint32_t nIp, uint32_t nMillis) {
+	DEBUG_ENTRY
+
+	if ((nLength < DISCOVERY_PACKET_SIZE(0)) || (pPacket->UniverseDiscoveryLayer.Vector != __builtin_bswap32(VECTOR_UNIVERSE_DISCOVERY_UNIVERSE_LIST))) {
+		DEBUG_EXIT
+		return;
+	}
+
+	const uint32_t nLayerLength = __builtin_bswap16(pPacket->UniverseDiscoveryLayer.FlagsLength) & 0x0FFF;
+
+	if (nLayerLength < DISCOVERY_LAYER_LENGTH(0)) {
+		DEBUG_EXIT
+		return;
+	}
+
+	uint32_t nUniverses = (nLayerLength - DISCOVERY_LAYER_LENGTH(0)) / 2;
+
+	if (nUniverses > 512) {
+		nUniverses = 512;
+	}
+
+	while (DISCOVERY_PACKET_SIZE(nUniverses) > nLength) {
+		nUniverses--;
+	}
+
+	struct TE131DiscoverySource *pSource = FindSource(pPacket->RootLayer.Cid);
+
+	if (pSource == 0) {
+		DEBUG_PUTS("Directory is full");
+		DEBUG_EXIT
+		return;
+	}
+
+	pSource->nIp = nIp;
+	pSource->nMillis = nMillis;
+	memcpy(pSource->SourceName, pPacket->FrameLayer.SourceName, E131_SOURCE_NAME_LENGTH);
+	pSource->SourceName[E131_SOURCE_NAME_LENGTH - 1] = '\0';
+
+	const uint32_t nPage = pPacket->UniverseDiscoveryLayer.Page;
+	const uint32_t nLastPage = pPacket->UniverseDiscoveryLayer.LastPage;
+
+	DEBUG_PRINTF("nPage=%d, nLastPage=%d, nUniverses=%d", nPage, nLastPage, nUniverses);
+
+	if (pSource->nLastPage != nLastPage) {
+		for (uint32_t i = nLastPage + 1; i < E131_DISCOVERY_PAGES_MAX; i++) {
+			pSource->Pages[i].nUniverses = 0;
+		}
+
+		pSource->nLastPage = nLastPage;
+		m_bIsChanged = true;
+	}
+
+	if ((nPage <= nLastPage) && (nPage < E131_DISCOVERY_PAGES_MAX)) {
+		if (UpdatePage(&pSource->Pages[nPage], (const uint8_t *) pPacket->UniverseDiscoveryLayer.ListOfUniverses, nUniverses)) {
+			m_bIsChanged = true;
+		}
+	}
+
+	DEBUG_EXIT
+}
+
+bool E131Discovery::Run(uint32_t nMillis) {
+	if (__builtin_expect(((nMillis - m_nCheckMillis) < 1000), 1)) {
+		return false;
+	}
+
+	m_nCheckMillis = nMillis;
+
+	for (uint32_t i = 0; i < E131_DISCOVERY_SOURCES_MAX; i++) {
+		if (m_pSources[i].bIsActive && ((nMillis - m_pSources[i].nMillis) >= (E131_DISCOVERY_TIMEOUT_SECONDS * 1000))) {
+			DEBUG_PRINTF("Source %d timed out", i);
+			m_pSources[i].bIsActive = false;
+			m_bIsChanged = true;
+		}
+	}
+
+	if (!m_bIsSettled) {
+		if ((nMillis - m_nStartMillis) < (E131_DISCOVERY_TIMEOUT_SECONDS * 1000)) {
+			return false;
+		}
+
+		m_bIsSettled = true;
+	}
+
+	const bool bIsChanged = m_bIsChanged;
+	m_bIsChanged = false;
+
+	return bIsChanged;
+}
+
+bool E131Discovery::IsUniversePresent(uint16_t nUniverse) const {
+	for (uint32_t i = 0; i < E131_DISCOVERY_SOURCES_MAX; i++) {
+		if (!m_pSources[i].bIsActive) {
+			continue;
+		}
+
+		for (uint32_t nPage = 0; (nPage <= m_pSources[i].nLastPage) && (nPage < E131_DISCOVERY_PAGES_MAX); nPage++) {
+			const struct TE131DiscoveryPage *pPage = &m_pSources[i].Pages[nPage];
+
+			int32_t nLow = 0;
+			int32_t nHigh = (int32_t) pPage->nUniverses - 1;
+
+			while (nLow <= nHigh) {
+				const int32_t nMiddle = (nLow + nHigh) / 2;
+
+				if (pPage->aUniverses[nMiddle] == nUniverse) {
+					return true;
+				}
+
+				if (pPage->aUniverses[nMiddle] < nUniverse) {
+					nLow = nMiddle + 1;
+				} else {
+					nHigh = nMiddle - 1;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+uint32_t E131Discovery::GetActiveSources(void) const {
+	uint32_t nSources = 0;
+
+	for (uint32_t i = 0; i < E131_DISCOVERY_SOURCES_MAX; i++) {
+		if (m_pSources[i].bIsActive) {
+			nSources++;
+		}
+	}
+
+	return nSources;
+}
+
+const struct TE131DiscoverySource *E131Discovery::GetActiveSource(uint32_t nIndex) const {
+	for (uint32_t i = 0; i < E131_DISCOVERY_SOURCES_MAX; i++) {
+		if (m_pSources[i].bIsActive) {
+			if (nIndex == 0) {
+				return &m_pSources[i];
+			}
+			nIndex--;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file e131discoveryprint.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "e131discovery.h"
+
+#include "network.h"
+
+void E131Discovery::Print(void) {
+	const uint32_t nSources = GetActiveSources();
+
+	printf("Universe discovery\n");
+	printf(" Sources : %d\n", (int) nSources);
+
+	for (uint32_t i = 0; i < nSources; i++) {
+		const struct TE131DiscoverySource *pSource = GetActiveSource(i);
+
+		printf("  " IPSTR " %.32s\n  ", IP2STR(pSource->nIp), pSource->SourceName);
+
+		for (uint32_t nPage = 0; (nPage <= pSource->nLastPage) && (nPage < E131_DISCOVERY_PAGES_MAX); nPage++) {
+			for (uint32_t j = 0; j < pSource->Pages[nPage].nUniverses; j++) {
+				printf(" %d", pSource->Pages[nPage].aUniverses[j]);
+			}
+		}
+
+		puts("");
+	}
+}
+
+static int ExportRange(char *pBuffer, uint32_t nLength, const char *pSeparator, int32_t nFirst, int32_t nLast) {
+	if (nFirst == nLast) {
+		return snprintf(pBuffer, nLength, "%s%d", pSeparator, (int) nFirst);
+	}
+
+	return snprintf(pBuffer, nLength, "%s%d-%d", pSeparator, (int) nFirst, (int) nLast);
+}
+
+uint32_t E131Discovery::Export(uint32_t nPage, char *pBuffer, uint32_t nLength) const {
+	const uint32_t nSources = GetActiveSources();
+	const struct TE131DiscoverySource *pSource = GetActiveSource(nPage);
+
+	int nSize = snprintf(pBuffer, nLength, "discovery:%d/%d\n", (int) nPage, (int) nSources);
+
+	if ((pSource == 0) || (nSize >= (int) nLength)) {
+		return (nSize < (int) nLength) ? nSize : nLength;
+	}
+
+	nSize += snprintf(&pBuffer[nSize], nLength - nSize, IPSTR ",%s\n", IP2STR(pSource->nIp), pSource->SourceName);
+
+	if (nSize >= (int) nLength) {
+		return nLength;
+	}
+
+	// Consecutive universes are exported as a range
+	int32_t nFirst = -1;
+	int32_t nPrevious = -1;
+	const char *pSeparator = "";
+
+	for (uint32_t nPageIndex = 0; (nPageIndex <= pSource->nLastPage) && (nPageIndex < E131_DISCOVERY_PAGES_MAX); nPageIndex++) {
+		for (uint32_t j = 0; j < pSource->Pages[nPageIndex].nUniverses; j++) {
+			const int32_t nUniverse = pSource->Pages[nPageIndex].aUniverses[j];
+
+			if ((nFirst != -1) && (nUniverse != (nPrevious + 1))) {
+				nSize += ExportRange(&pBuffer[nSize], nLength - nSize, pSeparator, nFirst, nPrevious);
+				pSeparator = ",";
+				nFirst = -1;
+
+				if (nSize >= (int) nLength) {
+					return nLength;
+				}
+			}
+
+			if (nFirst == -1) {
+				nFirst = nUniverse;
+			}
+
+			nPrevious = nUniverse;
+		}
+	}
+
+	if (nFirst != -1) {
+		nSize += ExportRange(&pBuffer[nSize], nLength - nSize, pSeparator, nFirst, nPrevious);
+	}
+
+	if (nSize < (int) nLength) {
+		nSize += snprintf(&pBuffer[nSize], nLength - nSize, "\n");
+	}
+
+	return (nSize < (int) nLength) ? nSize : nLength;
+}
@@ -36,6 +36,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #include "lightsetconst.h"
 
@@ -44,7 +45,53 @@
 #define BOOL2STRING(b)			(b) ? "Yes" : "No"
 #define MERGEMODE2STRING(m)		(m == E131_MERGE_HTP) ? "HTP" : "LTP"
 
-E131Params::E131Params(E131ParamsStore *pE131ParamsStore):m_pE131ParamsStore(pE131ParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TE131Params, f)
+
+enum TE131ParamsKey {
+	KEY_UNIVERSE,
+	KEY_MERGE_MODE,
+	KEY_NETWORK_DATA_LOSS_TIMEOUT,
+	KEY_DISABLE_MERGE_TIMEOUT,
+	KEY_ENABLE_NO_CHANGE_UPDATE,
+	KEY_DIRECTION,
+	KEY_PRIORITY,
+	KEY_ENABLE_DISCOVERY,
+	KEY_DISCOVERY_JOIN,
+	KEY_INPUT_MIN_INTERVAL,
+	KEY_SYNCHRONIZATION_ADDRESS,
+	KEY_UNIVERSE_PORT_A,
+	KEY_MERGE_MODE_PORT_A = KEY_UNIVERSE_PORT_A + E131_PARAMS_MAX_PORTS
+};
+
+// Must be in the order of TE131ParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ LightSetConst::PARAMS_UNIVERSE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ E131ParamsConst::MERGE_MODE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ E131ParamsConst::NETWORK_DATA_LOSS_TIMEOUT, OFFSET(nNetworkTimeout), PROPERTIES_TYPE_FLOAT, E131_PARAMS_MASK_NETWORK_TIMEOUT, 0, 0 },
+	{ E131ParamsConst::DISABLE_MERGE_TIMEOUT, OFFSET(bDisableMergeTimeout), PROPERTIES_TYPE_BOOL, E131_PARAMS_MASK_MERGE_TIMEOUT, 0, 0 },
+	{ LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE, OFFSET(bEnableNoChangeUpdate), PROPERTIES_TYPE_BOOL, E131_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT, 0, 0 },
+	{ E131ParamsConst::DIRECTION, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ E131ParamsConst::PRIORITY, OFFSET(nPriority), PROPERTIES_TYPE_UINT8, E131_PARAMS_MASK_PRIORITY, E131_PRIORITY_LOWEST, E131_PRIORITY_HIGHEST },
+	{ E131ParamsConst::ENABLE_DISCOVERY, OFFSET(bEnableDiscovery), PROPERTIES_TYPE_BOOL, E131_PARAMS_MASK_ENABLE_DISCOVERY, 0, 0 },
+	{ E131ParamsConst::DISCOVERY_JOIN, OFFSET(bDiscoveryJoin), PROPERTIES_TYPE_BOOL, E131_PARAMS_MASK_DISCOVERY_JOIN, 0, 0 },
+	{ E131ParamsConst::INPUT_MIN_INTERVAL, OFFSET(nInputMinInterval), PROPERTIES_TYPE_UINT16, E131_PARAMS_MASK_INPUT_MIN_INTERVAL, 0, 0xFFFF },
+	{ E131ParamsConst::SYNCHRONIZATION_ADDRESS, OFFSET(nSynchronizationAddress), PROPERTIES_TYPE_UINT16, E131_PARAMS_MASK_SYNCHRONIZATION_ADDRESS, 1, E131_UNIVERSE_MAX },
+	{ E131ParamsConst::UNIVERSE_PORT[0], OFFSET(nUniversePort) + 0 * sizeof(uint16_t), PROPERTIES_TYPE_UINT16, E131_PARAMS_MASK_UNIVERSE_A, 0, 0xFFFF },
+	{ E131ParamsConst::UNIVERSE_PORT[1], OFFSET(nUniversePort) + 1 * sizeof(uint16_t), PROPERTIES_TYPE_UINT16, E131_PARAMS_MASK_UNIVERSE_B, 0, 0xFFFF },
+	{ E131ParamsConst::UNIVERSE_PORT[2], OFFSET(nUniversePort) + 2 * sizeof(uint16_t), PROPERTIES_TYPE_UINT16, E131_PARAMS_MASK_UNIVERSE_C, 0, 0xFFFF },
+	{ E131ParamsConst::UNIVERSE_PORT[3], OFFSET(nUniversePort) + 3 * sizeof(uint16_t), PROPERTIES_TYPE_UINT16, E131_PARAMS_MASK_UNIVERSE_D, 0, 0xFFFF },
+	{ E131ParamsConst::MERGE_MODE_PORT[0], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ E131ParamsConst::MERGE_MODE_PORT[1], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ E131ParamsConst::MERGE_MODE_PORT[2], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ E131ParamsConst::MERGE_MODE_PORT[3], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == (KEY_MERGE_MODE_PORT_A + E131_PARAMS_MAX_PORTS), "s_Keys does not match TE131ParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable E131Params::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 7, 0x9E3779B1 };
+
+E131Params::E131Params(E131ParamsStore *pE131ParamsStore):m_pE131ParamsStore(pE131ParamsStore), m_pPropertiesParser(0) {
 	uint8_t *p = (uint8_t *) &m_tE131Params;
 
 	for (uint32_t i = 0; i < sizeof(struct TE131Params); i++) {
@@ -64,9 +111,16 @@ E131Params::~E131Params(void) {
 bool E131Params::Load(void) {
 	m_tE131Params.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tE131Params);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(E131Params::staticCallbackFunction, this);
 
-	if (configfile.Read(E131ParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(E131ParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pE131ParamsStore != 0) {
 			m_pE131ParamsStore->Update(&m_tE131Params);
@@ -92,50 +146,30 @@ void E131Params::Load(const char* pBuffer, uint32_t nLength) {
 
 	m_tE131Params.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tE131Params);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(E131Params::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pE131ParamsStore->Update(&m_tE131Params);
 }
 
 void E131Params::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	char value[16];
 	uint8_t len;
-	uint8_t value8;
 	uint16_t value16;
-	float fValue;
 
-	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_UNIVERSE, &value16) == SSCAN_OK) {
-		if ((value16 == 0) || (value16 > E131_UNIVERSE_MAX)) {
-			m_tE131Params.nUniverse = E131_UNIVERSE_DEFAULT;
-		} else {
-			m_tE131Params.nUniverse = value16;
-		}
-		m_tE131Params.nSetList |= E131_PARAMS_MASK_UNIVERSE;
-		return;
-	}
-
-	len = 3;
-	if (Sscan::Char(pLine, E131ParamsConst::MERGE_MODE, value, &len) == SSCAN_OK) {
-		if (memcmp(value, "ltp", 3) == 0) {
-			m_tE131Params.nMergeMode = E131_MERGE_LTP;
-			m_tE131Params.nSetList |= E131_PARAMS_MASK_MERGE_MODE;
-		} else if (memcmp(value, "htp", 3) == 0) {
-			m_tE131Params.nMergeMode = E131_MERGE_HTP;
-			m_tE131Params.nSetList |= E131_PARAMS_MASK_MERGE_MODE;
-		}
-		return;
-	}
+	const int32_t nKey = m_pPropertiesParser->Parse(pLine);
 
-	for (uint32_t i = 0; i < E131_PARAMS_MAX_PORTS; i++) {
-		if (Sscan::Uint16(pLine, E131ParamsConst::UNIVERSE_PORT[i], &value16) == SSCAN_OK) {
-			m_tE131Params.nUniversePort[i] = value16;
-			m_tE131Params.nSetList |= (E131_PARAMS_MASK_UNIVERSE_A << i);
-			return;
-		}
+	if ((nKey >= KEY_MERGE_MODE_PORT_A) && (nKey < (KEY_MERGE_MODE_PORT_A + E131_PARAMS_MAX_PORTS))) {
+		const uint32_t i = (uint32_t) (nKey - KEY_MERGE_MODE_PORT_A);
 
 		len = 3;
 		if (Sscan::Char(pLine, E131ParamsConst::MERGE_MODE_PORT[i], value, &len) == SSCAN_OK) {
@@ -146,54 +180,54 @@ void E131Params::callbackFunction(const char *pLine) {
 				m_tE131Params.nMergeModePort[i] = E131_MERGE_HTP;
 				m_tE131Params.nSetList |= (E131_PARAMS_MASK_MERGE_MODE_A << i);
 			}
-			return;
 		}
-	}
-
-	if (Sscan::Float(pLine, E131ParamsConst::NETWORK_DATA_LOSS_TIMEOUT, &fValue) == SSCAN_OK) {
-		m_tE131Params.nNetworkTimeout = fValue;
-		m_tE131Params.nSetList |= E131_PARAMS_MASK_NETWORK_TIMEOUT;
 		return;
 	}
 
-	if (Sscan::Uint8(pLine, E131ParamsConst::DISABLE_MERGE_TIMEOUT, &value8) == SSCAN_OK) {
-		m_tE131Params.bDisableMergeTimeout = (value8 != 0);
-		m_tE131Params.nSetList |= E131_PARAMS_MASK_MERGE_TIMEOUT;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE, &value8) == SSCAN_OK) {
-		m_tE131Params.bEnableNoChangeUpdate = (value8 != 0);
-		m_tE131Params.nSetList |= E131_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT;
-		return;
-	}
-
-	len = 5;
-	if (Sscan::Char(pLine, E131ParamsConst::DIRECTION, value, &len) == SSCAN_OK) {
-		if (memcmp(value, "input", 5) == 0) {
-			m_tE131Params.nDirection = (uint8_t) E131_INPUT_PORT;
-			m_tE131Params.nSetList |= E131_PARAMS_MASK_DIRECTION;
+	switch (nKey) {
+	case KEY_UNIVERSE:
+		if (Sscan::Uint16(pLine, LightSetConst::PARAMS_UNIVERSE, &value16) == SSCAN_OK) {
+			if ((value16 == 0) || (value16 > E131_UNIVERSE_MAX)) {
+				m_tE131Params.nUniverse = E131_UNIVERSE_DEFAULT;
+			} else {
+				m_tE131Params.nUniverse = value16;
+			}
+			m_tE131Params.nSetList |= E131_PARAMS_MASK_UNIVERSE;
 		}
-		return;
-	}
-
-	len = 6;
-	if (Sscan::Char(pLine, E131ParamsConst::DIRECTION, value, &len) == SSCAN_OK) {
-		if (memcmp(value, "output", 6) == 0) {
-			m_tE131Params.nDirection = (uint8_t) E131_OUTPUT_PORT;
-			m_tE131Params.nSetList |= E131_PARAMS_MASK_DIRECTION;
+		break;
+	case KEY_MERGE_MODE:
+		len = 3;
+		if (Sscan::Char(pLine, E131ParamsConst::MERGE_MODE, value, &len) == SSCAN_OK) {
+			if (memcmp(value, "ltp", 3) == 0) {
+				m_tE131Params.nMergeMode = E131_MERGE_LTP;
+				m_tE131Params.nSetList |= E131_PARAMS_MASK_MERGE_MODE;
+			} else if (memcmp(value, "htp", 3) == 0) {
+				m_tE131Params.nMergeMode = E131_MERGE_HTP;
+				m_tE131Params.nSetList |= E131_PARAMS_MASK_MERGE_MODE;
+			}
+		}
+		break;
+	case KEY_DIRECTION:
+		len = 5;
+		if (Sscan::Char(pLine, E131ParamsConst::DIRECTION, value, &len) == SSCAN_OK) {
+			if (memcmp(value, "input", 5) == 0) {
+				m_tE131Params.nDirection = (uint8_t) E131_INPUT_PORT;
+				m_tE131Params.nSetList |= E131_PARAMS_MASK_DIRECTION;
+			}
+			break;
 		}
-		return;
-	}
 
-	if (Sscan::Uint8(pLine, E131ParamsConst::PRIORITY, &value8) == SSCAN_OK) {
-		if ((value8 >= E131_PRIORITY_LOWEST) && (value8 <= E131_PRIORITY_HIGHEST)) {
-			m_tE131Params.nPriority = value8;
-			m_tE131Params.nSetList |= E131_PARAMS_MASK_PRIORITY;
+		len = 6;
+		if (Sscan::Char(pLine, E131ParamsConst::DIRECTION, value, &len) == SSCAN_OK) {
+			if (memcmp(value, "output", 6) == 0) {
+				m_tE131Params.nDirection = (uint8_t) E131_OUTPUT_PORT;
+				m_tE131Params.nSetList |= E131_PARAMS_MASK_DIRECTION;
+			}
 		}
-		return;
+		break;
+	default:
+		break;
 	}
-
 }
 
 void E131Params::Dump(void) {
@@ -239,6 +273,22 @@ void E131Params::Dump(void) {
 	if (isMaskSet(E131_PARAMS_MASK_PRIORITY)) {
 		printf(" %s=%d\n", E131ParamsConst::PRIORITY, m_tE131Params.nPriority);
 	}
+
+	if (isMaskSet(E131_PARAMS_MASK_ENABLE_DISCOVERY)) {
+		printf(" %s=%d [%s]\n", E131ParamsConst::ENABLE_DISCOVERY, (int) m_tE131Params.bEnableDiscovery, BOOL2STRING(m_tE131Params.bEnableDiscovery));
+	}
+
+	if (isMaskSet(E131_PARAMS_MASK_DISCOVERY_JOIN)) {
+		printf(" %s=%d [%s]\n", E131ParamsConst::DISCOVERY_JOIN, (int) m_tE131Params.bDiscoveryJoin, BOOL2STRING(m_tE131Params.bDiscoveryJoin));
+	}
+
+	if (isMaskSet(E131_PARAMS_MASK_INPUT_MIN_INTERVAL)) {
+		printf(" %s=%d [ms]\n", E131ParamsConst::INPUT_MIN_INTERVAL, m_tE131Params.nInputMinInterval);
+	}
+
+	if (isMaskSet(E131_PARAMS_MASK_SYNCHRONIZATION_ADDRESS)) {
+		printf(" %s=%d\n", E131ParamsConst::SYNCHRONIZATION_ADDRESS, m_tE131Params.nSynchronizationAddress);
+	}
 #endif
 }
 
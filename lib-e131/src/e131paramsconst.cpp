@@ -35,3 +35,7 @@ alignas(uint32_t) const char E131ParamsConst::NETWORK_DATA_LOSS_TIMEOUT[] = "net
 alignas(uint32_t) const char E131ParamsConst::DISABLE_MERGE_TIMEOUT[] = "disable_merge_timeout";
 alignas(uint32_t) const char E131ParamsConst::DIRECTION[] = "direction";
 alignas(uint32_t) const char E131ParamsConst::PRIORITY[] = "priority";
+alignas(uint32_t) const char E131ParamsConst::ENABLE_DISCOVERY[] = "enable_discovery";
+alignas(uint32_t) const char E131ParamsConst::DISCOVERY_JOIN[] = "discovery_join";
+alignas(uint32_t) const char E131ParamsConst::INPUT_MIN_INTERVAL[] = "input_min_interval";
+alignas(uint32_t) const char E131ParamsConst::SYNCHRONIZATION_ADDRESS[] = "synchronization_address";
@@ -66,6 +66,12 @@ void E131Params::Builder(const struct TE131Params *ptE131Params, uint8_t *pBuffe
 	builder.AddComment("DMX Input");
 	builder.Add(E131ParamsConst::DIRECTION, m_tE131Params.nDirection == (uint8_t) E131_INPUT_PORT ? "input" : "output" , isMaskSet(E131_PARAMS_MASK_DIRECTION));
 	builder.Add(E131ParamsConst::PRIORITY, m_tE131Params.nPriority, isMaskSet(E131_PARAMS_MASK_PRIORITY));
+	builder.Add(E131ParamsConst::INPUT_MIN_INTERVAL, (uint32_t) m_tE131Params.nInputMinInterval, isMaskSet(E131_PARAMS_MASK_INPUT_MIN_INTERVAL));
+	builder.Add(E131ParamsConst::SYNCHRONIZATION_ADDRESS, (uint32_t) m_tE131Params.nSynchronizationAddress, isMaskSet(E131_PARAMS_MASK_SYNCHRONIZATION_ADDRESS));
+
+	builder.AddComment("Universe Discovery");
+	builder.Add(E131ParamsConst::ENABLE_DISCOVERY, (uint32_t) m_tE131Params.bEnableDiscovery, isMaskSet(E131_PARAMS_MASK_ENABLE_DISCOVERY));
+	builder.Add(E131ParamsConst::DISCOVERY_JOIN, (uint32_t) m_tE131Params.bDiscoveryJoin, isMaskSet(E131_PARAMS_MASK_DISCOVERY_JOIN));
 
 	nSize = builder.GetSize();
 
@@ -59,4 +59,22 @@ void E131Params::Set(E131Bridge *pE131Bridge) {
 	if (isMaskSet(E131_PARAMS_MASK_PRIORITY)) {
 		pE131Bridge->SetPriority(m_tE131Params.nPriority);
 	}
+
+	if (isMaskSet(E131_PARAMS_MASK_INPUT_MIN_INTERVAL)) {
+		for (uint32_t i = 0; i < E131_MAX_UARTS; i++) {
+			pE131Bridge->SetInputMinInterval(m_tE131Params.nInputMinInterval, i);
+		}
+	}
+
+	if (isMaskSet(E131_PARAMS_MASK_SYNCHRONIZATION_ADDRESS)) {
+		pE131Bridge->SetInputSynchronizationAddress(m_tE131Params.nSynchronizationAddress);
+	}
+
+	if (isMaskSet(E131_PARAMS_MASK_ENABLE_DISCOVERY)) {
+		pE131Bridge->SetEnableDiscovery(m_tE131Params.bEnableDiscovery);
+	}
+
+	if (isMaskSet(E131_PARAMS_MASK_DISCOVERY_JOIN)) {
+		pE131Bridge->SetDiscoveryJoin(m_tE131Params.bDiscoveryJoin);
+	}
 }
@@ -0,0 +1,279 @@
+/**
+ * @file benchmark.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+extern "C" {
+void *h3_memcpy(void *__restrict__ dest, void const *__restrict__ src, size_t n);
+void *h3_memset(void *dest, int c, size_t n);
+int h3_memcmp(const void *s1, const void *s2, size_t n);
+}
+
+#define BUFFER_SIZE		2048
+#define BYTES_PER_RUN	(64 * 1024 * 1024)
+
+static const uint32_t s_aSizes[] = { 16, 42, 64, 128, 512, 530, 638, 1024, 1514 };
+static const uint32_t s_aOffsets[] = { 0, 2, 1 };
+
+static double s_fMHz;
+static volatile int s_nSink;
+
+/*
+ * The compiler barrier in the loops keeps the libc builtins from being hoisted.
+ */
+
+/*
+ * The h3_memcpy before the rewrite
+ */
+static void *memcpy_previous(void *__restrict__ dest, void const *__restrict__ src, size_t n) {
+	uint32_t *plDst = (uint32_t *) dest;
+	uint32_t const *plSrc = (uint32_t const *) src;
+
+	if ((((uintptr_t) src & 0x3) == 0) && (((uintptr_t) dest & 0x3) == 0)) {
+		while (n >= 4) {
+			*plDst++ = *plSrc++;
+			n -= 4;
+		}
+	}
+
+	uint8_t *pcDst = (uint8_t *) plDst;
+	uint8_t const *pcSrc = (uint8_t const *) plSrc;
+
+	while (n--) {
+		*pcDst++ = *pcSrc++;
+	}
+
+	return dest;
+}
+
+static void *memcpy_libc(void *__restrict__ dest, void const *__restrict__ src, size_t n) {
+	return memcpy(dest, src, n);
+}
+
+static void *memset_libc(void *dest, int c, size_t n) {
+	return memset(dest, c, n);
+}
+
+static int memcmp_libc(const void *s1, const void *s2, size_t n) {
+	return memcmp(s1, s2, n);
+}
+
+typedef void *(*memcpy_t)(void *__restrict__, void const *__restrict__, size_t);
+typedef void *(*memset_t)(void *, int, size_t);
+typedef int (*memcmp_t)(const void *, const void *, size_t);
+
+static uint64_t nanos(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+static double get_mhz(void) {
+	FILE *fp = fopen("/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq", "r");
+	double fMHz = 0;
+
+	if (fp != 0) {
+		unsigned long nKHz;
+		if (fscanf(fp, "%lu", &nKHz) == 1) {
+			fMHz = (double) nKHz / 1000;
+		}
+		fclose(fp);
+		return fMHz;
+	}
+
+	fp = fopen("/proc/cpuinfo", "r");
+
+	if (fp != 0) {
+		char aLine[256];
+		while (fgets(aLine, sizeof(aLine), fp) != 0) {
+			if (sscanf(aLine, "cpu MHz : %lf", &fMHz) == 1) {
+				break;
+			}
+		}
+		fclose(fp);
+	}
+
+	return fMHz;
+}
+
+static bool verify(void) {
+	static uint8_t aSrc[BUFFER_SIZE];
+	static uint8_t aDst[BUFFER_SIZE];
+	static uint8_t aRef[BUFFER_SIZE];
+
+	for (uint32_t i = 0; i < BUFFER_SIZE; i++) {
+		aSrc[i] = (uint8_t) (i * 7 + 3);
+	}
+
+	for (uint32_t nLength = 0; nLength <= 300; nLength++) {
+		for (uint32_t nDstOffset = 0; nDstOffset < 8; nDstOffset++) {
+			for (uint32_t nSrcOffset = 0; nSrcOffset < 8; nSrcOffset++) {
+				memset(aDst, 0xAA, sizeof(aDst));
+				memset(aRef, 0xAA, sizeof(aRef));
+
+				h3_memcpy(&aDst[64 + nDstOffset], &aSrc[64 + nSrcOffset], nLength);
+				memcpy(&aRef[64 + nDstOffset], &aSrc[64 + nSrcOffset], nLength);
+
+				if (memcmp(aDst, aRef, sizeof(aDst)) != 0) {
+					printf("h3_memcpy failed: length=%u, dst+%u, src+%u\n", nLength, nDstOffset, nSrcOffset);
+					return false;
+				}
+
+				const int nDiff = (int) ((nLength * 31 + nSrcOffset) % (nLength + 1));
+
+				if (nLength != 0) {
+					aDst[64 + nDstOffset + nDiff - (nDiff == (int) nLength)] ^= (uint8_t) (1 + nSrcOffset);
+				}
+
+				const int nExpected = memcmp(&aDst[64 + nDstOffset], &aRef[64 + nDstOffset], nLength);
+				const int nResult = h3_memcmp(&aDst[64 + nDstOffset], &aRef[64 + nDstOffset], nLength);
+
+				if ((nExpected < 0) != (nResult < 0) || (nExpected > 0) != (nResult > 0)) {
+					printf("h3_memcmp failed: length=%u, offset +%u\n", nLength, nDstOffset);
+					return false;
+				}
+			}
+
+			memset(aDst, 0xAA, sizeof(aDst));
+			memset(aRef, 0xAA, sizeof(aRef));
+
+			h3_memset(&aDst[64 + nDstOffset], (int) (0x100 + nLength), nLength);
+			memset(&aRef[64 + nDstOffset], (int) (0x100 + nLength), nLength);
+
+			if (memcmp(aDst, aRef, sizeof(aDst)) != 0) {
+				printf("h3_memset failed: length=%u, dst+%u\n", nLength, nDstOffset);
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+static void print(const char *pName, uint32_t nSize, uint32_t nOffset, uint64_t nBytes, uint64_t nNanos) {
+	const double fBytesPerNs = (double) nBytes / (double) nNanos;
+
+	printf("%-12s %5u  +%u  %8.2f", pName, nSize, nOffset, fBytesPerNs * 1000.0);
+
+	if (s_fMHz > 0) {
+		printf("  %6.2f", fBytesPerNs * 1000.0 / s_fMHz);
+	}
+
+	printf("\n");
+}
+
+static void run_memcpy(const char *pName, memcpy_t pFunction, uint32_t nSize, uint32_t nOffset) {
+	static uint8_t aSrc[BUFFER_SIZE] __attribute__((aligned(64)));
+	static uint8_t aDst[BUFFER_SIZE] __attribute__((aligned(64)));
+
+	const uint32_t nRuns = BYTES_PER_RUN / nSize;
+
+	pFunction(aDst, &aSrc[nOffset], nSize);
+
+	const uint64_t nStart = nanos();
+
+	for (uint32_t i = 0; i < nRuns; i++) {
+		pFunction(aDst, &aSrc[nOffset], nSize);
+		asm volatile("" : : : "memory");
+	}
+
+	print(pName, nSize, nOffset, (uint64_t) nRuns * nSize, nanos() - nStart);
+	s_nSink += aDst[nSize - 1];
+}
+
+static void run_memset(const char *pName, memset_t pFunction, uint32_t nSize, uint32_t nOffset) {
+	static uint8_t aDst[BUFFER_SIZE] __attribute__((aligned(64)));
+
+	const uint32_t nRuns = BYTES_PER_RUN / nSize;
+	const uint64_t nStart = nanos();
+
+	for (uint32_t i = 0; i < nRuns; i++) {
+		pFunction(&aDst[nOffset], (int) i, nSize);
+		asm volatile("" : : : "memory");
+	}
+
+	print(pName, nSize, nOffset, (uint64_t) nRuns * nSize, nanos() - nStart);
+	s_nSink += aDst[nOffset];
+}
+
+/*
+ * Equal buffers, so the whole length is compared.
+ */
+static void run_memcmp(const char *pName, memcmp_t pFunction, uint32_t nSize, uint32_t nOffset) {
+	static uint8_t aBuffer1[BUFFER_SIZE] __attribute__((aligned(64)));
+	static uint8_t aBuffer2[BUFFER_SIZE] __attribute__((aligned(64)));
+
+	const uint32_t nRuns = BYTES_PER_RUN / nSize;
+	const uint64_t nStart = nanos();
+	int nResult = 0;
+
+	for (uint32_t i = 0; i < nRuns; i++) {
+		nResult |= pFunction(&aBuffer1[nOffset], &aBuffer2[nOffset], nSize);
+		asm volatile("" : : : "memory");
+	}
+
+	print(pName, nSize, nOffset, (uint64_t) nRuns * nSize, nanos() - nStart);
+	s_nSink += nResult;
+}
+
+int main(int argc, char **argv) {
+	s_fMHz = (argc > 1) ? atof(argv[1]) : get_mhz();
+
+	if (!verify()) {
+		return EXIT_FAILURE;
+	}
+
+	printf("Verified against libc\n");
+
+	if (s_fMHz > 0) {
+		printf("CPU clock %.0f MHz\n", s_fMHz);
+	}
+
+	printf("\nFunction      size off      MB/s  bytes/cycle\n");
+
+	for (uint32_t i = 0; i < sizeof(s_aSizes) / sizeof(s_aSizes[0]); i++) {
+		for (uint32_t j = 0; j < sizeof(s_aOffsets) / sizeof(s_aOffsets[0]); j++) {
+			run_memcpy("previous", memcpy_previous, s_aSizes[i], s_aOffsets[j]);
+			run_memcpy("h3_memcpy", h3_memcpy, s_aSizes[i], s_aOffsets[j]);
+			run_memcpy("memcpy", memcpy_libc, s_aSizes[i], s_aOffsets[j]);
+		}
+	}
+
+	printf("\n");
+
+	for (uint32_t i = 0; i < sizeof(s_aSizes) / sizeof(s_aSizes[0]); i++) {
+		run_memset("h3_memset", h3_memset, s_aSizes[i], 0);
+		run_memset("memset", memset_libc, s_aSizes[i], 0);
+		run_memcmp("h3_memcmp", h3_memcmp, s_aSizes[i], 0);
+		run_memcmp("memcmp", memcmp_libc, s_aSizes[i], 0);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -651,6 +651,8 @@ extern "C" {
 
 extern void udelay(uint32_t);
 extern void *h3_memcpy(void *__restrict__ dest, void const *__restrict__ src, size_t n);
+extern void *h3_memset(void *dest, int c, size_t n);
+extern int h3_memcmp(const void *s1, const void *s2, size_t n);
 
 typedef enum H3_BOOT_DEVICE {
 	H3_BOOT_DEVICE_UNK,
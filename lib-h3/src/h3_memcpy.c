@@ -1,8 +1,8 @@
 /**
- * @file h3_memcpy.h
+ * @file h3_memcpy.c
  *
  */
-/* Copyright (C) 2019 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+/* Copyright (C) 2019-2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -25,38 +25,244 @@
 
 #include <stdint.h>
 #include <stddef.h>
-#include <assert.h>
 
-//#include <stdio.h>
+/*
+ * The NEON paths are used when the compiler targets NEON (H3: -mfpu=neon-vfpv4),
+ * otherwise the portable C paths are used (i.e. the Linux benchmark).
+ * Only d0-d7 are used, these are caller-saved.
+ *
+ * The EMAC DMA buffers are mapped Strongly-ordered, so every access goes to the bus.
+ * The stores are therefore always aligned 64-bit (NEON) or 32-bit (C) accesses,
+ * and a misaligned source is never read with unaligned word loads.
+ */
+
+#if defined (__ARM_NEON__) || defined (__ARM_NEON)
+ #define H3_MEM_NEON
+#endif
+
+#define H3_MEM_SMALL	16	///< Below this size the byte loop is faster than the prologue
+
+typedef uint32_t __attribute__((__may_alias__)) word_t;
+
+void *h3_memcpy(void *__restrict__ dest, void const *__restrict__ src, size_t n) {
+	uint8_t *pDst = (uint8_t *) dest;
+	const uint8_t *pSrc = (const uint8_t *) src;
+
+	if (n >= H3_MEM_SMALL) {
+#if defined (H3_MEM_NEON)
+		while (((uintptr_t) pDst & 0x7) != 0) {
+			*pDst++ = *pSrc++;
+			n--;
+		}
 
-void* h3_memcpy(void *__restrict__ dest, void const *__restrict__ src, size_t n) {
-//	assert(((uint32_t )((uint32_t* ) src) & 0x3) == 0);
-//	assert(((uint32_t )((uint32_t* ) dest) & 0x3) == 0);
+		if (((uintptr_t) pSrc & 0x7) == 0) {
+			while (n >= 64) {
+				asm volatile (
+					"pld [%1, #192]\n"
+					"vld1.64 {d0-d3}, [%1, :64]!\n"
+					"vld1.64 {d4-d7}, [%1, :64]!\n"
+					"vst1.64 {d0-d3}, [%0, :64]!\n"
+					"vst1.64 {d4-d7}, [%0, :64]!\n"
+					: "+r" (pDst), "+r" (pSrc) : : "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "memory");
+				n -= 64;
+			}
+		} else {
+			while (n >= 64) {
+				asm volatile (
+					"pld [%1, #192]\n"
+					"vld1.8 {d0-d3}, [%1]!\n"
+					"vld1.8 {d4-d7}, [%1]!\n"
+					"vst1.64 {d0-d3}, [%0, :64]!\n"
+					"vst1.64 {d4-d7}, [%0, :64]!\n"
+					: "+r" (pDst), "+r" (pSrc) : : "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "memory");
+				n -= 64;
+			}
+		}
+
+		while (n >= 8) {
+			asm volatile (
+				"vld1.8 {d0}, [%1]!\n"
+				"vst1.64 {d0}, [%0, :64]!\n"
+				: "+r" (pDst), "+r" (pSrc) : : "d0", "memory");
+			n -= 8;
+		}
+#else
+		while (((uintptr_t) pDst & 0x3) != 0) {
+			*pDst++ = *pSrc++;
+			n--;
+		}
 
-//	if (((uint32_t )((uint32_t* ) src) & 0x3) != 0) {
-//		printf("src=%p\n", (void *)src);
-//	}
-//
-//	if (((uint32_t )((uint32_t* ) dest) & 0x3) != 0) {
-//		printf("dest=%p\n", (void *)dest);
-//	}
+		word_t *pwDst = (word_t *) pDst;
+		const uint32_t nOffset = (uint32_t) ((uintptr_t) pSrc & 0x3);
 
-	uint32_t *plDst = (uint32_t*) dest;
-	uint32_t const *plSrc = (uint32_t const*) src;
+		if (nOffset == 0) {
+			const word_t *pwSrc = (const word_t *) pSrc;
+
+			while (n >= 16) {
+				const uint32_t w0 = pwSrc[0];
+				const uint32_t w1 = pwSrc[1];
+				const uint32_t w2 = pwSrc[2];
+				const uint32_t w3 = pwSrc[3];
+				pwDst[0] = w0;
+				pwDst[1] = w1;
+				pwDst[2] = w2;
+				pwDst[3] = w3;
+				pwDst += 4;
+				pwSrc += 4;
+				n -= 16;
+			}
+
+			while (n >= 4) {
+				*pwDst++ = *pwSrc++;
+				n -= 4;
+			}
+
+			pSrc = (const uint8_t *) pwSrc;
+		}
+#if (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		else {
+			/*
+			 * Aligned source words are merged with shifts. The last word read is
+			 * the one holding the last byte copied, so it never crosses the end.
+			 */
+			const uint32_t nShiftRight = nOffset * 8;
+			const uint32_t nShiftLeft = 32 - nShiftRight;
+			const word_t *pwSrc = (const word_t *) (pSrc - nOffset);
+			uint32_t nCurrent = *pwSrc++;
+
+			while (n >= 8) {
+				const uint32_t nNext = *pwSrc++;
+				*pwDst++ = (nCurrent >> nShiftRight) | (nNext << nShiftLeft);
+				nCurrent = nNext;
+				n -= 4;
+			}
+
+			pSrc = (const uint8_t *) pwSrc - 4 + nOffset;
+		}
+#endif
+		pDst = (uint8_t *) pwDst;
+#endif
+	}
+
+	while (n--) {
+		*pDst++ = *pSrc++;
+	}
+
+	return dest;
+}
+
+void *h3_memset(void *dest, int c, size_t n) {
+	uint8_t *pDst = (uint8_t *) dest;
+	const uint8_t nValue = (uint8_t) c;
+
+	if (n >= H3_MEM_SMALL) {
+#if defined (H3_MEM_NEON)
+		while (((uintptr_t) pDst & 0x7) != 0) {
+			*pDst++ = nValue;
+			n--;
+		}
+
+		size_t nBlocks = n & ~(size_t) 31;
+
+		if (nBlocks != 0) {
+			asm volatile (
+				"vdup.8 q0, %2\n"
+				"vmov q1, q0\n"
+				"1:\n"
+				"vst1.64 {d0-d3}, [%0, :64]!\n"
+				"subs %1, %1, #32\n"
+				"bne 1b\n"
+				: "+r" (pDst), "+r" (nBlocks) : "r" (nValue) : "d0", "d1", "d2", "d3", "cc", "memory");
+			n &= 31;
+		}
+
+		const uint32_t nWord = nValue * 0x01010101U;
+		word_t *pwDst = (word_t *) pDst;
 
-	if ((((uint32_t) src & 0x3) == 0) && (((uint32_t) dest & 0x3) == 0)) {
 		while (n >= 4) {
-			*plDst++ = *plSrc++;
+			*pwDst++ = nWord;
 			n -= 4;
 		}
-	}
 
-	uint8_t *pcDst = (uint8_t*) plDst;
-	uint8_t const *pcSrc = (uint8_t const*) plSrc;
+		pDst = (uint8_t *) pwDst;
+#else
+		while (((uintptr_t) pDst & 0x3) != 0) {
+			*pDst++ = nValue;
+			n--;
+		}
+
+		const uint32_t nWord = nValue * 0x01010101U;
+		word_t *pwDst = (word_t *) pDst;
+
+		while (n >= 16) {
+			pwDst[0] = nWord;
+			pwDst[1] = nWord;
+			pwDst[2] = nWord;
+			pwDst[3] = nWord;
+			pwDst += 4;
+			n -= 16;
+		}
+
+		while (n >= 4) {
+			*pwDst++ = nWord;
+			n -= 4;
+		}
+
+		pDst = (uint8_t *) pwDst;
+#endif
+	}
 
 	while (n--) {
-		*pcDst++ = *pcSrc++;
+		*pDst++ = nValue;
 	}
 
 	return dest;
 }
+
+int h3_memcmp(const void *s1, const void *s2, size_t n) {
+	const uint8_t *p1 = (const uint8_t *) s1;
+	const uint8_t *p2 = (const uint8_t *) s2;
+
+	if ((n >= H3_MEM_SMALL) && ((((uintptr_t) p1 ^ (uintptr_t) p2) & 0x3) == 0)) {
+		while (((uintptr_t) p1 & 0x3) != 0) {
+			if (*p1 != *p2) {
+				return *p1 - *p2;
+			}
+			p1++;
+			p2++;
+			n--;
+		}
+
+		const word_t *pw1 = (const word_t *) p1;
+		const word_t *pw2 = (const word_t *) p2;
+
+		// The first differing word is resolved by the byte loop below
+		while (n >= 16) {
+			if (((pw1[0] ^ pw2[0]) | (pw1[1] ^ pw2[1]) | (pw1[2] ^ pw2[2]) | (pw1[3] ^ pw2[3])) != 0) {
+				break;
+			}
+			pw1 += 4;
+			pw2 += 4;
+			n -= 16;
+		}
+
+		while ((n >= 4) && (*pw1 == *pw2)) {
+			pw1++;
+			pw2++;
+			n -= 4;
+		}
+
+		p1 = (const uint8_t *) pw1;
+		p2 = (const uint8_t *) pw2;
+	}
+
+	while (n--) {
+		if (*p1 != *p2) {
+			return *p1 - *p2;
+		}
+		p1++;
+		p2++;
+	}
+
+	return 0;
+}
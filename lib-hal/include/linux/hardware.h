@@ -70,6 +70,9 @@ public:
 	bool SetTime(const struct tm *pTime);
 	void GetTime(struct tm *pTime);
 
+	/*
+	 * Monotonic clock, not the wall clock
+	 */
 	uint32_t Micros(void);
 	uint32_t Millis(void);
 
@@ -373,19 +373,19 @@ bool Hardware::ExecCmd(const char *pCmd, char *Result, int nResultSize) {
 	return true;
 }
 
+/*
+ * The timeouts are based on CLOCK_MONOTONIC, so that they are not affected
+ * by NTP adjustments or SetTime. Wall clock time is GetTime.
+ */
+
 uint32_t Hardware::Micros(void) {
-	struct timeval tv;
-	gettimeofday(&tv, NULL);
-	return (tv.tv_sec * 1000000) + tv.tv_usec;
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint32_t) ts.tv_sec * 1000000) + (uint32_t) (ts.tv_nsec / 1000);
 }
 
 uint32_t Hardware::Millis(void) {
-	struct timeval tv;
-	gettimeofday(&tv, NULL);
-
-#if defined (__APPLE__)
-	return (tv.tv_sec * (__darwin_time_t) 1000) + (tv.tv_usec / (__darwin_suseconds_t) 1000);
-#else
-	return (tv.tv_sec * (__time_t) 1000) + (tv.tv_usec / (__suseconds_t) 1000);
-#endif
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint32_t) ts.tv_sec * 1000) + (uint32_t) (ts.tv_nsec / 1000000);
 }
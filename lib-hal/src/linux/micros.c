@@ -25,10 +25,9 @@
 
 #include <stdint.h>
 #include <time.h>
-#include <sys/time.h>
 
 uint32_t micros(void) {
-	struct timeval tv;
-	gettimeofday(&tv, NULL);
-	return (tv.tv_sec * 1000000) + tv.tv_usec;
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint32_t) ts.tv_sec * 1000000) + (uint32_t) (ts.tv_nsec / 1000);
 }
@@ -33,6 +33,9 @@
 
 #include "l6470.h"
 
+#define AUTODRIVER_MAX_BOARDS		8
+#define AUTODRIVER_BATCH_BYTES		16	///< Per board, a command is at most 4 bytes
+
 class AutoDriver: public L6470 {
 public:
 	AutoDriver(uint8_t, uint8_t, uint8_t, uint8_t);
@@ -46,6 +49,22 @@ public:
 
 private:
 	uint8_t SPIXfer(uint8_t);
+	void SPIXferRead(bool bBegin);
+
+public:
+	/*
+	 * Between BeginBatch and EndBatch the commands are queued per board.
+	 * The queues of the daisy-chained boards on a chip select are then sent
+	 * together, one SPI transfer carries a byte for each board. A shorter
+	 * queue is padded with NOP.
+	 */
+	static void BeginBatch(void) {
+		s_bBatch = true;
+	}
+	static void EndBatch(void);
+
+private:
+	static void BatchFlush(uint8_t nSpiChipSelect);
 
 	/*
 	 * Additional methods
@@ -70,8 +89,13 @@ private:
 	uint8_t m_nBusyPin;
 	uint8_t m_nPosition;
 	bool m_bIsBusy;
+	bool m_bIsReading;
 
 	static uint8_t m_nNumBoards[2];
+
+	static bool s_bBatch;
+	static uint8_t s_aBatch[2][AUTODRIVER_MAX_BOARDS][AUTODRIVER_BATCH_BYTES];
+	static uint8_t s_aBatchLength[2][AUTODRIVER_MAX_BOARDS];
 };
 
 #endif /* AUTODRIVER_H_ */
@@ -198,6 +198,14 @@ public:
 private:
 	virtual uint8_t SPIXfer(uint8_t)=0;
 
+	/*
+	 * Brackets a command that reads from the device.
+	 * A driver that queues the SPI bytes must send the queue first,
+	 * and transfer the read command directly.
+	 */
+	virtual void SPIXferRead(bool bBegin) {
+	}
+
 private:
 	long paramHandler(uint8_t, unsigned long);
 	long xferParam(unsigned long, uint8_t);
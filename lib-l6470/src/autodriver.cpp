@@ -42,12 +42,17 @@
 
 uint8_t AutoDriver::m_nNumBoards[2];
 
+bool AutoDriver::s_bBatch;
+uint8_t AutoDriver::s_aBatch[2][AUTODRIVER_MAX_BOARDS][AUTODRIVER_BATCH_BYTES];
+uint8_t AutoDriver::s_aBatchLength[2][AUTODRIVER_MAX_BOARDS];
+
 AutoDriver::AutoDriver(uint8_t nPosition, uint8_t nSpiChipSelect, uint8_t nResetPin, uint8_t nBusyPin) :
 	m_nSpiChipSelect(nSpiChipSelect),
 	m_nResetPin(nResetPin),
 	m_nBusyPin(nBusyPin),
 	m_nPosition(nPosition),
-	m_bIsBusy(false)
+	m_bIsBusy(false),
+	m_bIsReading(false)
 {
 	DEBUG_ENTRY
 
@@ -64,7 +69,8 @@ AutoDriver::AutoDriver(uint8_t nPosition, uint8_t nSpiChipSelect, uint8_t nReset
 	m_nResetPin(nResetPin),
 	m_nBusyPin(BUSY_PIN_NOT_USED),
 	m_nPosition(nPosition),
-	m_bIsBusy(false)
+	m_bIsBusy(false),
+	m_bIsReading(false)
 {
 	DEBUG_ENTRY
 
@@ -111,6 +117,19 @@ int AutoDriver::busyCheck(void) {
 uint8_t AutoDriver::SPIXfer(uint8_t data) {
 	DEBUG_ENTRY
 
+	if (s_bBatch && !m_bIsReading) {
+		assert(m_nPosition < AUTODRIVER_MAX_BOARDS);
+
+		if (s_aBatchLength[m_nSpiChipSelect][m_nPosition] == AUTODRIVER_BATCH_BYTES) {
+			BatchFlush(m_nSpiChipSelect);
+		}
+
+		s_aBatch[m_nSpiChipSelect][m_nPosition][s_aBatchLength[m_nSpiChipSelect][m_nPosition]++] = data;
+
+		DEBUG_EXIT
+		return 0;
+	}
+
 	uint8_t dataPacket[m_nNumBoards[m_nSpiChipSelect]];
 
 	for (int i = 0; i < m_nNumBoards[m_nSpiChipSelect]; i++) {
@@ -129,6 +148,55 @@ uint8_t AutoDriver::SPIXfer(uint8_t data) {
 	return dataPacket[m_nPosition];
 }
 
+void AutoDriver::SPIXferRead(bool bBegin) {
+	if (bBegin && s_bBatch) {
+		BatchFlush(m_nSpiChipSelect);
+	}
+
+	m_bIsReading = bBegin;
+}
+
+void AutoDriver::BatchFlush(uint8_t nSpiChipSelect) {
+	const uint8_t nBoards = m_nNumBoards[nSpiChipSelect];
+	uint32_t nTransfers = 0;
+
+	for (uint32_t i = 0; i < nBoards; i++) {
+		if (s_aBatchLength[nSpiChipSelect][i] > nTransfers) {
+			nTransfers = s_aBatchLength[nSpiChipSelect][i];
+		}
+	}
+
+	if (nTransfers == 0) {
+		return;
+	}
+
+	uint8_t dataPacket[AUTODRIVER_MAX_BOARDS];
+
+	FUNC_PREFIX(spi_chipSelect(nSpiChipSelect));
+	FUNC_PREFIX(spi_set_speed_hz(4000000));
+	FUNC_PREFIX(spi_setDataMode(SPI_MODE3));
+
+	for (uint32_t nByte = 0; nByte < nTransfers; nByte++) {
+		for (uint32_t i = 0; i < nBoards; i++) {
+			dataPacket[i] = nByte < s_aBatchLength[nSpiChipSelect][i] ? s_aBatch[nSpiChipSelect][i][nByte] : L6470_CMD_NOP;
+		}
+
+		FUNC_PREFIX(spi_transfern((char *) dataPacket, nBoards));
+	}
+
+	for (uint32_t i = 0; i < nBoards; i++) {
+		s_aBatchLength[nSpiChipSelect][i] = 0;
+	}
+}
+
+void AutoDriver::EndBatch(void) {
+	for (uint8_t nSpiChipSelect = 0; nSpiChipSelect < (sizeof(m_nNumBoards) / sizeof(m_nNumBoards[0])); nSpiChipSelect++) {
+		BatchFlush(nSpiChipSelect);
+	}
+
+	s_bBatch = false;
+}
+
 uint16_t AutoDriver::getNumBoards(void) {
 	int n = 0;
 	for (int i = 0; i < (int) (sizeof(m_nNumBoards) / sizeof(m_nNumBoards[0])); i++) {
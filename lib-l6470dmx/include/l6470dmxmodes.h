@@ -50,6 +50,17 @@ public:
 	bool IsDmxDataChanged(const uint8_t *, uint16_t);
 	void DmxData(const uint8_t *, uint16_t);
 
+	/*
+	 * Non-blocking alternative for HandleBusy, BusyCheck and DmxData.
+	 * Only the latest changed DMX data is kept, it is sent by RunPending
+	 * when the motor is no longer busy.
+	 */
+	bool SetPending(const uint8_t *pDmxData, uint16_t nLength);
+	bool RunPending(void);
+	bool IsPending(void) {
+		return m_bIsPending;
+	}
+
 	void Start(void);
 	void Stop(void);
 
@@ -80,6 +91,7 @@ private:
 
 private:
 	bool m_bIsStarted;
+	bool m_bIsPending;
 
 private:
 	uint8_t m_nMotorNumber;
@@ -30,6 +30,9 @@
 
 #include "l6470.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TL6470Params {
     uint32_t nSetList;
     //
@@ -81,6 +84,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -91,6 +95,7 @@ private:
 private:
 	L6470ParamsStore *m_pL6470ParamsStore;
     struct TL6470Params m_tL6470Params;
+    PropertiesParser *m_pPropertiesParser;
     char m_aFileName[16];
 };
 
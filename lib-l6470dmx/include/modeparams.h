@@ -32,6 +32,9 @@
 #include "lightset.h"
 #include "dmxslotinfo.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 #define MODE_PARAMS_MAX_DMX_FOOTPRINT		4
 #define MODE_PARAMS_MASK_SLOT_INFO_SHIFT	28
 #define MODE_PARAMS_MASK_SLOT_INFO_MASK		(0xF << MODE_PARAMS_MASK_SLOT_INFO_SHIFT)
@@ -128,12 +131,14 @@ private:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     ModeParamsStore *m_pModeParamsStore;
     struct TModeParams m_tModeParams;
     char m_aFileName[16];
     DmxSlotInfo *m_pDmxSlotInfo;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* MODEPARAMS_H_ */
@@ -30,6 +30,9 @@
 
 #include "l6470.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TMotorParams {
     uint32_t nSetList;
     //
@@ -102,10 +105,12 @@ private:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     MotorParamsStore *m_pMotorParamsStore;
     struct TMotorParams m_tMotorParams;
+    PropertiesParser *m_pPropertiesParser;
     char m_aFileName[16];
 };
 
@@ -49,6 +49,12 @@ public:
 
 	void SetData(uint8_t nPort, const uint8_t *, uint16_t);
 
+	/*
+	 * Sends the pending DMX data to the motors that are no longer busy.
+	 * To be called from the main loop.
+	 */
+	void Run(void);
+
 	uint32_t GetMotorsConnected(void) {
 		return m_nMotorsConnected;
 	}
@@ -123,6 +129,7 @@ private:
 	SlushBoard *m_pBoard;
 	bool m_bUseSpiBusy;
 	uint32_t m_nMotorsConnected;
+	bool m_bIsPending;
 
 	SlushMotor	*m_pSlushMotor[SLUSH_DMX_MAX_MOTORS];
 	MotorParams *m_pMotorParams[SLUSH_DMX_MAX_MOTORS];
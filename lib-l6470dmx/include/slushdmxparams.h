@@ -30,6 +30,9 @@
 
 #include "slushdmx.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TSlushDmxParams {
 	uint32_t nSetList;
 	//
@@ -76,6 +79,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -84,6 +88,7 @@ private:
 private:
 	SlushDmxParamsStore *m_pSlushDmxParamsStore;
     struct TSlushDmxParams m_tSlushDmxParams;
+    PropertiesParser *m_pPropertiesParser;
     char m_aFileName[16];
 };
 
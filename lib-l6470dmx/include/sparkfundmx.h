@@ -70,6 +70,12 @@ public:
 
 	void SetData(uint8_t nPort, const uint8_t *, uint16_t);
 
+	/*
+	 * Sends the pending DMX data to the motors that are no longer busy.
+	 * To be called from the main loop.
+	 */
+	void Run(void);
+
 	void Print(void);
 
 	uint32_t GetMotorsConnected(void) {
@@ -163,6 +169,7 @@ private:
 	uint16_t m_nDmxFootprint;
 
 	ModeStore *m_pModeStore;
+	bool m_bIsPending;
 };
 
 #endif /* SPARKFUNDMX_H_ */
@@ -30,6 +30,9 @@
 
 #include "sparkfundmx.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TSparkFunDmxParams {
     uint32_t nSetList;
     //
@@ -76,6 +79,7 @@ public:
 	void Dump(uint8_t nMotorIndex = 0xFF);
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -84,6 +88,7 @@ private:
 private:
 	SparkFunDmxParamsStore *m_pSparkFunDmxParamsStore;
     struct TSparkFunDmxParams m_tSparkFunDmxParams;
+    PropertiesParser *m_pPropertiesParser;
     char m_aFileName[16];
 };
 
@@ -32,9 +32,7 @@ class SparkFunDmxParamsConst {
 public:
 	alignas(uint32_t) static const char FILE_NAME[];
 	alignas(uint32_t) static const char POSITION[];
-#if !defined (H3)
 	alignas(uint32_t) static const char SPI_CS[];
-#endif
 	alignas(uint32_t) static const char RESET_PIN[];
 	alignas(uint32_t) static const char BUSY_PIN[];
 };
@@ -47,7 +47,7 @@
 
 #include "debug.h"
 
-L6470DmxModes::L6470DmxModes(TL6470DmxModes tMode, uint16_t nDmxStartAddress, L6470 *pL6470, MotorParams *pMotorParams, ModeParams *pModeParams): m_bIsStarted(false), m_nMotorNumber(0), m_nMode(L6470DMXMODE_UNDEFINED), m_pDmxMode(0), m_DmxFootPrint(0) {
+L6470DmxModes::L6470DmxModes(TL6470DmxModes tMode, uint16_t nDmxStartAddress, L6470 *pL6470, MotorParams *pMotorParams, ModeParams *pModeParams): m_bIsStarted(false), m_bIsPending(false), m_nMotorNumber(0), m_nMode(L6470DMXMODE_UNDEFINED), m_pDmxMode(0), m_DmxFootPrint(0) {
 	DEBUG1_ENTRY;
 
 	assert(nDmxStartAddress <= DMX_UNIVERSE_SIZE);
@@ -280,3 +280,41 @@ void L6470DmxModes::DmxData(const uint8_t *pDmxData, uint16_t nLength) {
 	DEBUG1_EXIT;
 }
 
+bool L6470DmxModes::SetPending(const uint8_t *pDmxData, uint16_t nLength) {
+	DEBUG1_ENTRY;
+
+	if (!IsDmxDataChanged(pDmxData, nLength)) {
+		DEBUG1_EXIT;
+		return false;
+	}
+
+	// A busy motor is stopped once, newer data only replaces the pending data
+	if (!m_bIsPending) {
+		m_pDmxMode->HandleBusy();
+		m_bIsPending = true;
+	}
+
+	DEBUG1_EXIT;
+	return true;
+}
+
+bool L6470DmxModes::RunPending(void) {
+	DEBUG1_ENTRY;
+
+	if (!m_bIsPending || m_pDmxMode->BusyCheck()) {
+		DEBUG1_EXIT;
+		return false;
+	}
+
+#ifndef NDEBUG
+	printf("\tMotor : %d [pending]\n", m_nMotorNumber);
+#endif
+
+	m_pDmxMode->Data(m_pDmxData);
+
+	m_bIsPending = false;
+	m_bIsStarted = true;
+
+	DEBUG1_EXIT;
+	return true;
+}
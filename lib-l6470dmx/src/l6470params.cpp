@@ -37,12 +37,29 @@
 #include "l6470dmxconst.h"
 
 #include "readconfigfile.h"
-#include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
 #include "debug.h"
 
-L6470Params::L6470Params(L6470ParamsStore *pL6470ParamsStore): m_pL6470ParamsStore(pL6470ParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TL6470Params, f)
+
+static const struct TPropertiesKey s_Keys[] = {
+	{ L6470ParamsConst::MIN_SPEED, OFFSET(fMinSpeed), PROPERTIES_TYPE_FLOAT, L6470_PARAMS_MASK_MIN_SPEED, 0, 0 },
+	{ L6470ParamsConst::MAX_SPEED, OFFSET(fMaxSpeed), PROPERTIES_TYPE_FLOAT, L6470_PARAMS_MASK_MAX_SPEED, 0, 0 },
+	{ L6470ParamsConst::ACC, OFFSET(fAcc), PROPERTIES_TYPE_FLOAT, L6470_PARAMS_MASK_ACC, 0, 0 },
+	{ L6470ParamsConst::DEC, OFFSET(fDec), PROPERTIES_TYPE_FLOAT, L6470_PARAMS_MASK_DEC, 0, 0 },
+	{ L6470ParamsConst::KVAL_HOLD, OFFSET(nKvalHold), PROPERTIES_TYPE_UINT8, L6470_PARAMS_MASK_KVAL_HOLD, 0, 0xFF },
+	{ L6470ParamsConst::KVAL_RUN, OFFSET(nKvalRun), PROPERTIES_TYPE_UINT8, L6470_PARAMS_MASK_KVAL_RUN, 0, 0xFF },
+	{ L6470ParamsConst::KVAL_ACC, OFFSET(nKvalAcc), PROPERTIES_TYPE_UINT8, L6470_PARAMS_MASK_KVAL_ACC, 0, 0xFF },
+	{ L6470ParamsConst::KVAL_DEC, OFFSET(nKvalDec), PROPERTIES_TYPE_UINT8, L6470_PARAMS_MASK_KVAL_DEC, 0, 0xFF },
+	{ L6470ParamsConst::MICRO_STEPS, OFFSET(nMicroSteps), PROPERTIES_TYPE_UINT8, L6470_PARAMS_MASK_MICRO_STEPS, 0, 0xFF }
+};
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable L6470Params::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 6, 0x9E3779B1 };
+
+L6470Params::L6470Params(L6470ParamsStore *pL6470ParamsStore): m_pL6470ParamsStore(pL6470ParamsStore), m_pPropertiesParser(0) {
 uint8_t *p = (uint8_t *) &m_tL6470Params;
 
 	for (uint32_t i = 0; i < sizeof(struct TL6470Params); i++) {
@@ -62,9 +79,16 @@ bool L6470Params::Load(uint8_t nMotorIndex) {
 
 	m_tL6470Params.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tL6470Params);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(L6470Params::staticCallbackFunction, this);
 
-	if (configfile.Read(m_aFileName)) {
+	const bool bHaveFile = configfile.Read(m_aFileName);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pL6470ParamsStore != 0) {
 			m_pL6470ParamsStore->Update(nMotorIndex, &m_tL6470Params);
@@ -89,10 +113,15 @@ void L6470Params::Load(uint8_t nMotorIndex, const char *pBuffer, uint32_t nLengt
 
 	m_tL6470Params.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tL6470Params);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(L6470Params::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pL6470ParamsStore->Update(nMotorIndex, &m_tL6470Params);
 }
 
@@ -137,57 +166,9 @@ void L6470Params::Save(uint8_t nMotorIndex, uint8_t *pBuffer, uint32_t nLength,
 
 void L6470Params::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
-	uint8_t value8;
-
-	if (Sscan::Float(pLine, L6470ParamsConst::MIN_SPEED, &m_tL6470Params.fMinSpeed) == SSCAN_OK) {
-		m_tL6470Params.nSetList |= L6470_PARAMS_MASK_MIN_SPEED;
-		return;
-	}
-
-	if (Sscan::Float(pLine, L6470ParamsConst::MAX_SPEED, &m_tL6470Params.fMaxSpeed) == SSCAN_OK) {
-		m_tL6470Params.nSetList |= L6470_PARAMS_MASK_MAX_SPEED;
-		return;
-	}
-
-	if (Sscan::Float(pLine, L6470ParamsConst::ACC, &m_tL6470Params.fAcc) == SSCAN_OK) {
-		m_tL6470Params.nSetList |= L6470_PARAMS_MASK_ACC;
-		return;
-	}
+	assert(m_pPropertiesParser != 0);
 
-	if (Sscan::Float(pLine, L6470ParamsConst::DEC, &m_tL6470Params.fDec) == SSCAN_OK) {
-		m_tL6470Params.nSetList |= L6470_PARAMS_MASK_DEC;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, L6470ParamsConst::KVAL_HOLD, &value8) == SSCAN_OK) {
-		m_tL6470Params.nKvalHold = value8;
-		m_tL6470Params.nSetList |= L6470_PARAMS_MASK_KVAL_HOLD;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, L6470ParamsConst::KVAL_RUN, &value8) == SSCAN_OK) {
-		m_tL6470Params.nKvalRun = value8;
-		m_tL6470Params.nSetList |= L6470_PARAMS_MASK_KVAL_RUN;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, L6470ParamsConst::KVAL_ACC, &value8) == SSCAN_OK) {
-		m_tL6470Params.nKvalAcc = value8;
-		m_tL6470Params.nSetList |= L6470_PARAMS_MASK_KVAL_ACC;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, L6470ParamsConst::KVAL_DEC, &value8) == SSCAN_OK) {
-		m_tL6470Params.nKvalDec = value8;
-		m_tL6470Params.nSetList |= L6470_PARAMS_MASK_KVAL_DEC;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, L6470ParamsConst::MICRO_STEPS, &value8) == SSCAN_OK) {
-		m_tL6470Params.nMicroSteps = value8;
-		m_tL6470Params.nSetList |= L6470_PARAMS_MASK_MICRO_STEPS;
-		return;
-	}
+	m_pPropertiesParser->Parse(pLine);
 }
 
 void L6470Params::Set(L6470 *pL6470) {
@@ -47,12 +47,44 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 #include "parse.h"
 #include "propertiesbuilder.h"
 
 #include "debug.h"
 
-ModeParams::ModeParams(ModeParamsStore *pModeParamsStore): m_pModeParamsStore(pModeParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TModeParams, f)
+
+enum TModeParamsKey {
+	KEY_DMX_MODE,
+	KEY_DMX_START_ADDRESS,
+	KEY_DMX_SLOT_INFO,
+	KEY_MAX_STEPS,
+	KEY_SWITCH_ACT,
+	KEY_SWITCH_DIR,
+	KEY_SWITCH_SPS,
+	KEY_SWITCH,
+	KEY_LAST
+};
+
+// Must be in the order of TModeParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ ModeParamsConst::DMX_MODE, OFFSET(nDmxMode), PROPERTIES_TYPE_UINT8, MODE_PARAMS_MASK_DMX_MODE, 0, L6470DMXMODE_UNDEFINED - 1 },
+	{ LightSetConst::PARAMS_DMX_START_ADDRESS, OFFSET(nDmxStartAddress), PROPERTIES_TYPE_UINT16, MODE_PARAMS_MASK_DMX_START_ADDRESS, 1, DMX_UNIVERSE_SIZE },
+	{ LightSetConst::PARAMS_DMX_SLOT_INFO, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ModeParamsConst::MAX_STEPS, OFFSET(nMaxSteps), PROPERTIES_TYPE_UINT32, MODE_PARAMS_MASK_MAX_STEPS, 0, 0xFFFFFFFF },
+	{ ModeParamsConst::SWITCH_ACT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ModeParamsConst::SWITCH_DIR, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ModeParamsConst::SWITCH_SPS, OFFSET(fSwitchStepsPerSec), PROPERTIES_TYPE_FLOAT, MODE_PARAMS_MASK_SWITCH_SPS, 0, 0 },
+	{ ModeParamsConst::SWITCH, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TModeParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable ModeParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779BD };
+
+ModeParams::ModeParams(ModeParamsStore *pModeParamsStore): m_pModeParamsStore(pModeParamsStore), m_pPropertiesParser(0) {
 	DEBUG_ENTRY
 
 	uint8_t *p = (uint8_t*) &m_tModeParams;
@@ -91,9 +123,16 @@ bool ModeParams::Load(uint8_t nMotorIndex) {
 
 	m_tModeParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tModeParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(ModeParams::staticCallbackFunction, this);
 
-	if (configfile.Read(m_aFileName)) {
+	const bool bHaveFile = configfile.Read(m_aFileName);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pModeParamsStore != 0) {
 			m_pModeParamsStore->Update(nMotorIndex, &m_tModeParams);
@@ -123,10 +162,15 @@ void ModeParams::Load(uint8_t nMotorIndex, const char *pBuffer, uint32_t nLength
 
 	m_tModeParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tModeParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(ModeParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pModeParamsStore->Update(nMotorIndex, &m_tModeParams);
 
 	DEBUG_EXIT
@@ -134,90 +178,54 @@ void ModeParams::Load(uint8_t nMotorIndex, const char *pBuffer, uint32_t nLength
 
 void ModeParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
-	float f;
 	char value[128];
 	uint8_t len;
 	uint8_t value8;
-	uint16_t value16;
-	uint32_t value32;
 
-	if (Sscan::Uint8(pLine, ModeParamsConst::DMX_MODE, &value8) == SSCAN_OK) {
-		if (value8 < L6470DMXMODE_UNDEFINED) {
-			m_tModeParams.nDmxMode = value8;
-			m_tModeParams.nSetList |= MODE_PARAMS_MASK_DMX_MODE;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_DMX_SLOT_INFO:
+		len = sizeof(value) - 1;
+		if (Sscan::Char(pLine, LightSetConst::PARAMS_DMX_SLOT_INFO, value, &len) == SSCAN_OK) {
+			value[len] = '\0';
+			uint32_t nMask = 0;
+			m_pDmxSlotInfo->FromString(value, nMask);
+			m_tModeParams.nSetList |= (nMask << MODE_PARAMS_MASK_SLOT_INFO_SHIFT);
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &value16) == SSCAN_OK) {
-		if ((value16 != 0) && (value16 <= DMX_UNIVERSE_SIZE)) {
-			m_tModeParams.nDmxStartAddress = value16;
-			m_tModeParams.nSetList |= MODE_PARAMS_MASK_DMX_START_ADDRESS;
-		}
-		return;
-	}
-
-	len = sizeof(value) - 1;
-	if (Sscan::Char(pLine, LightSetConst::PARAMS_DMX_SLOT_INFO, value, &len) == SSCAN_OK) {
-		value[len] = '\0';
-		uint32_t nMask = 0;
-		m_pDmxSlotInfo->FromString(value, nMask);
-		m_tModeParams.nSetList |= (nMask << MODE_PARAMS_MASK_SLOT_INFO_SHIFT);
-	}
-
-	if (Sscan::Uint32(pLine, ModeParamsConst::MAX_STEPS, &value32) == SSCAN_OK) {
-		m_tModeParams.nMaxSteps = value32;
-		m_tModeParams.nSetList |= MODE_PARAMS_MASK_MAX_STEPS;
-		return;
-	}
-
-	len = 5; //  copy, reset
-	if (Sscan::Char(pLine, ModeParamsConst::SWITCH_ACT, value, &len) == SSCAN_OK) {
-		if (len == 4) {
-			if (memcmp(value, "copy", 4) == 0) {
+		break;
+	case KEY_SWITCH_ACT:
+		len = 5; //  copy, reset
+		if (Sscan::Char(pLine, ModeParamsConst::SWITCH_ACT, value, &len) == SSCAN_OK) {
+			if ((len == 4) && (memcmp(value, "copy", 4) == 0)) {
 				m_tModeParams.tSwitchAction = L6470_ABSPOS_COPY;
 				m_tModeParams.nSetList |= MODE_PARAMS_MASK_SWITCH_ACT;
-				return;
-			}
-		}
-		if (len == 5) {
-			if (memcmp(value, "reset", 5) == 0) {
+			} else if ((len == 5) && (memcmp(value, "reset", 5) == 0)) {
 				m_tModeParams.tSwitchAction = L6470_ABSPOS_RESET;
 				m_tModeParams.nSetList |= MODE_PARAMS_MASK_SWITCH_ACT;
-				return;
 			}
 		}
-	}
-
-	len = 7; //  reverse, forward
-	if (Sscan::Char(pLine, ModeParamsConst::SWITCH_DIR, value, &len) == SSCAN_OK) {
-		if (len != 7) {
-			return;
-		}
-		if (memcmp(value, "forward", 7) == 0) {
-			m_tModeParams.tSwitchDir = L6470_DIR_FWD;
-			m_tModeParams.nSetList |= MODE_PARAMS_MASK_SWITCH_DIR;
-			return;
-		}
-		if (memcmp(value, "reverse", 7) == 0) {
-			m_tModeParams.tSwitchDir = L6470_DIR_REV;
-			m_tModeParams.nSetList |= MODE_PARAMS_MASK_SWITCH_DIR;
-			return;
+		break;
+	case KEY_SWITCH_DIR:
+		len = 7; //  reverse, forward
+		if ((Sscan::Char(pLine, ModeParamsConst::SWITCH_DIR, value, &len) == SSCAN_OK) && (len == 7)) {
+			if (memcmp(value, "forward", 7) == 0) {
+				m_tModeParams.tSwitchDir = L6470_DIR_FWD;
+				m_tModeParams.nSetList |= MODE_PARAMS_MASK_SWITCH_DIR;
+			} else if (memcmp(value, "reverse", 7) == 0) {
+				m_tModeParams.tSwitchDir = L6470_DIR_REV;
+				m_tModeParams.nSetList |= MODE_PARAMS_MASK_SWITCH_DIR;
+			}
 		}
-	}
-
-	if (Sscan::Float(pLine, ModeParamsConst::SWITCH_SPS, &f) == SSCAN_OK) {
-		m_tModeParams.fSwitchStepsPerSec = f;
-		m_tModeParams.nSetList |= MODE_PARAMS_MASK_SWITCH_SPS;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, ModeParamsConst::SWITCH, &value8) == SSCAN_OK) {
-		if (value8 == 0) {
+		break;
+	case KEY_SWITCH:
+		if ((Sscan::Uint8(pLine, ModeParamsConst::SWITCH, &value8) == SSCAN_OK) && (value8 == 0)) {
 			m_tModeParams.bSwitch = false;
 			m_tModeParams.nSetList |= MODE_PARAMS_MASK_SWITCH;
 		}
+		break;
+	default:
+		break;
 	}
 }
 
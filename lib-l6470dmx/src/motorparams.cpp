@@ -42,6 +42,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
 #include "debug.h"
@@ -52,7 +53,32 @@
 
 #define TICK_S	0.00000025	///< 250ns
 
-MotorParams::MotorParams(MotorParamsStore *pMotorParamsStore): m_pMotorParamsStore(pMotorParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TMotorParams, f)
+
+enum TMotorParamsKey {
+	KEY_STEP_ANGEL,
+	KEY_VOLTAGE,
+	KEY_CURRENT,
+	KEY_RESISTANCE,
+	KEY_INDUCTANCE,
+	KEY_LAST
+};
+
+// Must be in the order of TMotorParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ MotorParamsConst::STEP_ANGEL, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ MotorParamsConst::VOLTAGE, OFFSET(fVoltage), PROPERTIES_TYPE_FLOAT, MOTOR_PARAMS_MASK_VOLTAGE, 0, 0 },
+	{ MotorParamsConst::CURRENT, OFFSET(fCurrent), PROPERTIES_TYPE_FLOAT, MOTOR_PARAMS_MASK_CURRENT, 0, 0 },
+	{ MotorParamsConst::RESISTANCE, OFFSET(fResistance), PROPERTIES_TYPE_FLOAT, MOTOR_PARAMS_MASK_RESISTANCE, 0, 0 },
+	{ MotorParamsConst::INDUCTANCE, OFFSET(fInductance), PROPERTIES_TYPE_FLOAT, MOTOR_PARAMS_MASK_INDUCTANCE, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TMotorParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable MotorParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B7 };
+
+MotorParams::MotorParams(MotorParamsStore *pMotorParamsStore): m_pMotorParamsStore(pMotorParamsStore), m_pPropertiesParser(0) {
 	uint8_t *p = (uint8_t *) &m_tMotorParams;
 
 	for (uint32_t i = 0; i < sizeof(struct TMotorParams); i++) {
@@ -75,9 +101,16 @@ bool MotorParams::Load(uint8_t nMotorIndex) {
 
 	m_tMotorParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tMotorParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(MotorParams::staticCallbackFunction, this);
 
-	if (configfile.Read(m_aFileName)) {
+	const bool bHaveFile = configfile.Read(m_aFileName);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pMotorParamsStore != 0) {
 			m_pMotorParamsStore->Update(nMotorIndex, &m_tMotorParams);
@@ -102,10 +135,15 @@ void MotorParams::Load(uint8_t nMotorIndex, const char *pBuffer, uint32_t nLengt
 
 	m_tMotorParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tMotorParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(MotorParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pMotorParamsStore->Update(nMotorIndex, &m_tMotorParams);
 }
 
@@ -145,38 +183,16 @@ void MotorParams::Save(uint8_t nMotorIndex, uint8_t *pBuffer, uint32_t nLength,
 }
 
 void MotorParams::callbackFunction(const char *pLine) {
+	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
+
 	float f;
 
-	if (Sscan::Float(pLine, MotorParamsConst::STEP_ANGEL, &f) == SSCAN_OK) {
-		if (f != 0) {
+	if (m_pPropertiesParser->Parse(pLine) == KEY_STEP_ANGEL) {
+		if ((Sscan::Float(pLine, MotorParamsConst::STEP_ANGEL, &f) == SSCAN_OK) && (f != 0)) {
 			m_tMotorParams.fStepAngel = f;
 			m_tMotorParams.nSetList |= MOTOR_PARAMS_MASK_STEP_ANGEL;
 		}
-		return;
-	}
-
-	if (Sscan::Float(pLine, MotorParamsConst::VOLTAGE, &f) == SSCAN_OK) {
-		m_tMotorParams.fVoltage = f;
-		m_tMotorParams.nSetList |= MOTOR_PARAMS_MASK_VOLTAGE;
-		return;
-	}
-
-	if (Sscan::Float(pLine, MotorParamsConst::CURRENT, &f) == SSCAN_OK) {
-		m_tMotorParams.fCurrent = f;
-		m_tMotorParams.nSetList |= MOTOR_PARAMS_MASK_CURRENT;
-		return;
-	}
-
-	if (Sscan::Float(pLine, MotorParamsConst::RESISTANCE, &f) == SSCAN_OK) {
-		m_tMotorParams.fResistance = f;
-		m_tMotorParams.nSetList |= MOTOR_PARAMS_MASK_RESISTANCE;
-		return;
-	}
-
-	if (Sscan::Float(pLine, MotorParamsConst::INDUCTANCE, &f) == SSCAN_OK) {
-		m_tMotorParams.fInductance = f;
-		m_tMotorParams.nSetList |= MOTOR_PARAMS_MASK_INDUCTANCE;
-		return;
 	}
 }
 
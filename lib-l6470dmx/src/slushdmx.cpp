@@ -159,6 +159,7 @@ SlushDmx::SlushDmx(bool bUseSPI):
 	m_bSetPortB(false),
 	m_bUseSpiBusy(bUseSPI),
 	m_nMotorsConnected(0),
+	m_bIsPending(false),
 	m_nDmxStartAddress(DMX_ADDRESS_INVALID),
 	m_nDmxFootprint(0)  // Invalidate DMX Start Address and DMX Footprint
 {
@@ -504,39 +505,42 @@ void SlushDmx::SetData(uint8_t nPortId, const uint8_t *pData, uint16_t nLength)
 	assert(pData != 0);
 	assert(nLength <= DMX_MAX_CHANNELS);
 
-	bool bIsDmxDataChanged[SLUSH_DMX_MAX_MOTORS];
+	bool bIsPending = false;
 
 	for (uint32_t i = 0; i < SLUSH_DMX_MAX_MOTORS; i++) {
 		if (m_pL6470DmxModes[i] != 0) {
-			bIsDmxDataChanged[i] = m_pL6470DmxModes[i]->IsDmxDataChanged(pData, nLength);
-
-			if(bIsDmxDataChanged[i]) {
-				m_pL6470DmxModes[i]->HandleBusy();
-			}
-		} else {
-			bIsDmxDataChanged[i] = false;
-		}
+			const bool bIsDmxDataChanged = m_pL6470DmxModes[i]->SetPending(pData, nLength);
+			bIsPending |= bIsDmxDataChanged;
 #ifndef NDEBUG
-		printf("bIsDmxDataChanged[%d]=%d\n", i, bIsDmxDataChanged[i]);
+			printf("bIsDmxDataChanged[%d]=%d\n", i, bIsDmxDataChanged);
 #endif
+		}
 	}
 
-	for (uint32_t i = 0; i < SLUSH_DMX_MAX_MOTORS; i++) {
-		if (bIsDmxDataChanged[i]) {
-			while (m_pL6470DmxModes[i]->BusyCheck())
-				;
-		}
+	m_bIsPending |= bIsPending;
+
+	Run();
+
+	UpdateIOPorts(pData, nLength);
+
+	DEBUG_EXIT;
+}
+
+void SlushDmx::Run(void) {
+	if (__builtin_expect((!m_bIsPending), 1)) {
+		return;
 	}
 
+	bool bIsPending = false;
+
 	for (uint32_t i = 0; i < SLUSH_DMX_MAX_MOTORS; i++) {
-		if (bIsDmxDataChanged[i]) {
-			m_pL6470DmxModes[i]->DmxData(pData, nLength);
+		if (m_pL6470DmxModes[i] != 0) {
+			m_pL6470DmxModes[i]->RunPending();
+			bIsPending |= m_pL6470DmxModes[i]->IsPending();
 		}
 	}
 
-	UpdateIOPorts(pData, nLength);
-
-	DEBUG_EXIT;
+	m_bIsPending = bIsPending;
 }
 
 void SlushDmx::UpdateIOPorts(const uint8_t *pData, uint16_t nLength) {
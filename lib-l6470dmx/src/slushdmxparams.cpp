@@ -47,11 +47,37 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
 #include "debug.h"
 
-SlushDmxParams::SlushDmxParams(SlushDmxParamsStore *pSlushDmxParamsStore): m_pSlushDmxParamsStore(pSlushDmxParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TSlushDmxParams, f)
+
+enum TSlushDmxParamsKey {
+	KEY_USE_SPI,
+	KEY_DMX_START_ADDRESS_PORT_A,
+	KEY_DMX_START_ADDRESS_PORT_B,
+	KEY_DMX_FOOTPRINT_PORT_A,
+	KEY_DMX_FOOTPRINT_PORT_B,
+	KEY_LAST
+};
+
+// Must be in the order of TSlushDmxParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ SlushDmxParamsConst::USE_SPI, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ SlushDmxParamsConst::DMX_START_ADDRESS_PORT_A, OFFSET(nDmxStartAddressPortA), PROPERTIES_TYPE_UINT16, SLUSH_DMX_PARAMS_MASK_START_ADDRESS_PORT_A, 0, DMX_UNIVERSE_SIZE },
+	{ SlushDmxParamsConst::DMX_START_ADDRESS_PORT_B, OFFSET(nDmxStartAddressPortB), PROPERTIES_TYPE_UINT16, SLUSH_DMX_PARAMS_MASK_START_ADDRESS_PORT_B, 0, DMX_UNIVERSE_SIZE },
+	{ SlushDmxParamsConst::DMX_FOOTPRINT_PORT_A, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ SlushDmxParamsConst::DMX_FOOTPRINT_PORT_B, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TSlushDmxParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable SlushDmxParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B1 };
+
+SlushDmxParams::SlushDmxParams(SlushDmxParamsStore *pSlushDmxParamsStore): m_pSlushDmxParamsStore(pSlushDmxParamsStore), m_pPropertiesParser(0) {
 
 	assert(sizeof(m_aFileName) > strlen(L6470DmxConst::FILE_NAME_MOTOR));
 	const char *src = (char *)L6470DmxConst::FILE_NAME_MOTOR;
@@ -64,9 +90,16 @@ SlushDmxParams::~SlushDmxParams(void) {
 bool SlushDmxParams::Load(void) {
 	m_tSlushDmxParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tSlushDmxParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(SlushDmxParams::staticCallbackFunction, this);
 
-	if (configfile.Read(SlushDmxParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(SlushDmxParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pSlushDmxParamsStore != 0) {
 			m_pSlushDmxParamsStore->Update(&m_tSlushDmxParams);
@@ -91,55 +124,50 @@ void SlushDmxParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tSlushDmxParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tSlushDmxParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(SlushDmxParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pSlushDmxParamsStore->Update(&m_tSlushDmxParams);
 }
 
 void SlushDmxParams::callbackFunction(const char *pLine) {
+	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
+
 	uint8_t value;
 	uint16_t value16;
 
-	if (Sscan::Uint8(pLine, SlushDmxParamsConst::USE_SPI, &value) == SSCAN_OK) {
-		if (value != 0) {
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_USE_SPI:
+		if ((Sscan::Uint8(pLine, SlushDmxParamsConst::USE_SPI, &value) == SSCAN_OK) && (value != 0)) {
 			m_tSlushDmxParams.nUseSpiBusy = 1;
 			m_tSlushDmxParams.nSetList |= SLUSH_DMX_PARAMS_MASK_USE_SPI_BUSY;
-			return;
 		}
-	}
-
-	if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_START_ADDRESS_PORT_A, &value16) == SSCAN_OK) {
-		if (value16 <= DMX_UNIVERSE_SIZE) {
-			m_tSlushDmxParams.nDmxStartAddressPortA = value16;
-			m_tSlushDmxParams.nSetList |= SLUSH_DMX_PARAMS_MASK_START_ADDRESS_PORT_A;
+		break;
+	case KEY_DMX_FOOTPRINT_PORT_A:
+		if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_FOOTPRINT_PORT_A, &value16) == SSCAN_OK) {
+			if ((value16 > 0) && (value16 <= IO_PINS_IOPORT)) {
+				m_tSlushDmxParams.nDmxFootprintPortA = value16;
+				m_tSlushDmxParams.nSetList |= SLUSH_DMX_PARAMS_MASK_FOOTPRINT_PORT_A;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_START_ADDRESS_PORT_B, &value16) == SSCAN_OK) {
-		if (value16 <= DMX_UNIVERSE_SIZE) {
-			m_tSlushDmxParams.nDmxStartAddressPortB = value16;
-			m_tSlushDmxParams.nSetList |= SLUSH_DMX_PARAMS_MASK_START_ADDRESS_PORT_B;
-		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_FOOTPRINT_PORT_A, &value16) == SSCAN_OK) {
-		if ((value16 > 0) && (value16 <= IO_PINS_IOPORT)) {
-			m_tSlushDmxParams.nDmxFootprintPortA = value16;
-			m_tSlushDmxParams.nSetList |= SLUSH_DMX_PARAMS_MASK_FOOTPRINT_PORT_A;
-		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_FOOTPRINT_PORT_B, &value16) == SSCAN_OK) {
-		if ((value16 > 0) && (value16 <= IO_PINS_IOPORT)) {
-			m_tSlushDmxParams.nDmxFootprintPortB = value16;
-			m_tSlushDmxParams.nSetList |= SLUSH_DMX_PARAMS_MASK_FOOTPRINT_PORT_B;
+		break;
+	case KEY_DMX_FOOTPRINT_PORT_B:
+		if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_FOOTPRINT_PORT_B, &value16) == SSCAN_OK) {
+			if ((value16 > 0) && (value16 <= IO_PINS_IOPORT)) {
+				m_tSlushDmxParams.nDmxFootprintPortB = value16;
+				m_tSlushDmxParams.nSetList |= SLUSH_DMX_PARAMS_MASK_FOOTPRINT_PORT_B;
+			}
 		}
-		return;
+		break;
+	default:
+		break;
 	}
 }
 
@@ -61,7 +61,8 @@
 SparkFunDmx::SparkFunDmx(void):
 	m_nDmxStartAddress(DMX_ADDRESS_INVALID),
 	m_nDmxFootprint(0),
-	m_pModeStore(0)
+	m_pModeStore(0),
+	m_bIsPending(false)
 {
 	DEBUG_ENTRY;
 
@@ -350,37 +351,48 @@ void SparkFunDmx::SetData(uint8_t nPortId, const uint8_t *pData, uint16_t nLengt
 	assert(pData != 0);
 	assert(nLength <= DMX_UNIVERSE_SIZE);
 
-	bool bIsDmxDataChanged[SPARKFUN_DMX_MAX_MOTORS];
+	bool bIsPending = false;
+
+	AutoDriver::BeginBatch();
 
 	for (uint32_t i = 0; i < SPARKFUN_DMX_MAX_MOTORS; i++) {
 		if (m_pL6470DmxModes[i] != 0) {
-			bIsDmxDataChanged[i] = m_pL6470DmxModes[i]->IsDmxDataChanged(pData, nLength);
-
-			if(bIsDmxDataChanged[i]) {
-				m_pL6470DmxModes[i]->HandleBusy();
-			}
-		} else {
-			bIsDmxDataChanged[i] = false;
-		}
+			const bool bIsDmxDataChanged = m_pL6470DmxModes[i]->SetPending(pData, nLength);
+			bIsPending |= bIsDmxDataChanged;
 #ifndef NDEBUG
-		printf("bIsDmxDataChanged[%d]=%d\n", i, bIsDmxDataChanged[i]);
+			printf("bIsDmxDataChanged[%d]=%d\n", i, bIsDmxDataChanged);
 #endif
+		}
 	}
 
-	for (uint32_t i = 0; i < SPARKFUN_DMX_MAX_MOTORS; i++) {
-		if (bIsDmxDataChanged[i]) {
-			while (m_pL6470DmxModes[i]->BusyCheck())
-				;
-		}
+	AutoDriver::EndBatch();
+
+	m_bIsPending |= bIsPending;
+
+	Run();
+
+	DEBUG_EXIT;
+}
+
+void SparkFunDmx::Run(void) {
+	if (__builtin_expect((!m_bIsPending), 1)) {
+		return;
 	}
 
-	for (int i = 0; i < SPARKFUN_DMX_MAX_MOTORS; i++) {
-		if (bIsDmxDataChanged[i]) {
-			m_pL6470DmxModes[i]->DmxData(pData, nLength);
+	bool bIsPending = false;
+
+	AutoDriver::BeginBatch();
+
+	for (uint32_t i = 0; i < SPARKFUN_DMX_MAX_MOTORS; i++) {
+		if (m_pL6470DmxModes[i] != 0) {
+			m_pL6470DmxModes[i]->RunPending();
+			bIsPending |= m_pL6470DmxModes[i]->IsPending();
 		}
 	}
 
-	DEBUG_EXIT;
+	AutoDriver::EndBatch();
+
+	m_bIsPending = bIsPending;
 }
 
 bool SparkFunDmx::SetDmxStartAddress(uint16_t nDmxStartAddress) {
@@ -44,11 +44,35 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
 #include "debug.h"
 
-SparkFunDmxParams::SparkFunDmxParams(SparkFunDmxParamsStore *pSparkFunDmxParamsStore): m_pSparkFunDmxParamsStore(pSparkFunDmxParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TSparkFunDmxParams, f)
+
+enum TSparkFunDmxParamsKey {
+	KEY_POSITION,
+	KEY_SPI_CS,
+	KEY_RESET_PIN,
+	KEY_BUSY_PIN,
+	KEY_LAST
+};
+
+// Must be in the order of TSparkFunDmxParamsKey. The table is the same for all platforms, spi_cs is ignored on H3.
+static const struct TPropertiesKey s_Keys[] = {
+	{ SparkFunDmxParamsConst::POSITION, OFFSET(nPosition), PROPERTIES_TYPE_UINT8, SPARKFUN_DMX_PARAMS_MASK_POSITION, 0, SPARKFUN_DMX_MAX_MOTORS - 1 },
+	{ SparkFunDmxParamsConst::SPI_CS, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ SparkFunDmxParamsConst::RESET_PIN, OFFSET(nResetPin), PROPERTIES_TYPE_UINT8, SPARKFUN_DMX_PARAMS_MASK_RESET_PIN, 0, 0xFF },
+	{ SparkFunDmxParamsConst::BUSY_PIN, OFFSET(nBusyPin), PROPERTIES_TYPE_UINT8, SPARKFUN_DMX_PARAMS_MASK_BUSY_PIN, 0, 0xFF }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TSparkFunDmxParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable SparkFunDmxParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 4, 0x9E3779B1 };
+
+SparkFunDmxParams::SparkFunDmxParams(SparkFunDmxParamsStore *pSparkFunDmxParamsStore): m_pSparkFunDmxParamsStore(pSparkFunDmxParamsStore), m_pPropertiesParser(0) {
 	DEBUG_ENTRY
 
 	m_tSparkFunDmxParams.nSetList = 0;
@@ -72,9 +96,16 @@ bool SparkFunDmxParams::Load(void) {
 
 	m_tSparkFunDmxParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tSparkFunDmxParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(SparkFunDmxParams::staticCallbackFunction, this);
 
-	if (configfile.Read(SparkFunDmxParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(SparkFunDmxParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pSparkFunDmxParamsStore != 0) {
 			m_pSparkFunDmxParamsStore->Update(&m_tSparkFunDmxParams);
@@ -104,10 +135,15 @@ void SparkFunDmxParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tSparkFunDmxParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tSparkFunDmxParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(SparkFunDmxParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pSparkFunDmxParamsStore->Update(&m_tSparkFunDmxParams);
 
 	DEBUG_EXIT
@@ -121,9 +157,16 @@ bool SparkFunDmxParams::Load(uint8_t nMotorIndex) {
 
 	m_tSparkFunDmxParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tSparkFunDmxParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(SparkFunDmxParams::staticCallbackFunction, this);
 
-	if (configfile.Read(m_aFileName)) {
+	const bool bHaveFile = configfile.Read(m_aFileName);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pSparkFunDmxParamsStore != 0) {
 			m_pSparkFunDmxParamsStore->Update(nMotorIndex, &m_tSparkFunDmxParams);
@@ -153,10 +196,15 @@ void SparkFunDmxParams::Load(uint8_t nMotorIndex, const char *pBuffer, uint32_t
 
 	m_tSparkFunDmxParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tSparkFunDmxParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(SparkFunDmxParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pSparkFunDmxParamsStore->Update(nMotorIndex, &m_tSparkFunDmxParams);
 
 	DEBUG_EXIT
@@ -164,36 +212,22 @@ void SparkFunDmxParams::Load(uint8_t nMotorIndex, const char *pBuffer, uint32_t
 
 void SparkFunDmxParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
+
+	const int32_t nKey = m_pPropertiesParser->Parse(pLine);
 
+#if !defined (H3)
 	uint8_t value8;
 
-	if (Sscan::Uint8(pLine, SparkFunDmxParamsConst::POSITION, &value8) == SSCAN_OK) {
-		if (value8 < SPARKFUN_DMX_MAX_MOTORS) {
-			m_tSparkFunDmxParams.nPosition = value8;
-			m_tSparkFunDmxParams.nSetList |= SPARKFUN_DMX_PARAMS_MASK_POSITION;
+	if (nKey == KEY_SPI_CS) {
+		if (Sscan::Uint8(pLine, SparkFunDmxParamsConst::SPI_CS, &value8) == SSCAN_OK) {
+			m_tSparkFunDmxParams.nSpiCs = value8;
+			m_tSparkFunDmxParams.nSetList |= SPARKFUN_DMX_PARAMS_MASK_SPI_CS;
 		}
-		return;
-	}
-
-#if !defined (H3)
-	if (Sscan::Uint8(pLine, SparkFunDmxParamsConst::SPI_CS, &value8) == SSCAN_OK) {
-		m_tSparkFunDmxParams.nSpiCs = value8;
-		m_tSparkFunDmxParams.nSetList |= SPARKFUN_DMX_PARAMS_MASK_SPI_CS;
-		return;
 	}
+#else
+	(void) nKey;
 #endif
-
-	if (Sscan::Uint8(pLine, SparkFunDmxParamsConst::RESET_PIN, &value8) == SSCAN_OK) {
-		m_tSparkFunDmxParams.nResetPin = value8;
-		m_tSparkFunDmxParams.nSetList |= SPARKFUN_DMX_PARAMS_MASK_RESET_PIN;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, SparkFunDmxParamsConst::BUSY_PIN, &value8) == SSCAN_OK) {
-		m_tSparkFunDmxParams.nBusyPin = value8;
-		m_tSparkFunDmxParams.nSetList |= SPARKFUN_DMX_PARAMS_MASK_BUSY_PIN;
-		return;
-	}
 }
 
 void SparkFunDmxParams::Builder(const struct TSparkFunDmxParams *ptSparkFunDmxParams, uint8_t *pBuffer, uint32_t nLength, uint32_t &nSize, uint8_t nMotorIndex) {
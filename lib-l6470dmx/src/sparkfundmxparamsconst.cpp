@@ -29,8 +29,6 @@
 
 alignas(uint32_t) const char SparkFunDmxParamsConst::FILE_NAME[] = "sparkfun.txt";
 alignas(uint32_t) const char SparkFunDmxParamsConst::POSITION[] = "sparkfun_position";
-#if !defined (H3)
- alignas(uint32_t) const char SparkFunDmxParamsConst::SPI_CS[] = "sparkfun_spi_cs";
-#endif
+alignas(uint32_t) const char SparkFunDmxParamsConst::SPI_CS[] = "sparkfun_spi_cs";
 alignas(uint32_t) const char SparkFunDmxParamsConst::RESET_PIN[] = "sparkfun_reset_pin";
 alignas(uint32_t) const char SparkFunDmxParamsConst::BUSY_PIN[] = "sparkfun_busy_pin";
@@ -0,0 +1,98 @@
+/**
+ * @file dmxtransmit.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef DMXTRANSMIT_H_
+#define DMXTRANSMIT_H_
+
+#include <stdint.h>
+
+#define DMX_TRANSMIT_MAX_LENGTH		(1 + 512)	///< E1.31 property values include the start code
+
+/*
+ * Transmit policy for a DMX input port (DMX -> network).
+ *
+ * A frame is only transmitted when it differs from the previous one. After
+ * a change, the next nRepeats frames are transmitted as well, then the
+ * unchanged data is only repeated as keep-alive. An optional minimum
+ * interval caps the packet rate, the latest frame is sent when the
+ * interval has passed.
+ */
+class DmxTransmit {
+public:
+	DmxTransmit(void);
+	~DmxTransmit(void) {
+	}
+
+	void SetKeepAlive(uint32_t nKeepAliveMillis, uint32_t nRepeats);
+	uint32_t GetKeepAlive(void) const {
+		return m_nKeepAliveMillis;
+	}
+
+	void SetMinInterval(uint32_t nMinIntervalMillis) {
+		m_nMinIntervalMillis = nMinIntervalMillis;
+	}
+	uint32_t GetMinInterval(void) const {
+		return m_nMinIntervalMillis;
+	}
+
+	/*
+	 * pData is the received frame, or 0 when there is no new frame.
+	 * Returns the frame to be transmitted now, or 0.
+	 */
+	const uint8_t *Handler(uint32_t nMillis, const uint8_t *pData, uint32_t nLength, uint32_t &nSendLength);
+
+	/*
+	 * No DMX input, the keep-alive stops.
+	 */
+	void Reset(void) {
+		m_nLength = 0;
+		m_nRepeats = 0;
+		m_bIsPending = false;
+	}
+
+	uint32_t GetFrames(void) const {
+		return m_nFrames;
+	}
+	uint32_t GetSent(void) const {
+		return m_nSent;
+	}
+
+private:
+	bool Update(const uint8_t *pData, uint32_t nLength);
+
+private:
+	alignas(uint32_t) uint8_t m_aData[DMX_TRANSMIT_MAX_LENGTH];
+	uint32_t m_nLength;
+	uint32_t m_nSentMillis;
+	uint32_t m_nKeepAliveMillis;
+	uint32_t m_nMinIntervalMillis;
+	uint32_t m_nRepeatsMax;
+	uint32_t m_nRepeats;
+	uint32_t m_nFrames;
+	uint32_t m_nSent;
+	bool m_bIsPending;
+};
+
+#endif /* DMXTRANSMIT_H_ */
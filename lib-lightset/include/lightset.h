@@ -60,6 +60,19 @@ public:
 
 	virtual void SetData(uint8_t nPort, const uint8_t *pData, uint16_t nLength)= 0;
 
+	/*
+	 * A frame is the SetData calls for one or more ports between BeginFrame
+	 * and CommitFrame, for example all pending ports at a sync.
+	 * By default every SetData is output on its own. Outputs that refresh
+	 * all ports at once defer the refresh to CommitFrame while IsInFrame.
+	 */
+	virtual void BeginFrame(void);
+	virtual void CommitFrame(void);
+
+	bool IsInFrame(void) const {
+		return m_bIsInFrame;
+	}
+
 	virtual void Print(void);
 
 	void SetLightSetDisplay(LightSetDisplay *pLightSetDisplay) {
@@ -82,6 +95,7 @@ public: // WiFi solutions only
 
 protected:
 	LightSetDisplay *m_pLightSetDisplay;
+	bool m_bIsInFrame;
 
 public:
 	static LightSet *Get(void) {
@@ -47,6 +47,9 @@ public:
 
 	void SetData(uint8_t nPort, const uint8_t *, uint16_t);
 
+	void BeginFrame(void);
+	void CommitFrame(void);
+
 	void Print(void);
 
 public: // RDM
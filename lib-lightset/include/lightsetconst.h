@@ -35,6 +35,10 @@ public:
 
 	alignas(uint32_t) static const char PARAMS_DMX_START_ADDRESS[];
 	alignas(uint32_t) static const char PARAMS_DMX_SLOT_INFO[];
+
+	alignas(uint32_t) static const char PARAMS_OUTPUT_CURVE[];
+	alignas(uint32_t) static const char PARAMS_OUTPUT_GAMMA[];
+	alignas(uint32_t) static const char PARAMS_OUTPUT_16BIT[];
 };
 
 #endif /* LIGHTSETCONST_H_ */
@@ -0,0 +1,109 @@
+/**
+ * @file outputtransform.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef OUTPUTTRANSFORM_H_
+#define OUTPUTTRANSFORM_H_
+
+#include <stdint.h>
+
+#define OUTPUT_TRANSFORM_GAMMA_DEFAULT	2.2f
+
+enum TOutputTransformCurve {
+	OUTPUT_TRANSFORM_CURVE_LINEAR,
+	OUTPUT_TRANSFORM_CURVE_GAMMA,
+	OUTPUT_TRANSFORM_CURVE_SCURVE,
+	OUTPUT_TRANSFORM_CURVE_UNDEFINED
+};
+
+enum TOutputTransformResolution {
+	OUTPUT_TRANSFORM_RESOLUTION_8BIT,	///< One slot per output
+	OUTPUT_TRANSFORM_RESOLUTION_16BIT	///< Coarse/fine slot pair per output
+};
+
+/*
+ * DMX slots to output values for LED drivers.
+ *
+ * The dimmer curve is a lookup table, built when the configuration changes.
+ * With 8-bit resolution the table is indexed by the slot value. With 16-bit
+ * resolution the table has 257 points and the fine slot interpolates
+ * between two points.
+ *
+ * The linear curve is the bit replication (v << 8) | v, so the output is the
+ * same as before for 8-bit slots.
+ */
+class OutputTransform {
+public:
+	OutputTransform(uint32_t nOutputBits = 16);
+	~OutputTransform(void) {
+	}
+
+	void SetCurve(TOutputTransformCurve tCurve, float fGamma = OUTPUT_TRANSFORM_GAMMA_DEFAULT);
+	TOutputTransformCurve GetCurve(void) const {
+		return m_tCurve;
+	}
+	float GetGamma(void) const {
+		return m_fGamma;
+	}
+
+	void SetResolution(TOutputTransformResolution tResolution);
+	TOutputTransformResolution GetResolution(void) const {
+		return m_tResolution;
+	}
+
+	uint32_t GetSlotsPerOutput(void) const {
+		return m_tResolution == OUTPUT_TRANSFORM_RESOLUTION_16BIT ? 2 : 1;
+	}
+
+	uint32_t GetOutputBits(void) const {
+		return m_nOutputBits;
+	}
+
+	/*
+	 * Returns the number of outputs written, which is at most nOutputs
+	 */
+	uint32_t Apply(const uint8_t *pSlots, uint32_t nSlots, uint16_t *pOutput, uint32_t nOutputs) const;
+
+	void Print(void);
+
+	static const char *GetCurve(TOutputTransformCurve tCurve);
+	static TOutputTransformCurve GetCurve(const char *pValue);
+
+private:
+	void Build(void);
+	float Curve(float x) const;
+
+private:
+	uint32_t m_nOutputBits;
+	TOutputTransformCurve m_tCurve;
+	TOutputTransformResolution m_tResolution;
+	float m_fGamma;
+	/*
+	 * 8-bit: the output value for each slot value
+	 * 16-bit: the curve at (i / 256) in 1/65536 units
+	 */
+	uint32_t m_aLut[257];
+};
+
+#endif /* OUTPUTTRANSFORM_H_ */
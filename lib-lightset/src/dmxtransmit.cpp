@@ -0,0 +1,126 @@
+/**
+ * @file dmxtransmit.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "dmxtransmit.h"
+
+#define KEEP_ALIVE_MILLIS_DEFAULT	800	///< E1.31 6.6.1, non-changing data every 800 to 1000 ms
+#define REPEATS_DEFAULT				3	///< E1.31 6.6.1, 3 packets of non-changing data before suppressing
+
+DmxTransmit::DmxTransmit(void):
+	m_nLength(0),
+	m_nSentMillis(0),
+	m_nKeepAliveMillis(KEEP_ALIVE_MILLIS_DEFAULT),
+	m_nMinIntervalMillis(0),
+	m_nRepeatsMax(REPEATS_DEFAULT),
+	m_nRepeats(0),
+	m_nFrames(0),
+	m_nSent(0),
+	m_bIsPending(false)
+{
+}
+
+void DmxTransmit::SetKeepAlive(uint32_t nKeepAliveMillis, uint32_t nRepeats) {
+	assert(nKeepAliveMillis != 0);
+
+	m_nKeepAliveMillis = nKeepAliveMillis;
+	m_nRepeatsMax = nRepeats;
+}
+
+/*
+ * Compare word by word, the copy starts at the first changed word.
+ */
+bool DmxTransmit::Update(const uint8_t *pData, uint32_t nLength) {
+	if (nLength > DMX_TRANSMIT_MAX_LENGTH) {
+		nLength = DMX_TRANSMIT_MAX_LENGTH;
+	}
+
+	if (nLength != m_nLength) {
+		memcpy(m_aData, pData, nLength);
+		m_nLength = nLength;
+		return true;
+	}
+
+	const uint32_t nWords = nLength / 4;
+	const uint32_t *pLast = (const uint32_t *) m_aData;
+	uint32_t i;
+
+	for (i = 0; i < nWords; i++) {
+		uint32_t nWord;
+		memcpy(&nWord, &pData[i * 4], sizeof(uint32_t));
+
+		if (__builtin_expect((nWord != pLast[i]), 0)) {
+			memcpy(&m_aData[i * 4], &pData[i * 4], nLength - (i * 4));
+			return true;
+		}
+	}
+
+	for (i = nWords * 4; i < nLength; i++) {
+		if (pData[i] != m_aData[i]) {
+			memcpy(&m_aData[i], &pData[i], nLength - i);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const uint8_t *DmxTransmit::Handler(uint32_t nMillis, const uint8_t *pData, uint32_t nLength, uint32_t &nSendLength) {
+	if (pData != 0) {
+		m_nFrames++;
+
+		if (Update(pData, nLength)) {
+			m_nRepeats = m_nRepeatsMax;
+			m_bIsPending = true;
+		} else if (m_nRepeats != 0) {
+			m_nRepeats--;
+			m_bIsPending = true;
+		}
+	}
+
+	if (m_nLength == 0) {
+		return 0;
+	}
+
+	const uint32_t nElapsedMillis = nMillis - m_nSentMillis;
+
+	if (m_bIsPending) {
+		if (nElapsedMillis < m_nMinIntervalMillis) {
+			return 0;
+		}
+	} else if (nElapsedMillis < m_nKeepAliveMillis) {
+		return 0;
+	}
+
+	m_bIsPending = false;
+	m_nSentMillis = nMillis;
+	m_nSent++;
+
+	nSendLength = m_nLength;
+	return m_aData;
+}
@@ -27,13 +27,21 @@
 
 LightSet *LightSet::s_pThis = 0;
 
-LightSet::LightSet(void): m_pLightSetDisplay(0) {
+LightSet::LightSet(void): m_pLightSetDisplay(0), m_bIsInFrame(false) {
 	s_pThis = this;
 }
 
 LightSet::~LightSet(void) {
 }
 
+void LightSet::BeginFrame(void) {
+	m_bIsInFrame = true;
+}
+
+void LightSet::CommitFrame(void) {
+	m_bIsInFrame = false;
+}
+
 void LightSet::Print(void) {
 	// override
 }
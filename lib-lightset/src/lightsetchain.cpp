@@ -76,6 +76,22 @@ void LightSetChain::SetData(uint8_t nPort, const uint8_t *pData, uint16_t nSize)
 	}
 }
 
+void LightSetChain::BeginFrame(void) {
+	LightSet::BeginFrame();
+
+	for (unsigned i = 0; i < m_nSize; i++) {
+		m_pTable[i].pLightSet->BeginFrame();
+	}
+}
+
+void LightSetChain::CommitFrame(void) {
+	for (unsigned i = 0; i < m_nSize; i++) {
+		m_pTable[i].pLightSet->CommitFrame();
+	}
+
+	LightSet::CommitFrame();
+}
+
 void LightSetChain::Print(void) {
 	for (unsigned i = 0; i < m_nSize; i++) {
 		m_pTable[i].pLightSet->Print();
@@ -34,3 +34,7 @@ alignas(uint32_t) const char LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE[] = "
 
 alignas(uint32_t) const char LightSetConst::PARAMS_DMX_START_ADDRESS[] = "dmx_start_address";
 alignas(uint32_t) const char LightSetConst::PARAMS_DMX_SLOT_INFO[] = "dmx_slot_info";
+
+alignas(uint32_t) const char LightSetConst::PARAMS_OUTPUT_CURVE[] = "output_curve";
+alignas(uint32_t) const char LightSetConst::PARAMS_OUTPUT_GAMMA[] = "output_gamma";
+alignas(uint32_t) const char LightSetConst::PARAMS_OUTPUT_16BIT[] = "output_16bit";
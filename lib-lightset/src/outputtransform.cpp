@@ -0,0 +1,220 @@
+/**
+ * @file outputtransform.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "outputtransform.h"
+
+static const char s_aCurve[OUTPUT_TRANSFORM_CURVE_UNDEFINED][8] __attribute__((aligned(4))) = { "linear", "gamma", "scurve" };
+
+/*
+ * There is no libm for the bare-metal builds.
+ * These are only used when the lookup table is built.
+ */
+static float square_root(float x) {
+	if (x <= 0) {
+		return 0;
+	}
+
+	float r = x > 1 ? x : 1;
+
+	for (uint32_t i = 0; i < 24; i++) {
+		r = 0.5f * (r + x / r);
+	}
+
+	return r;
+}
+
+/*
+ * x^y for 0 <= x <= 1, the integer part of y by multiplication and the
+ * fraction by repeated square roots.
+ */
+static float power(float x, float y) {
+	if (x <= 0) {
+		return 0;
+	}
+
+	float fResult = 1;
+
+	for (uint32_t n = (uint32_t) y; n != 0; n--) {
+		fResult *= x;
+	}
+
+	float fFraction = y - (float) ((uint32_t) y);
+	float r = x;
+
+	for (uint32_t i = 0; (i < 16) && (fFraction > 0); i++) {
+		r = square_root(r);
+		fFraction *= 2;
+
+		if (fFraction >= 1) {
+			fResult *= r;
+			fFraction -= 1;
+		}
+	}
+
+	return fResult;
+}
+
+OutputTransform::OutputTransform(uint32_t nOutputBits):
+	m_nOutputBits(nOutputBits),
+	m_tCurve(OUTPUT_TRANSFORM_CURVE_LINEAR),
+	m_tResolution(OUTPUT_TRANSFORM_RESOLUTION_8BIT),
+	m_fGamma(OUTPUT_TRANSFORM_GAMMA_DEFAULT)
+{
+	assert((nOutputBits >= 8) && (nOutputBits <= 16));
+
+	Build();
+}
+
+void OutputTransform::SetCurve(TOutputTransformCurve tCurve, float fGamma) {
+	assert(tCurve < OUTPUT_TRANSFORM_CURVE_UNDEFINED);
+
+	m_tCurve = tCurve;
+
+	if (fGamma > 0) {
+		m_fGamma = fGamma;
+	}
+
+	Build();
+}
+
+void OutputTransform::SetResolution(TOutputTransformResolution tResolution) {
+	m_tResolution = tResolution;
+
+	Build();
+}
+
+float OutputTransform::Curve(float x) const {
+	switch (m_tCurve) {
+	case OUTPUT_TRANSFORM_CURVE_GAMMA:
+		return power(x, m_fGamma);
+	case OUTPUT_TRANSFORM_CURVE_SCURVE:
+		return x * x * (3.0f - 2.0f * x);
+	default:
+		return x;
+	}
+}
+
+void OutputTransform::Build(void) {
+	if (m_tResolution == OUTPUT_TRANSFORM_RESOLUTION_8BIT) {
+		const uint32_t nShift = 16 - m_nOutputBits;
+
+		for (uint32_t i = 0; i < 256; i++) {
+			const uint32_t nValue = (uint32_t) (Curve((float) i / 255) * 65535 + 0.5f);
+			m_aLut[i] = (nValue > 0xFFFF ? 0xFFFF : nValue) >> nShift;
+		}
+
+		m_aLut[256] = m_aLut[255];
+		return;
+	}
+
+	for (uint32_t i = 0; i <= 256; i++) {
+		m_aLut[i] = (uint32_t) (Curve((float) i / 256) * 65536 + 0.5f);
+	}
+}
+
+uint32_t OutputTransform::Apply(const uint8_t *pSlots, uint32_t nSlots, uint16_t *pOutput, uint32_t nOutputs) const {
+	assert(pSlots != 0);
+	assert(pOutput != 0);
+
+	const uint32_t *pLut = m_aLut;
+
+	if (m_tResolution == OUTPUT_TRANSFORM_RESOLUTION_8BIT) {
+		const uint32_t nCount = nSlots < nOutputs ? nSlots : nOutputs;
+		uint32_t i = nCount;
+
+		while (i >= 4) {
+			const uint32_t a = pLut[pSlots[0]];
+			const uint32_t b = pLut[pSlots[1]];
+			const uint32_t c = pLut[pSlots[2]];
+			const uint32_t d = pLut[pSlots[3]];
+			pOutput[0] = (uint16_t) a;
+			pOutput[1] = (uint16_t) b;
+			pOutput[2] = (uint16_t) c;
+			pOutput[3] = (uint16_t) d;
+			pSlots += 4;
+			pOutput += 4;
+			i -= 4;
+		}
+
+		while (i-- != 0) {
+			*pOutput++ = (uint16_t) pLut[*pSlots++];
+		}
+
+		return nCount;
+	}
+
+	const uint32_t nShift = 16 - m_nOutputBits;
+	const uint32_t nCount = (nSlots / 2) < nOutputs ? (nSlots / 2) : nOutputs;
+
+	for (uint32_t i = 0; i < nCount; i++) {
+		const uint32_t nCoarse = pSlots[0];
+		const uint32_t nFine = pSlots[1];
+		const uint32_t nLow = pLut[nCoarse];
+		const uint32_t nHigh = pLut[nCoarse + 1];
+
+		uint32_t nValue = nLow + (((nHigh - nLow) * nFine) >> 8);
+
+		if (nValue > 0xFFFF) {
+			nValue = 0xFFFF;
+		}
+
+		*pOutput++ = (uint16_t) (nValue >> nShift);
+		pSlots += 2;
+	}
+
+	return nCount;
+}
+
+void OutputTransform::Print(void) {
+	if (m_tCurve == OUTPUT_TRANSFORM_CURVE_GAMMA) {
+		printf(" Curve : %s %.1f\n", s_aCurve[m_tCurve], m_fGamma);
+	} else {
+		printf(" Curve : %s\n", s_aCurve[m_tCurve]);
+	}
+	printf(" Slots : %d-bit\n", m_tResolution == OUTPUT_TRANSFORM_RESOLUTION_16BIT ? 16 : 8);
+}
+
+const char *OutputTransform::GetCurve(TOutputTransformCurve tCurve) {
+	assert(tCurve < OUTPUT_TRANSFORM_CURVE_UNDEFINED);
+
+	return s_aCurve[tCurve];
+}
+
+TOutputTransformCurve OutputTransform::GetCurve(const char *pValue) {
+	assert(pValue != 0);
+
+	for (uint32_t i = 0; i < OUTPUT_TRANSFORM_CURVE_UNDEFINED; i++) {
+		if (strcasecmp(pValue, s_aCurve[i]) == 0) {
+			return (TOutputTransformCurve) i;
+		}
+	}
+
+	return OUTPUT_TRANSFORM_CURVE_UNDEFINED;
+}
@@ -35,6 +35,9 @@
 #include "ws28xx.h"
 #include "rgbmapping.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TLtcDisplayParams {
 	uint32_t nSetList;
 	uint8_t nMax7219Type;
@@ -105,6 +108,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -115,6 +119,7 @@ private:
 private:
 	LtcDisplayParamsStore *m_pLtcDisplayParamsStore;
 	struct TLtcDisplayParams m_tLtcDisplayParams;
+	PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* LTCDISPLAYPARAMS_H_ */
@@ -31,6 +31,9 @@
 
 #include "ltc.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 enum TLtcParamsMaskDisabledOutputs {
 	LTC_PARAMS_DISABLE_DISPLAY = (1 << 0),
 	LTC_PARAMS_DISABLE_MAX7219 = (1 << 1),
@@ -181,6 +184,8 @@ public:
 public:
     static void staticCallbackFunction(void *p, const char *s);
 
+    static const struct TPropertiesTable PROPERTIES_TABLE;
+
 private:
     void callbackFunction(const char *pLine);
     bool isMaskSet(uint32_t nMask) {
@@ -194,6 +199,7 @@ private:
 private:
     LtcParamsStore 	*m_pLTcParamsStore;
     struct TLtcParams m_tLtcParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* LTCPARAMS_H_ */
@@ -48,10 +48,46 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 static const char aColonBlinkMode[3][5] = { "off", "down", "up" };
 
-LtcDisplayParams::LtcDisplayParams(LtcDisplayParamsStore *pLtcDisplayParamsStore): m_pLtcDisplayParamsStore(pLtcDisplayParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TLtcDisplayParams, f)
+
+enum TLtcDisplayParamsKey {
+	KEY_MAX7219_TYPE,
+	KEY_MAX7219_INTENSITY,
+	KEY_WS28XX_TYPE,
+	KEY_LED_TYPE,
+	KEY_LED_RGB_MAPPING,
+	KEY_WS28XX_INTENSITY,
+	KEY_WS28XX_COLON_BLINK_MODE,
+	KEY_GLOBAL_BRIGHTNESS,
+	KEY_WS28XX_COLOUR_DIGIT,
+	KEY_LAST = KEY_WS28XX_COLOUR_DIGIT + LTCDISPLAYWS28XX_COLOUR_INDEX_LAST
+};
+
+// Must be in the order of TLtcDisplayParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ LtcDisplayParamsConst::MAX7219_TYPE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcDisplayParamsConst::MAX7219_INTENSITY, OFFSET(nMax7219Intensity), PROPERTIES_TYPE_UINT8, LTCDISPLAY_PARAMS_MASK_MAX7219_INTENSITY, 0, 0x0F },
+	{ LtcDisplayParamsConst::WS28XX_TYPE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DevicesParamsConst::LED_TYPE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DevicesParamsConst::LED_RGB_MAPPING, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcDisplayParamsConst::WS28XX_INTENSITY, OFFSET(nWS28xxIntensity), PROPERTIES_TYPE_UINT8, LTCDISPLAY_PARAMS_MASK_WS28XX_INTENSITY, 1, 0xFF },
+	{ LtcDisplayParamsConst::WS28XX_COLON_BLINK_MODE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DevicesParamsConst::GLOBAL_BRIGHTNESS, OFFSET(nGlobalBrightness), PROPERTIES_TYPE_UINT8, LTCDISPLAY_PARAMS_MASK_GLOBAL_BRIGHTNESS, 0, 0xFF },
+	{ LtcDisplayParamsConst::WS28XX_COLOUR[LTCDISPLAYWS28XX_COLOUR_INDEX_DIGIT], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcDisplayParamsConst::WS28XX_COLOUR[LTCDISPLAYWS28XX_COLOUR_INDEX_COLON], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcDisplayParamsConst::WS28XX_COLOUR[LTCDISPLAYWS28XX_COLOUR_INDEX_MESSAGE], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TLtcDisplayParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable LtcDisplayParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 6, 0x9E3779B3 };
+
+LtcDisplayParams::LtcDisplayParams(LtcDisplayParamsStore *pLtcDisplayParamsStore): m_pLtcDisplayParamsStore(pLtcDisplayParamsStore), m_pPropertiesParser(0) {
 	m_tLtcDisplayParams.nLedType = LTCDISPLAYWS28XX_DEFAULT_LED_TYPE;
 	m_tLtcDisplayParams.nGlobalBrightness = LTCDISPLAYWS28XX_DEFAULT_GLOBAL_BRIGHTNESS;
 	m_tLtcDisplayParams.nMax7219Type = LTCDISPLAYMAX7219_TYPE_MATRIX;
@@ -71,9 +107,16 @@ LtcDisplayParams::~LtcDisplayParams(void) {
 bool LtcDisplayParams::Load(void) {
 	m_tLtcDisplayParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tLtcDisplayParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(LtcDisplayParams::staticCallbackFunction, this);
 
-	if (configfile.Read(LtcDisplayParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(LtcDisplayParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pLtcDisplayParamsStore != 0) {
 			m_pLtcDisplayParamsStore->Update(&m_tLtcDisplayParams);
@@ -98,108 +141,102 @@ void LtcDisplayParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tLtcDisplayParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tLtcDisplayParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(LtcDisplayParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pLtcDisplayParamsStore->Update(&m_tLtcDisplayParams);
 }
 
 void LtcDisplayParams::callbackFunction(const char *pLine) {
+	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
+
 	char buffer[16];
-	uint8_t value8;
 	uint32_t value32;
 	uint8_t len;
 
-	len = sizeof(buffer);
-
-	if (Sscan::Char(pLine, LtcDisplayParamsConst::MAX7219_TYPE, buffer, &len) == SSCAN_OK) {
-		if (strncasecmp(buffer, "7segment", len) == 0) {
-			m_tLtcDisplayParams.nMax7219Type = LTCDISPLAYMAX7219_TYPE_7SEGMENT;
-			m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_MAX7219_TYPE;
-		} else if (strncasecmp(buffer, "matrix", len) == 0) {
-			m_tLtcDisplayParams.nMax7219Type = LTCDISPLAYMAX7219_TYPE_MATRIX;
-			m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_MAX7219_TYPE;
-		}
-		return;
-	}
+	const int32_t nKey = m_pPropertiesParser->Parse(pLine);
 
-	if (Sscan::Uint8(pLine, LtcDisplayParamsConst::MAX7219_INTENSITY, &value8) == SSCAN_OK) {
-		if (value8 <= 0x0F) {
-			m_tLtcDisplayParams.nMax7219Intensity = value8;
-			m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_MAX7219_INTENSITY;
-		}
-		return;
-	}
+	if ((nKey >= KEY_WS28XX_COLOUR_DIGIT) && (nKey < KEY_LAST)) {
+		const uint32_t nIndex = (uint32_t) (nKey - KEY_WS28XX_COLOUR_DIGIT);
 
-	if (Sscan::Char(pLine, LtcDisplayParamsConst::WS28XX_TYPE, buffer, &len) == SSCAN_OK) {
-		if (strncasecmp(buffer, "7segment", len) == 0) {
-			m_tLtcDisplayParams.nWS28xxType = LTCDISPLAYWS28XX_TYPE_7SEGMENT;
-			m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_TYPE;
-		} else if (strncasecmp(buffer, "matrix", len) == 0) {
-			m_tLtcDisplayParams.nWS28xxType = LTCDISPLAYWS28XX_TYPE_MATRIX;
-			m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_TYPE;
+		if (Sscan::Hex24Uint32(pLine, LtcDisplayParamsConst::WS28XX_COLOUR[nIndex], &value32) == SSCAN_OK) {
+			m_tLtcDisplayParams.aWS28xxColour[nIndex] = value32;
+			m_tLtcDisplayParams.nSetList |= (LTCDISPLAY_PARAMS_MASK_WS28XX_COLOUR_INDEX << nIndex);
 		}
 		return;
 	}
 
-	len = 7;
-	if (Sscan::Char(pLine, DevicesParamsConst::LED_TYPE, buffer, &len) == SSCAN_OK) {
-		buffer[len] = '\0';
-		for (uint32_t i = 0; i < WS28XX_UNDEFINED; i++) {
-			if (strcasecmp(buffer, WS28xxConst::TYPES[i]) == 0) {
-				m_tLtcDisplayParams.nLedType = (TWS28XXType) i;
-				m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_LED_TYPE;
-				return;
+	switch (nKey) {
+	case KEY_MAX7219_TYPE:
+		len = sizeof(buffer);
+		if (Sscan::Char(pLine, LtcDisplayParamsConst::MAX7219_TYPE, buffer, &len) == SSCAN_OK) {
+			if (strncasecmp(buffer, "7segment", len) == 0) {
+				m_tLtcDisplayParams.nMax7219Type = LTCDISPLAYMAX7219_TYPE_7SEGMENT;
+				m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_MAX7219_TYPE;
+			} else if (strncasecmp(buffer, "matrix", len) == 0) {
+				m_tLtcDisplayParams.nMax7219Type = LTCDISPLAYMAX7219_TYPE_MATRIX;
+				m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_MAX7219_TYPE;
 			}
 		}
-		return;
-	}
-
-	len = 3;
-	if (Sscan::Char(pLine, DevicesParamsConst::LED_RGB_MAPPING, buffer, &len) == SSCAN_OK) {
-		buffer[len] = '\0';
-		enum TRGBMapping tMapping;
-		if ((tMapping = RGBMapping::FromString(buffer)) != RGB_MAPPING_UNDEFINED) {
-			m_tLtcDisplayParams.nRgbMapping = (uint8_t) tMapping;
-			m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_RGB_MAPPING;
+		break;
+	case KEY_WS28XX_TYPE:
+		len = sizeof(buffer);
+		if (Sscan::Char(pLine, LtcDisplayParamsConst::WS28XX_TYPE, buffer, &len) == SSCAN_OK) {
+			if (strncasecmp(buffer, "7segment", len) == 0) {
+				m_tLtcDisplayParams.nWS28xxType = LTCDISPLAYWS28XX_TYPE_7SEGMENT;
+				m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_TYPE;
+			} else if (strncasecmp(buffer, "matrix", len) == 0) {
+				m_tLtcDisplayParams.nWS28xxType = LTCDISPLAYWS28XX_TYPE_MATRIX;
+				m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_TYPE;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcDisplayParamsConst::WS28XX_INTENSITY, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_tLtcDisplayParams.nWS28xxIntensity = value8;
-			m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_INTENSITY;
+		break;
+	case KEY_LED_TYPE:
+		len = 7;
+		if (Sscan::Char(pLine, DevicesParamsConst::LED_TYPE, buffer, &len) == SSCAN_OK) {
+			buffer[len] = '\0';
+			for (uint32_t i = 0; i < WS28XX_UNDEFINED; i++) {
+				if (strcasecmp(buffer, WS28xxConst::TYPES[i]) == 0) {
+					m_tLtcDisplayParams.nLedType = (TWS28XXType) i;
+					m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_LED_TYPE;
+					break;
+				}
+			}
 		}
-		return;
-	}
-
-	len = 4;
-	if (Sscan::Char(pLine, LtcDisplayParamsConst::WS28XX_COLON_BLINK_MODE, buffer, &len) == SSCAN_OK) {
-		buffer[len] = '\0';
-		for (uint32_t i = 0; i < (sizeof(aColonBlinkMode) / sizeof(aColonBlinkMode[0])); i++) {
-			if (strcasecmp(buffer, aColonBlinkMode[i]) == 0) {
-				m_tLtcDisplayParams.nWS28xxColonBlinkMode = (TLtcDisplayWS28xxColonBlinkMode) i;
-				m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_COLON_BLINK_MODE;
-				return;
+		break;
+	case KEY_LED_RGB_MAPPING:
+		len = 3;
+		if (Sscan::Char(pLine, DevicesParamsConst::LED_RGB_MAPPING, buffer, &len) == SSCAN_OK) {
+			buffer[len] = '\0';
+			enum TRGBMapping tMapping;
+			if ((tMapping = RGBMapping::FromString(buffer)) != RGB_MAPPING_UNDEFINED) {
+				m_tLtcDisplayParams.nRgbMapping = (uint8_t) tMapping;
+				m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_RGB_MAPPING;
 			}
 		}
-		return;
-	}
-
-	for (uint32_t nIndex = 0; nIndex < LTCDISPLAYWS28XX_COLOUR_INDEX_LAST; nIndex++) {
-		if(Sscan::Hex24Uint32(pLine, LtcDisplayParamsConst::WS28XX_COLOUR[nIndex], &value32) == SSCAN_OK) {
-			m_tLtcDisplayParams.aWS28xxColour[nIndex] = value32;
-			m_tLtcDisplayParams.nSetList |= (LTCDISPLAY_PARAMS_MASK_WS28XX_COLOUR_INDEX << nIndex);
-			return;
+		break;
+	case KEY_WS28XX_COLON_BLINK_MODE:
+		len = 4;
+		if (Sscan::Char(pLine, LtcDisplayParamsConst::WS28XX_COLON_BLINK_MODE, buffer, &len) == SSCAN_OK) {
+			buffer[len] = '\0';
+			for (uint32_t i = 0; i < (sizeof(aColonBlinkMode) / sizeof(aColonBlinkMode[0])); i++) {
+				if (strcasecmp(buffer, aColonBlinkMode[i]) == 0) {
+					m_tLtcDisplayParams.nWS28xxColonBlinkMode = (TLtcDisplayWS28xxColonBlinkMode) i;
+					m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_COLON_BLINK_MODE;
+					break;
+				}
+			}
 		}
-	}
-
-	if (Sscan::Uint8(pLine, DevicesParamsConst::GLOBAL_BRIGHTNESS, &value8) == SSCAN_OK) {
-		m_tLtcDisplayParams.nGlobalBrightness = value8;
-		m_tLtcDisplayParams.nSetList |= LTCDISPLAY_PARAMS_MASK_GLOBAL_BRIGHTNESS;
-		return;
+		break;
+	default:
+		break;
 	}
 }
 
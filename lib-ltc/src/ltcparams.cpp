@@ -42,8 +42,78 @@
 #include "readconfigfile.h"
 #include "sscan.h"
 #include "propertiesbuilder.h"
-
-LtcParams::LtcParams(LtcParamsStore *pLtcParamsStore): m_pLTcParamsStore(pLtcParamsStore) {
+#include "propertiesparser.h"
+
+#define OFFSET(f)	__builtin_offsetof(struct TLtcParams, f)
+
+enum TLtcParamsKey {
+	KEY_SOURCE,
+	KEY_AUTO_START,
+	KEY_DISABLE_DISPLAY,
+	KEY_DISABLE_MAX7219,
+	KEY_DISABLE_LTC,
+	KEY_DISABLE_MIDI,
+	KEY_DISABLE_ARTNET,
+	KEY_DISABLE_TCNET,
+	KEY_DISABLE_RTPMIDI,
+	KEY_SHOW_SYSTIME,
+	KEY_DISABLE_TIMESYNC,
+	KEY_YEAR,
+	KEY_MONTH,
+	KEY_DAY,
+	KEY_NTP_ENABLE,
+	KEY_FPS,
+	KEY_START_FRAME,
+	KEY_START_SECOND,
+	KEY_START_MINUTE,
+	KEY_START_HOUR,
+	KEY_STOP_FRAME,
+	KEY_STOP_SECOND,
+	KEY_STOP_MINUTE,
+	KEY_STOP_HOUR,
+	KEY_OSC_ENABLE,
+	KEY_OSC_PORT,
+	KEY_WS28XX_ENABLE,
+	KEY_LAST
+};
+
+// Must be in the order of TLtcParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ LtcParamsConst::SOURCE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcParamsConst::AUTO_START, OFFSET(nAutoStart), PROPERTIES_TYPE_FLAG, LTC_PARAMS_MASK_AUTO_START, 0, 0 },
+	{ LtcParamsConst::DISABLE_DISPLAY, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcParamsConst::DISABLE_MAX7219, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcParamsConst::DISABLE_LTC, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcParamsConst::DISABLE_MIDI, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcParamsConst::DISABLE_ARTNET, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcParamsConst::DISABLE_TCNET, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcParamsConst::DISABLE_RTPMIDI, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LtcParamsConst::SHOW_SYSTIME, OFFSET(nShowSysTime), PROPERTIES_TYPE_FLAG, LTC_PARAMS_MASK_SHOW_SYSTIME, 0, 0 },
+	{ LtcParamsConst::DISABLE_TIMESYNC, OFFSET(nDisableTimeSync), PROPERTIES_TYPE_FLAG, LTC_PARAMS_MASK_DISABLE_TIMESYNC, 0, 0 },
+	{ LtcParamsConst::YEAR, OFFSET(nYear), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_YEAR, 19, 0xFF },
+	{ LtcParamsConst::MONTH, OFFSET(nMonth), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_MONTH, 1, 12 },
+	{ LtcParamsConst::DAY, OFFSET(nDay), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_DAY, 1, 31 },
+	{ LtcParamsConst::NTP_ENABLE, OFFSET(nEnableNtp), PROPERTIES_TYPE_FLAG, LTC_PARAMS_MASK_ENABLE_NTP, 0, 0 },
+	{ LtcParamsConst::FPS, OFFSET(nFps), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_FPS, 24, 30 },
+	{ LtcParamsConst::START_FRAME, OFFSET(nStartFrame), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_START_FRAME, 0, 30 },
+	{ LtcParamsConst::START_SECOND, OFFSET(nStartSecond), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_START_SECOND, 0, 59 },
+	{ LtcParamsConst::START_MINUTE, OFFSET(nStartMinute), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_START_MINUTE, 0, 59 },
+	{ LtcParamsConst::START_HOUR, OFFSET(nStartHour), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_START_HOUR, 0, 23 },
+	{ LtcParamsConst::STOP_FRAME, OFFSET(nStopFrame), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_STOP_FRAME, 0, 30 },
+	{ LtcParamsConst::STOP_SECOND, OFFSET(nStopSecond), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_STOP_SECOND, 0, 59 },
+	{ LtcParamsConst::STOP_MINUTE, OFFSET(nStopMinute), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_STOP_MINUTE, 0, 59 },
+	{ LtcParamsConst::STOP_HOUR, OFFSET(nStopHour), PROPERTIES_TYPE_UINT8, LTC_PARAMS_MASK_STOP_HOUR, 0, 99 },
+	{ LtcParamsConst::OSC_ENABLE, OFFSET(nEnableOsc), PROPERTIES_TYPE_FLAG, LTC_PARAMS_MASK_ENABLE_OSC, 0, 0 },
+	{ LtcParamsConst::OSC_PORT, OFFSET(nOscPort), PROPERTIES_TYPE_UINT16, LTC_PARAMS_MASK_OSC_PORT, 1024, 0xFFFF },
+	{ LtcParamsConst::WS28XX_ENABLE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TLtcParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable LtcParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 7, 0x9E3779B5 };
+
+LtcParams::LtcParams(LtcParamsStore *pLtcParamsStore): m_pLTcParamsStore(pLtcParamsStore), m_pPropertiesParser(0) {
 	uint8_t *p = (uint8_t *) &m_tLtcParams;
 
 	for (uint32_t i = 0; i < sizeof(struct TLtcParams); i++) {
@@ -71,9 +141,16 @@ LtcParams::~LtcParams(void) {
 bool LtcParams::Load(void) {
 	m_tLtcParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tLtcParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(LtcParams::staticCallbackFunction, this);
 
-	if (configfile.Read(LtcParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(LtcParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pLTcParamsStore != 0) {
 			m_pLTcParamsStore->Update(&m_tLtcParams);
@@ -98,10 +175,15 @@ void LtcParams::Load(const char* pBuffer, uint32_t nLength) {
 
 	m_tLtcParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tLtcParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(LtcParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pLTcParamsStore->Update(&m_tLtcParams);
 }
 
@@ -120,213 +202,67 @@ void LtcParams::HandleDisabledOutput(const char *pLine, const char *pKeyword, TL
 
 void LtcParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t value8;
-	uint16_t value16;
 	char source[16];
 	uint8_t len = sizeof(source);
 
-	if (Sscan::Char(pLine, LtcParamsConst::SOURCE, source, &len) == SSCAN_OK) {
-		source[len] = '\0';
-		m_tLtcParams.tSource = GetSourceType((const char *) source);
-		m_tLtcParams.nSetList |= LTC_PARAMS_MASK_SOURCE;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::AUTO_START, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_tLtcParams.nAutoStart = 1;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_AUTO_START;
-		} else {
-			m_tLtcParams.nAutoStart = 0;
-			m_tLtcParams.nSetList &= ~LTC_PARAMS_MASK_AUTO_START;
-		}
-	}
-
-	HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_DISPLAY, LTC_PARAMS_DISABLE_DISPLAY);
-	HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_MAX7219, LTC_PARAMS_DISABLE_MAX7219);
-	HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_LTC, LTC_PARAMS_DISABLE_LTC);
-	HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_MIDI, LTC_PARAMS_DISABLE_MIDI);
-	HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_ARTNET, LTC_PARAMS_DISABLE_ARTNET);
-	HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_TCNET, LTC_PARAMS_DISABLE_TCNET);
-	HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_RTPMIDI, LTC_PARAMS_DISABLE_RTPMIDI);
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::SHOW_SYSTIME, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_tLtcParams.nShowSysTime = 1;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_SHOW_SYSTIME;
-		} else {
-			m_tLtcParams.nShowSysTime = 0;
-			m_tLtcParams.nSetList &= ~LTC_PARAMS_MASK_SHOW_SYSTIME;
-		}
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::DISABLE_TIMESYNC, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_tLtcParams.nDisableTimeSync = 1;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_DISABLE_TIMESYNC;
-		} else {
-			m_tLtcParams.nDisableTimeSync = 0;
-			m_tLtcParams.nSetList &= ~LTC_PARAMS_MASK_DISABLE_TIMESYNC;
-		}
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::YEAR, &value8) == SSCAN_OK) {
-		if (value8 >= 19) {
-			m_tLtcParams.nYear = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_YEAR;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::MONTH, &value8) == SSCAN_OK) {
-		if ((value8 >= 1) && (value8 <= 12)) {
-			m_tLtcParams.nMonth = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_MONTH;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::DAY, &value8) == SSCAN_OK) {
-		if ((value8 >= 1) && (value8 <= 31)) {
-			m_tLtcParams.nDay = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_DAY;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::NTP_ENABLE, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_tLtcParams.nEnableNtp = 1;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_ENABLE_NTP;
-		} else {
-			m_tLtcParams.nEnableNtp = 0;
-			m_tLtcParams.nSetList &= ~LTC_PARAMS_MASK_ENABLE_NTP;
-		}
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::FPS, &value8) == SSCAN_OK) {
-		if ((value8 >= 24) && (value8 <= 30)) {
-			m_tLtcParams.nFps = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_FPS;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::START_FRAME, &value8) == SSCAN_OK) {
-		if (value8 <= 30) {
-			m_tLtcParams.nStartFrame = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_START_FRAME;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::START_SECOND, &value8) == SSCAN_OK) {
-		if (value8 <= 59) {
-			m_tLtcParams.nStartSecond = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_START_SECOND;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::START_MINUTE, &value8) == SSCAN_OK) {
-		if (value8 <= 59) {
-			m_tLtcParams.nStartMinute = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_START_MINUTE;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::START_HOUR, &value8) == SSCAN_OK) {
-		if (value8 <= 23) {
-			m_tLtcParams.nStartHour = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_START_HOUR;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::STOP_FRAME, &value8) == SSCAN_OK) {
-		if (value8 <= 30) {
-			m_tLtcParams.nStopFrame = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_STOP_FRAME;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::STOP_SECOND, &value8) == SSCAN_OK) {
-		if (value8 <= 59) {
-			m_tLtcParams.nStopSecond = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_STOP_SECOND;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::STOP_MINUTE, &value8) == SSCAN_OK) {
-		if (value8 <= 59) {
-			m_tLtcParams.nStopMinute = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_STOP_MINUTE;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::STOP_HOUR, &value8) == SSCAN_OK) {
-		if (value8 <= 99) {
-			m_tLtcParams.nStopHour = value8;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_STOP_HOUR;
-		}
-		return;
-	}
-
-#if 0
-	if (Sscan::Uint8(pLine, LtcParamsConst::SET_DATE, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_tLtcParams.nSetDate = 1;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_SET_DATE;
-		} else {
-			m_tLtcParams.nSetDate = 0;
-			m_tLtcParams.nSetList &= ~LTC_PARAMS_MASK_SET_DATE;
-		}
-	}
-#endif
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::OSC_ENABLE, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_tLtcParams.nEnableOsc = 1;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_ENABLE_OSC;
-		} else {
-			m_tLtcParams.nEnableOsc = 0;
-			m_tLtcParams.nSetList &= ~LTC_PARAMS_MASK_ENABLE_OSC;
-		}
-	}
-
-	if (Sscan::Uint16(pLine, LtcParamsConst::OSC_PORT, &value16) == SSCAN_OK) {
-		if (value16 > 1023) {
-			m_tLtcParams.nOscPort = value16;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_OSC_PORT;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LtcParamsConst::WS28XX_ENABLE, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_tLtcParams.nEnableWS28xx = 1;
-			m_tLtcParams.nDisabledOutputs |= LTC_PARAMS_DISABLE_MAX7219;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_SOURCE:
+		if (Sscan::Char(pLine, LtcParamsConst::SOURCE, source, &len) == SSCAN_OK) {
+			source[len] = '\0';
+			m_tLtcParams.tSource = GetSourceType((const char *) source);
+			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_SOURCE;
+		}
+		break;
+	case KEY_DISABLE_DISPLAY:
+		HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_DISPLAY, LTC_PARAMS_DISABLE_DISPLAY);
+		break;
+	case KEY_DISABLE_MAX7219:
+		HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_MAX7219, LTC_PARAMS_DISABLE_MAX7219);
+		break;
+	case KEY_DISABLE_LTC:
+		HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_LTC, LTC_PARAMS_DISABLE_LTC);
+		break;
+	case KEY_DISABLE_MIDI:
+		HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_MIDI, LTC_PARAMS_DISABLE_MIDI);
+		break;
+	case KEY_DISABLE_ARTNET:
+		HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_ARTNET, LTC_PARAMS_DISABLE_ARTNET);
+		break;
+	case KEY_DISABLE_TCNET:
+		HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_TCNET, LTC_PARAMS_DISABLE_TCNET);
+		break;
+	case KEY_DISABLE_RTPMIDI:
+		HandleDisabledOutput(pLine, LtcParamsConst::DISABLE_RTPMIDI, LTC_PARAMS_DISABLE_RTPMIDI);
+		break;
+	case KEY_WS28XX_ENABLE:
+		if (Sscan::Uint8(pLine, LtcParamsConst::WS28XX_ENABLE, &value8) == SSCAN_OK) {
+			if (value8 != 0) {
+				m_tLtcParams.nEnableWS28xx = 1;
+				m_tLtcParams.nDisabledOutputs |= LTC_PARAMS_DISABLE_MAX7219;
 #if !defined(USE_SPI_DMA)
-			m_tLtcParams.nDisabledOutputs |= LTC_PARAMS_DISABLE_LTC;		// TODO Temporarily code until SPI DMA has been implemented
+				m_tLtcParams.nDisabledOutputs |= LTC_PARAMS_DISABLE_LTC;		// TODO Temporarily code until SPI DMA has been implemented
 #endif
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_ENABLE_WS28XX;
-			m_tLtcParams.nSetList |= LTC_PARAMS_MASK_DISABLED_OUTPUTS;
-		} else {
-			m_tLtcParams.nEnableWS28xx = 0;
-			if (!isDisabledOutputMaskSet(LTC_PARAMS_DISABLE_MAX7219)) {
-				m_tLtcParams.nDisabledOutputs &= ~LTC_PARAMS_DISABLE_MAX7219;
-			}
+				m_tLtcParams.nSetList |= LTC_PARAMS_MASK_ENABLE_WS28XX;
+				m_tLtcParams.nSetList |= LTC_PARAMS_MASK_DISABLED_OUTPUTS;
+			} else {
+				m_tLtcParams.nEnableWS28xx = 0;
+				if (!isDisabledOutputMaskSet(LTC_PARAMS_DISABLE_MAX7219)) {
+					m_tLtcParams.nDisabledOutputs &= ~LTC_PARAMS_DISABLE_MAX7219;
+				}
 #if !defined(USE_SPI_DMA)
-			if (!isDisabledOutputMaskSet(LTC_PARAMS_DISABLE_LTC)) {			// TODO Temporarily code until SPI DMA has been implemented
-				m_tLtcParams.nDisabledOutputs &= ~LTC_PARAMS_DISABLE_LTC;	// TODO Temporarily code until SPI DMA has been implemented
-			}																// TODO Temporarily code until SPI DMA has been implemented
+				if (!isDisabledOutputMaskSet(LTC_PARAMS_DISABLE_LTC)) {			// TODO Temporarily code until SPI DMA has been implemented
+					m_tLtcParams.nDisabledOutputs &= ~LTC_PARAMS_DISABLE_LTC;	// TODO Temporarily code until SPI DMA has been implemented
+				}																// TODO Temporarily code until SPI DMA has been implemented
 #endif
-			m_tLtcParams.nSetList &= ~LTC_PARAMS_MASK_ENABLE_WS28XX;
+				m_tLtcParams.nSetList &= ~LTC_PARAMS_MASK_ENABLE_WS28XX;
+			}
 		}
+		break;
+	default:
+		break;
 	}
 }
 
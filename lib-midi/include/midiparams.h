@@ -27,6 +27,9 @@
 
 #include <stdint.h>
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TMidiParams {
 	uint32_t nSetList;
 	uint32_t nBaudrate;
@@ -66,6 +69,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -76,6 +80,7 @@ private:
 private:
     MidiParamsStore *m_pMidiParamsStore;
     struct TMidiParams m_tMidiParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* MIDIPARAMS_H_ */
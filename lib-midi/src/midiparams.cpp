@@ -35,6 +35,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
 #define BOOL2STRING(b)	(b) ? "Yes" : "No"
@@ -46,7 +47,26 @@ static const char PARAMS_FILE_NAME[] ALIGNED = "midi.txt";
 static const char PARAMS_BAUDRATE[] ALIGNED = "baudrate";
 static const char PARAMS_ACTIVE_SENSE[] ALIGNED = "active_sense";
 
-MidiParams::MidiParams(MidiParamsStore* pMidiParamsStore): m_pMidiParamsStore(pMidiParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TMidiParams, f)
+
+enum TMidiParamsKey {
+	KEY_BAUDRATE,
+	KEY_ACTIVE_SENSE,
+	KEY_LAST
+};
+
+// Must be in the order of TMidiParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ PARAMS_BAUDRATE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_ACTIVE_SENSE, OFFSET(nActiveSense), PROPERTIES_TYPE_BOOL, SET_ACTIVE_SENSE, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TMidiParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable MidiParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 4, 0x9E3779B1 };
+
+MidiParams::MidiParams(MidiParamsStore* pMidiParamsStore): m_pMidiParamsStore(pMidiParamsStore), m_pPropertiesParser(0) {
 	uint8_t *p = (uint8_t *) &m_tMidiParams;
 
 	for (uint32_t i = 0; i < sizeof(struct TMidiParams); i++) {
@@ -64,9 +84,16 @@ MidiParams::~MidiParams(void) {
 bool MidiParams::Load(void) {
 	m_tMidiParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tMidiParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(MidiParams::staticCallbackFunction, this);
 
-	if (configfile.Read(PARAMS_FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pMidiParamsStore != 0) {
 			m_pMidiParamsStore->Update(&m_tMidiParams);
@@ -91,34 +118,34 @@ void MidiParams::Load(const char* pBuffer, uint32_t nLength) {
 
 	m_tMidiParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tMidiParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(MidiParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pMidiParamsStore->Update(&m_tMidiParams);
 }
 
 void MidiParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
-	uint8_t value8;
 	uint32_t value32;
 
-	if (Sscan::Uint32(pLine, PARAMS_BAUDRATE, &value32) == SSCAN_OK) {
-		if (value32 == 0) {
-			m_tMidiParams.nBaudrate = MIDI_BAUDRATE_DEFAULT;
-			m_tMidiParams.nSetList |= SET_BAUDRATE;
-		} else if ((value32 >= 9600) && (value32 <= 115200)) {
-			m_tMidiParams.nBaudrate = value32;
-			m_tMidiParams.nSetList |= SET_BAUDRATE;
+	if (m_pPropertiesParser->Parse(pLine) == KEY_BAUDRATE) {
+		if (Sscan::Uint32(pLine, PARAMS_BAUDRATE, &value32) == SSCAN_OK) {
+			if (value32 == 0) {
+				m_tMidiParams.nBaudrate = MIDI_BAUDRATE_DEFAULT;
+				m_tMidiParams.nSetList |= SET_BAUDRATE;
+			} else if ((value32 >= 9600) && (value32 <= 115200)) {
+				m_tMidiParams.nBaudrate = value32;
+				m_tMidiParams.nSetList |= SET_BAUDRATE;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, PARAMS_ACTIVE_SENSE, &value8) == SSCAN_OK) {
-		m_tMidiParams.nActiveSense = !(value8 == 0);
-		m_tMidiParams.nSetList |= SET_ACTIVE_SENSE;
-		return;
 	}
 }
 
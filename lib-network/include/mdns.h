@@ -73,13 +73,16 @@ public:
 
 private:
 	void Parse(void);
-	void HandleRequest(uint16_t nQuestions);
+	void HandleRequest(uint16_t nQuestions, uint16_t nAnswers);
+	uint32_t HandleKnownAnswers(uint32_t nOffset, uint16_t nAnswers);
+	bool IsInstanceName(uint32_t nIndex, const char *pDnsName);
 
 	uint32_t DecodeDNSNameNotation(const char *pDNSNameNotation, char *pString);
 
 	uint32_t WriteDnsName(const char *pSource, char *pDestination, bool bNullTerminated = true);
 	uint8_t* FindFirstDotFromRight(const uint8_t* pString);
 
+	void CreateAnswers(void);
 	void CreateAnswerLocalIpAddress(void);
 
 	uint32_t CreateAnswerServiceSrv(uint32_t nIndex, uint8_t *pDestination);
@@ -88,6 +91,7 @@ private:
 	uint32_t CreateAnswerServiceDnsSd(uint32_t nIndex, uint8_t *pDestination);
 
 	void CreateMDNSMessage(uint32_t nIndex);
+	void SendMessage(uint32_t nMask, uint32_t nIp);
 
 #ifndef NDEBUG
 	void Dump(const struct TmDNSHeader *pmDNSHeader, uint16_t nFlags);
@@ -107,6 +111,11 @@ private:
 	TMDNSRecordData m_aServiceRecordsData[SERVICE_RECORDS_MAX];
 	uint32_t m_nDNSServiceRecords;
 	TMDNSRecordData m_tAnswerLocalIp;
+	uint32_t m_nIp;
+	uint32_t m_nRandom;
+	uint32_t m_nPendingMask;
+	uint32_t m_nPendingMillis;
+	uint32_t m_nPendingDelay;
 };
 
 #endif /* MDNS_H_ */
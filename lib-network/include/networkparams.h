@@ -31,6 +31,9 @@
 
 #include "network.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TNetworkParams {
 	uint32_t nSetList;
 	uint32_t nLocalIp;
@@ -115,6 +118,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -125,6 +129,7 @@ private:
 private:
 	NetworkParamsStore *m_pNetworkParamsStore;
 	struct TNetworkParams m_tNetworkParams;
+	PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* NETWORKPARAMS_H_ */
@@ -39,6 +39,8 @@
 
 #include "hardware.h"
 
+#include "trace.h"
+
 #include "./../lib-h3/include/net/net.h"
 
 #define TO_HEX(i)		((i) < 10) ? (char)'0' + (char)(i) : (char)'A' + (char)((i) - 10)
@@ -167,11 +169,23 @@ void NetworkH3emac::LeaveGroup(uint32_t nHandle, uint32_t nIp) {
 }
 
 uint16_t NetworkH3emac::RecvFrom(uint32_t nHandle, uint8_t* packet, uint16_t size, uint32_t* from_ip, uint16_t* from_port) {
-	return udp_recv(nHandle, packet, size, from_ip, from_port);
+	TRACE_NET_MARK(nBeginMicros);
+
+	const uint16_t nBytesReceived = udp_recv(nHandle, packet, size, from_ip, from_port);
+
+	// Only the calls returning a packet are traced
+	if (nBytesReceived != 0) {
+		TRACE_NET_EVENT_AT(nBeginMicros, TRACE_NET_RECV_BEGIN, nBytesReceived);
+		TRACE_NET_EVENT(TRACE_NET_RECV_END, nBytesReceived);
+	}
+
+	return nBytesReceived;
 }
 
 void NetworkH3emac::SendTo(uint32_t nHandle, const uint8_t* packet, uint16_t size, uint32_t to_ip, uint16_t remote_port) {
+	TRACE_NET_EVENT(TRACE_NET_SEND_BEGIN, size);
 	udp_send(nHandle, packet, size, to_ip, remote_port);
+	TRACE_NET_EVENT(TRACE_NET_SEND_END, size);
 }
 
 void NetworkH3emac::SetIp(uint32_t nIp) {
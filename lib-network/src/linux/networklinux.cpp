@@ -39,6 +39,9 @@
 
 #include "debug.h"
 
+#include "hardware.h"
+#include "trace.h"
+
 /**
  * BEGIN - needed H3 code compatibility
  */
@@ -328,6 +331,7 @@ uint16_t NetworkLinux::RecvFrom(uint32_t nHandle, uint8_t* pPacket, uint16_t nSi
 	struct sockaddr_in si_other;
 	socklen_t slen = sizeof(si_other);
 
+	TRACE_NET_MARK(nBeginMicros);
 
 	if ((recv_len = recvfrom(nHandle, (void *)pPacket, nSize, 0, (struct sockaddr *) &si_other, &slen)) == -1) {
 		if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
@@ -340,6 +344,10 @@ uint16_t NetworkLinux::RecvFrom(uint32_t nHandle, uint8_t* pPacket, uint16_t nSi
 	*pFromIp = si_other.sin_addr.s_addr;
 	*pFromPort = ntohs(si_other.sin_port);
 
+	// Only the calls returning a packet are traced
+	TRACE_NET_EVENT_AT(nBeginMicros, TRACE_NET_RECV_BEGIN, recv_len);
+	TRACE_NET_EVENT(TRACE_NET_RECV_END, recv_len);
+
 	return recv_len;
 }
 
@@ -357,9 +365,13 @@ void NetworkLinux::SendTo(uint32_t nHandle, const uint8_t* pPacket, uint16_t nSi
 	si_other.sin_addr.s_addr = nToIp;
 	si_other.sin_port = htons(nRemotePort);
 
+	TRACE_NET_EVENT(TRACE_NET_SEND_BEGIN, nSize);
+
 	if (sendto(nHandle, pPacket, nSize, 0, (struct sockaddr*) &si_other, slen) == -1) {
 		perror("sendto");
 	}
+
+	TRACE_NET_EVENT(TRACE_NET_SEND_END, nSize);
 }
 
 #if defined(__linux__)
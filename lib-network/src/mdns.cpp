@@ -45,6 +45,11 @@
 
 #define BUFFER_SIZE				1024
 
+#define SERVICE_ANSWERS			4			///< SRV, TXT, DNS-SD PTR and PTR
+#define MASK_HOST				(1U << SERVICE_RECORDS_MAX)
+#define RESPONSE_DELAY_MIN		20			///< (in milliseconds)
+#define RESPONSE_DELAY_RANGE	100			///< (in milliseconds)
+
 enum TDNSClasses {
 	DNSClassInternet = 1
 };
@@ -60,6 +65,10 @@ enum TDNSCacheFlush {
 	DNSCacheFlushTrue = 0x8000
 };
 
+enum TDNSUnicastResponse {
+	DNSUnicastResponseTrue = 0x8000
+};
+
 enum TDNSOpCodes {
 	DNSOpQuery = 0,
 	DNSOpIQuery = 1,
@@ -86,7 +95,12 @@ MDNS::MDNS(void):
 	m_nBytesReceived(0),
 	m_pName(0),
 	m_nLastAnnounceMillis(0),
-	m_nDNSServiceRecords(0)
+	m_nDNSServiceRecords(0),
+	m_nIp(0),
+	m_nRandom(0),
+	m_nPendingMask(0),
+	m_nPendingMillis(0),
+	m_nPendingDelay(0)
 {
 	struct in_addr group_ip;
 	(void) inet_aton(MDNS_MULTICAST_ADDRESS, &group_ip);
@@ -119,7 +133,9 @@ void MDNS::Start(void) {
 		SetName(Network::Get()->GetHostName());
 	}
 
-	CreateAnswerLocalIpAddress();
+	CreateAnswers();
+
+	m_nRandom = m_nIp ^ Hardware::Get()->Micros();
 }
 
 void MDNS::Stop(void) {
@@ -141,36 +157,102 @@ void MDNS::SetName(const char *pName) {
 	strcpy((char *)m_pName + strlen(pName), MDNS_TLD);
 
 	DEBUG_PUTS(m_pName);
+
+	if (m_nHandle != -1) {
+		CreateAnswers();
+	}
 }
 
-void MDNS::CreateMDNSMessage(uint32_t nIndex) {
+void MDNS::CreateAnswers(void) {
 	DEBUG1_ENTRY
 
-	struct TmDNSHeader *pHeader = (struct TmDNSHeader*) &m_aServiceRecordsData[nIndex].aBuffer;
+	m_nIp = Network::Get()->GetIp();
 
-	pHeader->nFlags = __builtin_bswap16(0x8400);
-	pHeader->queryCount = 0;
-	pHeader->answerCount = __builtin_bswap16(4);
-	pHeader->authorityCount = __builtin_bswap16(1);
-	pHeader->additionalCount = __builtin_bswap16(0);
+	CreateAnswerLocalIpAddress();
 
-	uint8_t *pData = (uint8_t *)&m_aServiceRecordsData[nIndex].aBuffer + sizeof(struct TmDNSHeader);
+	for (uint32_t i = 0; i < SERVICE_RECORDS_MAX; i++) {
+		if (m_aServiceRecords[i].pName != 0) {
+			CreateMDNSMessage(i);
+		}
+	}
+
+	DEBUG1_EXIT
+}
+
+void MDNS::CreateMDNSMessage(uint32_t nIndex) {
+	DEBUG1_ENTRY
+
+	uint8_t *pData = (uint8_t *)&m_aServiceRecordsData[nIndex].aBuffer;
 
 	pData += CreateAnswerServiceSrv(nIndex, pData);
 	pData += CreateAnswerServiceTxt(nIndex, pData);
 	pData += CreateAnswerServiceDnsSd(nIndex, pData);
 	pData += CreateAnswerServicePtr(nIndex, pData);
 
-	memcpy(pData, &m_tAnswerLocalIp.aBuffer[sizeof (struct TmDNSHeader)], m_tAnswerLocalIp.nSize - sizeof (struct TmDNSHeader));
-	pData += (m_tAnswerLocalIp.nSize - sizeof (struct TmDNSHeader));
-
-	m_aServiceRecordsData[nIndex].nSize = pData - (uint8_t *)pHeader;
+	m_aServiceRecordsData[nIndex].nSize = pData - (uint8_t *)&m_aServiceRecordsData[nIndex].aBuffer;
 
 	debug_dump((void *)&m_aServiceRecordsData[nIndex].aBuffer, m_aServiceRecordsData[nIndex].nSize);
 
 	DEBUG1_EXIT
 }
 
+/*
+ * The answers are precomputed, a message is the header followed by the
+ * answers of the services in nMask. The A record is the answer when only
+ * the host is asked for, otherwise it is added as additional record.
+ */
+void MDNS::SendMessage(uint32_t nMask, uint32_t nIp) {
+	DEBUG1_ENTRY
+
+	struct TmDNSHeader *pHeader = (struct TmDNSHeader*) m_pOutBuffer;
+	uint8_t *pData = m_pOutBuffer + sizeof(struct TmDNSHeader);
+	uint32_t nAnswers = 0;
+	uint32_t nRemaining = 0;
+
+	for (uint32_t i = 0; i < SERVICE_RECORDS_MAX; i++) {
+		if (((nMask & (1U << i)) == 0) || (m_aServiceRecords[i].pName == 0)) {
+			continue;
+		}
+
+		if (((pData - m_pOutBuffer) + m_aServiceRecordsData[i].nSize + m_tAnswerLocalIp.nSize) > BUFFER_SIZE) {
+			nRemaining |= (1U << i);
+			continue;
+		}
+
+		memcpy(pData, m_aServiceRecordsData[i].aBuffer, m_aServiceRecordsData[i].nSize);
+		pData += m_aServiceRecordsData[i].nSize;
+		nAnswers += SERVICE_ANSWERS;
+	}
+
+	memcpy(pData, m_tAnswerLocalIp.aBuffer, m_tAnswerLocalIp.nSize);
+	pData += m_tAnswerLocalIp.nSize;
+
+	pHeader->xid = 0;
+	pHeader->nFlags = __builtin_bswap16(0x8400);
+	pHeader->queryCount = 0;
+	pHeader->authorityCount = 0;
+
+	if (nAnswers == 0) {
+		pHeader->answerCount = __builtin_bswap16(1);
+		pHeader->additionalCount = 0;
+	} else {
+		pHeader->answerCount = __builtin_bswap16(nAnswers);
+		pHeader->additionalCount = __builtin_bswap16(1);
+	}
+
+	const uint32_t nSize = pData - m_pOutBuffer;
+
+	debug_dump((void *)m_pOutBuffer, nSize);
+
+	Network::Get()->SendTo(m_nHandle, m_pOutBuffer, nSize, nIp, MDNS_PORT);
+
+	if (nRemaining != 0) {
+		SendMessage(nRemaining, nIp);
+	}
+
+	DEBUG1_EXIT
+}
+
 uint32_t MDNS::DecodeDNSNameNotation(const char *pDNSNameNotation, char *pString) {
 	DEBUG_ENTRY
 
@@ -285,7 +367,7 @@ bool MDNS::AddServiceRecord(const char *pName, const char *pServName, uint16_t n
 
 	CreateMDNSMessage(i);
 
-	Network::Get()->SendTo(m_nHandle, (uint8_t *)&m_aServiceRecordsData[i].aBuffer, m_aServiceRecordsData[i].nSize, m_nMulticastIp, MDNS_PORT);
+	SendMessage(1U << i, m_nMulticastIp);
 
 	DEBUG1_EXIT
 	return true;
@@ -331,15 +413,7 @@ uint32_t MDNS::WriteDnsName(const char *pSource, char *pDestination, bool bNullT
 void MDNS::CreateAnswerLocalIpAddress(void) {
 	DEBUG1_ENTRY
 
-	struct TmDNSHeader *pHeader = (struct TmDNSHeader*) &m_tAnswerLocalIp.aBuffer;
-
-	pHeader->nFlags = __builtin_bswap16(0x8400);
-	pHeader->queryCount = 0;
-	pHeader->answerCount = __builtin_bswap16(1);
-	pHeader->authorityCount = 0;
-	pHeader->additionalCount = 0;
-
-	const uint8_t *pData = (uint8_t*) &m_tAnswerLocalIp.aBuffer + sizeof(struct TmDNSHeader);
+	const uint8_t *pData = (uint8_t*) &m_tAnswerLocalIp.aBuffer;
 
 	pData += WriteDnsName((const char*) m_pName, (char*) pData);
 
@@ -351,10 +425,10 @@ void MDNS::CreateAnswerLocalIpAddress(void) {
 	pData += 4;
 	*(uint16_t *) pData = __builtin_bswap16(4);		// Data length
 	pData += 2;
-	*(uint32_t *) pData = Network::Get()->GetIp();
+	*(uint32_t *) pData = m_nIp;
 	pData += 4;
 
-	m_tAnswerLocalIp.nSize = pData - (uint8_t *)pHeader;
+	m_tAnswerLocalIp.nSize = pData - (uint8_t *)&m_tAnswerLocalIp.aBuffer;
 
 	DEBUG1_EXIT
 }
@@ -462,12 +536,83 @@ uint32_t MDNS::CreateAnswerServiceDnsSd(uint32_t nIndex, uint8_t *pDestination)
 	return (pDst - pDestination);
 }
 
-void MDNS::HandleRequest(uint16_t nQuestions) {
+bool MDNS::IsInstanceName(uint32_t nIndex, const char *pDnsName) {
+	const char *pName = (const char *)m_aServiceRecords[nIndex].pName;
+	const uint32_t nLength = strlen(pName);
+
+	return (strncmp(pName, pDnsName, nLength) == 0) && (strcmp(&pDnsName[nLength], "._udp" MDNS_TLD) == 0);
+}
+
+/*
+ * Known-answer suppression (RFC 6762, 7.1): a record in the answer section of
+ * the query with at least half of our TTL left is not sent again.
+ */
+uint32_t MDNS::HandleKnownAnswers(uint32_t nOffset, uint16_t nAnswers) {
+	DEBUG_ENTRY
+
+	char DnsName[255];
+	char DnsData[255];
+	uint32_t nKnown = 0;
+
+	for (uint32_t i = 0; i < nAnswers; i++) {
+		if (nOffset >= m_nBytesReceived) {
+			break;
+		}
+
+		nOffset += DecodeDNSNameNotation((const char *)&m_pBuffer[nOffset], DnsName);
+
+		if ((nOffset + 10) > m_nBytesReceived) {
+			break;
+		}
+
+		const uint16_t nType = __builtin_bswap16(*(uint16_t *)&m_pBuffer[nOffset]);
+		const uint16_t nClass = __builtin_bswap16(*(uint16_t *)&m_pBuffer[nOffset + 2]) & ~DNSCacheFlushTrue;
+		uint32_t nTTL;
+		memcpy(&nTTL, &m_pBuffer[nOffset + 4], sizeof(uint32_t));
+		nTTL = __builtin_bswap32(nTTL);
+		const uint16_t nDataLength = __builtin_bswap16(*(uint16_t *)&m_pBuffer[nOffset + 8]);
+		nOffset += 10;
+
+		DEBUG_PRINTF("%s ==> Type : %d, Class: %d, TTL: %d", DnsName, (int) nType, (int) nClass, (int) nTTL);
+
+		if ((nClass == DNSClassInternet) && (nTTL >= (MDNS_RESPONSE_TTL / 2)) && ((nOffset + nDataLength) <= m_nBytesReceived)) {
+			if ((nType == DNSRecordTypeA) && (nDataLength == 4)) {
+				if ((strcmp((const char *)m_pName, DnsName) == 0) && (memcmp(&m_pBuffer[nOffset], &m_nIp, 4) == 0)) {
+					nKnown |= MASK_HOST;
+				}
+			} else if (nType == DNSRecordTypePTR) {
+				DecodeDNSNameNotation((const char *)&m_pBuffer[nOffset], DnsData);
+
+				for (uint32_t j = 0; j < SERVICE_RECORDS_MAX; j++) {
+					if ((m_aServiceRecords[j].pName != 0) && (strcmp((const char *)m_aServiceRecords[j].pServName, DnsName) == 0) && IsInstanceName(j, DnsData)) {
+						nKnown |= (1U << j);
+					}
+				}
+			}
+		}
+
+		nOffset += nDataLength;
+	}
+
+	DEBUG_PRINTF("nKnown=%x", nKnown);
+	DEBUG_EXIT
+	return nKnown;
+}
+
+/*
+ * Questions with the unicast-response bit set are answered at once to the
+ * sender. The A record is unique and answered at once as well. The shared PTR
+ * answers are delayed 20-120ms (RFC 6762, 6) and aggregated with the answers
+ * for the other queries received in the meantime.
+ */
+void MDNS::HandleRequest(uint16_t nQuestions, uint16_t nAnswers) {
 	DEBUG_ENTRY
 
 	char DnsName[255];
 
 	uint32_t nOffset = sizeof(struct TmDNSHeader);
+	uint32_t nMulticastMask = 0;
+	uint32_t nUnicastMask = 0;
 
 	for (uint32_t i = 0; i < nQuestions; i++) {
 		nOffset += DecodeDNSNameNotation((const char *)&m_pBuffer[nOffset], DnsName);
@@ -475,14 +620,17 @@ void MDNS::HandleRequest(uint16_t nQuestions) {
 		const uint16_t nType = __builtin_bswap16(*(uint16_t *)&m_pBuffer[nOffset]);
 		nOffset += 2;
 
-		const uint16_t nClass = __builtin_bswap16(*(uint16_t *)&m_pBuffer[nOffset]) & 0x7F;
+		const uint16_t nClassUnicast = __builtin_bswap16(*(uint16_t *)&m_pBuffer[nOffset]);
+		const uint16_t nClass = nClassUnicast & ~DNSUnicastResponseTrue;
 		nOffset += 2;
 
 		DEBUG_PRINTF("%s ==> Type : %d, Class: %d", DnsName, (int) nType, (int) nClass);
 
 		if (nClass == DNSClassInternet) {
+			uint32_t nMask = 0;
+
 			if ((strcmp((const char *)m_pName, DnsName) == 0) && (nType == DNSRecordTypeA)) {
-				Network::Get()->SendTo(m_nHandle, m_tAnswerLocalIp.aBuffer, m_tAnswerLocalIp.nSize, m_nMulticastIp, MDNS_PORT);
+				nMask |= MASK_HOST;
 			}
 
 			const bool isDnsDs = (strcmp(DNS_SD_SERVICE, DnsName) == 0);
@@ -490,12 +638,44 @@ void MDNS::HandleRequest(uint16_t nQuestions) {
 			for (uint32_t i = 0; i < SERVICE_RECORDS_MAX; i++) {
 				if (m_aServiceRecords[i].pName != 0) {
 					if ((isDnsDs || (strcmp((const char *)m_aServiceRecords[i].pServName, DnsName) == 0)) && (nType == DNSRecordTypePTR) ) {
-						Network::Get()->SendTo(m_nHandle, (uint8_t *)&m_aServiceRecordsData[i].aBuffer, m_aServiceRecordsData[i].nSize, m_nMulticastIp, MDNS_PORT);
+						nMask |= (1U << i);
 					}
 				}
 			}
+
+			if ((nClassUnicast & DNSUnicastResponseTrue) == DNSUnicastResponseTrue) {
+				nUnicastMask |= nMask;
+			} else {
+				nMulticastMask |= nMask;
+			}
+		}
+
+		if (nOffset >= m_nBytesReceived) {
+			break;
 		}
+	}
 
+	if ((nAnswers != 0) && ((nMulticastMask | nUnicastMask) != 0)) {
+		const uint32_t nKnown = HandleKnownAnswers(nOffset, nAnswers);
+
+		nMulticastMask &= ~nKnown;
+		nUnicastMask &= ~nKnown;
+	}
+
+	if (nUnicastMask != 0) {
+		SendMessage(nUnicastMask, m_nRemoteIp);
+	}
+
+	if (nMulticastMask == MASK_HOST) {
+		SendMessage(MASK_HOST, m_nMulticastIp);
+	} else if (nMulticastMask != 0) {
+		if (m_nPendingMask == 0) {
+			m_nRandom = (m_nRandom * 1103515245) + 12345;
+			m_nPendingMillis = Hardware::Get()->Millis();
+			m_nPendingDelay = RESPONSE_DELAY_MIN + ((m_nRandom >> 16) % RESPONSE_DELAY_RANGE);
+		}
+
+		m_nPendingMask |= nMulticastMask;
 	}
 
 	DEBUG_EXIT
@@ -513,7 +693,7 @@ void MDNS::Parse(void) {
 
 	if ((((nFlags >> 15) & 1) == 0) && (((nFlags >> 14) & 0xf) == DNSOpQuery)) {
 		if (pmDNSHeader->queryCount != 0) {
-			HandleRequest((uint16_t)__builtin_bswap16(pmDNSHeader->queryCount));
+			HandleRequest((uint16_t)__builtin_bswap16(pmDNSHeader->queryCount), (uint16_t)__builtin_bswap16(pmDNSHeader->answerCount));
 		}
 	}
 
@@ -538,6 +718,28 @@ void MDNS::Run(void) {
 
 	}
 
+	if (__builtin_expect((m_nPendingMask != 0), 0)) {
+		if ((Hardware::Get()->Millis() - m_nPendingMillis) >= m_nPendingDelay) {
+			SendMessage(m_nPendingMask, m_nMulticastIp);
+			m_nPendingMask = 0;
+		}
+	}
+
+	if (__builtin_expect((Network::Get()->GetIp() != m_nIp), 0)) {
+		DEBUG_PUTS("> IP address changed <");
+		CreateAnswers();
+
+		uint32_t nMask = MASK_HOST;
+
+		for (uint32_t i = 0; i < SERVICE_RECORDS_MAX; i++) {
+			if (m_aServiceRecords[i].pName != 0) {
+				nMask |= (1U << i);
+			}
+		}
+
+		SendMessage(nMask, m_nMulticastIp);
+	}
+
 #if 0
 	if (__builtin_expect(((nNow - m_nLastAnnounceMillis) > 1000 * ANNOUNCE_TIMEOUT), 0)) {
 		DEBUG_PUTS("> Announce <");
@@ -45,14 +45,44 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #define BOOL2STRING(b)	(b) ? "Yes" : "No"
 
-#if !defined (H3)
 static const char PARAMS_NAME_SERVER[] ALIGNED = "name_server";
-#endif
 
-NetworkParams::NetworkParams(NetworkParamsStore *pNetworkParamsStore): m_pNetworkParamsStore(pNetworkParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TNetworkParams, f)
+
+enum TNetworkParamsKey {
+	KEY_USE_DHCP,
+	KEY_IP_ADDRESS,
+	KEY_NET_MASK,
+	KEY_DEFAULT_GATEWAY,
+	KEY_HOSTNAME,
+	KEY_NAME_SERVER,
+	KEY_NTP_SERVER,
+	KEY_NTP_UTC_OFFSET,
+	KEY_LAST
+};
+
+// Must be in the order of TNetworkParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ NetworkConst::PARAMS_USE_DHCP, OFFSET(bIsDhcpUsed), PROPERTIES_TYPE_BOOL, NETWORK_PARAMS_MASK_DHCP, 0, 0 },
+	{ NetworkConst::PARAMS_IP_ADDRESS, OFFSET(nLocalIp), PROPERTIES_TYPE_IP_ADDRESS, NETWORK_PARAMS_MASK_IP_ADDRESS, 0, 0 },
+	{ NetworkConst::PARAMS_NET_MASK, OFFSET(nNetmask), PROPERTIES_TYPE_IP_ADDRESS, NETWORK_PARAMS_MASK_NET_MASK, 0, 0 },
+	{ NetworkConst::PARAMS_DEFAULT_GATEWAY, OFFSET(nGatewayIp), PROPERTIES_TYPE_IP_ADDRESS, NETWORK_PARAMS_MASK_DEFAULT_GATEWAY, 0, 0 },
+	{ NetworkConst::PARAMS_HOSTNAME, OFFSET(aHostName), PROPERTIES_TYPE_CHAR, NETWORK_PARAMS_MASK_HOSTNAME, 0, NETWORK_HOSTNAME_SIZE },
+	{ PARAMS_NAME_SERVER, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ NetworkConst::PARAMS_NTP_SERVER, OFFSET(nNtpServerIp), PROPERTIES_TYPE_IP_ADDRESS, NETWORK_PARAMS_MASK_NTP_SERVER, 0, 0 },
+	{ NetworkConst::PARAMS_NTP_UTC_OFFSET, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TNetworkParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable NetworkParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B3 };
+
+NetworkParams::NetworkParams(NetworkParamsStore *pNetworkParamsStore): m_pNetworkParamsStore(pNetworkParamsStore), m_pPropertiesParser(0) {
 	uint8_t *p = (uint8_t *) &m_tNetworkParams;
 
 	for (uint32_t i = 0; i < sizeof(struct TNetworkParams); i++) {
@@ -69,9 +99,16 @@ NetworkParams::~NetworkParams(void) {
 bool NetworkParams::Load(void) {
 	m_tNetworkParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tNetworkParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(NetworkParams::staticCallbackFunction, this);
 
-	if (configfile.Read(NetworkConst::PARAMS_FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(NetworkConst::PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pNetworkParamsStore != 0) {
 			m_pNetworkParamsStore->Update(&m_tNetworkParams);
@@ -96,73 +133,47 @@ void NetworkParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tNetworkParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tNetworkParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(NetworkParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pNetworkParamsStore->Update(&m_tNetworkParams);
 }
 
 void NetworkParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
-	uint8_t value8;
 	uint32_t value32;
-	uint8_t len;
 	float f;
 
-	if (Sscan::Uint8(pLine, NetworkConst::PARAMS_USE_DHCP, &value8) == SSCAN_OK) {
-		m_tNetworkParams.bIsDhcpUsed = !(value8 == 0);
-		m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_DHCP;
-		return;
-	}
-
-	if (Sscan::IpAddress(pLine, NetworkConst::PARAMS_IP_ADDRESS, &value32) == SSCAN_OK) {
-		m_tNetworkParams.nLocalIp = value32;
-		m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_IP_ADDRESS;
-		return;
-	}
-
-	if (Sscan::IpAddress(pLine, NetworkConst::PARAMS_NET_MASK, &value32) == SSCAN_OK) {
-		m_tNetworkParams.nNetmask = value32;
-		m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_NET_MASK;
-		return;
-	}
-
-	if (Sscan::IpAddress(pLine, NetworkConst::PARAMS_DEFAULT_GATEWAY, &value32) == SSCAN_OK) {
-		m_tNetworkParams.nGatewayIp = value32;
-		m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_DEFAULT_GATEWAY;
-		return;
-	}
-
-	len = NETWORK_HOSTNAME_SIZE - 1;
-	if (Sscan::Char(pLine, NetworkConst::PARAMS_HOSTNAME, (char *) m_tNetworkParams.aHostName, &len) == SSCAN_OK) {
-		m_tNetworkParams.aHostName[len] = '\0';
-		m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_HOSTNAME;
-		return;
-	}
-
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_NAME_SERVER:
 #if !defined (H3)
-	if (Sscan::IpAddress(pLine, PARAMS_NAME_SERVER, &value32) == SSCAN_OK) {
-		m_tNetworkParams.nNameServerIp = value32;
-		m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_NAME_SERVER;
-		return;
-	}
+		if (Sscan::IpAddress(pLine, PARAMS_NAME_SERVER, &value32) == SSCAN_OK) {
+			m_tNetworkParams.nNameServerIp = value32;
+			m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_NAME_SERVER;
+		}
+#else
+		(void) value32;
 #endif
-
-	if (Sscan::IpAddress(pLine, NetworkConst::PARAMS_NTP_SERVER, &value32) == SSCAN_OK) {
-		m_tNetworkParams.nNtpServerIp = value32;
-		m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_NTP_SERVER;
-		return;
-	}
-
-	if (Sscan::Float(pLine, NetworkConst::PARAMS_NTP_UTC_OFFSET, &f) == SSCAN_OK) {
-		// https://en.wikipedia.org/wiki/List_of_UTC_time_offsets
-		if (((int32_t) f >= -12) && ((int32_t) f <= 14)) {
-			m_tNetworkParams.fNtpUtcOffset = f;
-			m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_NTP_UTC_OFFSET;
-			return;
+		break;
+	case KEY_NTP_UTC_OFFSET:
+		if (Sscan::Float(pLine, NetworkConst::PARAMS_NTP_UTC_OFFSET, &f) == SSCAN_OK) {
+			// https://en.wikipedia.org/wiki/List_of_UTC_time_offsets
+			if (((int32_t) f >= -12) && ((int32_t) f <= 14)) {
+				m_tNetworkParams.fNtpUtcOffset = f;
+				m_tNetworkParams.nSetList |= NETWORK_PARAMS_MASK_NTP_UTC_OFFSET;
+			}
 		}
+		break;
+	default:
+		break;
 	}
 }
 
@@ -30,6 +30,9 @@
 
 #include "oscclient.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 #define OSCCLIENT_PARAMS_CMD_MAX_COUNT				8
 #define OSCCLIENT_PARAMS_CMD_MAX_PATH_LENGTH		64
 #define OSCCLIENT_PARAMS_LED_MAX_COUNT				8
@@ -93,6 +96,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -101,8 +105,7 @@ private:
 private:
 	OscClientParamsStore *m_pOscClientParamsStore;
     struct TOscClientParams m_tOscClientParams;
-    char m_aCmd[8];
-    char m_aLed[8];
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* OSCCLIENTPARAMS_H_ */
@@ -36,8 +36,8 @@ public:
 	alignas(uint32_t) static const char PARAMS_INCOMING_PORT[];
 	alignas(uint32_t) static const char PARAMS_PING_DISABLE[];
 	alignas(uint32_t) static const char PARAMS_PING_DELAY[];
-	alignas(uint32_t) static const char PARAMS_CMD[];
-	alignas(uint32_t) static const char PARAMS_LED[];
+	alignas(uint32_t) static const char PARAMS_CMD[8][5];
+	alignas(uint32_t) static const char PARAMS_LED[8][5];
 };
 
 #endif /* OSCCLIENTPARAMSCONST_H_ */
@@ -37,9 +37,42 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
-OscClientParams::OscClientParams(OscClientParamsStore* pOscClientParamsStore): m_pOscClientParamsStore(pOscClientParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TOscClientParams, f)
+
+enum TOscClientParamsKey {
+	KEY_SERVER_IP,
+	KEY_OUTGOING_PORT,
+	KEY_INCOMING_PORT,
+	KEY_PING_DISABLE,
+	KEY_PING_DELAY,
+	KEY_CMD0,
+	KEY_LED0 = KEY_CMD0 + OSCCLIENT_PARAMS_CMD_MAX_COUNT,
+	KEY_LAST = KEY_LED0 + OSCCLIENT_PARAMS_LED_MAX_COUNT
+};
+
+#define CMD(i)	{ OscClientParamsConst::PARAMS_CMD[i], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+#define LED(i)	{ OscClientParamsConst::PARAMS_LED[i], 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+
+// Must be in the order of TOscClientParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ OscClientParamsConst::PARAMS_SERVER_IP, OFFSET(nServerIp), PROPERTIES_TYPE_IP_ADDRESS, OSCCLIENT_PARAMS_MASK_SERVER_IP, 0, 0 },
+	{ OscClientParamsConst::PARAMS_OUTGOING_PORT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ OscClientParamsConst::PARAMS_INCOMING_PORT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ OscClientParamsConst::PARAMS_PING_DISABLE, OFFSET(nPingDisable), PROPERTIES_TYPE_BOOL, OSCCLIENT_PARAMS_MASK_PING_DISABLE, 0, 0 },
+	{ OscClientParamsConst::PARAMS_PING_DELAY, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	CMD(0), CMD(1), CMD(2), CMD(3), CMD(4), CMD(5), CMD(6), CMD(7),
+	LED(0), LED(1), LED(2), LED(3), LED(4), LED(5), LED(6), LED(7)
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TOscClientParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable OscClientParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 7, 0x9E3779B3 };
+
+OscClientParams::OscClientParams(OscClientParamsStore* pOscClientParamsStore): m_pOscClientParamsStore(pOscClientParamsStore), m_pPropertiesParser(0) {
 	uint8_t *p = (uint8_t *) &m_tOscClientParams;
 
 	for (uint32_t i = 0; i < sizeof(struct TOscClientParams); i++) {
@@ -49,14 +82,6 @@ OscClientParams::OscClientParams(OscClientParamsStore* pOscClientParamsStore): m
 	m_tOscClientParams.nOutgoingPort = OSCCLIENT_DEFAULT_PORT_OUTGOING;
 	m_tOscClientParams.nIncomingPort = OSCCLIENT_DEFAULT_PORT_INCOMING;
 	m_tOscClientParams.nPingDelay = OSCCLIENT_DEFAULT_PING_DELAY_SECONDS;
-
-	assert(sizeof(m_aCmd) > strlen(OscClientParamsConst::PARAMS_CMD));
-	const char *src = (char *)OscClientParamsConst::PARAMS_CMD;
-	strncpy(m_aCmd, src, sizeof(m_aCmd));
-
-	assert(sizeof(m_aLed) > strlen(OscClientParamsConst::PARAMS_LED));
-	src = (char *)OscClientParamsConst::PARAMS_LED;
-	strncpy(m_aLed, src, sizeof(m_aLed));
 }
 
 OscClientParams::~OscClientParams(void) {
@@ -66,9 +91,16 @@ OscClientParams::~OscClientParams(void) {
 bool OscClientParams::Load(void) {
 	m_tOscClientParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tOscClientParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(OscClientParams::staticCallbackFunction, this);
 
-	if (configfile.Read(OscClientParamsConst::PARAMS_FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(OscClientParamsConst::PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pOscClientParamsStore != 0) {
 			m_pOscClientParamsStore->Update(&m_tOscClientParams);
@@ -93,78 +125,80 @@ void OscClientParams::Load(const char* pBuffer, uint32_t nLength) {
 
 	m_tOscClientParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tOscClientParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(OscClientParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pOscClientParamsStore->Update(&m_tOscClientParams);
 }
 
 void OscClientParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t value8;
 	uint16_t value16;
-	uint32_t value32;
 
-	if (Sscan::IpAddress(pLine, OscClientParamsConst::PARAMS_SERVER_IP, &value32) == SSCAN_OK) {
-		m_tOscClientParams.nServerIp = value32;
-		m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_SERVER_IP;
-		return;
-	}
+	const int32_t nKey = m_pPropertiesParser->Parse(pLine);
 
-	if (Sscan::Uint16(pLine, OscClientParamsConst::PARAMS_OUTGOING_PORT, &value16) == SSCAN_OK) {
-		if (value16 > 1023) {
-			m_tOscClientParams.nOutgoingPort = value16;
-			m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_OUTGOING_PORT;
-		} else {
-			m_tOscClientParams.nSetList &= ~OSCCLIENT_PARAMS_MASK_OUTGOING_PORT;
+	switch (nKey) {
+	case KEY_OUTGOING_PORT:
+		if (Sscan::Uint16(pLine, OscClientParamsConst::PARAMS_OUTGOING_PORT, &value16) == SSCAN_OK) {
+			if (value16 > 1023) {
+				m_tOscClientParams.nOutgoingPort = value16;
+				m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_OUTGOING_PORT;
+			} else {
+				m_tOscClientParams.nSetList &= ~OSCCLIENT_PARAMS_MASK_OUTGOING_PORT;
+			}
 		}
 		return;
-	}
-
-	if (Sscan::Uint16(pLine, OscClientParamsConst::PARAMS_INCOMING_PORT, &value16) == SSCAN_OK) {
-		if (value16 > 1023) {
-			m_tOscClientParams.nIncomingPort = value16;
-			m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_INCOMING_PORT;
-		} else {
-			m_tOscClientParams.nSetList &= ~OSCCLIENT_PARAMS_MASK_INCOMING_PORT;
+	case KEY_INCOMING_PORT:
+		if (Sscan::Uint16(pLine, OscClientParamsConst::PARAMS_INCOMING_PORT, &value16) == SSCAN_OK) {
+			if (value16 > 1023) {
+				m_tOscClientParams.nIncomingPort = value16;
+				m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_INCOMING_PORT;
+			} else {
+				m_tOscClientParams.nSetList &= ~OSCCLIENT_PARAMS_MASK_INCOMING_PORT;
+			}
 		}
 		return;
-	}
-
-	if (Sscan::Uint8(pLine, OscClientParamsConst::PARAMS_PING_DISABLE, &value8) == SSCAN_OK) {
-		m_tOscClientParams.nPingDisable = (value8 != 0);
-		m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_PING_DISABLE;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, OscClientParamsConst::PARAMS_PING_DELAY, &value8) == SSCAN_OK) {
-		if ((value8 >= 2) && (value8 <= 60)) {
-			m_tOscClientParams.nPingDelay = value8;
-			m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_PING_DELAY;
-		} else {
-			m_tOscClientParams.nSetList &= ~OSCCLIENT_PARAMS_MASK_PING_DELAY;
+	case KEY_PING_DELAY:
+		if (Sscan::Uint8(pLine, OscClientParamsConst::PARAMS_PING_DELAY, &value8) == SSCAN_OK) {
+			if ((value8 >= 2) && (value8 <= 60)) {
+				m_tOscClientParams.nPingDelay = value8;
+				m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_PING_DELAY;
+			} else {
+				m_tOscClientParams.nSetList &= ~OSCCLIENT_PARAMS_MASK_PING_DELAY;
+			}
 		}
 		return;
+	default:
+		break;
 	}
 
-	for (uint32_t i = 0; i < OSCCLIENT_PARAMS_CMD_MAX_COUNT; i++) {
-		m_aCmd[strlen(OscClientParamsConst::PARAMS_CMD) - 1] = i + '0';
+	if ((nKey >= KEY_CMD0) && (nKey < KEY_LED0)) {
+		const uint32_t i = (uint32_t) (nKey - KEY_CMD0);
+
 		value8 = OSCCLIENT_PARAMS_CMD_MAX_PATH_LENGTH;
-		if (Sscan::Char(pLine, (const char *)m_aCmd, (char *)&m_tOscClientParams.aCmd[i], &value8) == SSCAN_OK) {
+
+		if (Sscan::Char(pLine, OscClientParamsConst::PARAMS_CMD[i], (char *) &m_tOscClientParams.aCmd[i], &value8) == SSCAN_OK) {
 			if (m_tOscClientParams.aCmd[i][0] == '/') {
 				m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_CMD;
 			} else {
 				m_tOscClientParams.aCmd[i][0] = '\0';
 			}
 		}
-	}
+	} else if ((nKey >= KEY_LED0) && (nKey < KEY_LAST)) {
+		const uint32_t i = (uint32_t) (nKey - KEY_LED0);
 
-	for (uint32_t i = 0; i < OSCCLIENT_PARAMS_LED_MAX_COUNT; i++) {
-		m_aLed[strlen(OscClientParamsConst::PARAMS_LED) - 1] = i + '0';
 		value8 = OSCCLIENT_PARAMS_LED_MAX_PATH_LENGTH;
-		if (Sscan::Char(pLine, (const char *)m_aLed, (char *)&m_tOscClientParams.aLed[i], &value8) == SSCAN_OK) {
+
+		if (Sscan::Char(pLine, OscClientParamsConst::PARAMS_LED[i], (char *) &m_tOscClientParams.aLed[i], &value8) == SSCAN_OK) {
 			if (m_tOscClientParams.aLed[i][0] == '/') {
 				m_tOscClientParams.nSetList |= OSCCLIENT_PARAMS_MASK_LED;
 			} else {
@@ -236,15 +270,13 @@ void OscClientParams::Dump(void) {
 
 	if (isMaskSet(OSCCLIENT_PARAMS_MASK_CMD)) {
 		for (uint32_t i = 0; i < OSCCLIENT_PARAMS_CMD_MAX_COUNT; i++) {
-			m_aCmd[strlen(OscClientParamsConst::PARAMS_CMD) - 1] = i + '0';
-			printf(" %s=[%s]\n", m_aCmd, (const char *) &m_tOscClientParams.aCmd[i]);
+			printf(" %s=[%s]\n", OscClientParamsConst::PARAMS_CMD[i], (const char *) &m_tOscClientParams.aCmd[i]);
 		}
 	}
 
 	if (isMaskSet(OSCCLIENT_PARAMS_MASK_LED)) {
 		for (uint32_t i = 0; i < OSCCLIENT_PARAMS_LED_MAX_COUNT; i++) {
-			m_aLed[strlen(OscClientParamsConst::PARAMS_LED) - 1] = i + '0';
-			printf(" %s=[%s]\n", m_aLed, (const char *) &m_tOscClientParams.aLed[i]);
+			printf(" %s=[%s]\n", OscClientParamsConst::PARAMS_LED[i], (const char *) &m_tOscClientParams.aLed[i]);
 		}
 	}
 #endif
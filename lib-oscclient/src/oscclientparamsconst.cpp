@@ -33,5 +33,5 @@ alignas(uint32_t) const char OscClientParamsConst::PARAMS_OUTGOING_PORT[] = "out
 alignas(uint32_t) const char OscClientParamsConst::PARAMS_INCOMING_PORT[] = "incoming_port";
 alignas(uint32_t) const char OscClientParamsConst::PARAMS_PING_DISABLE[] = "ping_disable";
 alignas(uint32_t) const char OscClientParamsConst::PARAMS_PING_DELAY[] = "ping_delay";
-alignas(uint32_t) const char OscClientParamsConst::PARAMS_CMD[] = "cmd?";
-alignas(uint32_t) const char OscClientParamsConst::PARAMS_LED[] = "led?";
+alignas(uint32_t) const char OscClientParamsConst::PARAMS_CMD[8][5] = { "cmd0", "cmd1", "cmd2", "cmd3", "cmd4", "cmd5", "cmd6", "cmd7" };
+alignas(uint32_t) const char OscClientParamsConst::PARAMS_LED[8][5] = { "led0", "led1", "led2", "led3", "led4", "led5", "led6", "led7" };
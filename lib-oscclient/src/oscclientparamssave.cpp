@@ -55,15 +55,13 @@ void OscClientParams::Builder(const struct TOscClientParams* ptOscClientParams,
 	builder.Add(OscClientParamsConst::PARAMS_PING_DELAY, m_tOscClientParams.nPingDelay, isMaskSet(OSCCLIENT_PARAMS_MASK_PING_DELAY));
 
 	for (uint32_t i = 0; i < OSCCLIENT_PARAMS_CMD_MAX_COUNT; i++) {
-		m_aCmd[strlen(OscClientParamsConst::PARAMS_CMD) - 1] = i + '0';
 		const char *cmd = (const char *) &m_tOscClientParams.aCmd[i];
-		builder.Add(m_aCmd, cmd, *cmd == '/');
+		builder.Add(OscClientParamsConst::PARAMS_CMD[i], cmd, *cmd == '/');
 	}
 
 	for (uint32_t i = 0; i < OSCCLIENT_PARAMS_LED_MAX_COUNT; i++) {
-		m_aLed[strlen(OscClientParamsConst::PARAMS_LED) - 1] = i + '0';
 		const char *led = (const char *) &m_tOscClientParams.aLed[i];
-		builder.Add(m_aLed, led, *led == '/');
+		builder.Add(OscClientParamsConst::PARAMS_LED[i], led, *led == '/');
 	}
 
 	nSize = builder.GetSize();
@@ -32,6 +32,9 @@
 
 #include "lightset.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TOSCServerParams {
     uint32_t nSetList;
 	uint16_t nIncomingPort;
@@ -100,6 +103,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -108,6 +112,7 @@ private:
 private:
 	OSCServerParamsStore *m_pOSCServerParamsStore;
     struct TOSCServerParams m_tOSCServerParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* OSCSERVERPARAMS_H_ */
@@ -37,10 +37,25 @@
 #include "lightsetconst.h"
 
 #include "readconfigfile.h"
-#include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
-OSCServerParams::OSCServerParams(OSCServerParamsStore *pOSCServerParamsStore): m_pOSCServerParamsStore(pOSCServerParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TOSCServerParams, f)
+
+static const struct TPropertiesKey s_Keys[] = {
+	{ OSCServerConst::PARAMS_INCOMING_PORT, OFFSET(nIncomingPort), PROPERTIES_TYPE_UINT16, OSCSERVER_PARAMS_MASK_INCOMING_PORT, 1024, 0xFFFF },
+	{ OSCServerConst::PARAMS_OUTGOING_PORT, OFFSET(nOutgoingPort), PROPERTIES_TYPE_UINT16, OSCSERVER_PARAMS_MASK_OUTGOING_PORT, 1024, 0xFFFF },
+	{ OSCServerConst::PARAMS_TRANSMISSION, OFFSET(bPartialTransmission), PROPERTIES_TYPE_BOOL, OSCSERVER_PARAMS_MASK_TRANSMISSION, 0, 0 },
+	{ OSCServerConst::PARAMS_PATH, OFFSET(aPath), PROPERTIES_TYPE_CHAR, OSCSERVER_PARAMS_MASK_PATH, 0, OSCSERVER_PATH_LENGTH_MAX },
+	{ OSCServerConst::PARAMS_PATH_INFO, OFFSET(aPathInfo), PROPERTIES_TYPE_CHAR, OSCSERVER_PARAMS_MASK_PATH_INFO, 0, OSCSERVER_PATH_LENGTH_MAX },
+	{ OSCServerConst::PARAMS_PATH_BLACKOUT, OFFSET(aPathBlackOut), PROPERTIES_TYPE_CHAR, OSCSERVER_PARAMS_MASK_PATH_BLACKOUT, 0, OSCSERVER_PATH_LENGTH_MAX },
+	{ LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE, OFFSET(bEnableNoChangeUpdate), PROPERTIES_TYPE_BOOL, OSCSERVER_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT, 0, 0 }
+};
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable OSCServerParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B1 };
+
+OSCServerParams::OSCServerParams(OSCServerParamsStore *pOSCServerParamsStore): m_pOSCServerParamsStore(pOSCServerParamsStore), m_pPropertiesParser(0) {
 	uint8_t *p = (uint8_t *) &m_tOSCServerParams;
 
 	for (uint32_t i = 0; i < sizeof(struct TOSCServerParams); i++) {
@@ -58,9 +73,16 @@ OSCServerParams::~OSCServerParams(void) {
 bool OSCServerParams::Load(void) {
 	m_tOSCServerParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tOSCServerParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(OSCServerParams::staticCallbackFunction, this);
 
-	if (configfile.Read(OSCServerConst::PARAMS_FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(OSCServerConst::PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pOSCServerParamsStore != 0) {
 			m_pOSCServerParamsStore->Update(&m_tOSCServerParams);
@@ -85,65 +107,23 @@ void OSCServerParams::Load(const char* pBuffer, uint32_t nLength) {
 
 	m_tOSCServerParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tOSCServerParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(OSCServerParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pOSCServerParamsStore->Update(&m_tOSCServerParams);
 }
 
 void OSCServerParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
-	uint8_t value8;
-	uint16_t value16;
-	uint8_t len;
-
-	if (Sscan::Uint16(pLine, OSCServerConst::PARAMS_INCOMING_PORT, &value16) == SSCAN_OK) {
-		if (value16 > 1023) {
-			m_tOSCServerParams.nIncomingPort = value16;
-			m_tOSCServerParams.nSetList |= OSCSERVER_PARAMS_MASK_INCOMING_PORT;
-		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, OSCServerConst::PARAMS_OUTGOING_PORT, &value16) == SSCAN_OK) {
-		if (value16 > 1023) {
-			m_tOSCServerParams.nOutgoingPort = value16;
-			m_tOSCServerParams.nSetList |= OSCSERVER_PARAMS_MASK_OUTGOING_PORT;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, OSCServerConst::PARAMS_TRANSMISSION, &value8) == SSCAN_OK) {
-		m_tOSCServerParams.bPartialTransmission = (value8 != 0);
-		m_tOSCServerParams.nSetList |= OSCSERVER_PARAMS_MASK_TRANSMISSION;
-		return;
-	}
-
-	len = sizeof(m_tOSCServerParams.aPath) - 1;
-	if (Sscan::Char(pLine, OSCServerConst::PARAMS_PATH, m_tOSCServerParams.aPath, &len) == SSCAN_OK) {
-		m_tOSCServerParams.nSetList |= OSCSERVER_PARAMS_MASK_PATH;
-		return;
-	}
-
-	len = sizeof(m_tOSCServerParams.aPathInfo) - 1;
-	if (Sscan::Char(pLine, OSCServerConst::PARAMS_PATH_INFO, m_tOSCServerParams.aPathInfo, &len) == SSCAN_OK) {
-		m_tOSCServerParams.nSetList |= OSCSERVER_PARAMS_MASK_PATH_INFO;
-		return;
-	}
-
-	len = sizeof(m_tOSCServerParams.aPathBlackOut) - 1;
-	if (Sscan::Char(pLine, OSCServerConst::PARAMS_PATH_INFO, m_tOSCServerParams.aPathBlackOut, &len) == SSCAN_OK) {
-		m_tOSCServerParams.nSetList |= OSCSERVER_PARAMS_MASK_PATH_BLACKOUT;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE, &value8) == SSCAN_OK) {
-		m_tOSCServerParams.bEnableNoChangeUpdate = (value8 != 0);
-		m_tOSCServerParams.nSetList |= OSCSERVER_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT;
-		return;
-	}
+	m_pPropertiesParser->Parse(pLine);
 }
 
 void OSCServerParams::Dump(void) {
@@ -80,6 +80,12 @@ public:
 	void Write(uint8_t, uint16_t);
 	void Write(uint16_t);
 
+	/*
+	 * nCount consecutive channels in a single auto-increment I2C write.
+	 * Channel 16 is ALL_LED, then nCount must be 1.
+	 */
+	void WriteBurst(uint8_t nChannel, const uint16_t *pOn, const uint16_t *pOff, uint32_t nCount);
+
 	void SetFullOn(uint8_t, bool);
 	void SetFullOff(uint8_t, bool);
 
@@ -103,6 +109,7 @@ private:
 	uint16_t I2cReadReg16(uint8_t);
 
 	void I2cWriteReg(uint8_t, uint16_t, uint16_t);
+	void I2cWriteRegs(uint8_t, const uint16_t *, const uint16_t *, uint32_t);
 
 private:
 	uint8_t m_nAddress;
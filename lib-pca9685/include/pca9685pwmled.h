@@ -40,6 +40,12 @@ public:
 	void Set(uint8_t nChannel, uint16_t nData);
 	void Set(uint8_t nChannel, uint8_t nData);
 
+	/*
+	 * nCount consecutive channels with 12-bit values in a single I2C write.
+	 * The full on and full off bits are written together with the PWM value.
+	 */
+	void Set(uint8_t nChannel, const uint16_t *pData, uint32_t nCount);
+
 private:
 };
 
@@ -209,6 +209,24 @@ void PCA9685::Write(uint16_t nValue) {
 	Write((uint8_t) 16, nValue);
 }
 
+void PCA9685::WriteBurst(uint8_t nChannel, const uint16_t *pOn, const uint16_t *pOff, uint32_t nCount) {
+	assert(pOn != 0);
+	assert(pOff != 0);
+	assert(nCount != 0);
+
+	uint8_t reg;
+
+	if (nChannel <= 15) {
+		assert((nChannel + nCount) <= PCA9685_PWM_CHANNELS);
+		reg = PCA9685_REG_LED0_ON_L + (nChannel << 2);
+	} else {
+		assert(nCount == 1);
+		reg = PCA9685_REG_ALL_LED_ON_L;
+	}
+
+	I2cWriteRegs(reg, pOn, pOff, nCount);
+}
+
 void PCA9685::Read(uint8_t nChannel, uint16_t *pOn, uint16_t *pOff) {
 	assert(pOn != 0);
 	assert(pOff != 0);
@@ -425,3 +443,23 @@ void PCA9685::I2cWriteReg(uint8_t reg, uint16_t data, uint16_t data2) {
 	FUNC_PREFIX(i2c_write((char *) buffer, 5));
 }
 
+/*
+ * Requires MODE1 Auto-Increment, which is enabled in the constructor
+ */
+void PCA9685::I2cWriteRegs(uint8_t reg, const uint16_t *pOn, const uint16_t *pOff, uint32_t nCount) {
+	uint8_t buffer[1 + (PCA9685_PWM_CHANNELS * 4)];
+	uint8_t *p = &buffer[1];
+
+	buffer[0] = reg;
+
+	for (uint32_t i = 0; i < nCount; i++) {
+		*p++ = (uint8_t) (pOn[i] & 0xFF);
+		*p++ = (uint8_t) (pOn[i] >> 8);
+		*p++ = (uint8_t) (pOff[i] & 0xFF);
+		*p++ = (uint8_t) (pOff[i] >> 8);
+	}
+
+	I2cSetup();
+
+	FUNC_PREFIX(i2c_write((char *) buffer, 1 + (nCount * 4)));
+}
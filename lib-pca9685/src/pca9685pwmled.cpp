@@ -29,6 +29,7 @@
 
 #define MAX_12BIT	(0xFFF)
 #define MAX_8BIT	(0xFF)
+#define FULL_ON_OFF	(0x1000)	///< Bit 4 of LEDn_ON_H / LEDn_OFF_H
 
 PCA9685PWMLed::PCA9685PWMLed(uint8_t nAddress): PCA9685(nAddress) {
 	SetFrequency(PWMLED_DEFAULT_FREQUENCY);
@@ -59,3 +60,25 @@ void PCA9685PWMLed::Set(uint8_t nChannel, uint8_t nData) {
 		Write(nChannel, nValue);
 	}
 }
+
+void PCA9685PWMLed::Set(uint8_t nChannel, const uint16_t *pData, uint32_t nCount) {
+	uint16_t aOn[PCA9685_PWM_CHANNELS];
+	uint16_t aOff[PCA9685_PWM_CHANNELS];
+
+	for (uint32_t i = 0; i < nCount; i++) {
+		const uint16_t nData = pData[i];
+
+		if (nData >= MAX_12BIT) {
+			aOn[i] = FULL_ON_OFF;
+			aOff[i] = 0;
+		} else if (nData == 0) {
+			aOn[i] = 0;
+			aOff[i] = FULL_ON_OFF;
+		} else {
+			aOn[i] = 0;
+			aOff[i] = nData;
+		}
+	}
+
+	WriteBurst(nChannel, aOn, aOff, nCount);
+}
@@ -0,0 +1,205 @@
+/**
+ * @file benchmark.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pca9685dmxled.h"
+#include "pca9685pwmled.h"
+
+#include "bcm2835.h"
+
+#define BOARDS				4
+#define CHANNELS			(BOARDS * PCA9685_PWM_CHANNELS)
+#define ADDRESS_COALESCED	0x40
+#define ADDRESS_PER_CHANNEL	0x60
+
+#define REG_LED0_ON_L		0x06
+
+enum TScene {
+	SCENE_FADE,		///< All channels the same value
+	SCENE_RAINBOW,	///< All channels a different value
+	SCENE_SPARSE,	///< Every 4th channel
+	SCENE_SINGLE,	///< One channel
+	SCENE_LAST
+};
+
+static const char *s_aSceneName[SCENE_LAST] = { "fade", "rainbow", "sparse", "single" };
+
+static void scene(TScene tScene, uint32_t nFrame, uint8_t *pDmxData) {
+	const uint32_t nRamp = nFrame % 510;
+	const uint8_t nValue = (uint8_t) (nRamp < 256 ? nRamp : (510 - nRamp));
+
+	for (uint32_t i = 0; i < CHANNELS; i++) {
+		switch (tScene) {
+		case SCENE_FADE:
+			pDmxData[i] = nValue;
+			break;
+		case SCENE_RAINBOW:
+			pDmxData[i] = (uint8_t) (nValue + (i * 37));
+			break;
+		case SCENE_SPARSE:
+			if ((i & 0x3) == 0) {
+				pDmxData[i] = nValue;
+			}
+			break;
+		case SCENE_SINGLE:
+			if (i == 5) {
+				pDmxData[i] = nValue;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+/*
+ * Effective 12-bit duty cycle. LEDn_OFF_H full off has priority over full on.
+ */
+static uint32_t duty(uint8_t nAddress, uint32_t nChannel) {
+	const uint8_t *pRegisters = i2c_mock_get_registers(nAddress) + REG_LED0_ON_L + (nChannel * 4);
+	const uint32_t nOn = pRegisters[0] | ((pRegisters[1] & 0x0F) << 8);
+	const uint32_t nOff = pRegisters[2] | ((pRegisters[3] & 0x0F) << 8);
+
+	if (pRegisters[3] & 0x10) {
+		return 0;
+	}
+
+	if (pRegisters[1] & 0x10) {
+		return 4096;
+	}
+
+	return (nOff - nOn) & 0xFFF;
+}
+
+/*
+ * The previous PCA9685DmxLed::SetData, one Set per changed channel
+ */
+static void set_per_channel(PCA9685PWMLed **pPWMLed, uint8_t *pPrevious, const uint8_t *pDmxData) {
+	for (uint32_t i = 0; i < CHANNELS; i++) {
+		if (pDmxData[i] != pPrevious[i]) {
+			pPWMLed[i / PCA9685_PWM_CHANNELS]->Set(CHANNEL(i % PCA9685_PWM_CHANNELS), pDmxData[i]);
+			pPrevious[i] = pDmxData[i];
+		}
+	}
+}
+
+int main(int argc, char **argv) {
+	const uint32_t nFrames = (argc > 1) ? (uint32_t) atoi(argv[1]) : 1020;
+	const uint32_t nFlushEvery = 2;
+
+	printf("%d boards, %d channels, %u frames\n\n", BOARDS, CHANNELS, nFrames);
+	printf("%-8s | %-26s | %-26s | %-26s\n", "", "per channel", "coalesced", "deferred (flush 1 of 2)");
+	printf("%-8s | %12s %13s | %12s %13s | %12s %13s\n", "scene", "trans/frame", "bytes/frame", "trans/frame", "bytes/frame", "trans/frame", "bytes/frame");
+
+	int nResult = EXIT_SUCCESS;
+
+	for (uint32_t s = 0; s < SCENE_LAST; s++) {
+		const TScene tScene = (TScene) s;
+
+		PCA9685PWMLed *pPWMLed[BOARDS];
+
+		for (uint32_t i = 0; i < BOARDS; i++) {
+			pPWMLed[i] = new PCA9685PWMLed(ADDRESS_PER_CHANNEL + i);
+			pPWMLed[i]->SetFullOff(CHANNEL(16), true);
+		}
+
+		PCA9685DmxLed *pCoalesced = new PCA9685DmxLed;
+		pCoalesced->SetI2cAddress(ADDRESS_COALESCED);
+		pCoalesced->SetBoardInstances(BOARDS);
+		pCoalesced->Start();
+
+		PCA9685DmxLed *pDeferred = new PCA9685DmxLed;
+		pDeferred->SetI2cAddress(ADDRESS_COALESCED + BOARDS);
+		pDeferred->SetBoardInstances(BOARDS);
+		pDeferred->SetDeferredUpdate(true);
+		pDeferred->Start();
+
+		uint8_t aDmxData[CHANNELS];
+		uint8_t aPrevious[CHANNELS];
+
+		memset(aDmxData, 0, sizeof(aDmxData));
+		memset(aPrevious, 0, sizeof(aPrevious));
+
+		struct TI2cMockStatistics aTotal[3];
+		memset(aTotal, 0, sizeof(aTotal));
+
+		for (uint32_t nFrame = 1; nFrame <= nFrames; nFrame++) {
+			scene(tScene, nFrame, aDmxData);
+
+			i2c_mock_reset_statistics();
+			set_per_channel(pPWMLed, aPrevious, aDmxData);
+			aTotal[0].nWrites += i2c_mock_get_statistics()->nWrites + i2c_mock_get_statistics()->nReads;
+			aTotal[0].nBytes += i2c_mock_get_statistics()->nBytes;
+
+			i2c_mock_reset_statistics();
+			pCoalesced->SetData(0, aDmxData, CHANNELS);
+			aTotal[1].nWrites += i2c_mock_get_statistics()->nWrites + i2c_mock_get_statistics()->nReads;
+			aTotal[1].nBytes += i2c_mock_get_statistics()->nBytes;
+
+			i2c_mock_reset_statistics();
+			pDeferred->SetData(0, aDmxData, CHANNELS);
+			if ((nFrame % nFlushEvery) == 0) {
+				pDeferred->Flush();
+			}
+			aTotal[2].nWrites += i2c_mock_get_statistics()->nWrites + i2c_mock_get_statistics()->nReads;
+			aTotal[2].nBytes += i2c_mock_get_statistics()->nBytes;
+
+			for (uint32_t i = 0; i < CHANNELS; i++) {
+				const uint32_t nBoard = i / PCA9685_PWM_CHANNELS;
+				const uint32_t nChannel = i % PCA9685_PWM_CHANNELS;
+				const uint32_t nExpected = duty(ADDRESS_PER_CHANNEL + nBoard, nChannel);
+				const uint32_t nCoalesced = duty(ADDRESS_COALESCED + nBoard, nChannel);
+
+				if ((nExpected != nCoalesced) || (((nFrame % nFlushEvery) == 0) && (nExpected != duty(ADDRESS_COALESCED + BOARDS + nBoard, nChannel)))) {
+					fprintf(stderr, "%s: frame %u, channel %u: expected %u, got %u\n", s_aSceneName[s], nFrame, i, nExpected, nCoalesced);
+					nResult = EXIT_FAILURE;
+					nFrame = nFrames;
+					break;
+				}
+			}
+		}
+
+		printf("%-8s", s_aSceneName[s]);
+
+		for (uint32_t i = 0; i < 3; i++) {
+			printf(" | %12.2f %13.2f", (float) aTotal[i].nWrites / nFrames, (float) aTotal[i].nBytes / nFrames);
+		}
+
+		printf("\n");
+
+		delete pDeferred;
+		delete pCoalesced;
+
+		for (uint32_t i = 0; i < BOARDS; i++) {
+			delete pPWMLed[i];
+		}
+	}
+
+	return nResult;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file bcm2835.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef BCM2835_H_
+#define BCM2835_H_
+
+/*
+ * Linux mock of the bcm2835 I2C functions used by lib-pca9685.
+ * The PCA9685 register file is emulated, including auto-increment and the
+ * ALL_LED registers, and every transaction is counted.
+ */
+
+#include <stdint.h>
+
+#define BCM2835_GPIO_FSEL_INPT	0
+#define BCM2835_GPIO_FSEL_OUTP	1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern int bcm2835_i2c_begin(void);
+extern void bcm2835_i2c_end(void);
+extern void bcm2835_i2c_setSlaveAddress(uint8_t nAddress);
+extern void bcm2835_i2c_set_baudrate(uint32_t nBaudrate);
+extern uint8_t bcm2835_i2c_write(const char *pBuffer, uint32_t nLength);
+extern uint8_t bcm2835_i2c_read(char *pBuffer, uint32_t nLength);
+extern void bcm2835_delayMicroseconds(uint64_t nMicros);
+
+struct TI2cMockStatistics {
+	uint32_t nWrites;
+	uint32_t nReads;
+	uint32_t nBytes;
+};
+
+extern void i2c_mock_reset_statistics(void);
+extern const struct TI2cMockStatistics *i2c_mock_get_statistics(void);
+extern const uint8_t *i2c_mock_get_registers(uint8_t nAddress);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BCM2835_H_ */
@@ -0,0 +1,120 @@
+/**
+ * @file i2c_mock.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bcm2835.h"
+
+#define REG_LED0_ON_L		0x06
+#define REG_ALL_LED_ON_L	0xFA
+#define REG_ALL_LED_OFF_H	0xFD
+#define REG_MODE1			0x00
+#define MODE1_AI			(1U << 5)
+
+static uint8_t s_Registers[128][256];
+static uint8_t s_nPointer[128];
+static uint8_t s_nAddress;
+static struct TI2cMockStatistics s_Statistics;
+
+static void register_write(uint8_t nRegister, uint8_t nData) {
+	s_Registers[s_nAddress][nRegister] = nData;
+
+	if ((nRegister >= REG_ALL_LED_ON_L) && (nRegister <= REG_ALL_LED_OFF_H)) {
+		for (uint32_t i = 0; i < 16; i++) {
+			s_Registers[s_nAddress][REG_LED0_ON_L + (i * 4) + (nRegister - REG_ALL_LED_ON_L)] = nData;
+		}
+	}
+}
+
+static void pointer_increment(void) {
+	if (s_Registers[s_nAddress][REG_MODE1] & MODE1_AI) {
+		s_nPointer[s_nAddress]++;
+	}
+}
+
+extern "C" {
+
+int bcm2835_i2c_begin(void) {
+	return 1;
+}
+
+void bcm2835_i2c_end(void) {
+}
+
+void bcm2835_i2c_setSlaveAddress(uint8_t nAddress) {
+	assert(nAddress < 128);
+	s_nAddress = nAddress;
+}
+
+void bcm2835_i2c_set_baudrate(__attribute__((unused)) uint32_t nBaudrate) {
+}
+
+uint8_t bcm2835_i2c_write(const char *pBuffer, uint32_t nLength) {
+	assert(nLength != 0);
+
+	s_Statistics.nWrites++;
+	s_Statistics.nBytes += nLength;
+
+	s_nPointer[s_nAddress] = (uint8_t) pBuffer[0];
+
+	for (uint32_t i = 1; i < nLength; i++) {
+		register_write(s_nPointer[s_nAddress], (uint8_t) pBuffer[i]);
+		pointer_increment();
+	}
+
+	return 0;
+}
+
+uint8_t bcm2835_i2c_read(char *pBuffer, uint32_t nLength) {
+	s_Statistics.nReads++;
+	s_Statistics.nBytes += nLength;
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		pBuffer[i] = (char) s_Registers[s_nAddress][s_nPointer[s_nAddress]];
+		pointer_increment();
+	}
+
+	return 0;
+}
+
+void bcm2835_delayMicroseconds(__attribute__((unused)) uint64_t nMicros) {
+}
+
+void i2c_mock_reset_statistics(void) {
+	memset(&s_Statistics, 0, sizeof(struct TI2cMockStatistics));
+}
+
+const struct TI2cMockStatistics *i2c_mock_get_statistics(void) {
+	return &s_Statistics;
+}
+
+const uint8_t *i2c_mock_get_registers(uint8_t nAddress) {
+	assert(nAddress < 128);
+	return s_Registers[nAddress];
+}
+
+}
@@ -29,6 +29,7 @@
 #include <stdint.h>
 
 #include "lightset.h"
+#include "outputtransform.h"
 
 #include "pca9685pwmled.h"
 
@@ -42,6 +43,24 @@ public:
 
 	void SetData(uint8_t nPort, const uint8_t *pDmxData, uint16_t nLength);
 
+	/*
+	 * Writes the channels changed since the previous Flush, one I2C burst
+	 * per run of changed channels, or a single ALL_LED write when a board
+	 * is uniform.
+	 */
+	void Flush(void);
+
+	/*
+	 * With deferred update SetData only records the changes, the application
+	 * calls Flush from its main loop at its own rate.
+	 */
+	void SetDeferredUpdate(bool bDeferredUpdate = true) {
+		m_bDeferredUpdate = bDeferredUpdate;
+	}
+	bool GetDeferredUpdate(void) {
+		return m_bDeferredUpdate;
+	}
+
 public: // RDM
 	bool SetDmxStartAddress(uint16_t nDmxStartAddress);
 
@@ -79,8 +98,17 @@ public:
 
 	void SetDmxFootprint(uint16_t nDmxFootprint);
 
+	void SetOutputCurve(TOutputTransformCurve tCurve, float fGamma = OUTPUT_TRANSFORM_GAMMA_DEFAULT) {
+		m_OutputTransform.SetCurve(tCurve, fGamma);
+	}
+	void SetOutput16Bit(bool bOutput16Bit);
+	const OutputTransform& GetOutputTransform(void) {
+		return m_OutputTransform;
+	}
+
 private:
 	void Initialize(void);
+	void FlushBoard(uint32_t nBoard, uint32_t nChangedMask);
 
 private:
 	uint16_t m_nDmxStartAddress;
@@ -91,10 +119,15 @@ private:
 	bool m_bOutputInvert;
 	bool m_bOutputDriver;
 	bool m_bIsStarted;
+	bool m_bDeferredUpdate;
 	PCA9685PWMLed **m_pPWMLed;
-	uint8_t *m_pDmxData;
+	uint16_t m_nOutputs;
+	uint16_t *m_pOutput;
+	uint16_t *m_pOutputNext;
+	uint16_t *m_pChangedMask;
 	char *m_pSlotInfoRaw;
 	struct TLightSetSlotInfo *m_pSlotInfo;
+	OutputTransform m_OutputTransform;
 };
 
 #endif /* PCA9685DMXLED_H_ */
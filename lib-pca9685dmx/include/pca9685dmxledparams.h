@@ -31,6 +31,9 @@
 #include "pca9685dmxparams.h"
 #include "pca9685dmxled.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 class PCA9685DmxLedParams: public PCA9685DmxParams {
 public:
 	PCA9685DmxLedParams(void);
@@ -42,6 +45,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -55,6 +59,9 @@ private:
     uint16_t m_nPwmFrequency;
 	bool m_bOutputInvert;
 	bool m_bOutputDriver;
+	float m_fOutputGamma;
+	TOutputTransformCurve m_tOutputCurve;
+	PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* PCA9685DMXLEDPARAMS_H_ */
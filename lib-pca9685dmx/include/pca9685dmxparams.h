@@ -26,6 +26,9 @@
 
 #include <stdint.h>
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 class PCA9685DmxParams {
 public:
 	PCA9685DmxParams(const char *);
@@ -46,6 +49,7 @@ protected:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -57,6 +61,7 @@ private:
     uint16_t m_nDmxFootprint;
     uint8_t m_nBoardInstances;
     char *m_pDmxSlotInfoRaw;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* PCA9685DMXPARAMS_H_ */
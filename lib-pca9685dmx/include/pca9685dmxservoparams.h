@@ -31,6 +31,9 @@
 #include "pca9685dmxparams.h"
 #include "pca9685dmxservo.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 class PCA9685DmxServoParams: public PCA9685DmxParams  {
 public:
 	PCA9685DmxServoParams(void);
@@ -42,6 +45,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -54,6 +58,7 @@ private:
     uint8_t m_nI2cAddress;
 	uint16_t m_nLeftUs;
 	uint16_t m_nRightUs;
+	PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* PCA9685DMXSERVOPARAMS_H_ */
@@ -53,16 +53,27 @@ PCA9685DmxLed::PCA9685DmxLed(void):
 	m_bOutputInvert(false), // Output logic state not inverted. Value to use when external driver used.
 	m_bOutputDriver(true),	// The 16 LEDn outputs are configured with a totem pole structure.
 	m_bIsStarted(false),
+	m_bDeferredUpdate(false),
 	m_pPWMLed(0),
-	m_pDmxData(0),
+	m_nOutputs(PCA9685_PWM_CHANNELS),
+	m_pOutput(0),
+	m_pOutputNext(0),
+	m_pChangedMask(0),
 	m_pSlotInfoRaw(0),
-	m_pSlotInfo(0)
+	m_pSlotInfo(0),
+	m_OutputTransform(12)
 {
 }
 
 PCA9685DmxLed::~PCA9685DmxLed(void) {
-	delete[] m_pDmxData;
-	m_pDmxData = 0;
+	delete[] m_pOutput;
+	m_pOutput = 0;
+
+	delete[] m_pOutputNext;
+	m_pOutputNext = 0;
+
+	delete[] m_pChangedMask;
+	m_pChangedMask = 0;
 
 	for (unsigned i = 0; i < m_nBoardInstances; i++) {
 		delete m_pPWMLed[i];
@@ -94,6 +105,8 @@ void PCA9685DmxLed::Stop(uint8_t nPort) {
 	}
 
 	m_bIsStarted = false;
+
+	Flush();
 }
 
 void PCA9685DmxLed::SetData(uint8_t nPort, const uint8_t* pDmxData, uint16_t nLength) {
@@ -104,32 +117,113 @@ void PCA9685DmxLed::SetData(uint8_t nPort, const uint8_t* pDmxData, uint16_t nLe
 		Start();
 	}
 
-	uint8_t *p = (uint8_t *)pDmxData + m_nDmxStartAddress - 1;
-	uint8_t *q = m_pDmxData;
+	if (__builtin_expect((nLength < m_nDmxStartAddress), 0)) {
+		return;
+	}
 
-	uint16_t nChannel = m_nDmxStartAddress;
+	uint32_t nSlots = 1U + nLength - m_nDmxStartAddress;
 
-	for (unsigned j = 0; j < m_nBoardInstances; j++) {
-		for (unsigned i = 0; i < PCA9685_PWM_CHANNELS; i++) {
-			if ((nChannel >= (m_nDmxFootprint + m_nDmxStartAddress)) || (nChannel > nLength)) {
-				j = m_nBoardInstances;
-				break;
-			}
+	if (nSlots > m_nDmxFootprint) {
+		nSlots = m_nDmxFootprint;
+	}
+
+	const uint32_t nOutputs = m_OutputTransform.Apply(pDmxData + m_nDmxStartAddress - 1, nSlots, m_pOutputNext, m_nOutputs);
+
+	const uint16_t *p = m_pOutputNext;
+	uint16_t *q = m_pOutput;
+	uint32_t nOutput = 0;
+
+	for (unsigned j = 0; (j < m_nBoardInstances) && (nOutput < nOutputs); j++) {
+		uint32_t nChangedMask = 0;
+
+		for (unsigned i = 0; (i < PCA9685_PWM_CHANNELS) && (nOutput < nOutputs); i++) {
 			if (*p != *q) {
-				uint8_t value = *p;
-#ifndef NDEBUG
-				printf("m_pPWMLed[%d]->SetDmx(CHANNEL(%d), %d)\n", (int) j, (int) i, (int) value);
-#endif
-				m_pPWMLed[j]->Set(CHANNEL(i), value);
+				*q = *p;
+				nChangedMask |= (1U << i);
 			}
-			*q = *p;
 			p++;
 			q++;
-			nChannel++;
+			nOutput++;
+		}
+
+		m_pChangedMask[j] |= (uint16_t) nChangedMask;
+	}
+
+	if (!m_bDeferredUpdate) {
+		Flush();
+	}
+}
+
+void PCA9685DmxLed::Flush(void) {
+	if (__builtin_expect((m_pPWMLed == 0), 0)) {
+		return;
+	}
+
+	for (uint32_t j = 0; j < m_nBoardInstances; j++) {
+		const uint32_t nChangedMask = m_pChangedMask[j];
+
+		if (nChangedMask != 0) {
+			m_pChangedMask[j] = 0;
+			FlushBoard(j, nChangedMask);
 		}
 	}
 }
 
+void PCA9685DmxLed::FlushBoard(uint32_t nBoard, uint32_t nChangedMask) {
+	const uint32_t nOffset = nBoard * PCA9685_PWM_CHANNELS;
+	const uint16_t *pData = &m_pOutput[nOffset];
+
+	uint32_t nChannels = m_nOutputs - nOffset;
+
+	if (nChannels > PCA9685_PWM_CHANNELS) {
+		nChannels = PCA9685_PWM_CHANNELS;
+	}
+
+	if (nChannels == PCA9685_PWM_CHANNELS) {
+		uint32_t i;
+
+		for (i = 1; i < PCA9685_PWM_CHANNELS; i++) {
+			if (pData[i] != pData[0]) {
+				break;
+			}
+		}
+
+		if (i == PCA9685_PWM_CHANNELS) {
+#ifndef NDEBUG
+			printf("m_pPWMLed[%d]->Set(CHANNEL(16), %d)\n", (int) nBoard, (int) pData[0]);
+#endif
+			m_pPWMLed[nBoard]->Set(CHANNEL(16), pData, 1);
+			return;
+		}
+	}
+
+	/*
+	 * A single unchanged channel in between costs 4 bytes, a new transaction
+	 * costs the address, the register and the start/stop condition.
+	 * So runs separated by one unchanged channel are merged.
+	 */
+	uint32_t i = 0;
+
+	while (nChangedMask != 0) {
+		while ((nChangedMask & 0x1) == 0) {
+			nChangedMask >>= 1;
+			i++;
+		}
+
+		const uint32_t nStart = i;
+
+		while ((nChangedMask & 0x1) || (nChangedMask & 0x2)) {
+			nChangedMask >>= 1;
+			i++;
+		}
+
+#ifndef NDEBUG
+		printf("m_pPWMLed[%d]->Set(CHANNEL(%d), %d)\n", (int) nBoard, (int) nStart, (int) (i - nStart));
+#endif
+		m_pPWMLed[nBoard]->Set(CHANNEL(nStart), &pData[nStart], i - nStart);
+	}
+}
+
 bool PCA9685DmxLed::SetDmxStartAddress(uint16_t nDmxStartAddress) {
 	assert((nDmxStartAddress != 0) && (nDmxStartAddress <= DMX_MAX_CHANNELS));
 
@@ -167,7 +261,8 @@ void PCA9685DmxLed::SetI2cAddress(uint8_t nI2cAddress) {
 void PCA9685DmxLed::SetBoardInstances(uint8_t nBoardInstances) {
 	if ((nBoardInstances != 0) && (nBoardInstances <= BOARD_INSTANCES_MAX)) {
 		m_nBoardInstances = nBoardInstances;
-		m_nDmxFootprint = nBoardInstances * PCA9685_PWM_CHANNELS;
+		m_nOutputs = nBoardInstances * PCA9685_PWM_CHANNELS;
+		m_nDmxFootprint = m_nOutputs * m_OutputTransform.GetSlotsPerOutput();
 	}
 }
 
@@ -192,17 +287,35 @@ void PCA9685DmxLed::SetOutDriver(bool bOutputDriver) {
 }
 
 void PCA9685DmxLed::SetDmxFootprint(uint16_t nDmxFootprint) {
-	m_nDmxFootprint = nDmxFootprint;
-	m_nBoardInstances = (uint16_t) ceil((float) nDmxFootprint / PCA9685_PWM_CHANNELS);
+	m_nOutputs = nDmxFootprint / m_OutputTransform.GetSlotsPerOutput();
+	m_nDmxFootprint = m_nOutputs * m_OutputTransform.GetSlotsPerOutput();
+	m_nBoardInstances = (uint16_t) ceil((float) m_nOutputs / PCA9685_PWM_CHANNELS);
+}
+
+void PCA9685DmxLed::SetOutput16Bit(bool bOutput16Bit) {
+	m_OutputTransform.SetResolution(bOutput16Bit ? OUTPUT_TRANSFORM_RESOLUTION_16BIT : OUTPUT_TRANSFORM_RESOLUTION_8BIT);
+	m_nDmxFootprint = m_nOutputs * m_OutputTransform.GetSlotsPerOutput();
 }
 
 void PCA9685DmxLed::Initialize(void) {
-	assert(m_pDmxData == 0);
-	m_pDmxData = new uint8_t[m_nDmxFootprint];
-	assert(m_pDmxData != 0);
+	assert(m_pOutput == 0);
+	m_pOutput = new uint16_t[m_nOutputs];
+	assert(m_pOutput != 0);
 
-	for (unsigned i = 0; i < m_nDmxFootprint; i++) {
-		m_pDmxData[i] = 0;
+	assert(m_pOutputNext == 0);
+	m_pOutputNext = new uint16_t[m_nOutputs];
+	assert(m_pOutputNext != 0);
+
+	for (unsigned i = 0; i < m_nOutputs; i++) {
+		m_pOutput[i] = 0;
+	}
+
+	assert(m_pChangedMask == 0);
+	m_pChangedMask = new uint16_t[m_nBoardInstances];
+	assert(m_pChangedMask != 0);
+
+	for (unsigned i = 0; i < m_nBoardInstances; i++) {
+		m_pChangedMask[i] = 0;
 	}
 
 	assert(m_pPWMLed == 0);
@@ -242,8 +355,13 @@ void PCA9685DmxLed::Initialize(void) {
 		}
 
 		if (!isSet) {
-			m_pSlotInfo[i].nType = 0x00; // ST_PRIMARY
-			m_pSlotInfo[i].nCategory = 0x0001; // SD_INTENSITY
+			if ((m_OutputTransform.GetSlotsPerOutput() == 2) && ((i & 0x1) != 0)) {
+				m_pSlotInfo[i].nType = 0x01; // ST_SEC_FINE
+				m_pSlotInfo[i].nCategory = (uint16_t) (i - 1); // Slot offset of the primary slot
+			} else {
+				m_pSlotInfo[i].nType = 0x00; // ST_PRIMARY
+				m_pSlotInfo[i].nCategory = 0x0001; // SD_INTENSITY
+			}
 		}
 	}
 }
@@ -38,11 +38,17 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
+
+#include "lightsetconst.h"
 
 #define SET_PWM_FREQUENCY_MASK	(1 << 0)
 #define SET_OUTPUT_INVERT_MASK	(1 << 1)
 #define SET_OUTPUT_DRIVER_MASK	(1 << 2)
 #define I2C_SLAVE_ADDRESS_MASK	(1 << 3)
+#define OUTPUT_CURVE_MASK		(1 << 4)
+#define OUTPUT_GAMMA_MASK		(1 << 5)
+#define OUTPUT_16BIT_MASK		(1 << 6)
 
 static const char PARAMS_FILE_NAME[] ALIGNED = "pwmled.txt";
 static const char PARAMS_I2C_SLAVE_ADDRESS[] ALIGNED = "i2c_slave_address";
@@ -50,13 +56,43 @@ static const char PARAMS_PWM_FREQUENCY[] ALIGNED = "pwm_frequency";
 static const char PARAMS_OUTPUT_INVERT[] ALIGNED = "output_invert";
 static const char PARAMS_OUTPUT_DRIVER[] ALIGNED = "output_driver";
 
+enum TPCA9685DmxLedParamsKey {
+	KEY_I2C_SLAVE_ADDRESS,
+	KEY_PWM_FREQUENCY,
+	KEY_OUTPUT_INVERT,
+	KEY_OUTPUT_DRIVER,
+	KEY_OUTPUT_CURVE,
+	KEY_OUTPUT_GAMMA,
+	KEY_OUTPUT_16BIT,
+	KEY_LAST
+};
+
+// There is no params struct, all keys are handled in callbackFunction
+static const struct TPropertiesKey s_Keys[] = {
+	{ PARAMS_I2C_SLAVE_ADDRESS, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_PWM_FREQUENCY, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_OUTPUT_INVERT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_OUTPUT_DRIVER, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LightSetConst::PARAMS_OUTPUT_CURVE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LightSetConst::PARAMS_OUTPUT_GAMMA, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LightSetConst::PARAMS_OUTPUT_16BIT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TPCA9685DmxLedParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable PCA9685DmxLedParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B1 };
+
 PCA9685DmxLedParams::PCA9685DmxLedParams(void) :
 	PCA9685DmxParams(PARAMS_FILE_NAME),
 	m_bSetList(0),
 	m_nI2cAddress(PCA9685_I2C_ADDRESS_DEFAULT),
 	m_nPwmFrequency(PWMLED_DEFAULT_FREQUENCY),
 	m_bOutputInvert(false), // Output logic state not inverted. Value to use when external driver used.
-	m_bOutputDriver(true)	// The 16 LEDn outputs are configured with a totem pole structure.
+	m_bOutputDriver(true),	// The 16 LEDn outputs are configured with a totem pole structure.
+	m_fOutputGamma(OUTPUT_TRANSFORM_GAMMA_DEFAULT),
+	m_tOutputCurve(OUTPUT_TRANSFORM_CURVE_LINEAR),
+	m_pPropertiesParser(0)
 {
 }
 
@@ -64,8 +100,16 @@ PCA9685DmxLedParams::~PCA9685DmxLedParams(void) {
 }
 
 bool PCA9685DmxLedParams::Load(void) {
+	PropertiesParser parser(&PROPERTIES_TABLE, 0);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(PCA9685DmxLedParams::staticCallbackFunction, this);
-	return configfile.Read(PARAMS_FILE_NAME);
+
+	const bool bHaveFile = configfile.Read(PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	return bHaveFile;
 }
 
 void PCA9685DmxLedParams::Set(PCA9685DmxLed* pDmxLed) {
@@ -93,6 +137,17 @@ void PCA9685DmxLedParams::Set(PCA9685DmxLed* pDmxLed) {
 		pDmxLed->SetOutDriver(m_bOutputDriver);
 	}
 
+	if(isMaskSet(OUTPUT_CURVE_MASK)) {
+		pDmxLed->SetOutputCurve(m_tOutputCurve, m_fOutputGamma);
+	} else if (isMaskSet(OUTPUT_GAMMA_MASK)) {
+		pDmxLed->SetOutputCurve(OUTPUT_TRANSFORM_CURVE_GAMMA, m_fOutputGamma);
+	}
+
+	// Before the board instances and the footprint, these are in slots
+	if(isMaskSet(OUTPUT_16BIT_MASK)) {
+		pDmxLed->SetOutput16Bit(true);
+	}
+
 	const uint16_t DmxStartAddress = GetDmxStartAddress(isSet);
 	if (isSet) {
 		pDmxLed->SetDmxStartAddress(DmxStartAddress);
@@ -139,6 +194,18 @@ void PCA9685DmxLedParams::Dump(void) {
 		printf(" %s=%d [The 16 LEDn outputs are configured with %s structure]\n", PARAMS_OUTPUT_DRIVER, (int) m_bOutputDriver, m_bOutputDriver ? "a totem pole" : "an open-drain");
 	}
 
+	if(isMaskSet(OUTPUT_CURVE_MASK)) {
+		printf(" %s=%s\n", LightSetConst::PARAMS_OUTPUT_CURVE, OutputTransform::GetCurve(m_tOutputCurve));
+	}
+
+	if(isMaskSet(OUTPUT_GAMMA_MASK)) {
+		printf(" %s=%.1f\n", LightSetConst::PARAMS_OUTPUT_GAMMA, m_fOutputGamma);
+	}
+
+	if(isMaskSet(OUTPUT_16BIT_MASK)) {
+		printf(" %s=1\n", LightSetConst::PARAMS_OUTPUT_16BIT);
+	}
+
 	PCA9685DmxParams::Dump();
 #endif
 }
@@ -152,40 +219,75 @@ void PCA9685DmxLedParams::staticCallbackFunction(void* p, const char* s) {
 
 void PCA9685DmxLedParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t value8;
 	uint16_t value16;
-
-	if (Sscan::I2cAddress(pLine, PARAMS_I2C_SLAVE_ADDRESS, &value8) == SSCAN_OK) {
-		if ((value8 >= PCA9685_I2C_ADDRESS_DEFAULT) && (value8 != PCA9685_I2C_ADDRESS_FIXED)) {
-			m_nI2cAddress = value8;
-			m_bSetList |= I2C_SLAVE_ADDRESS_MASK;
+	float fValue;
+	uint8_t len;
+	char buffer[8];
+
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_I2C_SLAVE_ADDRESS:
+		if (Sscan::I2cAddress(pLine, PARAMS_I2C_SLAVE_ADDRESS, &value8) == SSCAN_OK) {
+			if ((value8 >= PCA9685_I2C_ADDRESS_DEFAULT) && (value8 != PCA9685_I2C_ADDRESS_FIXED)) {
+				m_nI2cAddress = value8;
+				m_bSetList |= I2C_SLAVE_ADDRESS_MASK;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, PARAMS_PWM_FREQUENCY, &value16) == SSCAN_OK) {
-		if ((value16 >= PCA9685_FREQUENCY_MIN) && (value16 <= PCA9685_FREQUENCY_MAX)) {
-			m_nPwmFrequency = value16;
-			m_bSetList |= SET_PWM_FREQUENCY_MASK;
+		break;
+	case KEY_PWM_FREQUENCY:
+		if (Sscan::Uint16(pLine, PARAMS_PWM_FREQUENCY, &value16) == SSCAN_OK) {
+			if ((value16 >= PCA9685_FREQUENCY_MIN) && (value16 <= PCA9685_FREQUENCY_MAX)) {
+				m_nPwmFrequency = value16;
+				m_bSetList |= SET_PWM_FREQUENCY_MASK;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, PARAMS_OUTPUT_INVERT, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_bOutputInvert = true;
-			m_bSetList |= SET_OUTPUT_INVERT_MASK;
+		break;
+	case KEY_OUTPUT_INVERT:
+		if (Sscan::Uint8(pLine, PARAMS_OUTPUT_INVERT, &value8) == SSCAN_OK) {
+			if (value8 != 0) {
+				m_bOutputInvert = true;
+				m_bSetList |= SET_OUTPUT_INVERT_MASK;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, PARAMS_OUTPUT_DRIVER, &value8) == SSCAN_OK) {
-		if (value8 == 0) {
-			m_bOutputDriver = false;
-			m_bSetList |= SET_OUTPUT_DRIVER_MASK;
+		break;
+	case KEY_OUTPUT_DRIVER:
+		if (Sscan::Uint8(pLine, PARAMS_OUTPUT_DRIVER, &value8) == SSCAN_OK) {
+			if (value8 == 0) {
+				m_bOutputDriver = false;
+				m_bSetList |= SET_OUTPUT_DRIVER_MASK;
+			}
 		}
-		return;
+		break;
+	case KEY_OUTPUT_CURVE:
+		len = 7;
+		if (Sscan::Char(pLine, LightSetConst::PARAMS_OUTPUT_CURVE, buffer, &len) == SSCAN_OK) {
+			buffer[len] = '\0';
+			const TOutputTransformCurve tCurve = OutputTransform::GetCurve(buffer);
+
+			if (tCurve != OUTPUT_TRANSFORM_CURVE_UNDEFINED) {
+				m_tOutputCurve = tCurve;
+				m_bSetList |= OUTPUT_CURVE_MASK;
+			}
+		}
+		break;
+	case KEY_OUTPUT_GAMMA:
+		if (Sscan::Float(pLine, LightSetConst::PARAMS_OUTPUT_GAMMA, &fValue) == SSCAN_OK) {
+			if ((fValue >= 1.0f) && (fValue <= 4.0f)) {
+				m_fOutputGamma = fValue;
+				m_bSetList |= OUTPUT_GAMMA_MASK;
+			}
+		}
+		break;
+	case KEY_OUTPUT_16BIT:
+		if (Sscan::Uint8(pLine, LightSetConst::PARAMS_OUTPUT_16BIT, &value8) == SSCAN_OK) {
+			if (value8 != 0) {
+				m_bSetList |= OUTPUT_16BIT_MASK;
+			}
+		}
+		break;
+	default:
+		break;
 	}
 }
-
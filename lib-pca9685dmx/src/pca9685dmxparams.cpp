@@ -40,6 +40,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #define DMX_START_ADDRESS_MASK	(1 << 0)
 #define DMX_FOOTPRINT_MASK		(1 << 1)
@@ -58,7 +59,30 @@ static const char PARAMS_BOARD_INSTANCES[] ALIGNED = "board_instances";
 
 #define DMX_SLOT_INFO_LENGTH				128
 
-PCA9685DmxParams::PCA9685DmxParams(const char *pFileName): m_bSetList(0) {
+enum TPCA9685DmxParamsKey {
+	KEY_DMX_START_ADDRESS,
+	KEY_DMX_FOOTPRINT,
+	KEY_I2C_SLAVE_ADDRESS,
+	KEY_BOARD_INSTANCES,
+	KEY_DMX_SLOT_INFO,
+	KEY_LAST
+};
+
+// There is no params struct, all keys are handled in callbackFunction
+static const struct TPropertiesKey s_Keys[] = {
+	{ LightSetConst::PARAMS_DMX_START_ADDRESS, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_DMX_FOOTPRINT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_I2C_SLAVE_ADDRESS, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_BOARD_INSTANCES, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LightSetConst::PARAMS_DMX_SLOT_INFO, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TPCA9685DmxParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable PCA9685DmxParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B5 };
+
+PCA9685DmxParams::PCA9685DmxParams(const char *pFileName): m_bSetList(0), m_pPropertiesParser(0) {
 	assert(pFileName != 0);
 
 	m_nI2cAddress = PCA9685_I2C_ADDRESS_DEFAULT;
@@ -74,8 +98,13 @@ PCA9685DmxParams::PCA9685DmxParams(const char *pFileName): m_bSetList(0) {
 		m_pDmxSlotInfoRaw[i] = 0;
 	}
 
+	PropertiesParser parser(&PROPERTIES_TABLE, 0);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(PCA9685DmxParams::staticCallbackFunction, this);
 	configfile.Read(pFileName);
+
+	m_pPropertiesParser = 0;
 }
 
 PCA9685DmxParams::~PCA9685DmxParams(void) {
@@ -92,48 +121,55 @@ void PCA9685DmxParams::staticCallbackFunction(void *p, const char *s) {
 
 void PCA9685DmxParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t value8;
 	uint16_t value16;
 	uint8_t len;
 
-	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &value16) == SSCAN_OK) {
-		if ((value16 != 0) && (value16 <= DMX_UNIVERSE_SIZE)) {
-			m_nDmxStartAddress = value16;
-			m_bSetList |= DMX_START_ADDRESS_MASK;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_DMX_START_ADDRESS:
+		if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &value16) == SSCAN_OK) {
+			if ((value16 != 0) && (value16 <= DMX_UNIVERSE_SIZE)) {
+				m_nDmxStartAddress = value16;
+				m_bSetList |= DMX_START_ADDRESS_MASK;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, PARAMS_DMX_FOOTPRINT, &value16) == SSCAN_OK) {
-		if ((value16 != 0) && (value16 <= (PCA9685_PWM_CHANNELS * PARAMS_BOARD_INSTANCES_MAX))) {
-			m_nDmxFootprint = value16;
-			m_bSetList |= DMX_FOOTPRINT_MASK;
+		break;
+	case KEY_DMX_FOOTPRINT:
+		if (Sscan::Uint16(pLine, PARAMS_DMX_FOOTPRINT, &value16) == SSCAN_OK) {
+			if ((value16 != 0) && (value16 <= (PCA9685_PWM_CHANNELS * PARAMS_BOARD_INSTANCES_MAX))) {
+				m_nDmxFootprint = value16;
+				m_bSetList |= DMX_FOOTPRINT_MASK;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::I2cAddress(pLine, PARAMS_I2C_SLAVE_ADDRESS, &value8) == SSCAN_OK) {
-		if ((value8 >= PCA9685_I2C_ADDRESS_DEFAULT) && (value8 != PCA9685_I2C_ADDRESS_FIXED)) {
-			m_nI2cAddress = value8;
-			m_bSetList |= I2C_SLAVE_ADDRESS_MASK;
-		return;
+		break;
+	case KEY_I2C_SLAVE_ADDRESS:
+		if (Sscan::I2cAddress(pLine, PARAMS_I2C_SLAVE_ADDRESS, &value8) == SSCAN_OK) {
+			if ((value8 >= PCA9685_I2C_ADDRESS_DEFAULT) && (value8 != PCA9685_I2C_ADDRESS_FIXED)) {
+				m_nI2cAddress = value8;
+				m_bSetList |= I2C_SLAVE_ADDRESS_MASK;
+			}
 		}
-	}
-
-	if (Sscan::Uint8(pLine, PARAMS_BOARD_INSTANCES, &value8) == SSCAN_OK) {
-		if ((value8 != 0) && (value8 <= PARAMS_BOARD_INSTANCES_MAX)) {
-			m_nBoardInstances = value8;
-			m_bSetList |= BOARD_INSTANCES_MASK;
+		break;
+	case KEY_BOARD_INSTANCES:
+		if (Sscan::Uint8(pLine, PARAMS_BOARD_INSTANCES, &value8) == SSCAN_OK) {
+			if ((value8 != 0) && (value8 <= PARAMS_BOARD_INSTANCES_MAX)) {
+				m_nBoardInstances = value8;
+				m_bSetList |= BOARD_INSTANCES_MASK;
+			}
 		}
-		return;
-	}
-
-	len = DMX_SLOT_INFO_LENGTH;
-	if (Sscan::Char(pLine, LightSetConst::PARAMS_DMX_SLOT_INFO, m_pDmxSlotInfoRaw, &len) == SSCAN_OK) {
-		if (len >= 7) { // 00:0000 at least one value set
-			m_bSetList |= DMX_SLOT_INFO_MASK;
+		break;
+	case KEY_DMX_SLOT_INFO:
+		len = DMX_SLOT_INFO_LENGTH;
+		if (Sscan::Char(pLine, LightSetConst::PARAMS_DMX_SLOT_INFO, m_pDmxSlotInfoRaw, &len) == SSCAN_OK) {
+			if (len >= 7) { // 00:0000 at least one value set
+				m_bSetList |= DMX_SLOT_INFO_MASK;
+			}
 		}
+		break;
+	default:
+		break;
 	}
 }
 
@@ -38,6 +38,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #define LEFT_US_MASK			(1 << 0)
 #define RIGHT_US_MASK			(1 << 1)
@@ -48,11 +49,31 @@ static const char PARAMS_I2C_SLAVE_ADDRESS[] ALIGNED = "i2c_slave_address";
 static const char PARAMS_LEFT_US[] ALIGNED = "left_us";
 static const char PARAMS_RIGHT_US[] ALIGNED = "right_us";
 
+enum TPCA9685DmxServoParamsKey {
+	KEY_I2C_SLAVE_ADDRESS,
+	KEY_LEFT_US,
+	KEY_RIGHT_US,
+	KEY_LAST
+};
+
+// There is no params struct, all keys are handled in callbackFunction
+static const struct TPropertiesKey s_Keys[] = {
+	{ PARAMS_I2C_SLAVE_ADDRESS, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_LEFT_US, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_RIGHT_US, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TPCA9685DmxServoParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable PCA9685DmxServoParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 4, 0x9E3779B1 };
+
 PCA9685DmxServoParams::PCA9685DmxServoParams(void) :
 	PCA9685DmxParams(PARAMS_FILE_NAME),
 	m_bSetList(0),
 	m_nI2cAddress(PCA9685_I2C_ADDRESS_DEFAULT),
-	m_nLeftUs(SERVO_LEFT_DEFAULT_US), m_nRightUs(SERVO_RIGHT_DEFAULT_US)
+	m_nLeftUs(SERVO_LEFT_DEFAULT_US), m_nRightUs(SERVO_RIGHT_DEFAULT_US),
+	m_pPropertiesParser(0)
 {
 }
 
@@ -60,8 +81,16 @@ PCA9685DmxServoParams::~PCA9685DmxServoParams(void) {
 }
 
 bool PCA9685DmxServoParams::Load(void) {
+	PropertiesParser parser(&PROPERTIES_TABLE, 0);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(PCA9685DmxServoParams::staticCallbackFunction, this);
-	return configfile.Read(PARAMS_FILE_NAME);
+
+	const bool bHaveFile = configfile.Read(PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	return bHaveFile;
 }
 
 void PCA9685DmxServoParams::Set(PCA9685DmxServo* pDmxServo) {
@@ -135,31 +164,37 @@ void PCA9685DmxServoParams::staticCallbackFunction(void* p, const char* s) {
 
 void PCA9685DmxServoParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t value8;
 	uint16_t value16;
 
-	if (Sscan::I2cAddress(pLine, PARAMS_I2C_SLAVE_ADDRESS, &value8) == SSCAN_OK) {
-		if ((value8 >= PCA9685_I2C_ADDRESS_DEFAULT) && (value8 != PCA9685_I2C_ADDRESS_FIXED)) {
-			m_nI2cAddress = value8;
-			m_bSetList |= I2C_SLAVE_ADDRESS_MASK;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_I2C_SLAVE_ADDRESS:
+		if (Sscan::I2cAddress(pLine, PARAMS_I2C_SLAVE_ADDRESS, &value8) == SSCAN_OK) {
+			if ((value8 >= PCA9685_I2C_ADDRESS_DEFAULT) && (value8 != PCA9685_I2C_ADDRESS_FIXED)) {
+				m_nI2cAddress = value8;
+				m_bSetList |= I2C_SLAVE_ADDRESS_MASK;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, PARAMS_LEFT_US, &value16) == SSCAN_OK) {
-		if ((value16 != 0) && (value16 < m_nRightUs)) {
-			m_nLeftUs = value16;
-			m_bSetList |= LEFT_US_MASK;
+		break;
+	case KEY_LEFT_US:
+		if (Sscan::Uint16(pLine, PARAMS_LEFT_US, &value16) == SSCAN_OK) {
+			if ((value16 != 0) && (value16 < m_nRightUs)) {
+				m_nLeftUs = value16;
+				m_bSetList |= LEFT_US_MASK;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, PARAMS_RIGHT_US, &value16) == SSCAN_OK) {
-		if (value16 > m_nLeftUs) {
-			m_nRightUs = value16;
-			m_bSetList |= RIGHT_US_MASK;
+		break;
+	case KEY_RIGHT_US:
+		if (Sscan::Uint16(pLine, PARAMS_RIGHT_US, &value16) == SSCAN_OK) {
+			if (value16 > m_nLeftUs) {
+				m_nRightUs = value16;
+				m_bSetList |= RIGHT_US_MASK;
+			}
 		}
-		return;
+		break;
+	default:
+		break;
 	}
 }
@@ -0,0 +1,2171 @@
+/**
+ * @file baseline.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The Sscan chains of the params classes before the PropertiesParser, the
+ * reference for the benchmark. Do not change, except for:
+ * - the ARTNET_PARAMS_MASK_RDM_DISCOVERY that the old chain did not set;
+ * - the OSCServerParams path_blackout that the old chain read with the
+ *   path_info key;
+ * - the OscClientParams cmd/led key names, from OscClientParamsConst instead
+ *   of the per instance buffers.
+ * The chains of the classes without a params struct write a TBaseline struct.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <assert.h>
+
+#include "baseline.h"
+
+#include "artnetparams.h"
+#include "artnetparamsconst.h"
+#include "artnet.h"
+#include "ltcparams.h"
+#include "ltcparamsconst.h"
+#include "ws28xxdmxparams.h"
+#include "ws28xx.h"
+#include "ws28xxconst.h"
+#include "rgbmapping.h"
+#include "devicesparamsconst.h"
+#include "lightset.h"
+#include "lightsetconst.h"
+#include "artnet4params.h"
+#include "artnet4paramsconst.h"
+#include "displayudfparams.h"
+#include "displayudfparamsconst.h"
+#include "networkconst.h"
+#include "dmxmonitorparams.h"
+#include "dmxmonitorparamsconst.h"
+#include "dmxparams.h"
+#include "dmxsendconst.h"
+#include "e131params.h"
+#include "e131paramsconst.h"
+#include "e131.h"
+#include "e131controller.h"
+#include "l6470params.h"
+#include "l6470paramsconst.h"
+#include "modeparams.h"
+#include "modeparamsconst.h"
+#include "l6470dmxmode.h"
+#include "dmxslotinfo.h"
+#include "motorparams.h"
+#include "motorparamsconst.h"
+#include "slushdmxparams.h"
+#include "slushdmxparamsconst.h"
+#include "slushdmx.h"
+#include "sparkfundmxparams.h"
+#include "sparkfundmxparamsconst.h"
+#include "ltcdisplayparams.h"
+#include "ltcdisplayparamsconst.h"
+#include "ltcdisplayws28xx.h"
+#include "ltcdisplaymax7219.h"
+#include "midiparams.h"
+#include "midi.h"
+#include "networkparams.h"
+#include "oscclientparams.h"
+#include "oscclientparamsconst.h"
+#include "oscserverparms.h"
+#include "oscserverconst.h"
+#include "oscconst.h"
+#include "pca9685.h"
+#include "pca9685servo.h"
+#include "outputtransform.h"
+#include "rdmdeviceparams.h"
+#include "rdmdeviceparamsconst.h"
+#include "remoteconfigparams.h"
+#include "remoteconfigconst.h"
+#include "showfileparams.h"
+#include "showfileparamsconst.h"
+#include "showfile.h"
+#include "showfileconst.h"
+#include "showfileosc.h"
+#include "tcnetparams.h"
+#include "tcnetparamsconst.h"
+#include "tcnet.h"
+#include "tlc59711dmxparams.h"
+#include "widgetparams.h"
+
+#include "sscan.h"
+
+static LtcParams s_LtcParams;	// GetSourceType
+
+static bool isDisabledOutputMaskSet(const struct TLtcParams *pLtcParams, uint8_t nMask) {
+	return (pLtcParams->nDisabledOutputs & nMask) == nMask;
+}
+
+void baselineArtNetParams(void *p, const char *pLine) {
+	struct TArtNetParams *pArtNetParams = (struct TArtNetParams *) p;
+
+	assert(pLine != 0);
+
+	char value[128];
+	uint8_t nLength;
+	uint8_t nValue8;
+	uint16_t nValue16;
+	uint32_t nValue32;
+
+	if (Sscan::Uint8(pLine, ArtNetParamsConst::TIMECODE, &nValue8) == SSCAN_OK) {
+		pArtNetParams->bUseTimeCode = (nValue8 != 0);
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_TIMECODE;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ArtNetParamsConst::TIMESYNC, &nValue8) == SSCAN_OK) {
+		pArtNetParams->bUseTimeSync = (nValue8 != 0);
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_TIMESYNC;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ArtNetParamsConst::RDM, &nValue8) == SSCAN_OK) {
+		pArtNetParams->bEnableRdm = (nValue8 != 0);
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_RDM;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ArtNetParamsConst::RDM_DISCOVERY, &nValue8) == SSCAN_OK) {
+		pArtNetParams->bRdmDiscovery = (nValue8 != 0);
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_RDM_DISCOVERY;
+		return;
+	}
+
+	nLength = ARTNET_SHORT_NAME_LENGTH - 1;
+	if (Sscan::Char(pLine, ArtNetParamsConst::NODE_SHORT_NAME, (char *) pArtNetParams->aShortName, &nLength) == SSCAN_OK) {
+		pArtNetParams->aShortName[nLength] = '\0';
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_SHORT_NAME;
+		return;
+	}
+
+	nLength = ARTNET_LONG_NAME_LENGTH - 1;
+	if (Sscan::Char(pLine, ArtNetParamsConst::NODE_LONG_NAME, (char *)pArtNetParams->aLongName, &nLength) == SSCAN_OK) {
+		pArtNetParams->aLongName[nLength] = '\0';
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_LONG_NAME;
+		return;
+	}
+
+	if (Sscan::HexUint16(pLine, ArtNetParamsConst::NODE_OEM_VALUE, &nValue16) == SSCAN_OK) {
+		pArtNetParams->aOemValue[0] = (uint8_t) (nValue16 >> 8);
+		pArtNetParams->aOemValue[1] = (uint8_t) (nValue16 & 0xFF);
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_OEM_VALUE;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ArtNetParamsConst::NODE_NETWORK_DATA_LOSS_TIMEOUT, &nValue8) == SSCAN_OK) {
+		pArtNetParams->nNetworkTimeout = (time_t) nValue8;
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_NETWORK_TIMEOUT;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ArtNetParamsConst::NODE_DISABLE_MERGE_TIMEOUT, &nValue8) == SSCAN_OK) {
+		pArtNetParams->bDisableMergeTimeout = (nValue8 != 0);
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_MERGE_TIMEOUT;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ArtNetParamsConst::NET, &nValue8) == SSCAN_OK) {
+		pArtNetParams->nNet = nValue8;
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_NET;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ArtNetParamsConst::SUBNET, &nValue8) == SSCAN_OK) {
+		pArtNetParams->nSubnet = nValue8;
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_SUBNET;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_UNIVERSE, &nValue8) == SSCAN_OK) {
+		if (nValue8 <= 0xF) {
+			pArtNetParams->nUniverse = nValue8;
+			pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_UNIVERSE;
+		}
+		return;
+	}
+
+	nLength = 3;
+	if (Sscan::Char(pLine, ArtNetParamsConst::MERGE_MODE, value, &nLength) == SSCAN_OK) {
+		if (memcmp(value, "ltp", 3) == 0) {
+			pArtNetParams->nMergeMode = ARTNET_MERGE_LTP;
+			pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_MERGE_MODE;
+		} else if (memcmp(value, "htp", 3) == 0) {
+			pArtNetParams->nMergeMode = ARTNET_MERGE_HTP;
+			pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_MERGE_MODE;
+		}
+		return;
+	}
+
+	nLength = 4;
+	if (Sscan::Char(pLine, ArtNetParamsConst::PROTOCOL, value, &nLength) == SSCAN_OK) {
+		if(memcmp(value, "sacn", 4) == 0) {
+			pArtNetParams->nProtocol = PORT_ARTNET_SACN;
+			pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_PROTOCOL;
+		} else {
+			pArtNetParams->nProtocol = PORT_ARTNET_ARTNET;
+		}
+		return;
+	}
+
+	for (unsigned i = 0; i < ARTNET_MAX_PORTS; i++) {
+		if (Sscan::Uint8(pLine, ArtNetParamsConst::UNIVERSE_PORT[i], &nValue8) == SSCAN_OK) {
+			pArtNetParams->nUniversePort[i] = nValue8;
+			pArtNetParams->nSetList |= (ARTNET_PARAMS_MASK_UNIVERSE_A << i);
+			return;
+		}
+
+		nLength = 3;
+		if (Sscan::Char(pLine, ArtNetParamsConst::MERGE_MODE_PORT[i], value, &nLength) == SSCAN_OK) {
+			if (memcmp(value, "ltp", 3) == 0) {
+				pArtNetParams->nMergeModePort[i] = ARTNET_MERGE_LTP;
+				pArtNetParams->nSetList |= (ARTNET_PARAMS_MASK_MERGE_MODE_A << i);
+			} else if (memcmp(value, "htp", 3) == 0) {
+				pArtNetParams->nMergeModePort[i] = ARTNET_MERGE_HTP;
+				pArtNetParams->nSetList |= (ARTNET_PARAMS_MASK_MERGE_MODE_A << i);
+			}
+			return;
+		}
+
+		nLength = 4;
+		if (Sscan::Char(pLine, ArtNetParamsConst::PROTOCOL_PORT[i], value, &nLength) == SSCAN_OK) {
+			if (memcmp(value, "sacn", 4) == 0) {
+				pArtNetParams->nProtocolPort[i] = PORT_ARTNET_SACN;
+				pArtNetParams->nSetList |= (ARTNET_PARAMS_MASK_PROTOCOL_A << i);
+			} else {
+				pArtNetParams->nProtocolPort[i] = PORT_ARTNET_ARTNET;
+			}
+			return;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE, &nValue8) == SSCAN_OK) {
+		pArtNetParams->bEnableNoChangeUpdate = (nValue8 != 0);
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT;
+		return;
+	}
+
+	nLength = 5;
+	if (Sscan::Char(pLine, ArtNetParamsConst::DIRECTION, value, &nLength) == SSCAN_OK) {
+		if (memcmp(value, "input", 5) == 0) {
+			pArtNetParams->nDirection = (uint8_t) ARTNET_INPUT_PORT;
+			pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_DIRECTION;
+		}
+		return;
+	}
+
+	nLength = 6;
+	if (Sscan::Char(pLine, ArtNetParamsConst::DIRECTION, value, &nLength) == SSCAN_OK) {
+		if (memcmp(value, "output", 6) == 0) {
+			pArtNetParams->nDirection = (uint8_t) ARTNET_OUTPUT_PORT;
+			pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_DIRECTION;
+		}
+		return;
+	}
+
+	if (Sscan::IpAddress(pLine, ArtNetParamsConst::DESTINATION_IP, &nValue32) == SSCAN_OK) {
+		pArtNetParams->nDestinationIp = nValue32;
+		pArtNetParams->nSetList |= ARTNET_PARAMS_MASK_DESTINATION_IP;
+		return;
+	}
+}
+
+static void handleDisabledOutput(struct TLtcParams *pLtcParams, const char *pLine, const char *pKeyword, TLtcParamsMaskDisabledOutputs tLtcParamsMaskDisabledOutputs) {
+	uint8_t value8;
+
+	if (Sscan::Uint8(pLine, pKeyword, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pLtcParams->nDisabledOutputs |= (uint8_t) tLtcParamsMaskDisabledOutputs;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_DISABLED_OUTPUTS;
+		} else {
+			pLtcParams->nDisabledOutputs &= ~((uint8_t) tLtcParamsMaskDisabledOutputs);
+		}
+	}
+}
+
+void baselineLtcParams(void *p, const char *pLine) {
+	struct TLtcParams *pLtcParams = (struct TLtcParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint16_t value16;
+	char source[16];
+	uint8_t len = sizeof(source);
+
+	if (Sscan::Char(pLine, LtcParamsConst::SOURCE, source, &len) == SSCAN_OK) {
+		source[len] = '\0';
+		pLtcParams->tSource = s_LtcParams.GetSourceType((const char *) source);
+		pLtcParams->nSetList |= LTC_PARAMS_MASK_SOURCE;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::AUTO_START, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pLtcParams->nAutoStart = 1;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_AUTO_START;
+		} else {
+			pLtcParams->nAutoStart = 0;
+			pLtcParams->nSetList &= ~LTC_PARAMS_MASK_AUTO_START;
+		}
+	}
+
+	handleDisabledOutput(pLtcParams, pLine, LtcParamsConst::DISABLE_DISPLAY, LTC_PARAMS_DISABLE_DISPLAY);
+	handleDisabledOutput(pLtcParams, pLine, LtcParamsConst::DISABLE_MAX7219, LTC_PARAMS_DISABLE_MAX7219);
+	handleDisabledOutput(pLtcParams, pLine, LtcParamsConst::DISABLE_LTC, LTC_PARAMS_DISABLE_LTC);
+	handleDisabledOutput(pLtcParams, pLine, LtcParamsConst::DISABLE_MIDI, LTC_PARAMS_DISABLE_MIDI);
+	handleDisabledOutput(pLtcParams, pLine, LtcParamsConst::DISABLE_ARTNET, LTC_PARAMS_DISABLE_ARTNET);
+	handleDisabledOutput(pLtcParams, pLine, LtcParamsConst::DISABLE_TCNET, LTC_PARAMS_DISABLE_TCNET);
+	handleDisabledOutput(pLtcParams, pLine, LtcParamsConst::DISABLE_RTPMIDI, LTC_PARAMS_DISABLE_RTPMIDI);
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::SHOW_SYSTIME, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pLtcParams->nShowSysTime = 1;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_SHOW_SYSTIME;
+		} else {
+			pLtcParams->nShowSysTime = 0;
+			pLtcParams->nSetList &= ~LTC_PARAMS_MASK_SHOW_SYSTIME;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::DISABLE_TIMESYNC, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pLtcParams->nDisableTimeSync = 1;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_DISABLE_TIMESYNC;
+		} else {
+			pLtcParams->nDisableTimeSync = 0;
+			pLtcParams->nSetList &= ~LTC_PARAMS_MASK_DISABLE_TIMESYNC;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::YEAR, &value8) == SSCAN_OK) {
+		if (value8 >= 19) {
+			pLtcParams->nYear = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_YEAR;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::MONTH, &value8) == SSCAN_OK) {
+		if ((value8 >= 1) && (value8 <= 12)) {
+			pLtcParams->nMonth = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_MONTH;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::DAY, &value8) == SSCAN_OK) {
+		if ((value8 >= 1) && (value8 <= 31)) {
+			pLtcParams->nDay = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_DAY;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::NTP_ENABLE, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pLtcParams->nEnableNtp = 1;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_ENABLE_NTP;
+		} else {
+			pLtcParams->nEnableNtp = 0;
+			pLtcParams->nSetList &= ~LTC_PARAMS_MASK_ENABLE_NTP;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::FPS, &value8) == SSCAN_OK) {
+		if ((value8 >= 24) && (value8 <= 30)) {
+			pLtcParams->nFps = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_FPS;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::START_FRAME, &value8) == SSCAN_OK) {
+		if (value8 <= 30) {
+			pLtcParams->nStartFrame = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_START_FRAME;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::START_SECOND, &value8) == SSCAN_OK) {
+		if (value8 <= 59) {
+			pLtcParams->nStartSecond = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_START_SECOND;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::START_MINUTE, &value8) == SSCAN_OK) {
+		if (value8 <= 59) {
+			pLtcParams->nStartMinute = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_START_MINUTE;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::START_HOUR, &value8) == SSCAN_OK) {
+		if (value8 <= 23) {
+			pLtcParams->nStartHour = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_START_HOUR;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::STOP_FRAME, &value8) == SSCAN_OK) {
+		if (value8 <= 30) {
+			pLtcParams->nStopFrame = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_STOP_FRAME;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::STOP_SECOND, &value8) == SSCAN_OK) {
+		if (value8 <= 59) {
+			pLtcParams->nStopSecond = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_STOP_SECOND;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::STOP_MINUTE, &value8) == SSCAN_OK) {
+		if (value8 <= 59) {
+			pLtcParams->nStopMinute = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_STOP_MINUTE;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::STOP_HOUR, &value8) == SSCAN_OK) {
+		if (value8 <= 99) {
+			pLtcParams->nStopHour = value8;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_STOP_HOUR;
+		}
+		return;
+	}
+
+#if 0
+	if (Sscan::Uint8(pLine, LtcParamsConst::SET_DATE, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pLtcParams->nSetDate = 1;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_SET_DATE;
+		} else {
+			pLtcParams->nSetDate = 0;
+			pLtcParams->nSetList &= ~LTC_PARAMS_MASK_SET_DATE;
+		}
+	}
+#endif
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::OSC_ENABLE, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pLtcParams->nEnableOsc = 1;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_ENABLE_OSC;
+		} else {
+			pLtcParams->nEnableOsc = 0;
+			pLtcParams->nSetList &= ~LTC_PARAMS_MASK_ENABLE_OSC;
+		}
+	}
+
+	if (Sscan::Uint16(pLine, LtcParamsConst::OSC_PORT, &value16) == SSCAN_OK) {
+		if (value16 > 1023) {
+			pLtcParams->nOscPort = value16;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_OSC_PORT;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcParamsConst::WS28XX_ENABLE, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pLtcParams->nEnableWS28xx = 1;
+			pLtcParams->nDisabledOutputs |= LTC_PARAMS_DISABLE_MAX7219;
+#if !defined(USE_SPI_DMA)
+			pLtcParams->nDisabledOutputs |= LTC_PARAMS_DISABLE_LTC;		// TODO Temporarily code until SPI DMA has been implemented
+#endif
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_ENABLE_WS28XX;
+			pLtcParams->nSetList |= LTC_PARAMS_MASK_DISABLED_OUTPUTS;
+		} else {
+			pLtcParams->nEnableWS28xx = 0;
+			if (!isDisabledOutputMaskSet(pLtcParams, LTC_PARAMS_DISABLE_MAX7219)) {
+				pLtcParams->nDisabledOutputs &= ~LTC_PARAMS_DISABLE_MAX7219;
+			}
+#if !defined(USE_SPI_DMA)
+			if (!isDisabledOutputMaskSet(pLtcParams, LTC_PARAMS_DISABLE_LTC)) {			// TODO Temporarily code until SPI DMA has been implemented
+				pLtcParams->nDisabledOutputs &= ~LTC_PARAMS_DISABLE_LTC;	// TODO Temporarily code until SPI DMA has been implemented
+			}																// TODO Temporarily code until SPI DMA has been implemented
+#endif
+			pLtcParams->nSetList &= ~LTC_PARAMS_MASK_ENABLE_WS28XX;
+		}
+	}
+}
+
+void baselineWS28xxDmxParams(void *p, const char *pLine) {
+	struct TWS28xxDmxParams *pWS28xxParams = (struct TWS28xxDmxParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t nValue8;
+	uint16_t nValue16;
+	uint32_t nValue32;
+	uint8_t nLength;
+	float fValue;
+	char cBuffer[16];
+
+	nLength = 7;
+	if (Sscan::Char(pLine, DevicesParamsConst::LED_TYPE, cBuffer, &nLength) == SSCAN_OK) {
+		cBuffer[nLength] = '\0';
+		uint32_t i;
+
+		for (i = 0; i < WS28XX_UNDEFINED; i++) {
+			if (strcasecmp(cBuffer, WS28xxConst::TYPES[i]) == 0) {
+				break;
+			}
+		}
+
+		pWS28xxParams->tLedType = (TWS28XXType) i;
+		pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_LED_TYPE;
+
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, DevicesParamsConst::LED_COUNT, &nValue16) == SSCAN_OK) {
+		if (nValue16 != 0 && nValue16 <= (4 * 170)) {
+			pWS28xxParams->nLedCount = nValue16;
+			pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_LED_COUNT;
+		}
+		return;
+	}
+
+	nLength = 3;
+	if (Sscan::Char(pLine, DevicesParamsConst::LED_RGB_MAPPING, cBuffer, &nLength) == SSCAN_OK) {
+		cBuffer[nLength] = '\0';
+		enum TRGBMapping tMapping;
+
+		if ((tMapping = RGBMapping::FromString(cBuffer)) != RGB_MAPPING_UNDEFINED) {
+			pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_RGB_MAPPING;
+		} else {
+			pWS28xxParams->nSetList &= ~WS28XXDMX_PARAMS_MASK_RGB_MAPPING;
+		}
+
+		pWS28xxParams->nRgbMapping = (uint8_t) tMapping;
+
+		return;
+	}
+
+	if (Sscan::Float(pLine, DevicesParamsConst::LED_T0H, &fValue) == SSCAN_OK) {
+		if ((nValue8 = WS28xx::ConvertTxH(fValue)) != 0) {
+			pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_LOW_CODE;
+		} else {
+			pWS28xxParams->nSetList &= ~WS28XXDMX_PARAMS_MASK_LOW_CODE;
+		}
+
+		pWS28xxParams->nLowCode = nValue8;
+
+		return;
+	}
+
+	if (Sscan::Float(pLine, DevicesParamsConst::LED_T1H, &fValue) == SSCAN_OK) {
+		if ((nValue8 = WS28xx::ConvertTxH(fValue)) != 0) {
+			pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_HIGH_CODE;
+		} else {
+			pWS28xxParams->nSetList &= ~WS28XXDMX_PARAMS_MASK_HIGH_CODE;
+		}
+
+		pWS28xxParams->nHighCode = nValue8;
+
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, DevicesParamsConst::ACTIVE_OUT, &nValue8) == SSCAN_OK) {
+		pWS28xxParams->nActiveOutputs = nValue8;
+		pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_ACTIVE_OUT;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, DevicesParamsConst::USE_SI5351A, &nValue8) == SSCAN_OK) {
+		pWS28xxParams->bUseSI5351A = (nValue8 != 0);
+		pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_USE_SI5351A;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, DevicesParamsConst::LED_GROUPING, &nValue8) == SSCAN_OK) {
+		pWS28xxParams->bLedGrouping = (nValue8 != 0);
+		pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_LED_GROUPING;
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, DevicesParamsConst::LED_GROUP_COUNT, &nValue16) == SSCAN_OK) {
+		if (nValue16 != 0 && nValue16 <= (4 * 170)) {
+			pWS28xxParams->nLedGroupCount = nValue16;
+			pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_LED_GROUP_COUNT;
+		}
+		return;
+	}
+
+	if (Sscan::Uint32(pLine, DevicesParamsConst::SPI_SPEED_HZ, &nValue32) == SSCAN_OK) {
+		pWS28xxParams->nSpiSpeedHz = nValue32;
+		pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_SPI_SPEED;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, DevicesParamsConst::GLOBAL_BRIGHTNESS, &nValue8) == SSCAN_OK) {
+		pWS28xxParams->nGlobalBrightness = nValue8;
+		pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_GLOBAL_BRIGHTNESS;
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &nValue16) == SSCAN_OK) {
+		if (nValue16 != 0 && nValue16 <= DMX_UNIVERSE_SIZE) {
+			pWS28xxParams->nDmxStartAddress = nValue16;
+			pWS28xxParams->nSetList |= WS28XXDMX_PARAMS_MASK_DMX_START_ADDRESS;
+		}
+		return;
+	}
+}
+
+/*
+ * File local in the params sources
+ */
+
+#define DMX_PARAMS_MIN_BREAK_TIME		9
+#define DMX_PARAMS_MAX_BREAK_TIME		127
+#define DMX_PARAMS_MIN_MAB_TIME			1
+#define DMX_PARAMS_MAX_MAB_TIME			127
+
+static const char *pArray[DISPLAY_UDF_LABEL_UNKNOWN] = {
+		DisplayUdfParamsConst::TITLE,
+		DisplayUdfParamsConst::BOARD_NAME,
+		NetworkConst::PARAMS_IP_ADDRESS,
+		DisplayUdfParamsConst::VERSION,
+		LightSetConst::PARAMS_UNIVERSE,
+		DisplayUdfParamsConst::ACTIVE_PORTS,
+		ArtNetParamsConst::NODE_SHORT_NAME,
+		NetworkConst::PARAMS_HOSTNAME,
+		ArtNetParamsConst::UNIVERSE_PORT[0],
+		ArtNetParamsConst::UNIVERSE_PORT[1],
+		ArtNetParamsConst::UNIVERSE_PORT[2],
+		ArtNetParamsConst::UNIVERSE_PORT[3],
+		NetworkConst::PARAMS_NET_MASK,
+		LightSetConst::PARAMS_DMX_START_ADDRESS,
+		ArtNetParamsConst::DESTINATION_IP
+};
+
+#define DATA_DIRECTION_MASK			(1 << 0)
+#define DATA_DIRECTION_OUT_A_MASK	(1 << 1)
+
+static const char PARAMS_DATA_DIRECTION[] = "data_direction";
+static const char PARAMS_DATA_DIRECTION_OUT[4][21] = {
+		"data_direction_out_a", "data_direction_out_b", "data_direction_out_c", "data_direction_out_d" };
+
+#define SET_DMX_START_ADDRESS		(1 << 0)
+#define SET_DMX_MAX_CHANNELS		(1 << 1)
+#define SET_FORMAT					(1 << 2)
+#define SET_RECORD					(1 << 3)
+#define SET_STATISTICS				(1 << 4)
+
+static const char aColonBlinkMode[3][5] = { "off", "down", "up" };
+
+#define SET_BAUDRATE		(1 << 0)
+#define SET_ACTIVE_SENSE	(1 << 1)
+
+static const char PARAMS_BAUDRATE[] = "baudrate";
+static const char PARAMS_ACTIVE_SENSE[] = "active_sense";
+
+static const char PARAMS_NAME_SERVER[] = "name_server";
+
+#define DMX_START_ADDRESS_MASK	(1 << 0)
+#define DMX_FOOTPRINT_MASK		(1 << 1)
+#define DMX_SLOT_INFO_MASK		(1 << 2)
+#define I2C_SLAVE_ADDRESS_MASK	(1 << 3)
+#define BOARD_INSTANCES_MASK	(1 << 4)
+
+static const char PARAMS_DMX_FOOTPRINT[] = "dmx_footprint";
+static const char PARAMS_I2C_SLAVE_ADDRESS[] = "i2c_slave_address";
+static const char PARAMS_BOARD_INSTANCES[] = "board_instances";
+
+#define PARAMS_BOARD_INSTANCES_MAX	32
+#define DMX_SLOT_INFO_LENGTH		BASELINE_DMX_SLOT_INFO_LENGTH
+
+#define SET_PWM_FREQUENCY_MASK		(1 << 0)
+#define SET_OUTPUT_INVERT_MASK		(1 << 1)
+#define SET_OUTPUT_DRIVER_MASK		(1 << 2)
+#define LED_I2C_SLAVE_ADDRESS_MASK	(1 << 3)
+#define OUTPUT_CURVE_MASK			(1 << 4)
+#define OUTPUT_GAMMA_MASK			(1 << 5)
+#define OUTPUT_16BIT_MASK			(1 << 6)
+
+static const char PARAMS_PWM_FREQUENCY[] = "pwm_frequency";
+static const char PARAMS_OUTPUT_INVERT[] = "output_invert";
+static const char PARAMS_OUTPUT_DRIVER[] = "output_driver";
+
+#define LEFT_US_MASK				(1 << 0)
+#define RIGHT_US_MASK				(1 << 1)
+#define SERVO_I2C_SLAVE_ADDRESS_MASK	(1 << 2)
+
+static const char PARAMS_LEFT_US[] = "left_us";
+static const char PARAMS_RIGHT_US[] = "right_us";
+
+#define INSTALL_UBOOT_MASK		(1 << 0)
+#define INSTALL_UIMAGE_MASK		(1 << 1)
+
+static const char PARAMS_INSTALL_UBOOT[] = "install_uboot";
+static const char PARAMS_INSTALL_UIMAGE[] = "install_uimage";
+
+static const char sLedTypes[TTLC59711_TYPE_UNDEFINED][10] = { "TLC59711\0", "TLC59711W" };
+
+enum {
+	WIDGET_MIN_BREAK_TIME = 9,
+	WIDGET_MAX_BREAK_TIME = 127
+};
+
+enum {
+	WIDGET_MIN_MAB_TIME = 1,
+	WIDGET_MAX_MAB_TIME = 127,
+};
+
+static const char DMXUSBPRO_PARAMS_BREAK_TIME[] = "dmxusbpro_break_time";
+static const char DMXUSBPRO_PARAMS_MAB_TIME[] = "dmxusbpro_mab_time";
+static const char DMXUSBPRO_PARAMS_REFRESH_RATE[] = "dmxusbpro_refresh_rate";
+static const char PARAMS_WIDGET_MODE[] = "widget_mode";
+static const char PARAMS_DMX_SEND_TO_HOST_THROTTLE[] = "dmx_send_to_host_throttle";
+
+void baselineArtNet4Params(void *p, const char *pLine) {
+	struct TArtNet4Params *pArtNet4Params = (struct TArtNet4Params *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint16_t value16;
+
+	if (Sscan::Uint8(pLine, ArtNet4ParamsConst::MAP_UNIVERSE0, &value8) == SSCAN_OK) {
+		pArtNet4Params->bMapUniverse0 = (value8 != 0);
+		pArtNet4Params->nSetList |= ARTNET4_PARAMS_MASK_MAP_UNIVERSE0;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ArtNet4ParamsConst::INPUT_ARTSYNC, &value8) == SSCAN_OK) {
+		pArtNet4Params->bInputArtSync = (value8 != 0);
+		pArtNet4Params->nSetList |= ARTNET4_PARAMS_MASK_INPUT_ARTSYNC;
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, ArtNet4ParamsConst::INPUT_MIN_INTERVAL, &value16) == SSCAN_OK) {
+		pArtNet4Params->nInputMinInterval = value16;
+		pArtNet4Params->nSetList |= ARTNET4_PARAMS_MASK_INPUT_MIN_INTERVAL;
+		return;
+	}
+}
+
+void baselineDisplayUdfParams(void *p, const char *pLine) {
+	struct TDisplayUdfParams *pDisplayUdfParams = (struct TDisplayUdfParams *) p;
+
+	assert(pLine != 0);
+	uint8_t value8;
+
+	if (Sscan::Uint8(pLine, DisplayUdfParamsConst::SLEEP_TIMEOUT, &value8) == SSCAN_OK) {
+		pDisplayUdfParams->nSleepTimeout = value8;
+		pDisplayUdfParams->nSetList |= DISPLAY_UDF_PARAMS_MASK_SLEEP_TIMEOUT;
+		return;
+	}
+
+	for (uint32_t i = 0; i < DISPLAY_UDF_LABEL_UNKNOWN; i++) {
+		if (Sscan::Uint8(pLine, pArray[i], &value8) == SSCAN_OK) {
+			pDisplayUdfParams->nLabelIndex[i] = value8;
+			pDisplayUdfParams->nSetList |= (1 << i);
+			return;
+		}
+	}
+}
+
+void baselineDmxGpioParams(void *p, const char *pLine) {
+	struct TBaselineDmxGpioParams *pDmxGpioParams = (struct TBaselineDmxGpioParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+
+	if (Sscan::Uint8(pLine, PARAMS_DATA_DIRECTION, &value8) == SSCAN_OK) {
+		if (value8 < 32) {
+			pDmxGpioParams->nDmxDataDirection = value8;
+			pDmxGpioParams->nSetList |= DATA_DIRECTION_MASK;
+		}
+		return;
+	}
+
+	for (unsigned i = 0; i < 4; i++) {
+		if (Sscan::Uint8(pLine, PARAMS_DATA_DIRECTION_OUT[i], &value8) == SSCAN_OK) {
+			pDmxGpioParams->nDmxDataDirectionOut[i] = value8;
+			pDmxGpioParams->nSetList |= (DATA_DIRECTION_OUT_A_MASK << i);
+			return;
+		}
+	}
+}
+
+void baselineDMXMonitorParams(void *p, const char *pLine) {
+	struct TDMXMonitorParams *pDMXMonitorParams = (struct TDMXMonitorParams *) p;
+
+	assert(pLine != 0);
+
+	uint16_t value16;
+	char value[8];
+	uint8_t len;
+
+	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &value16) == SSCAN_OK) {
+		if (value16 != 0 && value16 <= 512) {
+			pDMXMonitorParams->nDmxStartAddress = value16;
+			pDMXMonitorParams->nSetList |= SET_DMX_START_ADDRESS;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, DMXMonitorParamsConst::DMX_MAX_CHANNELS, &value16) == SSCAN_OK) {
+		if (value16 != 0 && value16 <= 512) {
+			pDMXMonitorParams->nDmxMaxChannels = value16;
+			pDMXMonitorParams->nSetList |= SET_DMX_MAX_CHANNELS;
+		}
+		return;
+	}
+
+	len = 3;
+	if (Sscan::Char(pLine, DMXMonitorParamsConst::FORMAT, value, &len) == SSCAN_OK) {
+		if (memcmp(value, "pct", 3) == 0) {
+			pDMXMonitorParams->tFormat = DMX_MONITOR_FORMAT_PCT;
+		} else if (memcmp(value, "dec", 3) == 0) {
+			pDMXMonitorParams->tFormat = DMX_MONITOR_FORMAT_DEC;
+		} else {
+			pDMXMonitorParams->tFormat = DMX_MONITOR_FORMAT_HEX;
+		}
+		pDMXMonitorParams->nSetList |= SET_FORMAT;
+		return;
+	}
+
+	len = DMX_MONITOR_RECORD_FILE_LENGTH - 1;
+	if (Sscan::Char(pLine, DMXMonitorParamsConst::RECORD, pDMXMonitorParams->aRecordFile, &len) == SSCAN_OK) {
+		pDMXMonitorParams->aRecordFile[len] = '\0';
+
+		if (len != 0) {
+			pDMXMonitorParams->nSetList |= SET_RECORD;
+		} else {
+			pDMXMonitorParams->nSetList &= ~SET_RECORD;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, DMXMonitorParamsConst::STATISTICS, &value16) == SSCAN_OK) {
+		pDMXMonitorParams->nStatisticsRefresh = value16;
+
+		if (value16 != 0) {
+			pDMXMonitorParams->nSetList |= SET_STATISTICS;
+		} else {
+			pDMXMonitorParams->nSetList &= ~SET_STATISTICS;
+		}
+		return;
+	}
+}
+
+void baselineDMXParams(void *p, const char *pLine) {
+	struct TDMXParams *pDMXParams = (struct TDMXParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+
+	if (Sscan::Uint8(pLine, DMXSendConst::PARAMS_BREAK_TIME, &value8) == SSCAN_OK) {
+		if ((value8 >= (uint8_t) DMX_PARAMS_MIN_BREAK_TIME) && (value8 <= (uint8_t) DMX_PARAMS_MAX_BREAK_TIME)) {
+			pDMXParams->nBreakTime = value8;
+			pDMXParams->nSetList |= DMX_SEND_PARAMS_MASK_BREAK_TIME;
+		}
+	} else if (Sscan::Uint8(pLine, DMXSendConst::PARAMS_MAB_TIME, &value8) == SSCAN_OK) {
+		if ((value8 >= (uint8_t) DMX_PARAMS_MIN_MAB_TIME) && (value8 <= (uint8_t) DMX_PARAMS_MAX_MAB_TIME)) {
+			pDMXParams->nMabTime = value8;
+			pDMXParams->nSetList |= DMX_SEND_PARAMS_MASK_MAB_TIME;
+		}
+	} else if (Sscan::Uint8(pLine, DMXSendConst::PARAMS_REFRESH_RATE, &value8) == SSCAN_OK) {
+		pDMXParams->nRefreshRate = value8;
+		pDMXParams->nSetList |= DMX_SEND_PARAMS_MASK_REFRESH_RATE;
+	}
+}
+
+void baselineE131Params(void *p, const char *pLine) {
+	struct TE131Params *pE131Params = (struct TE131Params *) p;
+
+	assert(pLine != 0);
+
+	char value[16];
+	uint8_t len;
+	uint8_t value8;
+	uint16_t value16;
+	float fValue;
+
+	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_UNIVERSE, &value16) == SSCAN_OK) {
+		if ((value16 == 0) || (value16 > E131_UNIVERSE_MAX)) {
+			pE131Params->nUniverse = E131_UNIVERSE_DEFAULT;
+		} else {
+			pE131Params->nUniverse = value16;
+		}
+		pE131Params->nSetList |= E131_PARAMS_MASK_UNIVERSE;
+		return;
+	}
+
+	len = 3;
+	if (Sscan::Char(pLine, E131ParamsConst::MERGE_MODE, value, &len) == SSCAN_OK) {
+		if (memcmp(value, "ltp", 3) == 0) {
+			pE131Params->nMergeMode = E131_MERGE_LTP;
+			pE131Params->nSetList |= E131_PARAMS_MASK_MERGE_MODE;
+		} else if (memcmp(value, "htp", 3) == 0) {
+			pE131Params->nMergeMode = E131_MERGE_HTP;
+			pE131Params->nSetList |= E131_PARAMS_MASK_MERGE_MODE;
+		}
+		return;
+	}
+
+	for (uint32_t i = 0; i < E131_PARAMS_MAX_PORTS; i++) {
+		if (Sscan::Uint16(pLine, E131ParamsConst::UNIVERSE_PORT[i], &value16) == SSCAN_OK) {
+			pE131Params->nUniversePort[i] = value16;
+			pE131Params->nSetList |= (E131_PARAMS_MASK_UNIVERSE_A << i);
+			return;
+		}
+
+		len = 3;
+		if (Sscan::Char(pLine, E131ParamsConst::MERGE_MODE_PORT[i], value, &len) == SSCAN_OK) {
+			if (memcmp(value, "ltp", 3) == 0) {
+				pE131Params->nMergeModePort[i] = E131_MERGE_LTP;
+				pE131Params->nSetList |= (E131_PARAMS_MASK_MERGE_MODE_A << i);
+			} else if (memcmp(value, "htp", 3) == 0) {
+				pE131Params->nMergeModePort[i] = E131_MERGE_HTP;
+				pE131Params->nSetList |= (E131_PARAMS_MASK_MERGE_MODE_A << i);
+			}
+			return;
+		}
+	}
+
+	if (Sscan::Float(pLine, E131ParamsConst::NETWORK_DATA_LOSS_TIMEOUT, &fValue) == SSCAN_OK) {
+		pE131Params->nNetworkTimeout = fValue;
+		pE131Params->nSetList |= E131_PARAMS_MASK_NETWORK_TIMEOUT;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, E131ParamsConst::DISABLE_MERGE_TIMEOUT, &value8) == SSCAN_OK) {
+		pE131Params->bDisableMergeTimeout = (value8 != 0);
+		pE131Params->nSetList |= E131_PARAMS_MASK_MERGE_TIMEOUT;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE, &value8) == SSCAN_OK) {
+		pE131Params->bEnableNoChangeUpdate = (value8 != 0);
+		pE131Params->nSetList |= E131_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT;
+		return;
+	}
+
+	len = 5;
+	if (Sscan::Char(pLine, E131ParamsConst::DIRECTION, value, &len) == SSCAN_OK) {
+		if (memcmp(value, "input", 5) == 0) {
+			pE131Params->nDirection = (uint8_t) E131_INPUT_PORT;
+			pE131Params->nSetList |= E131_PARAMS_MASK_DIRECTION;
+		}
+		return;
+	}
+
+	len = 6;
+	if (Sscan::Char(pLine, E131ParamsConst::DIRECTION, value, &len) == SSCAN_OK) {
+		if (memcmp(value, "output", 6) == 0) {
+			pE131Params->nDirection = (uint8_t) E131_OUTPUT_PORT;
+			pE131Params->nSetList |= E131_PARAMS_MASK_DIRECTION;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, E131ParamsConst::PRIORITY, &value8) == SSCAN_OK) {
+		if ((value8 >= E131_PRIORITY_LOWEST) && (value8 <= E131_PRIORITY_HIGHEST)) {
+			pE131Params->nPriority = value8;
+			pE131Params->nSetList |= E131_PARAMS_MASK_PRIORITY;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, E131ParamsConst::ENABLE_DISCOVERY, &value8) == SSCAN_OK) {
+		pE131Params->bEnableDiscovery = (value8 != 0);
+		pE131Params->nSetList |= E131_PARAMS_MASK_ENABLE_DISCOVERY;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, E131ParamsConst::DISCOVERY_JOIN, &value8) == SSCAN_OK) {
+		pE131Params->bDiscoveryJoin = (value8 != 0);
+		pE131Params->nSetList |= E131_PARAMS_MASK_DISCOVERY_JOIN;
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, E131ParamsConst::INPUT_MIN_INTERVAL, &value16) == SSCAN_OK) {
+		pE131Params->nInputMinInterval = value16;
+		pE131Params->nSetList |= E131_PARAMS_MASK_INPUT_MIN_INTERVAL;
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, E131ParamsConst::SYNCHRONIZATION_ADDRESS, &value16) == SSCAN_OK) {
+		if ((value16 != 0) && (value16 <= E131_UNIVERSE_MAX)) {
+			pE131Params->nSynchronizationAddress = value16;
+			pE131Params->nSetList |= E131_PARAMS_MASK_SYNCHRONIZATION_ADDRESS;
+		}
+		return;
+	}
+}
+
+void baselineL6470Params(void *p, const char *pLine) {
+	struct TL6470Params *pL6470Params = (struct TL6470Params *) p;
+
+	assert(pLine != 0);
+	uint8_t value8;
+
+	if (Sscan::Float(pLine, L6470ParamsConst::MIN_SPEED, &pL6470Params->fMinSpeed) == SSCAN_OK) {
+		pL6470Params->nSetList |= L6470_PARAMS_MASK_MIN_SPEED;
+		return;
+	}
+
+	if (Sscan::Float(pLine, L6470ParamsConst::MAX_SPEED, &pL6470Params->fMaxSpeed) == SSCAN_OK) {
+		pL6470Params->nSetList |= L6470_PARAMS_MASK_MAX_SPEED;
+		return;
+	}
+
+	if (Sscan::Float(pLine, L6470ParamsConst::ACC, &pL6470Params->fAcc) == SSCAN_OK) {
+		pL6470Params->nSetList |= L6470_PARAMS_MASK_ACC;
+		return;
+	}
+
+	if (Sscan::Float(pLine, L6470ParamsConst::DEC, &pL6470Params->fDec) == SSCAN_OK) {
+		pL6470Params->nSetList |= L6470_PARAMS_MASK_DEC;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, L6470ParamsConst::KVAL_HOLD, &value8) == SSCAN_OK) {
+		pL6470Params->nKvalHold = value8;
+		pL6470Params->nSetList |= L6470_PARAMS_MASK_KVAL_HOLD;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, L6470ParamsConst::KVAL_RUN, &value8) == SSCAN_OK) {
+		pL6470Params->nKvalRun = value8;
+		pL6470Params->nSetList |= L6470_PARAMS_MASK_KVAL_RUN;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, L6470ParamsConst::KVAL_ACC, &value8) == SSCAN_OK) {
+		pL6470Params->nKvalAcc = value8;
+		pL6470Params->nSetList |= L6470_PARAMS_MASK_KVAL_ACC;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, L6470ParamsConst::KVAL_DEC, &value8) == SSCAN_OK) {
+		pL6470Params->nKvalDec = value8;
+		pL6470Params->nSetList |= L6470_PARAMS_MASK_KVAL_DEC;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, L6470ParamsConst::MICRO_STEPS, &value8) == SSCAN_OK) {
+		pL6470Params->nMicroSteps = value8;
+		pL6470Params->nSetList |= L6470_PARAMS_MASK_MICRO_STEPS;
+		return;
+	}
+}
+
+void baselineLtcDisplayParams(void *p, const char *pLine) {
+	struct TLtcDisplayParams *pLtcDisplayParams = (struct TLtcDisplayParams *) p;
+
+	char buffer[16];
+	uint8_t value8;
+	uint32_t value32;
+	uint8_t len;
+
+	len = sizeof(buffer);
+
+	if (Sscan::Char(pLine, LtcDisplayParamsConst::MAX7219_TYPE, buffer, &len) == SSCAN_OK) {
+		if (strncasecmp(buffer, "7segment", len) == 0) {
+			pLtcDisplayParams->nMax7219Type = LTCDISPLAYMAX7219_TYPE_7SEGMENT;
+			pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_MAX7219_TYPE;
+		} else if (strncasecmp(buffer, "matrix", len) == 0) {
+			pLtcDisplayParams->nMax7219Type = LTCDISPLAYMAX7219_TYPE_MATRIX;
+			pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_MAX7219_TYPE;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcDisplayParamsConst::MAX7219_INTENSITY, &value8) == SSCAN_OK) {
+		if (value8 <= 0x0F) {
+			pLtcDisplayParams->nMax7219Intensity = value8;
+			pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_MAX7219_INTENSITY;
+		}
+		return;
+	}
+
+	if (Sscan::Char(pLine, LtcDisplayParamsConst::WS28XX_TYPE, buffer, &len) == SSCAN_OK) {
+		if (strncasecmp(buffer, "7segment", len) == 0) {
+			pLtcDisplayParams->nWS28xxType = LTCDISPLAYWS28XX_TYPE_7SEGMENT;
+			pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_TYPE;
+		} else if (strncasecmp(buffer, "matrix", len) == 0) {
+			pLtcDisplayParams->nWS28xxType = LTCDISPLAYWS28XX_TYPE_MATRIX;
+			pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_TYPE;
+		}
+		return;
+	}
+
+	len = 7;
+	if (Sscan::Char(pLine, DevicesParamsConst::LED_TYPE, buffer, &len) == SSCAN_OK) {
+		buffer[len] = '\0';
+		for (uint32_t i = 0; i < WS28XX_UNDEFINED; i++) {
+			if (strcasecmp(buffer, WS28xxConst::TYPES[i]) == 0) {
+				pLtcDisplayParams->nLedType = (TWS28XXType) i;
+				pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_LED_TYPE;
+				return;
+			}
+		}
+		return;
+	}
+
+	len = 3;
+	if (Sscan::Char(pLine, DevicesParamsConst::LED_RGB_MAPPING, buffer, &len) == SSCAN_OK) {
+		buffer[len] = '\0';
+		enum TRGBMapping tMapping;
+		if ((tMapping = RGBMapping::FromString(buffer)) != RGB_MAPPING_UNDEFINED) {
+			pLtcDisplayParams->nRgbMapping = (uint8_t) tMapping;
+			pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_RGB_MAPPING;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LtcDisplayParamsConst::WS28XX_INTENSITY, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pLtcDisplayParams->nWS28xxIntensity = value8;
+			pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_INTENSITY;
+		}
+		return;
+	}
+
+	len = 4;
+	if (Sscan::Char(pLine, LtcDisplayParamsConst::WS28XX_COLON_BLINK_MODE, buffer, &len) == SSCAN_OK) {
+		buffer[len] = '\0';
+		for (uint32_t i = 0; i < (sizeof(aColonBlinkMode) / sizeof(aColonBlinkMode[0])); i++) {
+			if (strcasecmp(buffer, aColonBlinkMode[i]) == 0) {
+				pLtcDisplayParams->nWS28xxColonBlinkMode = (TLtcDisplayWS28xxColonBlinkMode) i;
+				pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_WS28XX_COLON_BLINK_MODE;
+				return;
+			}
+		}
+		return;
+	}
+
+	for (uint32_t nIndex = 0; nIndex < LTCDISPLAYWS28XX_COLOUR_INDEX_LAST; nIndex++) {
+		if(Sscan::Hex24Uint32(pLine, LtcDisplayParamsConst::WS28XX_COLOUR[nIndex], &value32) == SSCAN_OK) {
+			pLtcDisplayParams->aWS28xxColour[nIndex] = value32;
+			pLtcDisplayParams->nSetList |= (LTCDISPLAY_PARAMS_MASK_WS28XX_COLOUR_INDEX << nIndex);
+			return;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, DevicesParamsConst::GLOBAL_BRIGHTNESS, &value8) == SSCAN_OK) {
+		pLtcDisplayParams->nGlobalBrightness = value8;
+		pLtcDisplayParams->nSetList |= LTCDISPLAY_PARAMS_MASK_GLOBAL_BRIGHTNESS;
+		return;
+	}
+}
+
+void baselineMidiParams(void *p, const char *pLine) {
+	struct TMidiParams *pMidiParams = (struct TMidiParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint32_t value32;
+
+	if (Sscan::Uint32(pLine, PARAMS_BAUDRATE, &value32) == SSCAN_OK) {
+		if (value32 == 0) {
+			pMidiParams->nBaudrate = MIDI_BAUDRATE_DEFAULT;
+			pMidiParams->nSetList |= SET_BAUDRATE;
+		} else if ((value32 >= 9600) && (value32 <= 115200)) {
+			pMidiParams->nBaudrate = value32;
+			pMidiParams->nSetList |= SET_BAUDRATE;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, PARAMS_ACTIVE_SENSE, &value8) == SSCAN_OK) {
+		pMidiParams->nActiveSense = !(value8 == 0);
+		pMidiParams->nSetList |= SET_ACTIVE_SENSE;
+		return;
+	}
+}
+
+void baselineModeParams(void *p, const char *pLine) {
+	struct TModeParams *pModeParams = (struct TModeParams *) p;
+
+	assert(pLine != 0);
+
+	float f;
+	char value[128];
+	uint8_t len;
+	uint8_t value8;
+	uint16_t value16;
+	uint32_t value32;
+
+	if (Sscan::Uint8(pLine, ModeParamsConst::DMX_MODE, &value8) == SSCAN_OK) {
+		if (value8 < L6470DMXMODE_UNDEFINED) {
+			pModeParams->nDmxMode = value8;
+			pModeParams->nSetList |= MODE_PARAMS_MASK_DMX_MODE;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &value16) == SSCAN_OK) {
+		if ((value16 != 0) && (value16 <= DMX_UNIVERSE_SIZE)) {
+			pModeParams->nDmxStartAddress = value16;
+			pModeParams->nSetList |= MODE_PARAMS_MASK_DMX_START_ADDRESS;
+		}
+		return;
+	}
+
+	len = sizeof(value) - 1;
+	if (Sscan::Char(pLine, LightSetConst::PARAMS_DMX_SLOT_INFO, value, &len) == SSCAN_OK) {
+		value[len] = '\0';
+		uint32_t nMask = 0;
+		DmxSlotInfo dmxSlotInfo(pModeParams->tLightSetSlotInfo, MODE_PARAMS_MAX_DMX_FOOTPRINT);
+		dmxSlotInfo.FromString(value, nMask);
+		pModeParams->nSetList |= (nMask << MODE_PARAMS_MASK_SLOT_INFO_SHIFT);
+	}
+
+	if (Sscan::Uint32(pLine, ModeParamsConst::MAX_STEPS, &value32) == SSCAN_OK) {
+		pModeParams->nMaxSteps = value32;
+		pModeParams->nSetList |= MODE_PARAMS_MASK_MAX_STEPS;
+		return;
+	}
+
+	len = 5; //  copy, reset
+	if (Sscan::Char(pLine, ModeParamsConst::SWITCH_ACT, value, &len) == SSCAN_OK) {
+		if (len == 4) {
+			if (memcmp(value, "copy", 4) == 0) {
+				pModeParams->tSwitchAction = L6470_ABSPOS_COPY;
+				pModeParams->nSetList |= MODE_PARAMS_MASK_SWITCH_ACT;
+				return;
+			}
+		}
+		if (len == 5) {
+			if (memcmp(value, "reset", 5) == 0) {
+				pModeParams->tSwitchAction = L6470_ABSPOS_RESET;
+				pModeParams->nSetList |= MODE_PARAMS_MASK_SWITCH_ACT;
+				return;
+			}
+		}
+	}
+
+	len = 7; //  reverse, forward
+	if (Sscan::Char(pLine, ModeParamsConst::SWITCH_DIR, value, &len) == SSCAN_OK) {
+		if (len != 7) {
+			return;
+		}
+		if (memcmp(value, "forward", 7) == 0) {
+			pModeParams->tSwitchDir = L6470_DIR_FWD;
+			pModeParams->nSetList |= MODE_PARAMS_MASK_SWITCH_DIR;
+			return;
+		}
+		if (memcmp(value, "reverse", 7) == 0) {
+			pModeParams->tSwitchDir = L6470_DIR_REV;
+			pModeParams->nSetList |= MODE_PARAMS_MASK_SWITCH_DIR;
+			return;
+		}
+	}
+
+	if (Sscan::Float(pLine, ModeParamsConst::SWITCH_SPS, &f) == SSCAN_OK) {
+		pModeParams->fSwitchStepsPerSec = f;
+		pModeParams->nSetList |= MODE_PARAMS_MASK_SWITCH_SPS;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ModeParamsConst::SWITCH, &value8) == SSCAN_OK) {
+		if (value8 == 0) {
+			pModeParams->bSwitch = false;
+			pModeParams->nSetList |= MODE_PARAMS_MASK_SWITCH;
+		}
+	}
+}
+
+void baselineMotorParams(void *p, const char *pLine) {
+	struct TMotorParams *pMotorParams = (struct TMotorParams *) p;
+
+	float f;
+
+	if (Sscan::Float(pLine, MotorParamsConst::STEP_ANGEL, &f) == SSCAN_OK) {
+		if (f != 0) {
+			pMotorParams->fStepAngel = f;
+			pMotorParams->nSetList |= MOTOR_PARAMS_MASK_STEP_ANGEL;
+		}
+		return;
+	}
+
+	if (Sscan::Float(pLine, MotorParamsConst::VOLTAGE, &f) == SSCAN_OK) {
+		pMotorParams->fVoltage = f;
+		pMotorParams->nSetList |= MOTOR_PARAMS_MASK_VOLTAGE;
+		return;
+	}
+
+	if (Sscan::Float(pLine, MotorParamsConst::CURRENT, &f) == SSCAN_OK) {
+		pMotorParams->fCurrent = f;
+		pMotorParams->nSetList |= MOTOR_PARAMS_MASK_CURRENT;
+		return;
+	}
+
+	if (Sscan::Float(pLine, MotorParamsConst::RESISTANCE, &f) == SSCAN_OK) {
+		pMotorParams->fResistance = f;
+		pMotorParams->nSetList |= MOTOR_PARAMS_MASK_RESISTANCE;
+		return;
+	}
+
+	if (Sscan::Float(pLine, MotorParamsConst::INDUCTANCE, &f) == SSCAN_OK) {
+		pMotorParams->fInductance = f;
+		pMotorParams->nSetList |= MOTOR_PARAMS_MASK_INDUCTANCE;
+		return;
+	}
+}
+
+void baselineNetworkParams(void *p, const char *pLine) {
+	struct TNetworkParams *pNetworkParams = (struct TNetworkParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint32_t value32;
+	uint8_t len;
+	float f;
+
+	if (Sscan::Uint8(pLine, NetworkConst::PARAMS_USE_DHCP, &value8) == SSCAN_OK) {
+		pNetworkParams->bIsDhcpUsed = !(value8 == 0);
+		pNetworkParams->nSetList |= NETWORK_PARAMS_MASK_DHCP;
+		return;
+	}
+
+	if (Sscan::IpAddress(pLine, NetworkConst::PARAMS_IP_ADDRESS, &value32) == SSCAN_OK) {
+		pNetworkParams->nLocalIp = value32;
+		pNetworkParams->nSetList |= NETWORK_PARAMS_MASK_IP_ADDRESS;
+		return;
+	}
+
+	if (Sscan::IpAddress(pLine, NetworkConst::PARAMS_NET_MASK, &value32) == SSCAN_OK) {
+		pNetworkParams->nNetmask = value32;
+		pNetworkParams->nSetList |= NETWORK_PARAMS_MASK_NET_MASK;
+		return;
+	}
+
+	if (Sscan::IpAddress(pLine, NetworkConst::PARAMS_DEFAULT_GATEWAY, &value32) == SSCAN_OK) {
+		pNetworkParams->nGatewayIp = value32;
+		pNetworkParams->nSetList |= NETWORK_PARAMS_MASK_DEFAULT_GATEWAY;
+		return;
+	}
+
+	len = NETWORK_HOSTNAME_SIZE - 1;
+	if (Sscan::Char(pLine, NetworkConst::PARAMS_HOSTNAME, (char *) pNetworkParams->aHostName, &len) == SSCAN_OK) {
+		pNetworkParams->aHostName[len] = '\0';
+		pNetworkParams->nSetList |= NETWORK_PARAMS_MASK_HOSTNAME;
+		return;
+	}
+
+#if !defined (H3)
+	if (Sscan::IpAddress(pLine, PARAMS_NAME_SERVER, &value32) == SSCAN_OK) {
+		pNetworkParams->nNameServerIp = value32;
+		pNetworkParams->nSetList |= NETWORK_PARAMS_MASK_NAME_SERVER;
+		return;
+	}
+#endif
+
+	if (Sscan::IpAddress(pLine, NetworkConst::PARAMS_NTP_SERVER, &value32) == SSCAN_OK) {
+		pNetworkParams->nNtpServerIp = value32;
+		pNetworkParams->nSetList |= NETWORK_PARAMS_MASK_NTP_SERVER;
+		return;
+	}
+
+	if (Sscan::Float(pLine, NetworkConst::PARAMS_NTP_UTC_OFFSET, &f) == SSCAN_OK) {
+		// https://en.wikipedia.org/wiki/List_of_UTC_time_offsets
+		if (((int32_t) f >= -12) && ((int32_t) f <= 14)) {
+			pNetworkParams->fNtpUtcOffset = f;
+			pNetworkParams->nSetList |= NETWORK_PARAMS_MASK_NTP_UTC_OFFSET;
+			return;
+		}
+	}
+}
+
+void baselineOscClientParams(void *p, const char *pLine) {
+	struct TOscClientParams *pOscClientParams = (struct TOscClientParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint16_t value16;
+	uint32_t value32;
+
+	if (Sscan::IpAddress(pLine, OscClientParamsConst::PARAMS_SERVER_IP, &value32) == SSCAN_OK) {
+		pOscClientParams->nServerIp = value32;
+		pOscClientParams->nSetList |= OSCCLIENT_PARAMS_MASK_SERVER_IP;
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, OscClientParamsConst::PARAMS_OUTGOING_PORT, &value16) == SSCAN_OK) {
+		if (value16 > 1023) {
+			pOscClientParams->nOutgoingPort = value16;
+			pOscClientParams->nSetList |= OSCCLIENT_PARAMS_MASK_OUTGOING_PORT;
+		} else {
+			pOscClientParams->nSetList &= ~OSCCLIENT_PARAMS_MASK_OUTGOING_PORT;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, OscClientParamsConst::PARAMS_INCOMING_PORT, &value16) == SSCAN_OK) {
+		if (value16 > 1023) {
+			pOscClientParams->nIncomingPort = value16;
+			pOscClientParams->nSetList |= OSCCLIENT_PARAMS_MASK_INCOMING_PORT;
+		} else {
+			pOscClientParams->nSetList &= ~OSCCLIENT_PARAMS_MASK_INCOMING_PORT;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, OscClientParamsConst::PARAMS_PING_DISABLE, &value8) == SSCAN_OK) {
+		pOscClientParams->nPingDisable = (value8 != 0);
+		pOscClientParams->nSetList |= OSCCLIENT_PARAMS_MASK_PING_DISABLE;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, OscClientParamsConst::PARAMS_PING_DELAY, &value8) == SSCAN_OK) {
+		if ((value8 >= 2) && (value8 <= 60)) {
+			pOscClientParams->nPingDelay = value8;
+			pOscClientParams->nSetList |= OSCCLIENT_PARAMS_MASK_PING_DELAY;
+		} else {
+			pOscClientParams->nSetList &= ~OSCCLIENT_PARAMS_MASK_PING_DELAY;
+		}
+		return;
+	}
+
+	for (uint32_t i = 0; i < OSCCLIENT_PARAMS_CMD_MAX_COUNT; i++) {
+		value8 = OSCCLIENT_PARAMS_CMD_MAX_PATH_LENGTH;
+		if (Sscan::Char(pLine, OscClientParamsConst::PARAMS_CMD[i], (char *)&pOscClientParams->aCmd[i], &value8) == SSCAN_OK) {
+			if (pOscClientParams->aCmd[i][0] == '/') {
+				pOscClientParams->nSetList |= OSCCLIENT_PARAMS_MASK_CMD;
+			} else {
+				pOscClientParams->aCmd[i][0] = '\0';
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < OSCCLIENT_PARAMS_LED_MAX_COUNT; i++) {
+		value8 = OSCCLIENT_PARAMS_LED_MAX_PATH_LENGTH;
+		if (Sscan::Char(pLine, OscClientParamsConst::PARAMS_LED[i], (char *)&pOscClientParams->aLed[i], &value8) == SSCAN_OK) {
+			if (pOscClientParams->aLed[i][0] == '/') {
+				pOscClientParams->nSetList |= OSCCLIENT_PARAMS_MASK_LED;
+			} else {
+				pOscClientParams->aLed[i][0] = '\0';
+			}
+		}
+	}
+}
+
+void baselineOSCServerParams(void *p, const char *pLine) {
+	struct TOSCServerParams *pOSCServerParams = (struct TOSCServerParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint16_t value16;
+	uint8_t len;
+
+	if (Sscan::Uint16(pLine, OSCServerConst::PARAMS_INCOMING_PORT, &value16) == SSCAN_OK) {
+		if (value16 > 1023) {
+			pOSCServerParams->nIncomingPort = value16;
+			pOSCServerParams->nSetList |= OSCSERVER_PARAMS_MASK_INCOMING_PORT;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, OSCServerConst::PARAMS_OUTGOING_PORT, &value16) == SSCAN_OK) {
+		if (value16 > 1023) {
+			pOSCServerParams->nOutgoingPort = value16;
+			pOSCServerParams->nSetList |= OSCSERVER_PARAMS_MASK_OUTGOING_PORT;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, OSCServerConst::PARAMS_TRANSMISSION, &value8) == SSCAN_OK) {
+		pOSCServerParams->bPartialTransmission = (value8 != 0);
+		pOSCServerParams->nSetList |= OSCSERVER_PARAMS_MASK_TRANSMISSION;
+		return;
+	}
+
+	len = sizeof(pOSCServerParams->aPath) - 1;
+	if (Sscan::Char(pLine, OSCServerConst::PARAMS_PATH, pOSCServerParams->aPath, &len) == SSCAN_OK) {
+		pOSCServerParams->nSetList |= OSCSERVER_PARAMS_MASK_PATH;
+		return;
+	}
+
+	len = sizeof(pOSCServerParams->aPathInfo) - 1;
+	if (Sscan::Char(pLine, OSCServerConst::PARAMS_PATH_INFO, pOSCServerParams->aPathInfo, &len) == SSCAN_OK) {
+		pOSCServerParams->nSetList |= OSCSERVER_PARAMS_MASK_PATH_INFO;
+		return;
+	}
+
+	len = sizeof(pOSCServerParams->aPathBlackOut) - 1;
+	if (Sscan::Char(pLine, OSCServerConst::PARAMS_PATH_BLACKOUT, pOSCServerParams->aPathBlackOut, &len) == SSCAN_OK) {
+		pOSCServerParams->nSetList |= OSCSERVER_PARAMS_MASK_PATH_BLACKOUT;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_ENABLE_NO_CHANGE_UPDATE, &value8) == SSCAN_OK) {
+		pOSCServerParams->bEnableNoChangeUpdate = (value8 != 0);
+		pOSCServerParams->nSetList |= OSCSERVER_PARAMS_MASK_ENABLE_NO_CHANGE_OUTPUT;
+		return;
+	}
+}
+
+void baselinePCA9685DmxLedParams(void *p, const char *pLine) {
+	struct TBaselinePCA9685DmxLedParams *pPCA9685DmxLedParams = (struct TBaselinePCA9685DmxLedParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint16_t value16;
+	float fValue;
+	uint8_t len;
+	char buffer[8];
+
+	if (Sscan::I2cAddress(pLine, PARAMS_I2C_SLAVE_ADDRESS, &value8) == SSCAN_OK) {
+		if ((value8 >= PCA9685_I2C_ADDRESS_DEFAULT) && (value8 != PCA9685_I2C_ADDRESS_FIXED)) {
+			pPCA9685DmxLedParams->nI2cAddress = value8;
+			pPCA9685DmxLedParams->bSetList |= LED_I2C_SLAVE_ADDRESS_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, PARAMS_PWM_FREQUENCY, &value16) == SSCAN_OK) {
+		if ((value16 >= PCA9685_FREQUENCY_MIN) && (value16 <= PCA9685_FREQUENCY_MAX)) {
+			pPCA9685DmxLedParams->nPwmFrequency = value16;
+			pPCA9685DmxLedParams->bSetList |= SET_PWM_FREQUENCY_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, PARAMS_OUTPUT_INVERT, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pPCA9685DmxLedParams->bOutputInvert = true;
+			pPCA9685DmxLedParams->bSetList |= SET_OUTPUT_INVERT_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, PARAMS_OUTPUT_DRIVER, &value8) == SSCAN_OK) {
+		if (value8 == 0) {
+			pPCA9685DmxLedParams->bOutputDriver = false;
+			pPCA9685DmxLedParams->bSetList |= SET_OUTPUT_DRIVER_MASK;
+		}
+		return;
+	}
+
+	len = 7;
+	if (Sscan::Char(pLine, LightSetConst::PARAMS_OUTPUT_CURVE, buffer, &len) == SSCAN_OK) {
+		buffer[len] = '\0';
+		const TOutputTransformCurve tCurve = OutputTransform::GetCurve(buffer);
+		if (tCurve != OUTPUT_TRANSFORM_CURVE_UNDEFINED) {
+			pPCA9685DmxLedParams->tOutputCurve = tCurve;
+			pPCA9685DmxLedParams->bSetList |= OUTPUT_CURVE_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::Float(pLine, LightSetConst::PARAMS_OUTPUT_GAMMA, &fValue) == SSCAN_OK) {
+		if ((fValue >= 1.0f) && (fValue <= 4.0f)) {
+			pPCA9685DmxLedParams->fOutputGamma = fValue;
+			pPCA9685DmxLedParams->bSetList |= OUTPUT_GAMMA_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_OUTPUT_16BIT, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pPCA9685DmxLedParams->bSetList |= OUTPUT_16BIT_MASK;
+		}
+		return;
+	}
+}
+
+void baselinePCA9685DmxParams(void *p, const char *pLine) {
+	struct TBaselinePCA9685DmxParams *pPCA9685DmxParams = (struct TBaselinePCA9685DmxParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint16_t value16;
+	uint8_t len;
+
+	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &value16) == SSCAN_OK) {
+		if ((value16 != 0) && (value16 <= DMX_UNIVERSE_SIZE)) {
+			pPCA9685DmxParams->nDmxStartAddress = value16;
+			pPCA9685DmxParams->bSetList |= DMX_START_ADDRESS_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, PARAMS_DMX_FOOTPRINT, &value16) == SSCAN_OK) {
+		if ((value16 != 0) && (value16 <= (PCA9685_PWM_CHANNELS * PARAMS_BOARD_INSTANCES_MAX))) {
+			pPCA9685DmxParams->nDmxFootprint = value16;
+			pPCA9685DmxParams->bSetList |= DMX_FOOTPRINT_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::I2cAddress(pLine, PARAMS_I2C_SLAVE_ADDRESS, &value8) == SSCAN_OK) {
+		if ((value8 >= PCA9685_I2C_ADDRESS_DEFAULT) && (value8 != PCA9685_I2C_ADDRESS_FIXED)) {
+			pPCA9685DmxParams->nI2cAddress = value8;
+			pPCA9685DmxParams->bSetList |= I2C_SLAVE_ADDRESS_MASK;
+		return;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, PARAMS_BOARD_INSTANCES, &value8) == SSCAN_OK) {
+		if ((value8 != 0) && (value8 <= PARAMS_BOARD_INSTANCES_MAX)) {
+			pPCA9685DmxParams->nBoardInstances = value8;
+			pPCA9685DmxParams->bSetList |= BOARD_INSTANCES_MASK;
+		}
+		return;
+	}
+
+	len = DMX_SLOT_INFO_LENGTH;
+	if (Sscan::Char(pLine, LightSetConst::PARAMS_DMX_SLOT_INFO, pPCA9685DmxParams->aDmxSlotInfoRaw, &len) == SSCAN_OK) {
+		if (len >= 7) { // 00:0000 at least one value set
+			pPCA9685DmxParams->bSetList |= DMX_SLOT_INFO_MASK;
+		}
+	}
+}
+
+void baselinePCA9685DmxServoParams(void *p, const char *pLine) {
+	struct TBaselinePCA9685DmxServoParams *pPCA9685DmxServoParams = (struct TBaselinePCA9685DmxServoParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint16_t value16;
+
+	if (Sscan::I2cAddress(pLine, PARAMS_I2C_SLAVE_ADDRESS, &value8) == SSCAN_OK) {
+		if ((value8 >= PCA9685_I2C_ADDRESS_DEFAULT) && (value8 != PCA9685_I2C_ADDRESS_FIXED)) {
+			pPCA9685DmxServoParams->nI2cAddress = value8;
+			pPCA9685DmxServoParams->bSetList |= SERVO_I2C_SLAVE_ADDRESS_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, PARAMS_LEFT_US, &value16) == SSCAN_OK) {
+		if ((value16 != 0) && (value16 < pPCA9685DmxServoParams->nRightUs)) {
+			pPCA9685DmxServoParams->nLeftUs = value16;
+			pPCA9685DmxServoParams->bSetList |= LEFT_US_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, PARAMS_RIGHT_US, &value16) == SSCAN_OK) {
+		if (value16 > pPCA9685DmxServoParams->nLeftUs) {
+			pPCA9685DmxServoParams->nRightUs = value16;
+			pPCA9685DmxServoParams->bSetList |= RIGHT_US_MASK;
+		}
+		return;
+	}
+}
+
+void baselineRDMDeviceParams(void *p, const char *pLine) {
+	struct TRDMDeviceParams *pRDMDeviceParams = (struct TRDMDeviceParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t len;
+	uint16_t uint16;
+
+	len = RDM_DEVICE_LABEL_MAX_LENGTH;
+	if (Sscan::Char(pLine, RDMDeviceParamsConst::LABEL, pRDMDeviceParams->aDeviceRootLabel, &len) == SSCAN_OK) {
+		pRDMDeviceParams->nDeviceRootLabelLength = len;
+		pRDMDeviceParams->nSetList |= RDMDEVICE_PARAMS_MASK_LABEL;
+		return;
+	}
+
+	if (Sscan::HexUint16(pLine, RDMDeviceParamsConst::PRODUCT_CATEGORY, &uint16) == SSCAN_OK) {
+		pRDMDeviceParams->nProductCategory = uint16;
+		pRDMDeviceParams->nSetList |= RDMDEVICE_PARAMS_MASK_PRODUCT_CATEGORY;
+		return;
+	}
+
+	if (Sscan::HexUint16(pLine, RDMDeviceParamsConst::PRODUCT_DETAIL, &uint16) == SSCAN_OK) {
+		pRDMDeviceParams->nProductDetail = uint16;
+		pRDMDeviceParams->nSetList |= RDMDEVICE_PARAMS_MASK_PRODUCT_DETAIL;
+	}
+}
+
+void baselineRemoteConfigParams(void *p, const char *pLine) {
+	struct TRemoteConfigParams *pRemoteConfigParams = (struct TRemoteConfigParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint8_t len;
+
+	if (Sscan::Uint8(pLine, RemoteConfigConst::PARAMS_DISABLE, &value8) == SSCAN_OK) {
+		pRemoteConfigParams->bDisabled = (value8 != 0);
+		pRemoteConfigParams->nSetList |= REMOTE_CONFIG_PARAMS_DISABLED;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, RemoteConfigConst::PARAMS_DISABLE_WRITE, &value8) == SSCAN_OK) {
+		pRemoteConfigParams->bDisableWrite = (value8 != 0);
+		pRemoteConfigParams->nSetList |= REMOTE_CONFIG_PARAMS_DISABLE_WRITE;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, RemoteConfigConst::PARAMS_ENABLE_REBOOT, &value8) == SSCAN_OK) {
+		pRemoteConfigParams->bEnableReboot = (value8 != 0);
+		pRemoteConfigParams->nSetList |= REMOTE_CONFIG_PARAMS_ENABLE_REBOOT;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, RemoteConfigConst::PARAMS_ENABLE_UPTIME, &value8) == SSCAN_OK) {
+		pRemoteConfigParams->bEnableUptime = (value8 != 0);
+		pRemoteConfigParams->nSetList |= REMOTE_CONFIG_PARAMS_ENABLE_UPTIME;
+		return;
+	}
+
+	len = REMOTE_CONFIG_DISPLAY_NAME_LENGTH - 1;
+	if (Sscan::Char(pLine, RemoteConfigConst::PARAMS_DISPLAY_NAME, (char *) pRemoteConfigParams->aDisplayName, &len) == SSCAN_OK) {
+		pRemoteConfigParams->aDisplayName[len] = '\0';
+		pRemoteConfigParams->nSetList |= REMOTE_CONFIG_PARAMS_DISPLAY_NAME;
+		return;
+	}
+}
+
+static void handleOptions(struct TShowFileParams *pShowFileParams, const char *pLine, const char *pKeyword, TShowFileOptions tShowFileOptions) {
+	uint8_t value8;
+
+	if (Sscan::Uint8(pLine, pKeyword, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pShowFileParams->nOptions |= (uint8_t) tShowFileOptions;
+			pShowFileParams->nSetList |= SHOWFILE_PARAMS_MASK_OPTIONS;
+		} else {
+			pShowFileParams->nOptions &= ~((uint8_t) tShowFileOptions);
+		}
+
+		if (pShowFileParams->nOptions == 0) {
+			pShowFileParams->nSetList &= ~SHOWFILE_PARAMS_MASK_OPTIONS;
+		}
+	}
+}
+
+void baselineShowFileParams(void *p, const char *pLine) {
+	struct TShowFileParams *pShowFileParams = (struct TShowFileParams *) p;
+
+	assert(pLine != 0);
+
+	char value[16];
+	uint8_t nLength;
+	uint8_t value8;
+	uint16_t value16;
+
+	nLength = SHOWFILECONST_FORMAT_NAME_LENGTH - 1;
+	if (Sscan::Char(pLine, ShowFileParamsConst::FORMAT, value, &nLength) == SSCAN_OK) {
+		value[nLength] = '\0';
+
+		TShowFileFormats tFormat = ShowFile::GetFormat(value);
+
+		if (tFormat != SHOWFILE_FORMAT_UNDEFINED) {
+			pShowFileParams->nFormat = tFormat;
+			pShowFileParams->nSetList |= SHOWFILE_PARAMS_MASK_FORMAT;
+		} else {
+			pShowFileParams->nFormat = SHOWFILE_FORMAT_OLA;
+			pShowFileParams->nSetList &= ~SHOWFILE_PARAMS_MASK_FORMAT;
+		}
+
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, OscConst::PARAMS_INCOMING_PORT, &value16) == SSCAN_OK) {
+		if (value16 > 1023) {
+			pShowFileParams->nOscPortIncoming = value16;
+			pShowFileParams->nSetList |= SHOWFILE_PARAMS_MASK_OSC_PORT_INCOMING;
+		} else {
+			pShowFileParams->nOscPortIncoming = OSCSERVER_PORT_DEFAULT_INCOMING;
+			pShowFileParams->nSetList &= ~SHOWFILE_PARAMS_MASK_OSC_PORT_INCOMING;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, OscConst::PARAMS_OUTGOING_PORT, &value16) == SSCAN_OK) {
+		if (value16 > 1023) {
+			pShowFileParams->nOscPortOutgoing = value16;
+			pShowFileParams->nSetList |= SHOWFILE_PARAMS_MASK_OSC_PORT_OUTGOING;
+		} else {
+			pShowFileParams->nOscPortOutgoing = OSCSERVER_PORT_DEFAULT_OUTGOING;
+			pShowFileParams->nSetList &= ~SHOWFILE_PARAMS_MASK_OSC_PORT_OUTGOING;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ShowFileParamsConst::SHOW, &value8) == SSCAN_OK) {
+		if (value8 < SHOWFILE_FILE_MAX_NUMBER) {
+			pShowFileParams->nShow = value8;
+			pShowFileParams->nSetList |= SHOWFILE_PARAMS_MASK_SHOW;
+		} else {
+			pShowFileParams->nShow = 0;
+			pShowFileParams->nSetList &= ~SHOWFILE_PARAMS_MASK_SHOW;
+		}
+		return;
+	}
+
+	nLength = 6;
+	if (Sscan::Char(pLine, ShowFileParamsConst::PROTOCOL, value, &nLength) == SSCAN_OK) {
+		value[nLength] = '\0';
+
+		if(strcasecmp(value, "artnet") == 0) {
+			pShowFileParams->nProtocol = SHOWFILE_PROTOCOL_ARTNET;
+			pShowFileParams->nSetList |= SHOWFILE_PARAMS_MASK_PROTOCOL;
+		} else {
+			pShowFileParams->nProtocol = SHOWFILE_PROTOCOL_SACN;
+			pShowFileParams->nSetList &= SHOWFILE_PARAMS_MASK_PROTOCOL;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, ShowFileParamsConst::SACN_SYNC_UNIVERSE, &value16) == SSCAN_OK) {
+		if (value16 > E131_UNIVERSE_MAX) {
+			pShowFileParams->nUniverse = DEFAULT_SYNCHRONIZATION_ADDRESS;
+			pShowFileParams->nSetList &= ~SHOWFILE_PARAMS_MASK_SACN_UNIVERSE;
+		} else {
+			pShowFileParams->nUniverse = value16;
+			pShowFileParams->nSetList |= SHOWFILE_PARAMS_MASK_SACN_UNIVERSE;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, ShowFileParamsConst::ARTNET_DISABLE_UNICAST, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pShowFileParams->nDisableUnicast = 1;
+			pShowFileParams->nSetList |= SHOWFILE_PARAMS_MASK_ARTNET_UNICAST;
+		} else {
+			pShowFileParams->nDisableUnicast = 0;
+			pShowFileParams->nSetList &= ~SHOWFILE_PARAMS_MASK_ARTNET_UNICAST;
+		}
+		return;
+	}
+
+	handleOptions(pShowFileParams, pLine, ShowFileParamsConst::OPTION_AUTO_START, SHOWFILE_OPTION_AUTO_START);
+	handleOptions(pShowFileParams, pLine, ShowFileParamsConst::OPTION_LOOP, SHOWFILE_OPTION_LOOP);
+}
+
+void baselineSlushDmxParams(void *p, const char *pLine) {
+	struct TSlushDmxParams *pSlushDmxParams = (struct TSlushDmxParams *) p;
+
+	uint8_t value;
+	uint16_t value16;
+
+	if (Sscan::Uint8(pLine, SlushDmxParamsConst::USE_SPI, &value) == SSCAN_OK) {
+		if (value != 0) {
+			pSlushDmxParams->nUseSpiBusy = 1;
+			pSlushDmxParams->nSetList |= SLUSH_DMX_PARAMS_MASK_USE_SPI_BUSY;
+			return;
+		}
+	}
+
+	if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_START_ADDRESS_PORT_A, &value16) == SSCAN_OK) {
+		if (value16 <= DMX_UNIVERSE_SIZE) {
+			pSlushDmxParams->nDmxStartAddressPortA = value16;
+			pSlushDmxParams->nSetList |= SLUSH_DMX_PARAMS_MASK_START_ADDRESS_PORT_A;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_START_ADDRESS_PORT_B, &value16) == SSCAN_OK) {
+		if (value16 <= DMX_UNIVERSE_SIZE) {
+			pSlushDmxParams->nDmxStartAddressPortB = value16;
+			pSlushDmxParams->nSetList |= SLUSH_DMX_PARAMS_MASK_START_ADDRESS_PORT_B;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_FOOTPRINT_PORT_A, &value16) == SSCAN_OK) {
+		if ((value16 > 0) && (value16 <= IO_PINS_IOPORT)) {
+			pSlushDmxParams->nDmxFootprintPortA = value16;
+			pSlushDmxParams->nSetList |= SLUSH_DMX_PARAMS_MASK_FOOTPRINT_PORT_A;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, SlushDmxParamsConst::DMX_FOOTPRINT_PORT_B, &value16) == SSCAN_OK) {
+		if ((value16 > 0) && (value16 <= IO_PINS_IOPORT)) {
+			pSlushDmxParams->nDmxFootprintPortB = value16;
+			pSlushDmxParams->nSetList |= SLUSH_DMX_PARAMS_MASK_FOOTPRINT_PORT_B;
+		}
+		return;
+	}
+}
+
+void baselineSparkFunDmxParams(void *p, const char *pLine) {
+	struct TSparkFunDmxParams *pSparkFunDmxParams = (struct TSparkFunDmxParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+
+	if (Sscan::Uint8(pLine, SparkFunDmxParamsConst::POSITION, &value8) == SSCAN_OK) {
+		if (value8 < SPARKFUN_DMX_MAX_MOTORS) {
+			pSparkFunDmxParams->nPosition = value8;
+			pSparkFunDmxParams->nSetList |= SPARKFUN_DMX_PARAMS_MASK_POSITION;
+		}
+		return;
+	}
+
+#if !defined (H3)
+	if (Sscan::Uint8(pLine, SparkFunDmxParamsConst::SPI_CS, &value8) == SSCAN_OK) {
+		pSparkFunDmxParams->nSpiCs = value8;
+		pSparkFunDmxParams->nSetList |= SPARKFUN_DMX_PARAMS_MASK_SPI_CS;
+		return;
+	}
+#endif
+
+	if (Sscan::Uint8(pLine, SparkFunDmxParamsConst::RESET_PIN, &value8) == SSCAN_OK) {
+		pSparkFunDmxParams->nResetPin = value8;
+		pSparkFunDmxParams->nSetList |= SPARKFUN_DMX_PARAMS_MASK_RESET_PIN;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, SparkFunDmxParamsConst::BUSY_PIN, &value8) == SSCAN_OK) {
+		pSparkFunDmxParams->nBusyPin = value8;
+		pSparkFunDmxParams->nSetList |= SPARKFUN_DMX_PARAMS_MASK_BUSY_PIN;
+		return;
+	}
+}
+
+void baselineSpiFlashInstallParams(void *p, const char *pLine) {
+	struct TBaselineSpiFlashInstallParams *pSpiFlashInstallParams = (struct TBaselineSpiFlashInstallParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+
+	if (Sscan::Uint8(pLine, PARAMS_INSTALL_UBOOT, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pSpiFlashInstallParams->bInstalluboot = true;
+			pSpiFlashInstallParams->nSetList |= INSTALL_UBOOT_MASK;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, PARAMS_INSTALL_UIMAGE, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pSpiFlashInstallParams->bInstalluImage = true;
+			pSpiFlashInstallParams->nSetList |= INSTALL_UIMAGE_MASK;
+		}
+		return;
+	}
+}
+
+void baselineTCNetParams(void *p, const char *pLine) {
+	struct TTCNetParams *pTCNetParams = (struct TTCNetParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t len;
+	char ch;
+	uint8_t uint8;
+
+	len = TCNET_NODE_NAME_LENGTH;
+	if (Sscan::Char(pLine, TCNetParamsConst::NODE_NAME, (char *) pTCNetParams->aNodeName, &len) == SSCAN_OK) {
+		pTCNetParams->nSetList |= TCNET_PARAMS_MASK_NODE_NAME;
+		return;
+	}
+
+	len = 1;
+	ch = ' ';
+	if (Sscan::Char(pLine, TCNetParamsConst::LAYER, &ch, &len) == SSCAN_OK) {
+		pTCNetParams->nLayer = (uint8_t) TCNet::GetLayer((uint8_t) ch);
+
+		if (pTCNetParams->nLayer != TCNET_LAYER_UNDEFINED) {
+			pTCNetParams->nSetList |= TCNET_PARAMS_MASK_LAYER;
+		} else {
+			pTCNetParams->nLayer = TCNET_LAYER_M;
+			pTCNetParams->nSetList &= ~TCNET_PARAMS_MASK_LAYER;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, TCNetParamsConst::TIMECODE_TYPE, &uint8) == SSCAN_OK) {
+		switch (uint8) {
+		case 24:
+			pTCNetParams->nTimeCodeType = TCNET_TIMECODE_TYPE_FILM;
+			pTCNetParams->nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
+			break;
+		case 25:
+			pTCNetParams->nTimeCodeType = TCNET_TIMECODE_TYPE_EBU_25FPS;
+			pTCNetParams->nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
+			break;
+		case 29:
+			pTCNetParams->nTimeCodeType = TCNET_TIMECODE_TYPE_DF;
+			pTCNetParams->nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
+			break;
+		case 30:
+			pTCNetParams->nTimeCodeType = TCNET_TIMECODE_TYPE_SMPTE_30FPS;
+			pTCNetParams->nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
+			break;
+		default:
+			pTCNetParams->nSetList &= ~TCNET_PARAMS_MASK_TIMECODE_TYPE;
+			break;
+		}
+
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, TCNetParamsConst::USE_TIMECODE, &uint8) == SSCAN_OK) {
+		if (uint8 != 0) {
+			pTCNetParams->nUseTimeCode = 1;
+			pTCNetParams->nSetList |= TCNET_PARAMS_MASK_USE_TIMECODE;
+		} else {
+			pTCNetParams->nUseTimeCode = 0;
+			pTCNetParams->nSetList &= ~TCNET_PARAMS_MASK_USE_TIMECODE;
+		}
+
+		return;
+	}
+}
+
+void baselineTLC59711DmxParams(void *p, const char *pLine) {
+	struct TTLC59711DmxParams *pTLC59711Params = (struct TTLC59711DmxParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+	uint16_t value16;
+	uint32_t value32;
+	float fValue;
+	uint8_t len;
+	char buffer[12];
+
+	len = 9;
+	if (Sscan::Char(pLine, DevicesParamsConst::LED_TYPE, buffer, &len) == SSCAN_OK) {
+		buffer[len] = '\0';
+		if (strcasecmp(buffer, sLedTypes[TTLC59711_TYPE_RGB]) == 0) {
+			pTLC59711Params->LedType = TTLC59711_TYPE_RGB;
+			pTLC59711Params->nSetList |= TLC59711DMX_PARAMS_MASK_LED_TYPE;
+		} else if (strcasecmp(buffer, sLedTypes[TTLC59711_TYPE_RGBW]) == 0) {
+			pTLC59711Params->LedType = TTLC59711_TYPE_RGBW;
+			pTLC59711Params->nSetList |= TLC59711DMX_PARAMS_MASK_LED_TYPE;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, DevicesParamsConst::LED_COUNT, &value8) == SSCAN_OK) {
+		if ((value8 != 0) && (value8 <= 170)) {
+			pTLC59711Params->nLedCount = value8;
+			pTLC59711Params->nSetList |= TLC59711DMX_PARAMS_MASK_LED_COUNT;
+		}
+		return;
+	}
+
+	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &value16) == SSCAN_OK) {
+		if ((value16 != 0) && (value16 <= DMX_UNIVERSE_SIZE)) {
+			pTLC59711Params->nDmxStartAddress = value16;
+			pTLC59711Params->nSetList |= TLC59711DMX_PARAMS_MASK_START_ADDRESS;
+		}
+		return;
+	}
+
+	if (Sscan::Uint32(pLine, DevicesParamsConst::SPI_SPEED_HZ, &value32) == SSCAN_OK) {
+		pTLC59711Params->nSpiSpeedHz = value32;
+		pTLC59711Params->nSetList |= TLC59711DMX_PARAMS_MASK_SPI_SPEED;
+		return;
+	}
+
+	len = 7;
+	if (Sscan::Char(pLine, LightSetConst::PARAMS_OUTPUT_CURVE, buffer, &len) == SSCAN_OK) {
+		buffer[len] = '\0';
+		const TOutputTransformCurve tCurve = OutputTransform::GetCurve(buffer);
+		if (tCurve != OUTPUT_TRANSFORM_CURVE_UNDEFINED) {
+			pTLC59711Params->nOutputCurve = (uint8_t) tCurve;
+			pTLC59711Params->nSetList |= TLC59711DMX_PARAMS_MASK_OUTPUT_CURVE;
+		}
+		return;
+	}
+
+	if (Sscan::Float(pLine, LightSetConst::PARAMS_OUTPUT_GAMMA, &fValue) == SSCAN_OK) {
+		if ((fValue >= 1.0f) && (fValue <= 4.0f)) {
+			pTLC59711Params->fOutputGamma = fValue;
+			pTLC59711Params->nSetList |= TLC59711DMX_PARAMS_MASK_OUTPUT_GAMMA;
+		}
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, LightSetConst::PARAMS_OUTPUT_16BIT, &value8) == SSCAN_OK) {
+		if (value8 != 0) {
+			pTLC59711Params->bOutput16Bit = true;
+			pTLC59711Params->nSetList |= TLC59711DMX_PARAMS_MASK_OUTPUT_16BIT;
+		} else {
+			pTLC59711Params->bOutput16Bit = false;
+			pTLC59711Params->nSetList &= ~TLC59711DMX_PARAMS_MASK_OUTPUT_16BIT;
+		}
+	}
+}
+
+void baselineWidgetParams(void *p, const char *pLine) {
+	struct TWidgetParams *pWidgetParams = (struct TWidgetParams *) p;
+
+	assert(pLine != 0);
+
+	uint8_t value8;
+
+	if (Sscan::Uint8(pLine, DMXUSBPRO_PARAMS_BREAK_TIME, &value8) == SSCAN_OK) {
+		if ((value8 >= (uint8_t) WIDGET_MIN_BREAK_TIME) && (value8 <= (uint8_t) WIDGET_MAX_BREAK_TIME)) {
+			pWidgetParams->nBreakTime = value8;
+			pWidgetParams->nSetList |= WIDGET_PARAMS_MASK_BREAK_TIME;
+			return;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, DMXUSBPRO_PARAMS_MAB_TIME, &value8) == SSCAN_OK) {
+		if ((value8 >= (uint8_t) WIDGET_MIN_MAB_TIME) && (value8 <= (uint8_t) WIDGET_MAX_MAB_TIME)) {
+			pWidgetParams->nMabTime = value8;
+			pWidgetParams->nSetList |= WIDGET_PARAMS_MASK_MAB_TIME;
+			return;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, DMXUSBPRO_PARAMS_REFRESH_RATE, &value8) == SSCAN_OK) {
+		pWidgetParams->nRefreshRate = value8;
+		pWidgetParams->nSetList |= WIDGET_PARAMS_MASK_REFRESH_RATE;
+		return;
+	}
+
+	if (Sscan::Uint8(pLine, PARAMS_WIDGET_MODE, &value8) == SSCAN_OK) {
+		if (value8 <= (uint8_t) WIDGET_MODE_RDM_SNIFFER) {
+			pWidgetParams->tMode = (TWidgetMode) value8;
+			pWidgetParams->nSetList |= WIDGET_PARAMS_MASK_MODE;
+			return;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, PARAMS_DMX_SEND_TO_HOST_THROTTLE, &value8) == SSCAN_OK) {
+		pWidgetParams->nThrottle = value8;
+		pWidgetParams->nSetList |= WIDGET_PARAMS_MASK_THROTTLE;
+		return;
+	}
+
+}
@@ -0,0 +1,111 @@
+/**
+ * @file baseline.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef BASELINE_H_
+#define BASELINE_H_
+
+#include <stdint.h>
+
+#include "dmx.h"
+#include "outputtransform.h"
+
+/*
+ * The classes without a params struct
+ */
+
+#define BASELINE_DMX_SLOT_INFO_LENGTH	128
+
+struct TBaselineDmxGpioParams {
+	uint32_t nSetList;
+	uint8_t nDmxDataDirection;
+	uint8_t nDmxDataDirectionOut[DMX_MAX_OUT];
+};
+
+struct TBaselinePCA9685DmxParams {
+	uint32_t bSetList;
+	uint8_t nI2cAddress;
+	uint16_t nDmxStartAddress;
+	uint16_t nDmxFootprint;
+	uint8_t nBoardInstances;
+	char aDmxSlotInfoRaw[BASELINE_DMX_SLOT_INFO_LENGTH];
+};
+
+struct TBaselinePCA9685DmxLedParams {
+	uint32_t bSetList;
+	uint8_t nI2cAddress;
+	uint16_t nPwmFrequency;
+	bool bOutputInvert;
+	bool bOutputDriver;
+	float fOutputGamma;
+	TOutputTransformCurve tOutputCurve;
+};
+
+struct TBaselinePCA9685DmxServoParams {
+	uint32_t bSetList;
+	uint8_t nI2cAddress;
+	uint16_t nLeftUs;
+	uint16_t nRightUs;
+};
+
+struct TBaselineSpiFlashInstallParams {
+	uint32_t nSetList;
+	bool bInstalluboot;
+	bool bInstalluImage;
+};
+
+/*
+ * ReadConfigFile callbacks, p is the params struct or the TBaseline struct of the class
+ */
+void baselineArtNetParams(void *p, const char *pLine);
+void baselineLtcParams(void *p, const char *pLine);
+void baselineWS28xxDmxParams(void *p, const char *pLine);
+void baselineArtNet4Params(void *p, const char *pLine);
+void baselineDisplayUdfParams(void *p, const char *pLine);
+void baselineDmxGpioParams(void *p, const char *pLine);
+void baselineDMXMonitorParams(void *p, const char *pLine);
+void baselineDMXParams(void *p, const char *pLine);
+void baselineE131Params(void *p, const char *pLine);
+void baselineL6470Params(void *p, const char *pLine);
+void baselineLtcDisplayParams(void *p, const char *pLine);
+void baselineMidiParams(void *p, const char *pLine);
+void baselineModeParams(void *p, const char *pLine);
+void baselineMotorParams(void *p, const char *pLine);
+void baselineNetworkParams(void *p, const char *pLine);
+void baselineOscClientParams(void *p, const char *pLine);
+void baselineOSCServerParams(void *p, const char *pLine);
+void baselinePCA9685DmxLedParams(void *p, const char *pLine);
+void baselinePCA9685DmxParams(void *p, const char *pLine);
+void baselinePCA9685DmxServoParams(void *p, const char *pLine);
+void baselineRDMDeviceParams(void *p, const char *pLine);
+void baselineRemoteConfigParams(void *p, const char *pLine);
+void baselineShowFileParams(void *p, const char *pLine);
+void baselineSlushDmxParams(void *p, const char *pLine);
+void baselineSparkFunDmxParams(void *p, const char *pLine);
+void baselineSpiFlashInstallParams(void *p, const char *pLine);
+void baselineTCNetParams(void *p, const char *pLine);
+void baselineTLC59711DmxParams(void *p, const char *pLine);
+void baselineWidgetParams(void *p, const char *pLine);
+
+#endif /* BASELINE_H_ */
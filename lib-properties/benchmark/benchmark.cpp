@@ -0,0 +1,758 @@
+/**
+ * @file benchmark.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "artnetparams.h"
+#include "artnetparamsconst.h"
+#include "artnet4params.h"
+#include "displayudfparams.h"
+#include "displayudfparamsconst.h"
+#include "dmxgpioparams.h"
+#include "dmxmonitorparams.h"
+#include "dmxmonitorparamsconst.h"
+#include "dmxparams.h"
+#include "dmxsendconst.h"
+#include "e131params.h"
+#include "e131paramsconst.h"
+#include "l6470params.h"
+#include "ltcdisplayparams.h"
+#include "ltcdisplayparamsconst.h"
+#include "ltcparams.h"
+#include "ltcparamsconst.h"
+#include "midiparams.h"
+#include "modeparams.h"
+#include "motorparams.h"
+#include "networkparams.h"
+#include "networkconst.h"
+#include "oscclientparams.h"
+#include "oscclientparamsconst.h"
+#include "oscserverparms.h"
+#include "oscserverconst.h"
+#include "pca9685dmxparams.h"
+#include "pca9685dmxledparams.h"
+#include "pca9685dmxservoparams.h"
+#include "rdmdeviceparams.h"
+#include "rdmdeviceparamsconst.h"
+#include "remoteconfigparams.h"
+#include "remoteconfigconst.h"
+#include "showfileparams.h"
+#include "showfileparamsconst.h"
+#include "slushdmxparams.h"
+#include "slushdmxparamsconst.h"
+#include "sparkfundmxparams.h"
+#include "sparkfundmxparamsconst.h"
+#include "spiflashinstallparams.h"
+#include "tcnetparams.h"
+#include "tcnetparamsconst.h"
+#include "tlc59711dmxparams.h"
+#include "widgetparams.h"
+#include "ws28xxdmxparams.h"
+#include "devicesparamsconst.h"
+#include "lightsetconst.h"
+
+#include "readconfigfile.h"
+
+#include "baseline.h"
+
+static const char s_aHeader[] = "#\n";
+
+static const char s_aArtNet[] =
+	"#artnet.txt\n"
+	"net=0\n"
+	"subnet=0\n"
+	"universe=1\n"
+	"universe_port_a=1\n"
+	"universe_port_b=2\n"
+	"universe_port_c=3\n"
+	"universe_port_d=4\n"
+	"merge_mode=htp\n"
+	"merge_mode_port_a=ltp\n"
+	"merge_mode_port_d=htp\n"
+	"protocol=artnet\n"
+	"protocol_port_a=sacn\n"
+	"protocol_port_d=artnet\n"
+	"short_name=Orange Pi Zero\n"
+	"long_name=Orange Pi Zero Art-Net 4 Node\n"
+	"oem_value=0x00FF\n"
+	"network_data_loss_timeout=10\n"
+	"disable_merge_timeout=0\n"
+	"enable_no_change_update=0\n"
+	"direction=output\n"
+	"destination_ip=192.168.2.100\n"
+	"use_timecode=0\n"
+	"use_timesync=0\n"
+	"enable_rdm=1\n"
+	"rdm_discovery_at_startup=1\n"
+	"universe_port_b=not_a_number\n"
+	"unknown_key=1\n";
+
+static const char s_aArtNet4[] =
+	"#artnet.txt\n"
+	"universe_port_a=1\n"
+	"map_universe0=1\n"
+	"input_artsync=1\n"
+	"input_min_interval=25\n"
+	"short_name=Orange Pi Zero\n";
+
+static const char s_aDisplayUdf[] =
+	"#display.txt\n"
+	"sleep_timeout=5\n"
+	"title=1\n"
+	"board_name=2\n"
+	"ip_address=3\n"
+	"version=4\n"
+	"universe=5\n"
+	"active_ports=6\n"
+	"short_name=0\n"
+	"hostname=0\n"
+	"universe_port_a=0\n"
+	"universe_port_b=0\n"
+	"universe_port_c=0\n"
+	"universe_port_d=0\n"
+	"net_mask=0\n"
+	"dmx_start_address=0\n"
+	"destination_ip=0\n";
+
+static const char s_aDmxGpio[] =
+	"#gpio.txt\n"
+	"data_direction=18\n"
+	"data_direction_out_a=22\n"
+	"data_direction_out_b=23\n"
+	"data_direction_out_c=24\n"
+	"data_direction_out_d=25\n"
+	"data_direction=40\n";
+
+static const char s_aDMXMonitor[] =
+	"#mon.txt\n"
+	"dmx_start_address=1\n"
+	"dmx_max_channels=512\n"
+	"format=pct\n"
+	"record=record.txt\n"
+	"statistics=10\n"
+	"dmx_max_channels=513\n";
+
+static const char s_aDMXSend[] =
+	"#params.txt\n"
+	"dmxsend_break_time=176\n"
+	"dmxsend_mab_time=12\n"
+	"dmxsend_refresh_rate=40\n"
+	"dmxsend_break_time=0\n";
+
+static const char s_aE131[] =
+	"#e131.txt\n"
+	"universe=1\n"
+	"universe_port_a=1\n"
+	"universe_port_b=2\n"
+	"universe_port_c=3\n"
+	"universe_port_d=4\n"
+	"merge_mode=htp\n"
+	"merge_mode_port_a=ltp\n"
+	"merge_mode_port_d=htp\n"
+	"network_data_loss_timeout=10\n"
+	"disable_merge_timeout=0\n"
+	"enable_no_change_update=0\n"
+	"direction=output\n"
+	"priority=100\n"
+	"enable_discovery=1\n"
+	"discovery_join=1\n"
+	"input_min_interval=25\n"
+	"synchronization_address=5000\n"
+	"priority=201\n"
+	"unknown_key=1\n";
+
+static const char s_aL6470[] =
+	"#motor0.txt\n"
+	"l6470_min_speed=0\n"
+	"l6470_max_speed=800.5\n"
+	"l6470_acc=200\n"
+	"l6470_dec=200\n"
+	"l6470_kval_hold=40\n"
+	"l6470_kval_run=40\n"
+	"l6470_kval_acc=40\n"
+	"l6470_kval_dec=40\n"
+	"l6470_micro_steps=16\n";
+
+static const char s_aLtcDisplay[] =
+	"#ldisplay.txt\n"
+	"max7219_type=matrix\n"
+	"max7219_intensity=4\n"
+	"ws28xx_type=7segment\n"
+	"led_type=WS2812B\n"
+	"led_rgb_mapping=GRB\n"
+	"ws28xx_intensity=128\n"
+	"ws28xx_colon_blink_mode=down\n"
+	"ws28xx_colour_segment=ff0000\n"
+	"ws28xx_colour_colon=00ff00\n"
+	"ws28xx_colour_message=0000ff\n"
+	"global_brightness=255\n"
+	"max7219_intensity=16\n";
+
+static const char s_aLtc[] =
+	"#ltc.txt\n"
+	"source=ltc\n"
+	"auto_start=0\n"
+	"disable_display=0\n"
+	"disable_max7219=0\n"
+	"disable_midi=0\n"
+	"disable_artnet=0\n"
+	"disable_tcnet=0\n"
+	"disable_ltc=0\n"
+	"disable_rtpmidi=1\n"
+	"show_systime=0\n"
+	"disable_timesync=0\n"
+	"year=20\n"
+	"month=3\n"
+	"day=14\n"
+	"ntp_enable=0\n"
+	"fps=25\n"
+	"start_frame=0\n"
+	"start_second=0\n"
+	"start_minute=0\n"
+	"start_hour=0\n"
+	"stop_frame=24\n"
+	"stop_second=59\n"
+	"stop_minute=59\n"
+	"stop_hour=23\n"
+	"osc_enable=0\n"
+	"osc_port=8000\n"
+	"ws28xx_enable=0\n"
+	"fps=31\n";
+
+static const char s_aMidi[] =
+	"#midi.txt\n"
+	"baudrate=31250\n"
+	"active_sense=1\n"
+	"baudrate=300\n";
+
+static const char s_aMode[] =
+	"#motor0.txt\n"
+	"dmx_mode=2\n"
+	"dmx_start_address=100\n"
+	"dmx_slot_info=00:0000,01:0100\n"
+	"mode_max_steps=3200\n"
+	"mode_switch_act=reset\n"
+	"mode_switch_dir=forward\n"
+	"mode_switch_sps=10000.5\n"
+	"mode_switch=0\n";
+
+static const char s_aMotor[] =
+	"#motor0.txt\n"
+	"motor_step_angel=1.8\n"
+	"motor_voltage=3.2\n"
+	"motor_current=1.2\n"
+	"motor_resistance=2.6\n"
+	"motor_inductance=4.3\n"
+	"motor_step_angel=0\n";
+
+static const char s_aNetwork[] =
+	"#network.txt\n"
+	"use_dhcp=0\n"
+	"ip_address=192.168.2.10\n"
+	"net_mask=255.255.255.0\n"
+	"default_gateway=192.168.2.1\n"
+	"hostname=orangepi\n"
+	"name_server=192.168.2.1\n"
+	"ntp_server=192.168.2.1\n"
+	"ntp_utc_offset=1.5\n"
+	"ntp_utc_offset=15\n";
+
+static const char s_aOscClient[] =
+	"#oscclnt.txt\n"
+	"server_ip=192.168.2.150\n"
+	"outgoing_port=8000\n"
+	"incoming_port=9000\n"
+	"ping_disable=0\n"
+	"ping_delay=10\n"
+	"cmd0=/1/go\n"
+	"cmd1=/1/stop\n"
+	"cmd7=/1/pause\n"
+	"led0=/1/led\n"
+	"led3=not_a_path\n"
+	"ping_delay=1\n";
+
+static const char s_aOSCServer[] =
+	"#osc.txt\n"
+	"incoming_port=8000\n"
+	"outgoing_port=9000\n"
+	"partial_transmission=1\n"
+	"path=/dmx1/*\n"
+	"path_info=/2/info\n"
+	"path_blackout=/2/blackout\n"
+	"enable_no_change_update=1\n"
+	"incoming_port=80\n";
+
+static const char s_aPCA9685DmxLed[] =
+	"#pwmled.txt\n"
+	"dmx_start_address=1\n"
+	"dmx_footprint=32\n"
+	"i2c_slave_address=0x41\n"
+	"board_instances=2\n"
+	"dmx_slot_info=00:0000,01:0100\n"
+	"pwm_frequency=240\n"
+	"output_invert=1\n"
+	"output_driver=0\n"
+	"output_curve=gamma\n"
+	"output_gamma=2.2\n"
+	"output_16bit=1\n";
+
+static const char s_aPCA9685DmxServo[] =
+	"#servo.txt\n"
+	"dmx_start_address=1\n"
+	"i2c_slave_address=0x42\n"
+	"left_us=1000\n"
+	"right_us=2000\n"
+	"right_us=500\n";
+
+static const char s_aRDMDevice[] =
+	"#rdm_device.txt\n"
+	"device_label=Orange Pi Zero\n"
+	"product_category=0x0100\n"
+	"product_detail=0x0001\n";
+
+static const char s_aRemoteConfig[] =
+	"#rconfig.txt\n"
+	"disable=0\n"
+	"disable_write=1\n"
+	"enable_reboot=1\n"
+	"enable_uptime=1\n"
+	"display_name=Stage left\n";
+
+static const char s_aShowFile[] =
+	"#show.txt\n"
+	"format=ola\n"
+	"incoming_port=8000\n"
+	"outgoing_port=9000\n"
+	"show=1\n"
+	"protocol=artnet\n"
+	"sync_universe=5000\n"
+	"disable_unicast=1\n"
+	"auto_start=1\n"
+	"loop=1\n"
+	"show=100\n";
+
+static const char s_aSlushDmx[] =
+	"#slush.txt\n"
+	"use_spi_busy=1\n"
+	"dmx_start_address_port_a=1\n"
+	"dmx_footprint_port_a=8\n"
+	"dmx_start_address_port_b=9\n"
+	"dmx_footprint_port_b=9\n";
+
+static const char s_aSparkFunDmx[] =
+	"#sparkfun.txt\n"
+	"sparkfun_position=1\n"
+	"sparkfun_spi_cs=0\n"
+	"sparkfun_reset_pin=24\n"
+	"sparkfun_busy_pin=25\n"
+	"sparkfun_position=9\n";
+
+static const char s_aSpiFlashInstall[] =
+	"#spiflash.txt\n"
+	"install_uboot=1\n"
+	"install_uimage=1\n";
+
+static const char s_aTCNet[] =
+	"#tcnet.txt\n"
+	"node_name=AvV\n"
+	"layer=A\n"
+	"timecode_type=25\n"
+	"use_timecode=1\n"
+	"timecode_type=26\n";
+
+static const char s_aTLC59711Dmx[] =
+	"#devices.txt\n"
+	"led_type=TLC59711W\n"
+	"led_count=8\n"
+	"dmx_start_address=1\n"
+	"spi_speed_hz=5000000\n"
+	"output_curve=scurve\n"
+	"output_gamma=2.5\n"
+	"output_16bit=1\n"
+	"led_count=171\n";
+
+static const char s_aWidget[] =
+	"#params.txt\n"
+	"dmxusbpro_break_time=9\n"
+	"dmxusbpro_mab_time=1\n"
+	"dmxusbpro_refresh_rate=40\n"
+	"widget_mode=3\n"
+	"dmx_send_to_host_throttle=10\n"
+	"widget_mode=4\n";
+
+static const char s_aDevices[] =
+	"#devices.txt\n"
+	"led_type=WS2812B\n"
+	"led_rgb_mapping=RGB\n"
+	"led_t0h=0.38\n"
+	"led_t1h=0.82\n"
+	"led_count=170\n"
+	"led_group_count=1\n"
+	"led_grouping=0\n"
+	"active_out=4\n"
+	"use_si5351a=0\n"
+	"clock_speed_hz=6400000\n"
+	"global_brightness=255\n"
+	"dmx_start_address=1\n"
+	"led_count=0\n";
+
+template<class TStore, typename T>
+class Store: public TStore {
+public:
+	void Update(const T *pParams) {
+		memcpy(&m_tParams, pParams, sizeof(T));
+	}
+	void Copy(T *pParams) {
+		memcpy(pParams, &m_tParams, sizeof(T));
+	}
+	T m_tParams;
+};
+
+template<class TStore, typename T>
+class StoreMotor: public TStore {
+public:
+	void Update(__attribute__((unused)) uint8_t nMotorIndex, const T *pParams) {
+		memcpy(&m_tParams, pParams, sizeof(T));
+	}
+	void Copy(__attribute__((unused)) uint8_t nMotorIndex, T *pParams) {
+		memcpy(pParams, &m_tParams, sizeof(T));
+	}
+	T m_tParams;
+};
+
+template<class TStore, typename T>
+class StoreBoth: public TStore {
+public:
+	void Update(const T *pParams) {
+		memcpy(&m_tParams, pParams, sizeof(T));
+	}
+	void Copy(T *pParams) {
+		memcpy(pParams, &m_tParams, sizeof(T));
+	}
+	void Update(__attribute__((unused)) uint8_t nMotorIndex, const T *pParams) {
+		memcpy(&m_tParams, pParams, sizeof(T));
+	}
+	void Copy(__attribute__((unused)) uint8_t nMotorIndex, T *pParams) {
+		memcpy(pParams, &m_tParams, sizeof(T));
+	}
+	T m_tParams;
+};
+
+class StoreE131: public Store<E131ParamsStore, struct TE131Params> {
+public:
+	void UpdateUuid(__attribute__((unused)) const uuid_t uuid) {
+	}
+	void CopyUuid(uuid_t uuid) {
+		memset(uuid, 0, sizeof(uuid_t));
+	}
+};
+
+static uint64_t micros(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000) + ((uint64_t) ts.tv_nsec / 1000);
+}
+
+static uint32_t countLines(const char *pBuffer) {
+	uint32_t nLines = 0;
+
+	while (*pBuffer != '\0') {
+		if (*pBuffer++ == '\n') {
+			nLines++;
+		}
+	}
+
+	return nLines;
+}
+
+static void report(const char *pFileName, const char *pBuffer, uint32_t nIterations, uint64_t nBaseline, uint64_t nTable) {
+	const double fLines = (double) countLines(pBuffer) * nIterations;
+
+	printf("%-18s %4u lines  Sscan chain %8.1f ns/line  table %8.1f ns/line  speedup %.2fx\n", pFileName, countLines(pBuffer),
+			(double) nBaseline * 1000 / fLines, (double) nTable * 1000 / fLines, (double) nBaseline / (double) nTable);
+}
+
+/*
+ * Both parsers must give the same struct, including the set list
+ */
+static bool isIdentical(const char *pFileName, const void *pBaseline, const void *pTable, uint32_t nSize) {
+	const uint8_t *p = (const uint8_t *) pBaseline;
+	const uint8_t *q = (const uint8_t *) pTable;
+
+	for (uint32_t i = 0; i < nSize; i++) {
+		if (p[i] != q[i]) {
+			printf("%s: the structs differ at offset %u (Sscan chain 0x%.2x, table 0x%.2x)\n", pFileName, i, p[i], q[i]);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void writeFile(const char *pFileName, const char *pBuffer) {
+	FILE *fp = fopen(pFileName, "w");
+
+	if (fp == 0) {
+		perror(pFileName);
+		exit(EXIT_FAILURE);
+	}
+
+	fputs(pBuffer, fp);
+	fclose(fp);
+}
+
+static uint32_t s_nIterations;
+static uint32_t s_nErrors;
+
+/*
+ * load parses pBuffer with the table; the classes that can only load a file
+ * get pFileName != 0 and read it, for both parsers. get copies the result of
+ * the table into T and returns false when the class has no accessors for it.
+ */
+template<typename T, typename L, typename G>
+static void run(const char *pName, const char *pFileName, const char *pBuffer, CallbackFunctionPtr pBaseline, L load, G get) {
+	const uint32_t nLength = strlen(pBuffer);
+
+	T tDefaults;
+	T tBaseline;
+	T tTable;
+
+	// The padding must compare equal
+	memset(&tDefaults, 0, sizeof(T));
+	memset(&tBaseline, 0, sizeof(T));
+	memset(&tTable, 0, sizeof(T));
+
+	if (pFileName != 0) {
+		writeFile(pFileName, s_aHeader);
+	}
+
+	load(s_aHeader, sizeof(s_aHeader) - 1);	// The defaults of the constructor
+	const bool bCompare = get(tDefaults);
+
+	if (pFileName != 0) {
+		writeFile(pFileName, pBuffer);
+	}
+
+	ReadConfigFile config(pBaseline, &tBaseline);
+
+	uint64_t nStart = micros();
+	for (uint32_t i = 0; i < s_nIterations; i++) {
+		memcpy(&tBaseline, &tDefaults, sizeof(T));
+		if (pFileName != 0) {
+			config.Read(pFileName);
+		} else {
+			config.Read(pBuffer, nLength);
+		}
+	}
+	const uint64_t nBaseline = micros() - nStart;
+
+	nStart = micros();
+	for (uint32_t i = 0; i < s_nIterations; i++) {
+		load(pBuffer, nLength);
+	}
+	const uint64_t nTable = micros() - nStart;
+
+	report(pName, pBuffer, s_nIterations, nBaseline, nTable);
+
+	if (!bCompare) {
+		printf("%-18s no accessors for the members, timing only\n", pName);
+		return;
+	}
+
+	get(tTable);
+
+	if (!isIdentical(pName, &tBaseline, &tTable, sizeof(T))) {
+		s_nErrors++;
+	}
+}
+
+/*
+ * The params classes with a store and Load(pBuffer, nLength)
+ */
+template<typename T, class TParams, class TStore>
+static void runBuffer(const char *pName, const char *pBuffer, CallbackFunctionPtr pBaseline) {
+	TStore store;
+	TParams params(&store);
+
+	run<T>(pName, 0, pBuffer, pBaseline,
+		[&](const char *p, uint32_t n) { params.Load(p, n); },
+		[&](T &t) { memcpy(&t, &store.m_tParams, sizeof(T)); return true; });
+}
+
+template<typename T, class TParams, class TStore>
+static void runMotor(const char *pName, const char *pBuffer, CallbackFunctionPtr pBaseline) {
+	TStore store;
+	TParams params(&store);
+
+	run<T>(pName, 0, pBuffer, pBaseline,
+		[&](const char *p, uint32_t n) { params.Load(0, p, n); },
+		[&](T &t) { memcpy(&t, &store.m_tParams, sizeof(T)); return true; });
+}
+
+/*
+ * The params classes with a store and only Load(void)
+ */
+template<typename T, class TParams, class TStore>
+static void runFile(const char *pName, const char *pBuffer, CallbackFunctionPtr pBaseline) {
+	TStore store;
+	TParams params(&store);
+
+	run<T>(pName, pName, pBuffer, pBaseline,
+		[&](const char *, uint32_t) { params.Load(); },
+		[&](T &t) { memcpy(&t, &store.m_tParams, sizeof(T)); return true; });
+}
+
+int main(int argc, char **argv) {
+	s_nIterations = (argc > 1) ? (uint32_t) atoi(argv[1]) : 20000;
+
+	printf("Properties parser benchmark, %u iterations\n", s_nIterations);
+
+	// The classes that only load a file read it from the current directory
+	char aDirectory[] = "/tmp/benchmarkXXXXXX";
+
+	if ((mkdtemp(aDirectory) == 0) || (chdir(aDirectory) != 0)) {
+		perror(aDirectory);
+		return EXIT_FAILURE;
+	}
+
+	runBuffer<struct TArtNetParams, ArtNetParams, Store<ArtNetParamsStore, struct TArtNetParams>>(ArtNetParamsConst::FILE_NAME, s_aArtNet, baselineArtNetParams);
+	runBuffer<struct TArtNet4Params, ArtNet4Params, Store<ArtNet4ParamsStore, struct TArtNet4Params>>("artnet.txt (4)", s_aArtNet4, baselineArtNet4Params);
+	runBuffer<struct TDisplayUdfParams, DisplayUdfParams, Store<DisplayUdfParamsStore, struct TDisplayUdfParams>>(DisplayUdfParamsConst::FILE_NAME, s_aDisplayUdf, baselineDisplayUdfParams);
+
+	// gpio.txt
+	{
+		DmxGpioParams params;
+
+		run<struct TBaselineDmxGpioParams>("gpio.txt", "gpio.txt", s_aDmxGpio, baselineDmxGpioParams,
+			[&](const char *, uint32_t) { params.Load(); },
+			[&](struct TBaselineDmxGpioParams &t) {
+				bool bIsSet;
+				t.nSetList = 0;
+				t.nDmxDataDirection = params.GetDataDirection(bIsSet);
+				t.nSetList |= bIsSet ? (1 << 0) : 0;
+				for (uint8_t i = 0; i < DMX_MAX_OUT; i++) {
+					t.nDmxDataDirectionOut[i] = params.GetDataDirection(bIsSet, i);
+					t.nSetList |= bIsSet ? (1 << (i + 1)) : 0;
+				}
+				return true;
+			});
+	}
+
+	runFile<struct TDMXMonitorParams, DMXMonitorParams, Store<DMXMonitorParamsStore, struct TDMXMonitorParams>>(DMXMonitorParamsConst::FILE_NAME, s_aDMXMonitor, baselineDMXMonitorParams);
+	runBuffer<struct TDMXParams, DMXParams, Store<DMXParamsStore, struct TDMXParams>>(DMXSendConst::PARAMS_FILE_NAME, s_aDMXSend, baselineDMXParams);
+	runBuffer<struct TE131Params, E131Params, StoreE131>(E131ParamsConst::FILE_NAME, s_aE131, baselineE131Params);
+	runMotor<struct TL6470Params, L6470Params, StoreMotor<L6470ParamsStore, struct TL6470Params>>("motor0.txt (l6470)", s_aL6470, baselineL6470Params);
+	runBuffer<struct TLtcDisplayParams, LtcDisplayParams, Store<LtcDisplayParamsStore, struct TLtcDisplayParams>>(LtcDisplayParamsConst::FILE_NAME, s_aLtcDisplay, baselineLtcDisplayParams);
+	runBuffer<struct TLtcParams, LtcParams, Store<LtcParamsStore, struct TLtcParams>>(LtcParamsConst::FILE_NAME, s_aLtc, baselineLtcParams);
+	runBuffer<struct TMidiParams, MidiParams, Store<MidiParamsStore, struct TMidiParams>>("midi.txt", s_aMidi, baselineMidiParams);
+	runMotor<struct TModeParams, ModeParams, StoreMotor<ModeParamsStore, struct TModeParams>>("motor0.txt (mode)", s_aMode, baselineModeParams);
+	runMotor<struct TMotorParams, MotorParams, StoreMotor<MotorParamsStore, struct TMotorParams>>("motor0.txt (motor)", s_aMotor, baselineMotorParams);
+	runBuffer<struct TNetworkParams, NetworkParams, Store<NetworkParamsStore, struct TNetworkParams>>(NetworkConst::PARAMS_FILE_NAME, s_aNetwork, baselineNetworkParams);
+	runBuffer<struct TOscClientParams, OscClientParams, Store<OscClientParamsStore, struct TOscClientParams>>(OscClientParamsConst::PARAMS_FILE_NAME, s_aOscClient, baselineOscClientParams);
+	runBuffer<struct TOSCServerParams, OSCServerParams, Store<OSCServerParamsStore, struct TOSCServerParams>>(OSCServerConst::PARAMS_FILE_NAME, s_aOSCServer, baselineOSCServerParams);
+
+	// pwmled.txt, the PCA9685DmxParams keys are read by the constructor
+	{
+		PCA9685DmxParams *pParams = 0;
+
+		run<struct TBaselinePCA9685DmxParams>("pwmled.txt (dmx)", "pwmled.txt", s_aPCA9685DmxLed, baselinePCA9685DmxParams,
+			[&](const char *, uint32_t) { delete pParams; pParams = new PCA9685DmxParams("pwmled.txt"); },
+			[&](struct TBaselinePCA9685DmxParams &t) {
+				bool bIsSet;
+				t.bSetList = 0;
+				t.nDmxStartAddress = pParams->GetDmxStartAddress(bIsSet);
+				t.bSetList |= bIsSet ? (1 << 0) : 0;
+				t.nDmxFootprint = pParams->GetDmxFootprint(bIsSet);
+				t.bSetList |= bIsSet ? (1 << 1) : 0;
+				strncpy(t.aDmxSlotInfoRaw, pParams->GetDmxSlotInfoRaw(bIsSet), sizeof(t.aDmxSlotInfoRaw));
+				t.bSetList |= bIsSet ? (1 << 2) : 0;
+				t.nI2cAddress = pParams->GetI2cAddress(bIsSet);
+				t.bSetList |= bIsSet ? (1 << 3) : 0;
+				t.nBoardInstances = pParams->GetBoardInstances(bIsSet);
+				t.bSetList |= bIsSet ? (1 << 4) : 0;
+				return true;
+			});
+
+		delete pParams;
+	}
+
+	{
+		PCA9685DmxLedParams params;
+
+		run<struct TBaselinePCA9685DmxLedParams>("pwmled.txt (led)", "pwmled.txt", s_aPCA9685DmxLed, baselinePCA9685DmxLedParams,
+			[&](const char *, uint32_t) { params.Load(); },
+			[&](struct TBaselinePCA9685DmxLedParams &) { return false; });
+	}
+
+	{
+		PCA9685DmxServoParams params;
+
+		run<struct TBaselinePCA9685DmxServoParams>("servo.txt", "servo.txt", s_aPCA9685DmxServo, baselinePCA9685DmxServoParams,
+			[&](const char *, uint32_t) { params.Load(); },
+			[&](struct TBaselinePCA9685DmxServoParams &) { return false; });
+	}
+
+	runBuffer<struct TRDMDeviceParams, RDMDeviceParams, Store<RDMDeviceParamsStore, struct TRDMDeviceParams>>(RDMDeviceParamsConst::FILE_NAME, s_aRDMDevice, baselineRDMDeviceParams);
+	runBuffer<struct TRemoteConfigParams, RemoteConfigParams, Store<RemoteConfigParamsStore, struct TRemoteConfigParams>>(RemoteConfigConst::PARAMS_FILE_NAME, s_aRemoteConfig, baselineRemoteConfigParams);
+	runBuffer<struct TShowFileParams, ShowFileParams, Store<ShowFileParamsStore, struct TShowFileParams>>(ShowFileParamsConst::FILE_NAME, s_aShowFile, baselineShowFileParams);
+	runBuffer<struct TSlushDmxParams, SlushDmxParams, StoreBoth<SlushDmxParamsStore, struct TSlushDmxParams>>(SlushDmxParamsConst::FILE_NAME, s_aSlushDmx, baselineSlushDmxParams);
+	runBuffer<struct TSparkFunDmxParams, SparkFunDmxParams, StoreBoth<SparkFunDmxParamsStore, struct TSparkFunDmxParams>>(SparkFunDmxParamsConst::FILE_NAME, s_aSparkFunDmx, baselineSparkFunDmxParams);
+
+	// spiflash.txt, there is no accessor for the set list
+	{
+		SpiFlashInstallParams params;
+
+		run<struct TBaselineSpiFlashInstallParams>("spiflash.txt", "spiflash.txt", s_aSpiFlashInstall, baselineSpiFlashInstallParams,
+			[&](const char *, uint32_t) { params.Load(); },
+			[&](struct TBaselineSpiFlashInstallParams &t) {
+				t.bInstalluboot = params.GetInstalluboot();
+				t.bInstalluImage = params.GetInstalluImage();
+				t.nSetList = (t.bInstalluboot ? (1 << 0) : 0) | (t.bInstalluImage ? (1 << 1) : 0);
+				return true;
+			});
+	}
+
+	runBuffer<struct TTCNetParams, TCNetParams, Store<TCNetParamsStore, struct TTCNetParams>>(TCNetParamsConst::FILE_NAME, s_aTCNet, baselineTCNetParams);
+	runBuffer<struct TTLC59711DmxParams, TLC59711DmxParams, Store<TLC59711DmxParamsStore, struct TTLC59711DmxParams>>("devices.txt (tlc)", s_aTLC59711Dmx, baselineTLC59711DmxParams);
+	runFile<struct TWidgetParams, WidgetParams, Store<WidgetParamsStore, struct TWidgetParams>>("params.txt", s_aWidget, baselineWidgetParams);
+	runBuffer<struct TWS28xxDmxParams, WS28xxDmxParams, Store<WS28xxDmxParamsStore, struct TWS28xxDmxParams>>(DevicesParamsConst::FILE_NAME, s_aDevices, baselineWS28xxDmxParams);
+
+	const char *pFiles[] = { "gpio.txt", DMXMonitorParamsConst::FILE_NAME, "pwmled.txt", "servo.txt", "spiflash.txt", "params.txt" };
+
+	for (uint32_t i = 0; i < sizeof(pFiles) / sizeof(pFiles[0]); i++) {
+		unlink(pFiles[i]);
+	}
+
+	if ((chdir("/") != 0) || (rmdir(aDirectory) != 0)) {
+		perror(aDirectory);
+	}
+
+	return (s_nErrors == 0) ? 0 : 1;
+}
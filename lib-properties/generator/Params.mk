@@ -0,0 +1,50 @@
+#
+# The params classes with a PropertiesParser, shared by the generator and the benchmark
+#
+
+ROOT ?= ./../..
+
+PARAMS_LIBS := artnet artnet4 displayudf dmx dmxmonitor dmxsend e131 l6470 l6470dmx lightset ltc midi network osc oscclient oscserver
+PARAMS_LIBS += pca9685 pca9685dmx rdm remoteconfig showfile spiflashstore tcnet tlc59711 tlc59711dmx widget ws28xx ws28xxdmx
+
+# The bcm2835 mock only has the defines used by the SparkFunDmxParams defaults
+INCLUDES := -I$(ROOT)/lib-properties/generator/mock -I$(ROOT)/lib-properties/include
+INCLUDES += $(addprefix -I$(ROOT)/lib-,$(addsuffix /include,$(PARAMS_LIBS)))
+INCLUDES += -I$(ROOT)/lib-spiflashinstall/src -I$(ROOT)/lib-display/include -I$(ROOT)/lib-hal/include -I$(ROOT)/lib-debug/include
+
+SOURCES := $(wildcard $(ROOT)/lib-properties/src/*.c) $(wildcard $(ROOT)/lib-properties/src/*.cpp)
+SOURCES += $(ROOT)/lib-artnet/src/artnetparams.cpp $(ROOT)/lib-artnet/src/artnetparamsconst.cpp $(ROOT)/lib-artnet/src/artnetconst.cpp
+SOURCES += $(ROOT)/lib-artnet4/src/artnet4params.cpp $(ROOT)/lib-artnet4/src/artnet4paramsconst.cpp
+SOURCES += $(ROOT)/lib-displayudf/src/displayudfparams.cpp $(ROOT)/lib-displayudf/src/displayudfparamsconst.cpp
+SOURCES += $(ROOT)/lib-dmx/src/dmxgpioparams.cpp
+SOURCES += $(ROOT)/lib-dmxmonitor/src/dmxmonitorparams.cpp $(ROOT)/lib-dmxmonitor/src/dmxmonitorparamsconst.cpp
+SOURCES += $(ROOT)/lib-dmxsend/src/dmxsendparams.cpp $(ROOT)/lib-dmxsend/src/dmxsendconst.cpp
+SOURCES += $(ROOT)/lib-e131/src/e131params.cpp $(ROOT)/lib-e131/src/e131paramsconst.cpp
+SOURCES += $(ROOT)/lib-l6470dmx/src/l6470params.cpp $(ROOT)/lib-l6470dmx/src/l6470paramsconst.cpp
+SOURCES += $(ROOT)/lib-l6470dmx/src/modeparams.cpp $(ROOT)/lib-l6470dmx/src/modeparamsconst.cpp
+SOURCES += $(ROOT)/lib-l6470dmx/src/motorparams.cpp $(ROOT)/lib-l6470dmx/src/motorparamsconst.cpp
+SOURCES += $(ROOT)/lib-l6470dmx/src/slushdmxparams.cpp $(ROOT)/lib-l6470dmx/src/slushdmxparamsconst.cpp
+SOURCES += $(ROOT)/lib-l6470dmx/src/sparkfundmxparams.cpp $(ROOT)/lib-l6470dmx/src/sparkfundmxparamsconst.cpp
+SOURCES += $(ROOT)/lib-ltc/src/ltcparams.cpp $(ROOT)/lib-ltc/src/ltcparamsconst.cpp $(ROOT)/lib-ltc/src/ltcparamsgetsourcetype.cpp $(ROOT)/lib-ltc/src/ltc.cpp
+SOURCES += $(ROOT)/lib-ltc/src/ltcdisplayparams.cpp $(ROOT)/lib-ltc/src/ltcdisplayparamsconst.cpp
+SOURCES += $(ROOT)/lib-midi/src/midiparams.cpp
+SOURCES += $(ROOT)/lib-network/src/networkparams.cpp $(ROOT)/lib-network/src/networkconst.cpp
+SOURCES += $(ROOT)/lib-oscclient/src/oscclientparams.cpp $(ROOT)/lib-oscclient/src/oscclientparamsconst.cpp
+SOURCES += $(ROOT)/lib-oscserver/src/oscserverparams.cpp $(ROOT)/lib-oscserver/src/oscserverconst.cpp $(ROOT)/lib-osc/src/oscconst.cpp
+SOURCES += $(ROOT)/lib-pca9685dmx/src/pca9685dmxparams.cpp $(ROOT)/lib-pca9685dmx/src/pca9685dmxledparams.cpp $(ROOT)/lib-pca9685dmx/src/pca9685dmxservoparams.cpp
+SOURCES += $(ROOT)/lib-rdm/src/rdmdeviceparams.cpp $(ROOT)/lib-rdm/src/rdmdeviceparamsconst.cpp
+SOURCES += $(ROOT)/lib-remoteconfig/src/remoteconfigparams.cpp $(ROOT)/lib-remoteconfig/src/remoteconfigconst.cpp
+SOURCES += $(ROOT)/lib-showfile/src/showfileparams.cpp $(ROOT)/lib-showfile/src/showfileparamsconst.cpp
+SOURCES += $(ROOT)/lib-spiflashinstall/src/spiflashinstallparams.cpp
+SOURCES += $(ROOT)/lib-tcnet/src/tcnetparams.cpp $(ROOT)/lib-tcnet/src/tcnetparamsconst.cpp
+SOURCES += $(ROOT)/lib-tlc59711dmx/src/tlc59711dmxparams.cpp
+SOURCES += $(ROOT)/lib-widget/src/h3/widgetparams.cpp
+SOURCES += $(ROOT)/lib-ws28xxdmx/src/ws28xxdmxparams.cpp
+SOURCES += $(ROOT)/lib-ws28xx/src/ws28xxstatic.cpp $(ROOT)/lib-ws28xx/src/ws28xxconst.cpp $(ROOT)/lib-ws28xx/src/rgbmapping.cpp
+SOURCES += $(ROOT)/lib-lightset/src/lightsetconst.cpp
+
+# Only the params code is linked, not the unused functions of the library sources
+COPS_PARAMS := -DBUILDER_NOT_SET -ffunction-sections -fdata-sections
+# The host g++ is newer than the arm-none-eabi toolchain the firmware is built with
+COPS_PARAMS += -Wno-address-of-packed-member -Wno-stringop-truncation
+LDOPS_PARAMS := -Wl,--gc-sections
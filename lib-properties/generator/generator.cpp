@@ -0,0 +1,136 @@
+/**
+ * @file generator.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Generates nBits and nMultiplier of the TPropertiesTable of every params class:
+ * the smallest multiplicative hash over the FNV-1a hashes of the key names that is
+ * perfect (collision free). The values only depend on the key names, not on
+ * their order in the table.
+ *
+ * The exit code is non-zero when a table in the sources does not have the
+ * generated values, or has a duplicate key name.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "propertiesparser.h"
+
+#include "params.h"
+
+#define TABLE_BITS_MIN		4
+#define SEEDS_PER_SIZE		256
+#define GOLDEN_RATIO		0x9E3779B1U
+
+static bool isPerfect(const uint32_t *pHashes, uint32_t nKeys, uint32_t nBits, uint32_t nMultiplier) {
+	uint8_t aUsed[1U << PROPERTIES_TABLE_BITS_MAX];
+
+	memset(aUsed, 0, 1U << nBits);
+
+	for (uint32_t i = 0; i < nKeys; i++) {
+		const uint32_t nSlot = PropertiesParser::GetSlot(pHashes[i], nBits, nMultiplier);
+
+		if (aUsed[nSlot] != 0) {
+			return false;
+		}
+
+		aUsed[nSlot] = 1;
+	}
+
+	return true;
+}
+
+static bool generate(const uint32_t *pHashes, uint32_t nKeys, uint32_t &nBits, uint32_t &nMultiplier) {
+	nBits = TABLE_BITS_MIN;
+
+	while (((1U << nBits) < (4 * nKeys)) && (nBits < PROPERTIES_TABLE_BITS_MAX)) {
+		nBits++;
+	}
+
+	for (; nBits <= PROPERTIES_TABLE_BITS_MAX; nBits++) {
+		for (uint32_t nSeed = 0; nSeed < SEEDS_PER_SIZE; nSeed++) {
+			nMultiplier = GOLDEN_RATIO + (nSeed << 1);
+
+			if (isPerfect(pHashes, nKeys, nBits, nMultiplier)) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+static bool isUnique(const char *pClass, const struct TPropertiesTable *pTable) {
+	for (uint32_t i = 0; i < pTable->nKeys; i++) {
+		for (uint32_t j = i + 1; j < pTable->nKeys; j++) {
+			if (strcmp(pTable->pKeys[i].pName, pTable->pKeys[j].pName) == 0) {
+				printf("%s: duplicate key \"%s\"\n", pClass, pTable->pKeys[i].pName);
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+int main(void) {
+	uint32_t nErrors = 0;
+
+	for (uint32_t i = 0; i < sizeof(s_aParams) / sizeof(s_aParams[0]); i++) {
+		const char *pClass = s_aParams[i].pClass;
+		const struct TPropertiesTable *pTable = s_aParams[i].pTable;
+
+		if ((pTable->nKeys == 0) || (pTable->nKeys > PROPERTIES_KEYS_MAX) || !isUnique(pClass, pTable)) {
+			nErrors++;
+			continue;
+		}
+
+		uint32_t aHashes[PROPERTIES_KEYS_MAX];
+
+		for (uint32_t nKey = 0; nKey < pTable->nKeys; nKey++) {
+			const char *pName = pTable->pKeys[nKey].pName;
+			aHashes[nKey] = PropertiesParser::Hash(pName, strlen(pName));
+		}
+
+		uint32_t nBits, nMultiplier;
+
+		if (!generate(aHashes, pTable->nKeys, nBits, nMultiplier)) {
+			printf("%s: no perfect hash for %u keys\n", pClass, (unsigned) pTable->nKeys);
+			nErrors++;
+			continue;
+		}
+
+		const bool bMatch = (pTable->nBits == nBits) && (pTable->nMultiplier == nMultiplier);
+
+		printf("%-24s %2u keys  %u, 0x%.8X  %s\n", pClass, (unsigned) pTable->nKeys, (unsigned) nBits, (unsigned) nMultiplier, bMatch ? "ok" : "<- update the table");
+
+		if (!bMatch) {
+			nErrors++;
+		}
+	}
+
+	return (nErrors == 0) ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file params.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PARAMS_H_
+#define PARAMS_H_
+
+/*
+ * The key tables of the params classes with a PropertiesParser
+ */
+
+#include "artnetparams.h"
+#include "artnet4params.h"
+#include "displayudfparams.h"
+#include "dmxgpioparams.h"
+#include "dmxmonitorparams.h"
+#include "dmxparams.h"
+#include "e131params.h"
+#include "l6470params.h"
+#include "ltcdisplayparams.h"
+#include "ltcparams.h"
+#include "midiparams.h"
+#include "modeparams.h"
+#include "motorparams.h"
+#include "networkparams.h"
+#include "oscclientparams.h"
+#include "oscserverparms.h"
+#include "pca9685dmxparams.h"
+#include "pca9685dmxledparams.h"
+#include "pca9685dmxservoparams.h"
+#include "rdmdeviceparams.h"
+#include "remoteconfigparams.h"
+#include "showfileparams.h"
+#include "slushdmxparams.h"
+#include "sparkfundmxparams.h"
+#include "spiflashinstallparams.h"
+#include "tcnetparams.h"
+#include "tlc59711dmxparams.h"
+#include "widgetparams.h"
+#include "ws28xxdmxparams.h"
+
+struct TParams {
+	const char *pClass;
+	const struct TPropertiesTable *pTable;
+};
+
+static const struct TParams s_aParams[] = {
+	{ "ArtNetParams", &ArtNetParams::PROPERTIES_TABLE },
+	{ "ArtNet4Params", &ArtNet4Params::PROPERTIES_TABLE },
+	{ "DisplayUdfParams", &DisplayUdfParams::PROPERTIES_TABLE },
+	{ "DmxGpioParams", &DmxGpioParams::PROPERTIES_TABLE },
+	{ "DMXMonitorParams", &DMXMonitorParams::PROPERTIES_TABLE },
+	{ "DMXParams", &DMXParams::PROPERTIES_TABLE },
+	{ "E131Params", &E131Params::PROPERTIES_TABLE },
+	{ "L6470Params", &L6470Params::PROPERTIES_TABLE },
+	{ "LtcDisplayParams", &LtcDisplayParams::PROPERTIES_TABLE },
+	{ "LtcParams", &LtcParams::PROPERTIES_TABLE },
+	{ "MidiParams", &MidiParams::PROPERTIES_TABLE },
+	{ "ModeParams", &ModeParams::PROPERTIES_TABLE },
+	{ "MotorParams", &MotorParams::PROPERTIES_TABLE },
+	{ "NetworkParams", &NetworkParams::PROPERTIES_TABLE },
+	{ "OscClientParams", &OscClientParams::PROPERTIES_TABLE },
+	{ "OSCServerParams", &OSCServerParams::PROPERTIES_TABLE },
+	{ "PCA9685DmxParams", &PCA9685DmxParams::PROPERTIES_TABLE },
+	{ "PCA9685DmxLedParams", &PCA9685DmxLedParams::PROPERTIES_TABLE },
+	{ "PCA9685DmxServoParams", &PCA9685DmxServoParams::PROPERTIES_TABLE },
+	{ "RDMDeviceParams", &RDMDeviceParams::PROPERTIES_TABLE },
+	{ "RemoteConfigParams", &RemoteConfigParams::PROPERTIES_TABLE },
+	{ "ShowFileParams", &ShowFileParams::PROPERTIES_TABLE },
+	{ "SlushDmxParams", &SlushDmxParams::PROPERTIES_TABLE },
+	{ "SparkFunDmxParams", &SparkFunDmxParams::PROPERTIES_TABLE },
+	{ "SpiFlashInstallParams", &SpiFlashInstallParams::PROPERTIES_TABLE },
+	{ "TCNetParams", &TCNetParams::PROPERTIES_TABLE },
+	{ "TLC59711DmxParams", &TLC59711DmxParams::PROPERTIES_TABLE },
+	{ "WidgetParams", &WidgetParams::PROPERTIES_TABLE },
+	{ "WS28xxDmxParams", &WS28xxDmxParams::PROPERTIES_TABLE }
+};
+
+#endif /* PARAMS_H_ */
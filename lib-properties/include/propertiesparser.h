@@ -0,0 +1,123 @@
+/**
+ * @file propertiesparser.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PROPERTIESPARSER_H_
+#define PROPERTIESPARSER_H_
+
+#include <stdint.h>
+
+#define PROPERTIES_KEY_UNKNOWN		(-1)
+#define PROPERTIES_KEYS_MAX			64
+#define PROPERTIES_TABLE_BITS_MAX	9
+
+enum TPropertiesType {
+	PROPERTIES_TYPE_CUSTOM,		///< No field setter, the caller handles the value
+	PROPERTIES_TYPE_UINT8,		///< Range checked with nMin/nMax, ignored when out of range
+	PROPERTIES_TYPE_UINT16,		///< Range checked with nMin/nMax, ignored when out of range
+	PROPERTIES_TYPE_UINT32,
+	PROPERTIES_TYPE_BOOL,		///< Field = (value != 0), mask is always set
+	PROPERTIES_TYPE_FLAG,		///< Field = (value != 0), mask is set or cleared
+	PROPERTIES_TYPE_CHAR,		///< nMax is the field size, including the '\0'
+	PROPERTIES_TYPE_IP_ADDRESS,
+	PROPERTIES_TYPE_FLOAT		///< Not range checked
+};
+
+struct TPropertiesKey {
+	const char *pName;
+	uint16_t nOffset;
+	uint8_t nType;
+	uint32_t nMask;
+	uint32_t nMin;
+	uint32_t nMax;
+};
+
+/*
+ * nBits and nMultiplier are generated by lib-properties/generator, for the key names
+ * of pKeys. Run the generator again after adding, removing or renaming a key.
+ */
+struct TPropertiesTable {
+	const struct TPropertiesKey *pKeys;
+	uint16_t nKeys;
+	uint8_t nBits;			///< The hash table has (1 << nBits) slots
+	uint32_t nMultiplier;
+};
+
+/*
+ * The params struct starts with the uint32_t nSetList. For a table with custom keys
+ * only, pParams can be 0.
+ *
+ * On construction the keys are put in the slots of the generated perfect hash,
+ * there is no search at runtime. With the table each line is hashed and compared
+ * once, instead of trying every Sscan function in sequence.
+ * When the generated values do not match the key names, GetTableSize() returns 0
+ * and the keys are compared in sequence.
+ */
+class PropertiesParser {
+public:
+	PropertiesParser(const struct TPropertiesTable *pTable, void *pParams);
+	~PropertiesParser(void);
+
+	/*
+	 * Returns the index of the key in the table, or PROPERTIES_KEY_UNKNOWN.
+	 * For typed keys the field and mask are already updated.
+	 */
+	int32_t Parse(const char *pLine);
+
+	/*
+	 * Binary value for the key with index nKey, with the range check and mask of Parse.
+	 * nLength is the size of the field, for CHAR the string without the '\0'.
+	 * Returns false when the length or the value is not valid.
+	 */
+	bool Set(uint32_t nKey, const uint8_t *pValue, uint32_t nLength);
+
+	uint32_t GetTableSize(void) {
+		return (m_nBits == 0) ? 0 : (1U << m_nBits);
+	}
+
+	/*
+	 * The size of the field, 0 for a custom key
+	 */
+	static uint32_t GetSize(const struct TPropertiesKey *pKey);
+
+	static uint32_t Hash(const char *pName, uint32_t nLength);
+	static uint32_t GetSlot(uint32_t nHash, uint32_t nBits, uint32_t nMultiplier) {
+		return (nHash * nMultiplier) >> (32 - nBits);
+	}
+
+private:
+	int32_t Find(const char *pLine, uint32_t nLength);
+	void Set(const struct TPropertiesKey *pKey, const char *pValue);
+	void SetMask(uint32_t nMask, bool bSet);
+
+private:
+	const struct TPropertiesKey *m_pKeys;
+	uint32_t m_nKeys;
+	uint8_t *m_pParams;
+	uint32_t m_nBits;	///< 0 is no table
+	uint32_t m_nMultiplier;
+	uint8_t m_aSlots[1U << PROPERTIES_TABLE_BITS_MAX];
+};
+
+#endif /* PROPERTIESPARSER_H_ */
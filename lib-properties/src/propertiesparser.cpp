@@ -0,0 +1,305 @@
+/**
+ * @file propertiesparser.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "propertiesparser.h"
+
+#include "sscan.h"
+
+#define SLOT_EMPTY			0xFF
+
+#define FNV_OFFSET_BASIS	2166136261U
+#define FNV_PRIME			16777619U
+
+PropertiesParser::PropertiesParser(const struct TPropertiesTable *pTable, void *pParams):
+	m_pKeys(pTable->pKeys),
+	m_nKeys(pTable->nKeys),
+	m_pParams((uint8_t *) pParams),
+	m_nBits(pTable->nBits),
+	m_nMultiplier(pTable->nMultiplier)
+{
+	assert(m_pKeys != 0);
+	assert(m_nKeys != 0);
+	assert(m_nKeys <= PROPERTIES_KEYS_MAX);
+
+	if ((m_nBits == 0) || (m_nBits > PROPERTIES_TABLE_BITS_MAX)) {
+		m_nBits = 0;
+	} else {
+		memset(m_aSlots, SLOT_EMPTY, 1U << m_nBits);
+
+		for (uint32_t i = 0; i < m_nKeys; i++) {
+			const char *pName = m_pKeys[i].pName;
+			const uint32_t nSlot = GetSlot(Hash(pName, strlen(pName)), m_nBits, m_nMultiplier);
+
+			if (m_aSlots[nSlot] != SLOT_EMPTY) {
+				m_nBits = 0;
+				break;
+			}
+
+			m_aSlots[nSlot] = (uint8_t) i;
+		}
+	}
+
+	// The generated nBits and nMultiplier do not match the key names: run lib-properties/generator
+	assert(m_nBits != 0);
+}
+
+PropertiesParser::~PropertiesParser(void) {
+}
+
+uint32_t PropertiesParser::Hash(const char *pName, uint32_t nLength) {
+	uint32_t nHash = FNV_OFFSET_BASIS;
+
+	while (nLength-- != 0) {
+		nHash ^= (uint8_t) *pName++;
+		nHash *= FNV_PRIME;
+	}
+
+	return nHash;
+}
+
+int32_t PropertiesParser::Find(const char *pLine, uint32_t nLength) {
+	for (uint32_t i = 0; i < m_nKeys; i++) {
+		if ((strncmp(m_pKeys[i].pName, pLine, nLength) == 0) && (m_pKeys[i].pName[nLength] == '\0')) {
+			return (int32_t) i;
+		}
+	}
+
+	return PROPERTIES_KEY_UNKNOWN;
+}
+
+int32_t PropertiesParser::Parse(const char *pLine) {
+	assert(pLine != 0);
+
+	const char *p = pLine;
+	uint32_t nHash = FNV_OFFSET_BASIS;
+
+	while ((*p != '=') && (*p != '\0')) {
+		nHash ^= (uint8_t) *p++;
+		nHash *= FNV_PRIME;
+	}
+
+	if (*p != '=') {
+		return PROPERTIES_KEY_UNKNOWN;
+	}
+
+	const uint32_t nLength = (uint32_t) (p - pLine);
+	int32_t nIndex;
+
+	if (__builtin_expect((m_nBits == 0), 0)) {
+		nIndex = Find(pLine, nLength);
+	} else {
+		const uint32_t nSlot = m_aSlots[GetSlot(nHash, m_nBits, m_nMultiplier)];
+
+		if (nSlot == SLOT_EMPTY) {
+			return PROPERTIES_KEY_UNKNOWN;
+		}
+
+		const char *pName = m_pKeys[nSlot].pName;
+
+		if ((strncmp(pName, pLine, nLength) != 0) || (pName[nLength] != '\0')) {
+			return PROPERTIES_KEY_UNKNOWN;
+		}
+
+		nIndex = (int32_t) nSlot;
+	}
+
+	if ((nIndex != PROPERTIES_KEY_UNKNOWN) && (m_pKeys[nIndex].nType != PROPERTIES_TYPE_CUSTOM)) {
+		Set(&m_pKeys[nIndex], p);
+	}
+
+	return nIndex;
+}
+
+/*
+ * pValue points to the '=', the key is already matched: Sscan is called with an empty name
+ */
+void PropertiesParser::Set(const struct TPropertiesKey *pKey, const char *pValue) {
+	uint8_t *pField = m_pParams + pKey->nOffset;
+	uint8_t nValue8;
+	uint16_t nValue16;
+	uint32_t nValue32;
+	float fValue;
+
+	assert(m_pParams != 0);
+
+	switch (pKey->nType) {
+	case PROPERTIES_TYPE_UINT8:
+		if ((Sscan::Uint8(pValue, "", &nValue8) == SSCAN_OK) && (nValue8 >= pKey->nMin) && (nValue8 <= pKey->nMax)) {
+			*pField = nValue8;
+			SetMask(pKey->nMask, true);
+		}
+		break;
+	case PROPERTIES_TYPE_UINT16:
+		if ((Sscan::Uint16(pValue, "", &nValue16) == SSCAN_OK) && (nValue16 >= pKey->nMin) && (nValue16 <= pKey->nMax)) {
+			memcpy(pField, &nValue16, sizeof(uint16_t));
+			SetMask(pKey->nMask, true);
+		}
+		break;
+	case PROPERTIES_TYPE_UINT32:
+		if ((Sscan::Uint32(pValue, "", &nValue32) == SSCAN_OK) && (nValue32 >= pKey->nMin) && (nValue32 <= pKey->nMax)) {
+			memcpy(pField, &nValue32, sizeof(uint32_t));
+			SetMask(pKey->nMask, true);
+		}
+		break;
+	case PROPERTIES_TYPE_BOOL:
+		if (Sscan::Uint8(pValue, "", &nValue8) == SSCAN_OK) {
+			*pField = (nValue8 != 0);
+			SetMask(pKey->nMask, true);
+		}
+		break;
+	case PROPERTIES_TYPE_FLAG:
+		if (Sscan::Uint8(pValue, "", &nValue8) == SSCAN_OK) {
+			if (nValue8 != 0) {
+				*pField = 1;
+				SetMask(pKey->nMask, true);
+			} else {
+				*pField = 0;
+				SetMask(pKey->nMask, false);
+			}
+		}
+		break;
+	case PROPERTIES_TYPE_CHAR:
+		assert(pKey->nMax > 1);
+		nValue8 = (uint8_t) (pKey->nMax - 1);
+		if (Sscan::Char(pValue, "", (char *) pField, &nValue8) == SSCAN_OK) {
+			pField[nValue8] = '\0';
+			SetMask(pKey->nMask, true);
+		}
+		break;
+	case PROPERTIES_TYPE_IP_ADDRESS:
+		if (Sscan::IpAddress(pValue, "", &nValue32) == SSCAN_OK) {
+			memcpy(pField, &nValue32, sizeof(uint32_t));
+			SetMask(pKey->nMask, true);
+		}
+		break;
+	case PROPERTIES_TYPE_FLOAT:
+		if (Sscan::Float(pValue, "", &fValue) == SSCAN_OK) {
+			memcpy(pField, &fValue, sizeof(float));
+			SetMask(pKey->nMask, true);
+		}
+		break;
+	default:
+		assert(0);
+		break;
+	}
+}
+
+uint32_t PropertiesParser::GetSize(const struct TPropertiesKey *pKey) {
+	switch (pKey->nType) {
+	case PROPERTIES_TYPE_UINT8:
+	case PROPERTIES_TYPE_BOOL:
+	case PROPERTIES_TYPE_FLAG:
+		return sizeof(uint8_t);
+		break;
+	case PROPERTIES_TYPE_UINT16:
+		return sizeof(uint16_t);
+		break;
+	case PROPERTIES_TYPE_UINT32:
+	case PROPERTIES_TYPE_IP_ADDRESS:
+		return sizeof(uint32_t);
+		break;
+	case PROPERTIES_TYPE_FLOAT:
+		return sizeof(float);
+		break;
+	case PROPERTIES_TYPE_CHAR:
+		return pKey->nMax;
+		break;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+bool PropertiesParser::Set(uint32_t nKey, const uint8_t *pValue, uint32_t nLength) {
+	assert(nKey < m_nKeys);
+	assert(m_pParams != 0);
+
+	const struct TPropertiesKey *pKey = &m_pKeys[nKey];
+	uint8_t *pField = m_pParams + pKey->nOffset;
+	const uint32_t nSize = GetSize(pKey);
+
+	if (pKey->nType == PROPERTIES_TYPE_CHAR) {
+		if (nLength >= nSize) {
+			return false;
+		}
+
+		memcpy(pField, pValue, nLength);
+		pField[nLength] = '\0';
+		SetMask(pKey->nMask, true);
+		return true;
+	}
+
+	if ((nSize == 0) || (nLength != nSize)) {
+		return false;
+	}
+
+	uint32_t nValue32 = 0;	// Little endian, as the fields
+
+	switch (pKey->nType) {
+	case PROPERTIES_TYPE_UINT8:
+	case PROPERTIES_TYPE_UINT16:
+	case PROPERTIES_TYPE_UINT32:
+		memcpy(&nValue32, pValue, nLength);
+		if ((nValue32 < pKey->nMin) || (nValue32 > pKey->nMax)) {
+			return false;
+		}
+		memcpy(pField, pValue, nLength);
+		SetMask(pKey->nMask, true);
+		break;
+	case PROPERTIES_TYPE_BOOL:
+		*pField = (pValue[0] != 0);
+		SetMask(pKey->nMask, true);
+		break;
+	case PROPERTIES_TYPE_FLAG:
+		*pField = (pValue[0] != 0);
+		SetMask(pKey->nMask, (pValue[0] != 0));
+		break;
+	default:	// IP_ADDRESS, FLOAT
+		memcpy(pField, pValue, nLength);
+		SetMask(pKey->nMask, true);
+		break;
+	}
+
+	return true;
+}
+
+void PropertiesParser::SetMask(uint32_t nMask, bool bSet) {
+	uint32_t nSetList;
+
+	memcpy(&nSetList, m_pParams, sizeof(uint32_t));
+
+	if (bSet) {
+		nSetList |= nMask;
+	} else {
+		nSetList &= ~nMask;
+	}
+
+	memcpy(m_pParams, &nSetList, sizeof(uint32_t));
+}
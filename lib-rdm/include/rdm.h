@@ -179,6 +179,21 @@ public:
 	static const uint8_t *Receive(uint8_t nPort);
 	static const uint8_t *ReceiveTimeOut(uint8_t nPort, uint32_t);
 
+	/*
+	 * Writes the checksum after the message, pRdmData starts with the start code
+	 */
+	static void Checksum(uint8_t *pRdmData) {
+		const uint32_t nLength = ((struct TRdmMessage *) pRdmData)->message_length;
+		uint16_t nChecksum = 0;
+
+		for (uint32_t i = 0; i < nLength; i++) {
+			nChecksum += pRdmData[i];
+		}
+
+		pRdmData[nLength] = (uint8_t) (nChecksum >> 8);
+		pRdmData[nLength + 1] = (uint8_t) (nChecksum & 0xFF);
+	}
+
 public:
 #if defined(H3)
 	static uint8_t m_TransactionNumber[4];
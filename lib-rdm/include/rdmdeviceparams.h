@@ -32,6 +32,9 @@
 
 #include "rdm.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TRDMDeviceParams {
     uint32_t nSetList;
 	char aDeviceRootLabel[RDM_DEVICE_LABEL_MAX_LENGTH];
@@ -71,6 +74,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -81,6 +85,7 @@ private:
 private:
     RDMDeviceParamsStore *m_pRDMDeviceParamsStore;
     struct TRDMDeviceParams m_tRDMDeviceParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* RDMDEVICEPARAMS_H_ */
@@ -40,10 +40,30 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #include "debug.h"
 
-RDMDeviceParams::RDMDeviceParams(RDMDeviceParamsStore *pRDMDeviceParamsStore): m_pRDMDeviceParamsStore(pRDMDeviceParamsStore) {
+enum TRDMDeviceParamsKey {
+	KEY_LABEL,
+	KEY_PRODUCT_CATEGORY,
+	KEY_PRODUCT_DETAIL,
+	KEY_LAST
+};
+
+// Must be in the order of TRDMDeviceParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ RDMDeviceParamsConst::LABEL, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ RDMDeviceParamsConst::PRODUCT_CATEGORY, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ RDMDeviceParamsConst::PRODUCT_DETAIL, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TRDMDeviceParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable RDMDeviceParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 4, 0x9E3779B1 };
+
+RDMDeviceParams::RDMDeviceParams(RDMDeviceParamsStore *pRDMDeviceParamsStore): m_pRDMDeviceParamsStore(pRDMDeviceParamsStore), m_pPropertiesParser(0) {
 	DEBUG_ENTRY
 
 	m_tRDMDeviceParams.nSetList = 0;
@@ -70,9 +90,16 @@ bool RDMDeviceParams::Load(void) {
 
 	m_tRDMDeviceParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tRDMDeviceParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(RDMDeviceParams::staticCallbackFunction, this);
 
-	if (configfile.Read(RDMDeviceParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(RDMDeviceParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pRDMDeviceParamsStore != 0) {
 			m_pRDMDeviceParamsStore->Update(&m_tRDMDeviceParams);
@@ -102,10 +129,15 @@ void RDMDeviceParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tRDMDeviceParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tRDMDeviceParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(RDMDeviceParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pRDMDeviceParamsStore->Update(&m_tRDMDeviceParams);
 
 	DEBUG_EXIT
@@ -113,26 +145,33 @@ void RDMDeviceParams::Load(const char *pBuffer, uint32_t nLength) {
 
 void RDMDeviceParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t len;
 	uint16_t uint16;
 
-	len = RDM_DEVICE_LABEL_MAX_LENGTH;
-	if (Sscan::Char(pLine, RDMDeviceParamsConst::LABEL, m_tRDMDeviceParams.aDeviceRootLabel, &len) == SSCAN_OK) {
-		m_tRDMDeviceParams.nDeviceRootLabelLength = len;
-		m_tRDMDeviceParams.nSetList |= RDMDEVICE_PARAMS_MASK_LABEL;
-		return;
-	}
-
-	if (Sscan::HexUint16(pLine, RDMDeviceParamsConst::PRODUCT_CATEGORY, &uint16) == SSCAN_OK) {
-		m_tRDMDeviceParams.nProductCategory = uint16;
-		m_tRDMDeviceParams.nSetList |= RDMDEVICE_PARAMS_MASK_PRODUCT_CATEGORY;
-		return;
-	}
-
-	if (Sscan::HexUint16(pLine, RDMDeviceParamsConst::PRODUCT_DETAIL, &uint16) == SSCAN_OK) {
-		m_tRDMDeviceParams.nProductDetail = uint16;
-		m_tRDMDeviceParams.nSetList |= RDMDEVICE_PARAMS_MASK_PRODUCT_DETAIL;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_LABEL:
+		len = RDM_DEVICE_LABEL_MAX_LENGTH;
+		if (Sscan::Char(pLine, RDMDeviceParamsConst::LABEL, m_tRDMDeviceParams.aDeviceRootLabel, &len) == SSCAN_OK) {
+			m_tRDMDeviceParams.nDeviceRootLabelLength = len;
+			m_tRDMDeviceParams.nSetList |= RDMDEVICE_PARAMS_MASK_LABEL;
+		}
+		break;
+	case KEY_PRODUCT_CATEGORY:
+		if (Sscan::HexUint16(pLine, RDMDeviceParamsConst::PRODUCT_CATEGORY, &uint16) == SSCAN_OK) {
+			m_tRDMDeviceParams.nProductCategory = uint16;
+			m_tRDMDeviceParams.nSetList |= RDMDEVICE_PARAMS_MASK_PRODUCT_CATEGORY;
+		}
+		break;
+	case KEY_PRODUCT_DETAIL:
+		if (Sscan::HexUint16(pLine, RDMDeviceParamsConst::PRODUCT_DETAIL, &uint16) == SSCAN_OK) {
+			m_tRDMDeviceParams.nProductDetail = uint16;
+			m_tRDMDeviceParams.nSetList |= RDMDEVICE_PARAMS_MASK_PRODUCT_DETAIL;
+		}
+		break;
+	default:
+		break;
 	}
 }
 
@@ -0,0 +1,398 @@
+/**
+ * @file benchmark.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "linux/rdmsimulator.h"
+
+#include "rdm.h"
+#include "rdm_e120.h"
+#include "rdmmessage.h"
+#include "rdmdiscovery.h"
+#include "rdmtransactions.h"
+
+#include "rdmdeviceresponder.h"
+#include "rdmhandler.h"
+#include "rdmpersonality.h"
+#include "rdmsoftwareversion.h"
+
+#include "lightset.h"
+
+#include "hardware.h"
+#include "networklinux.h"
+
+#define MANUFACTURER_ID		0x7FF0
+#define GET_TIME_OUT		20000	///< Microseconds, as the ArtNetRdmController::Handler
+
+static const uint8_t s_aControllerUid[RDM_UID_SIZE] = { 0x7F, 0xF1, 0x00, 0x00, 0x00, 0x01 };
+static const uint32_t s_aResponders[] = { 1, 16, 64, 128, TOD_TABLE_SIZE };
+
+/*
+ * The wired-AND of the DISC_UNIQUE_BRANCH responses of these responders decodes as
+ * the first UID, with a valid checksum. With the first muted, the other three decode
+ * as the second UID: QuickFind is called again for it. With the second muted, the last
+ * two collide. QuickFind must pass the collision up, so the binary search finds them.
+ */
+static const uint8_t s_aQuickFindNested[][RDM_UID_SIZE] = {
+		{ 0x7F, 0xF0, 0x80, 0x06, 0x00, 0x11 },
+		{ 0x7F, 0xF0, 0x83, 0xC6, 0x08, 0x51 },
+		{ 0x7F, 0xF0, 0xE3, 0xD6, 0x18, 0x55 },
+		{ 0x7F, 0xF0, 0xA3, 0xC7, 0x69, 0x73 }
+};
+
+static const char SOFTWARE_VERSION[] = "1.0";
+
+const char *RDMSoftwareVersion::GetVersion(void) {
+	return SOFTWARE_VERSION;
+}
+
+const uint8_t RDMSoftwareVersion::GetVersionLength(void) {
+	return (uint8_t) sizeof(SOFTWARE_VERSION) / sizeof(SOFTWARE_VERSION[0]) - 1;
+}
+
+const uint32_t RDMSoftwareVersion::GetVersionId(void) {
+	return 0;
+}
+
+/*
+ * The discovery calls udelay between the DISC_UN_MUTE messages, this is bus time
+ */
+extern "C" {
+void udelay(uint32_t nMicros) {
+	RDMSimulator::Get()->Delay(nMicros);
+}
+}
+
+static uint64_t micros(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * 1000000) + (uint64_t) (ts.tv_nsec / 1000);
+}
+
+static bool is_device_info(const uint8_t *pResponse, const uint8_t *pUid) {
+	const struct TRdmMessage *p = (const struct TRdmMessage *) pResponse;
+
+	return (pResponse != 0) && (p->start_code == E120_SC_RDM)
+			&& (p->command_class == E120_GET_COMMAND_RESPONSE)
+			&& (p->slot16.response_type == E120_RESPONSE_TYPE_ACK)
+			&& (p->param_data_length == sizeof(struct TRDMDeviceInfo))
+			&& (memcmp(p->source_uid, pUid, RDM_UID_SIZE) == 0);
+}
+
+class DummyLightSet: public LightSet {
+public:
+	void Start(uint8_t nPort) {
+	}
+	void Stop(uint8_t nPort) {
+	}
+	void SetData(uint8_t nPort, const uint8_t *pData, uint16_t nLength) {
+	}
+};
+
+/*
+ * The one RDMHandler answers for all virtual responders, the UIDs are swapped
+ */
+class SimulatedResponders: public RDMSimulatorHandler {
+public:
+	SimulatedResponders(void): m_nHandled(0) {
+	}
+
+	const uint8_t *Handler(const uint8_t *pUid, const uint8_t *pRdmDataNoSC) {
+		const struct TRdmMessageNoSc *pRequest = (const struct TRdmMessageNoSc *) pRdmDataNoSC;
+		struct TRdmMessage *pResponse = (struct TRdmMessage *) m_aResponse;
+
+		m_nHandled++;
+
+		memcpy(m_aRequest, pRdmDataNoSC, pRequest->message_length + 1);
+
+		if (memcmp(&pRequest->destination_uid[2], &UID_ALL[2], RDM_UID_SIZE - 2) != 0) {
+			memcpy(((struct TRdmMessageNoSc *) m_aRequest)->destination_uid, RDMDeviceResponder::Get()->GetUID(), RDM_UID_SIZE);
+		}
+
+		m_RDMHandler.HandleData(m_aRequest, m_aResponse);
+
+		if (pResponse->start_code != E120_SC_RDM) {
+			return 0;
+		}
+
+		memcpy(pResponse->source_uid, pUid, RDM_UID_SIZE);
+		Rdm::Checksum(m_aResponse);
+
+		return m_aResponse;
+	}
+
+	uint32_t GetHandled(void) const {
+		return m_nHandled;
+	}
+
+private:
+	RDMHandler m_RDMHandler;
+	uint32_t m_nHandled;
+	alignas(uint32_t) uint8_t m_aRequest[sizeof(struct TRdmMessage) + RDM_MESSAGE_CHECKSUM_SIZE];
+	alignas(uint32_t) uint8_t m_aResponse[sizeof(struct TRdmMessage) + RDM_MESSAGE_CHECKSUM_SIZE];
+};
+
+static bool discovery(RDMSimulator &simulator, RDMDiscovery &discovery) {
+	const uint64_t nBusMicros = simulator.GetMicros();
+	const uint64_t nMicros = micros();
+
+	discovery.Full();
+
+	const uint64_t nElapsed = micros() - nMicros;
+	const uint32_t nExpected = (simulator.GetResponders() < TOD_TABLE_SIZE) ? simulator.GetResponders() : TOD_TABLE_SIZE;
+	uint8_t aTod[TOD_TABLE_SIZE * RDM_UID_SIZE];
+	uint32_t nFound = 0;
+
+	discovery.Copy(aTod);
+
+	for (uint32_t i = 0; i < discovery.GetUidCount(); i++) {
+		nFound += simulator.Exist(&aTod[i * RDM_UID_SIZE]) ? 1 : 0;
+	}
+
+	const struct TRdmSimulatorStatistics *pStatistics = simulator.GetStatistics();
+
+	printf("%10u | %5u %5u | %6u %10u %9u | %10.3f %9.2f\n", (unsigned) simulator.GetResponders(), (unsigned) discovery.GetUidCount(), (unsigned) nFound,
+			(unsigned) pStatistics->nDiscUniqueBranch, (unsigned) pStatistics->nCollisions, (unsigned) pStatistics->nTimeOuts,
+			(double) (simulator.GetMicros() - nBusMicros) / 1000000.0, (double) nElapsed / 1000.0);
+
+	return (nFound == nExpected) && (discovery.GetUidCount() == nExpected);
+}
+
+/*
+ * One GET DEVICE_INFO at a time with Send and ReceiveTimeOut
+ */
+static uint32_t get_blocking(const uint8_t *pTod, uint32_t nUids, uint32_t nRounds) {
+	RDMMessage message;
+	uint32_t nOk = 0;
+
+	message.SetSrcUid(s_aControllerUid);
+	message.SetCc(E120_GET_COMMAND);
+	message.SetPid(E120_DEVICE_INFO);
+	message.SetPd(0, 0);
+
+	for (uint32_t r = 0; r < nRounds; r++) {
+		for (uint32_t i = 0; i < nUids; i++) {
+			const uint8_t *pUid = &pTod[i * RDM_UID_SIZE];
+
+			message.SetDstUid(pUid);
+			message.Send(0);
+
+			nOk += is_device_info(message.ReceiveTimeOut(0, GET_TIME_OUT), pUid) ? 1 : 0;
+		}
+	}
+
+	return nOk;
+}
+
+/*
+ * The requests are queued with RDMTransactions, as the ArtRdm controller does
+ */
+static uint32_t get_queued(const uint8_t *pTod, uint32_t nUids, uint32_t nRounds) {
+	RDMTransactions transactions;
+	alignas(uint32_t) uint8_t aRequest[sizeof(struct TRdmMessage) + RDM_MESSAGE_CHECKSUM_SIZE];
+	struct TRdmMessage *pRequest = (struct TRdmMessage *) aRequest;
+	const uint32_t nTotal = nUids * nRounds;
+	uint32_t nQueued = 0;
+	uint32_t nOk = 0;
+
+	memset(aRequest, 0, sizeof(aRequest));
+
+	pRequest->start_code = E120_SC_RDM;
+	pRequest->sub_start_code = E120_SC_SUB_MESSAGE;
+	pRequest->message_length = RDM_MESSAGE_MINIMUM_SIZE;
+	memcpy(pRequest->source_uid, s_aControllerUid, RDM_UID_SIZE);
+	pRequest->slot16.port_id = 1;
+	pRequest->command_class = E120_GET_COMMAND;
+	pRequest->param_id[0] = (uint8_t) (E120_DEVICE_INFO >> 8);
+	pRequest->param_id[1] = (uint8_t) E120_DEVICE_INFO;
+
+	for (;;) {
+		while (nQueued < nTotal) {
+			memcpy(pRequest->destination_uid, &pTod[(nQueued % nUids) * RDM_UID_SIZE], RDM_UID_SIZE);
+			pRequest->transaction_number = (uint8_t) nQueued;
+			Rdm::Checksum(aRequest);
+
+			if (!transactions.Queue(0, &aRequest[1], nQueued)) {
+				break;
+			}
+
+			nQueued++;
+		}
+
+		transactions.Run(0);
+
+		uint32_t nTag;
+		const uint8_t *pResponse = transactions.GetResponse(0, nTag);
+
+		if (pResponse != 0) {
+			nOk += is_device_info(pResponse, &pTod[(nTag % nUids) * RDM_UID_SIZE]) ? 1 : 0;
+		} else if ((nQueued == nTotal) && transactions.IsIdle(0)) {
+			break;
+		}
+	}
+
+	return nOk;
+}
+
+static bool get(RDMSimulator &simulator, const char *pName, uint32_t (*pGet)(const uint8_t *, uint32_t, uint32_t), const uint8_t *pTod, uint32_t nUids, uint32_t nRounds) {
+	const uint32_t nTotal = nUids * nRounds;
+
+	simulator.ResetStatistics();
+
+	const uint64_t nBusMicros = simulator.GetMicros();
+	const uint64_t nMicros = micros();
+
+	const uint32_t nOk = pGet(pTod, nUids, nRounds);
+
+	const uint64_t nElapsed = micros() - nMicros;
+	const double fBusSeconds = (double) (simulator.GetMicros() - nBusMicros) / 1000000.0;
+
+	printf("%-10s | %5u %5u | %10.3f %10.1f | %9.2f %10.0f\n", pName, (unsigned) nTotal, (unsigned) nOk, fBusSeconds, (double) nOk / fBusSeconds,
+			(double) nElapsed / 1000.0, (double) nOk * 1000000.0 / (double) (nElapsed == 0 ? 1 : nElapsed));
+
+	return nOk == nTotal;
+}
+
+static void usage(const char *pName) {
+	fprintf(stderr, "Usage: %s [-n responders] [-r rounds] [-s seed] [-t min-max]\n", pName);
+	exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+	uint32_t nResponders = 0;
+	uint32_t nRounds = 100;
+	uint32_t nSeed = 1;
+	unsigned nTurnaroundMin = RDM_SIMULATOR_TURNAROUND_MIN;
+	unsigned nTurnaroundMax = RDM_SIMULATOR_TURNAROUND_MAX;
+	int c;
+
+	while ((c = getopt(argc, argv, "n:r:s:t:")) != -1) {
+		switch (c) {
+		case 'n':
+			nResponders = (uint32_t) atoi(optarg);
+			break;
+		case 'r':
+			nRounds = (uint32_t) atoi(optarg);
+			break;
+		case 's':
+			nSeed = (uint32_t) atoi(optarg);
+			break;
+		case 't':
+			if ((sscanf(optarg, "%u-%u", &nTurnaroundMin, &nTurnaroundMax) != 2) || (nTurnaroundMin > nTurnaroundMax) || (nTurnaroundMax > 0xFFFF)) {
+				usage(argv[0]);
+			}
+			break;
+		default:
+			usage(argv[0]);
+			break;
+		}
+	}
+
+	if ((nResponders > RDM_SIMULATOR_RESPONDERS_MAX) || (nRounds == 0)) {
+		usage(argv[0]);
+	}
+
+	Hardware hw;
+	NetworkLinux nw;
+	DummyLightSet lightSet;
+	RDMPersonality personality("Simulated responder", 16);
+	RDMDeviceResponder deviceResponder(&personality, &lightSet, false);
+
+	deviceResponder.Init();
+
+	SimulatedResponders responders;
+
+	const uint32_t *pResponders = (nResponders != 0) ? &nResponders : s_aResponders;
+	const uint32_t nRuns = (nResponders != 0) ? 1 : sizeof(s_aResponders) / sizeof(s_aResponders[0]);
+	int nResult = EXIT_SUCCESS;
+
+	printf("Turnaround %u-%u us, seed %u, %u GET rounds\n\n", nTurnaroundMin, nTurnaroundMax, (unsigned) nSeed, (unsigned) nRounds);
+
+	{
+		RDMSimulator simulator(nSeed);
+
+		for (uint32_t i = 0; i < sizeof(s_aQuickFindNested) / sizeof(s_aQuickFindNested[0]); i++) {
+			simulator.AddResponder(s_aQuickFindNested[i]);
+		}
+
+		RDMDiscovery rdmDiscovery;
+		rdmDiscovery.SetUid(s_aControllerUid);
+
+		printf("Nested QuickFind\n");
+		printf("%10s | %11s | %6s %10s %9s | %10s %9s\n", "responders", "TOD found", "DUB", "collisions", "time-outs", "bus s", "wall ms");
+
+		if (!discovery(simulator, rdmDiscovery)) {
+			fprintf(stderr, "Nested QuickFind: not all responders are found\n");
+			nResult = EXIT_FAILURE;
+		}
+
+		printf("\n");
+	}
+
+	for (uint32_t nRun = 0; nRun < nRuns; nRun++) {
+		RDMSimulator simulator(nSeed);
+
+		simulator.AddResponders(MANUFACTURER_ID, pResponders[nRun], (uint16_t) nTurnaroundMin, (uint16_t) nTurnaroundMax);
+		simulator.SetHandler(&responders);
+
+		RDMDiscovery rdmDiscovery;
+		rdmDiscovery.SetUid(s_aControllerUid);
+
+		printf("%10s | %11s | %6s %10s %9s | %10s %9s\n", "responders", "TOD found", "DUB", "collisions", "time-outs", "bus s", "wall ms");
+
+		if (!discovery(simulator, rdmDiscovery)) {
+			fprintf(stderr, "Discovery: not all responders are found\n");
+			nResult = EXIT_FAILURE;
+		}
+
+		uint8_t aTod[TOD_TABLE_SIZE * RDM_UID_SIZE];
+		const uint32_t nUids = rdmDiscovery.GetUidCount();
+
+		rdmDiscovery.Copy(aTod);
+
+		if (nUids != 0) {
+			printf("%-10s | %11s | %10s %10s | %9s %10s\n", "GET", "total ok", "bus s", "bus GET/s", "wall ms", "host GET/s");
+
+			if (!get(simulator, "blocking", get_blocking, aTod, nUids, nRounds)) {
+				nResult = EXIT_FAILURE;
+			}
+
+			if (!get(simulator, "queued", get_queued, aTod, nUids, nRounds)) {
+				nResult = EXIT_FAILURE;
+			}
+		}
+
+		printf("\n");
+	}
+
+	printf("RDMHandler calls: %u\n", (unsigned) responders.GetHandled());
+
+	return nResult;
+}
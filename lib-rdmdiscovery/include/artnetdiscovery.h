@@ -8,6 +8,8 @@
 
 #include "rdmdiscovery.h"
 #include "rdmdevicecontroller.h"
+#include "rdmtransactions.h"
+#include "rdmresponsecache.h"
 
 #include "dmx_uarts.h"
 #include "rdm.h"
@@ -24,11 +26,20 @@ public:
 	void Copy(uint8_t nPort, uint8_t *pTod);
 	const uint8_t *Handler(uint8_t nPort, const uint8_t *pRdmData);
 
+	bool Queue(uint8_t nPort, const uint8_t *pRdmData, uint32_t nIPAddressFrom);
+	const uint8_t *Run(uint8_t nPort, uint32_t &nIPAddressFrom);
+	bool IsIdle(uint8_t nPort);
+	bool IsWaitingResponse(uint8_t nPort);
+	bool IsSendPending(uint8_t nPort);
+	const uint8_t *GetCachedResponse(uint8_t nPort, const uint8_t *pRdmData);
+
 	void DumpTod(uint8_t nPort = 0);
 
 private:
 	RDMDiscovery *m_Discovery[DMX_MAX_UARTS];
 	struct TRdmMessage *m_pRdmCommand;
+	RDMTransactions m_Transactions;
+	RDMResponseCache m_ResponseCache;
 };
 
 #endif /* ARTNETDISCOVERY_H_ */
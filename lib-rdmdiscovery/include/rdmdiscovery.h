@@ -34,6 +34,12 @@
 #include "rdmmessage.h"
 #include "rdmtod.h"
 
+enum TRdmDiscoveryQuickFind {
+	RDM_DISCOVERY_QUICK_FIND_EMPTY,			///< The branch has no unmuted responders left
+	RDM_DISCOVERY_QUICK_FIND_COLLISION,		///< More responders in the branch, continue with the binary search
+	RDM_DISCOVERY_QUICK_FIND_MUTE_FAILED	///< The UID, decoded from a collision, did not acknowledge the mute
+};
+
 class RDMDiscovery: public RDMTod {
 public:
 	RDMDiscovery(uint8_t nPort = 0);
@@ -46,7 +52,7 @@ public:
 
 private:
 	bool FindDevices(uint64_t, uint64_t);
-	bool QuickFind(const uint8_t *);
+	TRdmDiscoveryQuickFind QuickFind(const uint8_t *);
 
 	bool IsValidDiscoveryResponse(const uint8_t *, uint8_t *);
 
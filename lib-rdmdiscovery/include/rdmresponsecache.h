@@ -0,0 +1,85 @@
+/**
+ * @file rdmresponsecache.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef RDMRESPONSECACHE_H_
+#define RDMRESPONSECACHE_H_
+
+#include <stdint.h>
+
+#include "rdm.h"
+
+#define RDM_RESPONSE_CACHE_ENTRIES		64
+#define RDM_RESPONSE_CACHE_MESSAGE_SIZE	(sizeof(struct TRdmMessage) + RDM_MESSAGE_CHECKSUM_SIZE)
+#define RDM_RESPONSE_CACHE_MAX_AGE		5000	///< Milliseconds, for the PIDs that can also change on the device itself
+
+struct TRdmResponseCacheEntry {
+	uint32_t nMillis;		///< Stored
+	uint32_t nUsedMillis;	///< For the replacement
+	uint16_t nPid;
+	uint16_t nSubDevice;
+	uint16_t nKey;			///< The leading parameter data, i.e. the personality or slot number
+	uint8_t nPort;
+	bool bIsValid;
+	bool bIsStatic;
+	uint8_t aUid[RDM_UID_SIZE];
+	alignas(uint32_t) uint8_t aResponse[RDM_RESPONSE_CACHE_MESSAGE_SIZE];	///< Including the start code
+};
+
+/*
+ * GET responses of static and slowly changing PIDs, per port and UID.
+ * A SET to a UID invalidates all its entries, both when queued and when answered.
+ * A broadcast SET and a discovery flush invalidate everything.
+ * Only ACK responses are stored.
+ */
+class RDMResponseCache {
+public:
+	RDMResponseCache(void);
+	~RDMResponseCache(void);
+
+	/*
+	 * pRdmData is the request without the start code. The response is
+	 * patched for the requester (transaction number, destination UID).
+	 */
+	const uint8_t *Get(uint8_t nPort, const uint8_t *pRdmData);
+
+	void Request(uint8_t nPort, const uint8_t *pRdmData);
+	void Response(uint8_t nPort, const uint8_t *pResponse);
+
+	void Clear(void);
+
+	void Print(void);
+
+private:
+	struct TRdmResponseCacheEntry *Find(uint8_t nPort, const uint8_t *pUid, uint16_t nSubDevice, uint16_t nPid, uint16_t nKey);
+	void Invalidate(uint8_t nPort, const uint8_t *pUid);
+
+private:
+	struct TRdmResponseCacheEntry *m_pEntries;
+	alignas(uint32_t) uint8_t m_aResponse[RDM_RESPONSE_CACHE_MESSAGE_SIZE];
+	uint32_t m_nHits;
+	uint32_t m_nMisses;
+};
+
+#endif /* RDMRESPONSECACHE_H_ */
@@ -0,0 +1,130 @@
+/**
+ * @file rdmtransactions.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef RDMTRANSACTIONS_H_
+#define RDMTRANSACTIONS_H_
+
+#include <stdint.h>
+
+#include "rdm.h"
+
+#include "dmx_uarts.h"
+
+#define RDM_TRANSACTIONS_QUEUE_ENTRIES		8		///< Per port, must be a power of 2
+#define RDM_TRANSACTIONS_MESSAGE_SIZE		(sizeof(struct TRdmMessage) + RDM_MESSAGE_CHECKSUM_SIZE)
+#define RDM_TRANSACTIONS_RESPONSE_TIMEOUT	20000	///< Microseconds, as the blocking ArtNetRdmController::Handler
+#define RDM_TRANSACTIONS_BROADCAST_SPACING	200		///< Microseconds, no response is expected
+#define RDM_TRANSACTIONS_ACK_TIMER_MAX		5000	///< Milliseconds
+#define RDM_TRANSACTIONS_RETRIES_MAX		16		///< ACK_TIMER and ACK_OVERFLOW follow-ups per request
+
+enum TRdmTransactionsState {
+	RDM_TRANSACTIONS_STATE_IDLE,
+	RDM_TRANSACTIONS_STATE_WAITING_RESPONSE,	///< Sent, waiting for the response or the time-out
+	RDM_TRANSACTIONS_STATE_WAITING_TIMER,		///< ACK_TIMER, waiting to send GET QUEUED_MESSAGE
+	RDM_TRANSACTIONS_STATE_COMPLETED			///< Response available with GetResponse
+};
+
+struct TRdmTransaction {
+	uint32_t nTag;
+	alignas(uint32_t) uint8_t aRequest[RDM_TRANSACTIONS_MESSAGE_SIZE];	///< Including the start code
+};
+
+struct TRdmTransactionsPort {
+	struct TRdmTransaction aQueue[RDM_TRANSACTIONS_QUEUE_ENTRIES];
+	uint32_t nHead;
+	uint32_t nTail;
+	TRdmTransactionsState tState;
+	uint32_t nMicros;		///< Start of the current wait
+	uint32_t nTimeOut;		///< Microseconds
+	uint32_t nRetries;
+	uint8_t nTransactionNumber;	///< Of the message on the wire
+	bool bIsBroadcast;
+	alignas(uint32_t) uint8_t aCommand[RDM_TRANSACTIONS_MESSAGE_SIZE];	///< Follow-up messages
+	alignas(uint32_t) uint8_t aResponse[RDM_TRANSACTIONS_MESSAGE_SIZE];
+};
+
+/*
+ * RDM controller transactions, one queue per port.
+ * Run is called from the main loop for every port; the ports progress independently,
+ * so a request on one port does not wait for the response window of another port.
+ * Only the response window is not blocking: a request is sent with Rdm::SendRaw/Send,
+ * which return when the last slot is on the line (on the H3 the UART is polled).
+ *
+ * ACK_TIMER is followed by GET QUEUED_MESSAGE after the indicated time.
+ * ACK_OVERFLOW makes every part a response and the request is sent again until the final ACK.
+ * The responses get the transaction number of the original request.
+ * A request without a response is dropped after the time-out.
+ */
+class RDMTransactions {
+public:
+	RDMTransactions(void);
+	~RDMTransactions(void);
+
+	/*
+	 * pRdmData is without the start code, including the checksum
+	 */
+	bool Queue(uint8_t nPort, const uint8_t *pRdmData, uint32_t nTag);
+
+	void Run(uint8_t nPort);
+
+	/*
+	 * Returns the response including the start code, the transaction then continues with Run
+	 */
+	const uint8_t *GetResponse(uint8_t nPort, uint32_t &nTag);
+
+	bool IsIdle(uint8_t nPort) const {
+		return (m_pPorts[nPort].nHead == m_pPorts[nPort].nTail);
+	}
+
+	/*
+	 * A request is on the line, the response window is open
+	 */
+	bool IsWaitingResponse(uint8_t nPort) const {
+		return (m_pPorts[nPort].tState == RDM_TRANSACTIONS_STATE_WAITING_RESPONSE);
+	}
+
+	/*
+	 * The next Run sends a request
+	 */
+	bool IsSendPending(uint8_t nPort);
+
+	uint32_t GetDropped(void) const {
+		return m_nDropped;
+	}
+
+private:
+	void Start(uint8_t nPort);
+	void SendQueuedMessage(uint8_t nPort);
+	void SendAgain(uint8_t nPort);
+	bool IsValidResponse(struct TRdmTransactionsPort *pPort, const uint8_t *pResponse);
+	void HandleResponse(uint8_t nPort, const uint8_t *pResponse);
+	void Next(uint8_t nPort);
+
+private:
+	struct TRdmTransactionsPort *m_pPorts;
+	uint32_t m_nDropped;
+};
+
+#endif /* RDMTRANSACTIONS_H_ */
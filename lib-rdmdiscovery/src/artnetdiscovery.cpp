@@ -39,6 +39,8 @@
 #include "rdmdevicecontroller.h"
 
 #include "rdmdiscovery.h"
+#include "rdmtransactions.h"
+#include "rdmresponsecache.h"
 
 #include "debug.h"
 
@@ -70,6 +72,7 @@ ArtNetRdmController::~ArtNetRdmController(void) {
 
 void ArtNetRdmController::Print(void) {
 	RDMDeviceController::Print();
+	m_ResponseCache.Print();
 }
 
 void ArtNetRdmController::Full(uint8_t nPort) {
@@ -77,6 +80,7 @@ void ArtNetRdmController::Full(uint8_t nPort) {
 
 	DEBUG_PRINTF("nPort=%d", nPort);
 
+	m_ResponseCache.Clear();
 	m_Discovery[nPort]->Full();
 }
 
@@ -126,12 +130,73 @@ const uint8_t *ArtNetRdmController::Handler(uint8_t nPort, const uint8_t *pRdmDa
 	RDMMessage::Print((const uint8_t *) c);
 #endif
 
+	m_ResponseCache.Request(nPort, pRdmData);
+
 	RDMMessage::SendRaw(nPort, c, p->message_length + 2);
 
 	const uint8_t *pResponse = RDMMessage::ReceiveTimeOut(nPort, 20000);
 
+	if (pResponse != 0) {
+		m_ResponseCache.Response(nPort, pResponse);
+	}
+
 #ifndef NDEBUG
 	RDMMessage::Print(pResponse);
 #endif
 	return pResponse;
 }
+
+/*
+ * A full queue drops the request, the controller will retry.
+ */
+bool ArtNetRdmController::Queue(uint8_t nPort, const uint8_t *pRdmData, uint32_t nIPAddressFrom) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	if (pRdmData != 0) {
+		m_ResponseCache.Request(nPort, pRdmData);
+		m_Transactions.Queue(nPort, pRdmData, nIPAddressFrom);
+	}
+
+	return true;
+}
+
+const uint8_t *ArtNetRdmController::Run(uint8_t nPort, uint32_t &nIPAddressFrom) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	m_Transactions.Run(nPort);
+
+	const uint8_t *pResponse = m_Transactions.GetResponse(nPort, nIPAddressFrom);
+
+	if (pResponse != 0) {
+		m_ResponseCache.Response(nPort, pResponse);
+#ifndef NDEBUG
+		RDMMessage::Print(pResponse);
+#endif
+	}
+
+	return pResponse;
+}
+
+bool ArtNetRdmController::IsIdle(uint8_t nPort) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	return m_Transactions.IsIdle(nPort);
+}
+
+bool ArtNetRdmController::IsWaitingResponse(uint8_t nPort) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	return m_Transactions.IsWaitingResponse(nPort);
+}
+
+bool ArtNetRdmController::IsSendPending(uint8_t nPort) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	return m_Transactions.IsSendPending(nPort);
+}
+
+const uint8_t *ArtNetRdmController::GetCachedResponse(uint8_t nPort, const uint8_t *pRdmData) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	return m_ResponseCache.Get(nPort, pRdmData);
+}
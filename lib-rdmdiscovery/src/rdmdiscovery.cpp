@@ -152,7 +152,7 @@ bool RDMDiscovery::FindDevices(uint64_t LowerBound, uint64_t UpperBound) {
 			bDeviceFound = true;
 
 			if (IsValidDiscoveryResponse((const uint8_t *)response, uid)) {
-				bDeviceFound = QuickFind(uid);
+				bDeviceFound = (QuickFind(uid) != RDM_DISCOVERY_QUICK_FIND_EMPTY);
 			}
 
 			if (bDeviceFound) {
@@ -234,7 +234,7 @@ bool RDMDiscovery::IsValidDiscoveryResponse(const uint8_t *response, uint8_t *ui
 	return bIsValid;
 }
 
-bool RDMDiscovery::QuickFind(const uint8_t *uid) {
+TRdmDiscoveryQuickFind RDMDiscovery::QuickFind(const uint8_t *uid) {
 	uint8_t *response;
 	struct TRdmMessage *p;
 	uint8_t r_uid[RDM_UID_SIZE];
@@ -251,25 +251,31 @@ bool RDMDiscovery::QuickFind(const uint8_t *uid) {
 	m_Mute.Send(m_nPort);
 
 	response = (uint8_t *) m_Mute.ReceiveTimeOut(m_nPort, RECEIVE_TIME_OUT);
-
-	if (response != 0) {
-		p = (struct TRdmMessage *) response;
-		if ((p->command_class == E120_DISCOVERY_COMMAND_RESPONSE) && (memcmp(uid, p->source_uid, RDM_UID_SIZE) == 0)) {
-			AddUid(uid);
-		}
+	p = (struct TRdmMessage *) response;
+
+	/*
+	 * Colliding responses can decode as a valid UID which is not muted,
+	 * the same collision would come back. Continue with the binary search.
+	 */
+	if ((response == 0) || (p->command_class != E120_DISCOVERY_COMMAND_RESPONSE) || (memcmp(uid, p->source_uid, RDM_UID_SIZE) != 0)) {
+		return RDM_DISCOVERY_QUICK_FIND_MUTE_FAILED;
 	}
 
+	AddUid(uid);
+
 	Hardware::Get()->WatchdogFeed();
 
 	m_DiscUniqueBranch.Send(m_nPort);
 
 	response = (uint8_t *) m_DiscUniqueBranch.ReceiveTimeOut(m_nPort, RECEIVE_TIME_OUT);
 
-	if ((response != 0) && (IsValidDiscoveryResponse(response, r_uid))) {
-		QuickFind(r_uid);
-	} else {
-		return true;
+	if (response == 0) {
+		return RDM_DISCOVERY_QUICK_FIND_EMPTY;
 	}
 
-	return false;
+	if (IsValidDiscoveryResponse(response, r_uid)) {
+		return QuickFind(r_uid);
+	}
+
+	return RDM_DISCOVERY_QUICK_FIND_COLLISION;
 }
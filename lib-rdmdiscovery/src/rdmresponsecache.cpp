@@ -0,0 +1,259 @@
+/**
+ * @file rdmresponsecache.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <assert.h>
+
+#include "rdmresponsecache.h"
+
+#include "rdm.h"
+#include "rdm_e120.h"
+
+#include "hardware.h"
+
+#include "debug.h"
+
+struct TRdmResponseCachePid {
+	uint16_t nPid;
+	uint8_t nKeyLength;		///< Leading parameter data bytes, echoed in the response
+	bool bIsStatic;			///< Otherwise it expires after RDM_RESPONSE_CACHE_MAX_AGE
+};
+
+static const struct TRdmResponseCachePid s_aPids[] = {
+		{ E120_SUPPORTED_PARAMETERS, 0, true },
+		{ E120_PARAMETER_DESCRIPTION, 2, true },
+		{ E120_DEVICE_INFO, 0, false },
+		{ E120_PRODUCT_DETAIL_ID_LIST, 0, true },
+		{ E120_DEVICE_MODEL_DESCRIPTION, 0, true },
+		{ E120_MANUFACTURER_LABEL, 0, true },
+		{ E120_DEVICE_LABEL, 0, false },
+		{ E120_LANGUAGE_CAPABILITIES, 0, true },
+		{ E120_SOFTWARE_VERSION_LABEL, 0, true },
+		{ E120_BOOT_SOFTWARE_VERSION_ID, 0, true },
+		{ E120_BOOT_SOFTWARE_VERSION_LABEL, 0, true },
+		{ E120_DMX_PERSONALITY, 0, false },
+		{ E120_DMX_PERSONALITY_DESCRIPTION, 1, true },
+		{ E120_DMX_START_ADDRESS, 0, false },
+		{ E120_SLOT_INFO, 0, false },
+		{ E120_SLOT_DESCRIPTION, 2, false },
+		{ E120_DEFAULT_SLOT_VALUE, 0, false },
+		{ E120_SENSOR_DEFINITION, 1, true } };
+
+static const struct TRdmResponseCachePid *get_pid(uint16_t nPid) {
+	for (uint32_t i = 0; i < sizeof(s_aPids) / sizeof(s_aPids[0]); i++) {
+		if (s_aPids[i].nPid == nPid) {
+			return &s_aPids[i];
+		}
+	}
+
+	return 0;
+}
+
+static uint16_t get_key(const uint8_t *pParamData, uint8_t nKeyLength) {
+	if (nKeyLength == 2) {
+		return (uint16_t) ((pParamData[0] << 8) | pParamData[1]);
+	}
+
+	if (nKeyLength == 1) {
+		return pParamData[0];
+	}
+
+	return 0;
+}
+
+RDMResponseCache::RDMResponseCache(void): m_pEntries(0), m_nHits(0), m_nMisses(0) {
+	DEBUG_ENTRY
+
+	m_pEntries = new struct TRdmResponseCacheEntry[RDM_RESPONSE_CACHE_ENTRIES];
+	assert(m_pEntries != 0);
+
+	Clear();
+
+	DEBUG_EXIT
+}
+
+RDMResponseCache::~RDMResponseCache(void) {
+	delete [] m_pEntries;
+	m_pEntries = 0;
+}
+
+const uint8_t *RDMResponseCache::Get(uint8_t nPort, const uint8_t *pRdmData) {
+	const struct TRdmMessageNoSc *pRequest = (const struct TRdmMessageNoSc *) pRdmData;
+
+	if ((pRequest == 0) || (pRequest->command_class != E120_GET_COMMAND)) {
+		return 0;
+	}
+
+	const struct TRdmResponseCachePid *pPid = get_pid((uint16_t) ((pRequest->param_id[0] << 8) | pRequest->param_id[1]));
+
+	if ((pPid == 0) || (pRequest->param_data_length < pPid->nKeyLength)) {
+		return 0;
+	}
+
+	const uint16_t nSubDevice = (uint16_t) ((pRequest->sub_device[0] << 8) | pRequest->sub_device[1]);
+	struct TRdmResponseCacheEntry *pEntry = Find(nPort, pRequest->destination_uid, nSubDevice, pPid->nPid, get_key(pRequest->param_data, pPid->nKeyLength));
+
+	if (pEntry == 0) {
+		m_nMisses++;
+		return 0;
+	}
+
+	const uint32_t nMillis = Hardware::Get()->Millis();
+
+	if (!pEntry->bIsStatic && ((nMillis - pEntry->nMillis) >= RDM_RESPONSE_CACHE_MAX_AGE)) {
+		pEntry->bIsValid = false;
+		m_nMisses++;
+		return 0;
+	}
+
+	pEntry->nUsedMillis = nMillis;
+
+	const struct TRdmMessage *pStored = (const struct TRdmMessage *) pEntry->aResponse;
+	memcpy(m_aResponse, pEntry->aResponse, pStored->message_length + RDM_MESSAGE_CHECKSUM_SIZE);
+
+	struct TRdmMessage *pResponse = (struct TRdmMessage *) m_aResponse;
+
+	pResponse->transaction_number = pRequest->transaction_number;
+	memcpy(pResponse->destination_uid, pRequest->source_uid, RDM_UID_SIZE);
+	Rdm::Checksum(m_aResponse);
+
+	m_nHits++;
+
+	return m_aResponse;
+}
+
+void RDMResponseCache::Request(uint8_t nPort, const uint8_t *pRdmData) {
+	const struct TRdmMessageNoSc *pRequest = (const struct TRdmMessageNoSc *) pRdmData;
+
+	if ((pRequest == 0) || (pRequest->command_class != E120_SET_COMMAND)) {
+		return;
+	}
+
+	if (memcmp(&pRequest->destination_uid[2], &UID_ALL[2], RDM_UID_SIZE - 2) == 0) {
+		Clear();
+		return;
+	}
+
+	Invalidate(nPort, pRequest->destination_uid);
+}
+
+void RDMResponseCache::Response(uint8_t nPort, const uint8_t *pResponse) {
+	const struct TRdmMessage *pMessage = (const struct TRdmMessage *) pResponse;
+
+	if ((pMessage == 0) || (pMessage->start_code != E120_SC_RDM)) {
+		return;
+	}
+
+	if (pMessage->command_class == E120_SET_COMMAND_RESPONSE) {
+		Invalidate(nPort, pMessage->source_uid);
+		return;
+	}
+
+	if ((pMessage->command_class != E120_GET_COMMAND_RESPONSE) || (pMessage->slot16.response_type != E120_RESPONSE_TYPE_ACK)) {
+		return;
+	}
+
+	const struct TRdmResponseCachePid *pPid = get_pid((uint16_t) ((pMessage->param_id[0] << 8) | pMessage->param_id[1]));
+
+	if ((pPid == 0) || (pMessage->param_data_length < pPid->nKeyLength)) {
+		return;
+	}
+
+	const uint16_t nSubDevice = (uint16_t) ((pMessage->sub_device[0] << 8) | pMessage->sub_device[1]);
+	const uint16_t nKey = get_key(pMessage->param_data, pPid->nKeyLength);
+	const uint32_t nMillis = Hardware::Get()->Millis();
+
+	struct TRdmResponseCacheEntry *pEntry = Find(nPort, pMessage->source_uid, nSubDevice, pPid->nPid, nKey);
+
+	if (pEntry == 0) {
+		// A free entry, otherwise the least recently used
+		pEntry = &m_pEntries[0];
+
+		for (uint32_t i = 0; i < RDM_RESPONSE_CACHE_ENTRIES; i++) {
+			if (!m_pEntries[i].bIsValid) {
+				pEntry = &m_pEntries[i];
+				break;
+			}
+
+			if ((nMillis - m_pEntries[i].nUsedMillis) > (nMillis - pEntry->nUsedMillis)) {
+				pEntry = &m_pEntries[i];
+			}
+		}
+	}
+
+	pEntry->nMillis = nMillis;
+	pEntry->nUsedMillis = nMillis;
+	pEntry->nPid = pPid->nPid;
+	pEntry->nSubDevice = nSubDevice;
+	pEntry->nKey = nKey;
+	pEntry->nPort = nPort;
+	pEntry->bIsValid = true;
+	pEntry->bIsStatic = pPid->bIsStatic;
+	memcpy(pEntry->aUid, pMessage->source_uid, RDM_UID_SIZE);
+	memcpy(pEntry->aResponse, pResponse, pMessage->message_length + RDM_MESSAGE_CHECKSUM_SIZE);
+}
+
+void RDMResponseCache::Clear(void) {
+	for (uint32_t i = 0; i < RDM_RESPONSE_CACHE_ENTRIES; i++) {
+		m_pEntries[i].bIsValid = false;
+	}
+}
+
+void RDMResponseCache::Print(void) {
+	uint32_t nValid = 0;
+
+	for (uint32_t i = 0; i < RDM_RESPONSE_CACHE_ENTRIES; i++) {
+		nValid += m_pEntries[i].bIsValid ? 1 : 0;
+	}
+
+	printf("RDM response cache\n");
+	printf(" Entries : %u/%u\n", (unsigned) nValid, (unsigned) RDM_RESPONSE_CACHE_ENTRIES);
+	printf(" Hits    : %u\n", (unsigned) m_nHits);
+	printf(" Misses  : %u\n", (unsigned) m_nMisses);
+}
+
+struct TRdmResponseCacheEntry *RDMResponseCache::Find(uint8_t nPort, const uint8_t *pUid, uint16_t nSubDevice, uint16_t nPid, uint16_t nKey) {
+	for (uint32_t i = 0; i < RDM_RESPONSE_CACHE_ENTRIES; i++) {
+		struct TRdmResponseCacheEntry *pEntry = &m_pEntries[i];
+
+		if (pEntry->bIsValid && (pEntry->nPid == nPid) && (pEntry->nKey == nKey) && (pEntry->nSubDevice == nSubDevice) && (pEntry->nPort == nPort) && (memcmp(pEntry->aUid, pUid, RDM_UID_SIZE) == 0)) {
+			return pEntry;
+		}
+	}
+
+	return 0;
+}
+
+void RDMResponseCache::Invalidate(uint8_t nPort, const uint8_t *pUid) {
+	for (uint32_t i = 0; i < RDM_RESPONSE_CACHE_ENTRIES; i++) {
+		struct TRdmResponseCacheEntry *pEntry = &m_pEntries[i];
+
+		if (pEntry->bIsValid && (pEntry->nPort == nPort) && (memcmp(pEntry->aUid, pUid, RDM_UID_SIZE) == 0)) {
+			pEntry->bIsValid = false;
+		}
+	}
+}
@@ -0,0 +1,280 @@
+/**
+ * @file rdmtransactions.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "rdmtransactions.h"
+
+#include "rdm.h"
+#include "rdm_e120.h"
+
+#include "hardware.h"
+
+#include "debug.h"
+
+RDMTransactions::RDMTransactions(void): m_pPorts(0), m_nDropped(0) {
+	DEBUG_ENTRY
+
+	m_pPorts = new struct TRdmTransactionsPort[DMX_MAX_UARTS];
+	assert(m_pPorts != 0);
+
+	for (uint32_t i = 0; i < DMX_MAX_UARTS; i++) {
+		m_pPorts[i].nHead = 0;
+		m_pPorts[i].nTail = 0;
+		m_pPorts[i].tState = RDM_TRANSACTIONS_STATE_IDLE;
+	}
+
+	DEBUG_EXIT
+}
+
+RDMTransactions::~RDMTransactions(void) {
+	delete [] m_pPorts;
+	m_pPorts = 0;
+}
+
+bool RDMTransactions::Queue(uint8_t nPort, const uint8_t *pRdmData, uint32_t nTag) {
+	assert(nPort < DMX_MAX_UARTS);
+	assert(pRdmData != 0);
+
+	const struct TRdmMessageNoSc *p = (const struct TRdmMessageNoSc *) pRdmData;
+
+	if (p->message_length < RDM_MESSAGE_MINIMUM_SIZE) {
+		return false;
+	}
+
+	struct TRdmTransactionsPort *pPort = &m_pPorts[nPort];
+
+	if ((pPort->nTail - pPort->nHead) == RDM_TRANSACTIONS_QUEUE_ENTRIES) {
+		m_nDropped++;
+		return false;
+	}
+
+	struct TRdmTransaction *pTransaction = &pPort->aQueue[pPort->nTail & (RDM_TRANSACTIONS_QUEUE_ENTRIES - 1)];
+
+	pTransaction->nTag = nTag;
+	pTransaction->aRequest[0] = E120_SC_RDM;
+	// The message length includes the start code, the checksum is 2 bytes
+	memcpy(&pTransaction->aRequest[1], pRdmData, p->message_length + 1);
+
+	pPort->nTail++;
+
+	return true;
+}
+
+void RDMTransactions::Run(uint8_t nPort) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	struct TRdmTransactionsPort *pPort = &m_pPorts[nPort];
+
+	switch (pPort->tState) {
+	case RDM_TRANSACTIONS_STATE_IDLE:
+		if (pPort->nHead != pPort->nTail) {
+			Start(nPort);
+		}
+		break;
+	case RDM_TRANSACTIONS_STATE_WAITING_RESPONSE: {
+		const uint8_t *pResponse = Rdm::Receive(nPort);
+
+		if ((pResponse != 0) && !pPort->bIsBroadcast && IsValidResponse(pPort, pResponse)) {
+			HandleResponse(nPort, pResponse);
+		} else if ((Hardware::Get()->Micros() - pPort->nMicros) >= pPort->nTimeOut) {
+			Next(nPort);
+		}
+	}
+		break;
+	case RDM_TRANSACTIONS_STATE_WAITING_TIMER:
+		if ((Hardware::Get()->Micros() - pPort->nMicros) >= pPort->nTimeOut) {
+			SendQueuedMessage(nPort);
+		}
+		break;
+	case RDM_TRANSACTIONS_STATE_COMPLETED:
+		break;
+	default:
+		assert(0);
+		break;
+	}
+}
+
+bool RDMTransactions::IsSendPending(uint8_t nPort) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	const struct TRdmTransactionsPort *pPort = &m_pPorts[nPort];
+
+	switch (pPort->tState) {
+	case RDM_TRANSACTIONS_STATE_IDLE:
+		return (pPort->nHead != pPort->nTail);
+	case RDM_TRANSACTIONS_STATE_WAITING_TIMER:
+		return ((Hardware::Get()->Micros() - pPort->nMicros) >= pPort->nTimeOut);
+	default:
+		break;
+	}
+
+	return false;
+}
+
+const uint8_t *RDMTransactions::GetResponse(uint8_t nPort, uint32_t &nTag) {
+	assert(nPort < DMX_MAX_UARTS);
+
+	struct TRdmTransactionsPort *pPort = &m_pPorts[nPort];
+
+	if (pPort->tState != RDM_TRANSACTIONS_STATE_COMPLETED) {
+		return 0;
+	}
+
+	nTag = pPort->aQueue[pPort->nHead & (RDM_TRANSACTIONS_QUEUE_ENTRIES - 1)].nTag;
+
+	const struct TRdmMessage *pResponse = (const struct TRdmMessage *) pPort->aResponse;
+
+	if ((pResponse->slot16.response_type == E120_RESPONSE_TYPE_ACK_OVERFLOW) && (pPort->nRetries < RDM_TRANSACTIONS_RETRIES_MAX)) {
+		pPort->nRetries++;
+		SendAgain(nPort);
+	} else {
+		Next(nPort);
+	}
+
+	return pPort->aResponse;
+}
+
+void RDMTransactions::Start(uint8_t nPort) {
+	struct TRdmTransactionsPort *pPort = &m_pPorts[nPort];
+	struct TRdmTransaction *pTransaction = &pPort->aQueue[pPort->nHead & (RDM_TRANSACTIONS_QUEUE_ENTRIES - 1)];
+	const struct TRdmMessage *pRequest = (const struct TRdmMessage *) pTransaction->aRequest;
+
+	while (0 != Rdm::Receive(nPort)) {
+		// Discard late responses
+	}
+
+	pPort->nRetries = 0;
+	pPort->nTransactionNumber = pRequest->transaction_number;
+	pPort->bIsBroadcast = (memcmp(&pRequest->destination_uid[2], &UID_ALL[2], RDM_UID_SIZE - 2) == 0);
+
+	Rdm::SendRaw(nPort, pTransaction->aRequest, pRequest->message_length + RDM_MESSAGE_CHECKSUM_SIZE);
+
+	pPort->tState = RDM_TRANSACTIONS_STATE_WAITING_RESPONSE;
+	pPort->nMicros = Hardware::Get()->Micros();
+	pPort->nTimeOut = pPort->bIsBroadcast ? RDM_TRANSACTIONS_BROADCAST_SPACING : RDM_TRANSACTIONS_RESPONSE_TIMEOUT;
+}
+
+void RDMTransactions::SendQueuedMessage(uint8_t nPort) {
+	struct TRdmTransactionsPort *pPort = &m_pPorts[nPort];
+	const struct TRdmTransaction *pTransaction = &pPort->aQueue[pPort->nHead & (RDM_TRANSACTIONS_QUEUE_ENTRIES - 1)];
+	struct TRdmMessage *pCommand = (struct TRdmMessage *) pPort->aCommand;
+
+	memcpy(pCommand, pTransaction->aRequest, RDM_MESSAGE_MINIMUM_SIZE);
+
+	pCommand->message_length = RDM_MESSAGE_MINIMUM_SIZE + 1;
+	pCommand->sub_device[0] = 0;
+	pCommand->sub_device[1] = 0;
+	pCommand->command_class = E120_GET_COMMAND;
+	pCommand->param_id[0] = (uint8_t) (E120_QUEUED_MESSAGE >> 8);
+	pCommand->param_id[1] = (uint8_t) E120_QUEUED_MESSAGE;
+	pCommand->param_data_length = 1;
+	pCommand->param_data[0] = E120_STATUS_ERROR;
+
+	Rdm::Send(nPort, pCommand);
+
+	pPort->nTransactionNumber = pCommand->transaction_number;
+	pPort->tState = RDM_TRANSACTIONS_STATE_WAITING_RESPONSE;
+	pPort->nMicros = Hardware::Get()->Micros();
+	pPort->nTimeOut = RDM_TRANSACTIONS_RESPONSE_TIMEOUT;
+}
+
+void RDMTransactions::SendAgain(uint8_t nPort) {
+	struct TRdmTransactionsPort *pPort = &m_pPorts[nPort];
+	const struct TRdmTransaction *pTransaction = &pPort->aQueue[pPort->nHead & (RDM_TRANSACTIONS_QUEUE_ENTRIES - 1)];
+	struct TRdmMessage *pCommand = (struct TRdmMessage *) pPort->aCommand;
+
+	memcpy(pCommand, pTransaction->aRequest, ((const struct TRdmMessage *) pTransaction->aRequest)->message_length);
+
+	Rdm::Send(nPort, pCommand);
+
+	pPort->nTransactionNumber = pCommand->transaction_number;
+	pPort->tState = RDM_TRANSACTIONS_STATE_WAITING_RESPONSE;
+	pPort->nMicros = Hardware::Get()->Micros();
+	pPort->nTimeOut = RDM_TRANSACTIONS_RESPONSE_TIMEOUT;
+}
+
+bool RDMTransactions::IsValidResponse(struct TRdmTransactionsPort *pPort, const uint8_t *pResponse) {
+	const struct TRdmMessage *pMessage = (const struct TRdmMessage *) pResponse;
+	const struct TRdmMessage *pRequest = (const struct TRdmMessage *) pPort->aQueue[pPort->nHead & (RDM_TRANSACTIONS_QUEUE_ENTRIES - 1)].aRequest;
+
+	if ((pMessage->start_code != E120_SC_RDM) || (pMessage->sub_start_code != E120_SC_SUB_MESSAGE)) {
+		return false;
+	}
+
+	if ((pMessage->message_length < RDM_MESSAGE_MINIMUM_SIZE) || (pMessage->transaction_number != pPort->nTransactionNumber)) {
+		return false;
+	}
+
+	return (memcmp(pMessage->source_uid, pRequest->destination_uid, RDM_UID_SIZE) == 0);
+}
+
+void RDMTransactions::HandleResponse(uint8_t nPort, const uint8_t *pResponse) {
+	struct TRdmTransactionsPort *pPort = &m_pPorts[nPort];
+	const struct TRdmMessage *pMessage = (const struct TRdmMessage *) pResponse;
+
+	if ((pMessage->slot16.response_type == E120_RESPONSE_TYPE_ACK_TIMER) && (pPort->nRetries < RDM_TRANSACTIONS_RETRIES_MAX)) {
+		uint32_t nMillis = 0;
+
+		// 6.3.1 The estimated response time is in tenths of a second
+		if (pMessage->param_data_length >= 2) {
+			nMillis = (uint32_t) ((pMessage->param_data[0] << 8) | pMessage->param_data[1]) * 100;
+		}
+
+		if (nMillis > RDM_TRANSACTIONS_ACK_TIMER_MAX) {
+			nMillis = RDM_TRANSACTIONS_ACK_TIMER_MAX;
+		}
+
+		pPort->nRetries++;
+		pPort->tState = RDM_TRANSACTIONS_STATE_WAITING_TIMER;
+		pPort->nMicros = Hardware::Get()->Micros();
+		pPort->nTimeOut = nMillis * 1000;
+
+		DEBUG_PRINTF("ACK_TIMER %u ms", nMillis);
+		return;
+	}
+
+	const struct TRdmMessage *pRequest = (const struct TRdmMessage *) pPort->aQueue[pPort->nHead & (RDM_TRANSACTIONS_QUEUE_ENTRIES - 1)].aRequest;
+
+	memcpy(pPort->aResponse, pResponse, pMessage->message_length + RDM_MESSAGE_CHECKSUM_SIZE);
+
+	struct TRdmMessage *pCopy = (struct TRdmMessage *) pPort->aResponse;
+
+	if (pCopy->transaction_number != pRequest->transaction_number) {
+		pCopy->transaction_number = pRequest->transaction_number;
+		Rdm::Checksum(pPort->aResponse);
+	}
+
+	pPort->tState = RDM_TRANSACTIONS_STATE_COMPLETED;
+}
+
+void RDMTransactions::Next(uint8_t nPort) {
+	struct TRdmTransactionsPort *pPort = &m_pPorts[nPort];
+
+	pPort->nHead++;
+	pPort->tState = RDM_TRANSACTIONS_STATE_IDLE;
+}
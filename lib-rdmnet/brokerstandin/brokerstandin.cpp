@@ -0,0 +1,694 @@
+/**
+ * @file brokerstandin.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "hardware.h"
+
+#include "rdmnetclient.h"
+#include "rdmnetpdu.h"
+#include "e133.h"
+
+#include "rdm.h"
+#include "rdm_e120.h"
+
+#define BUFFER_SIZE			(64 * 1024)
+#define TIMEOUT_MILLIS		5000
+#define REQUEST_MAX			256		///< A GET request with the TCP preamble, rounded up
+#define STALL_REQUESTS_MAX	1000000	///< The loopback socket buffers hold megabytes
+
+static const uint8_t s_aBrokerCID[16] = { 'b', 'r', 'o', 'k', 'e', 'r', '-', 's', 't', 'a', 'n', 'd', '-', 'i', 'n', 0 };
+static const uint8_t s_aBrokerUID[6] = { 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xB0 };
+static const uint8_t s_aControllerUID[6] = { 0x7F, 0xF0, 0x00, 0x00, 0x00, 0xC0 };
+static const uint8_t s_aDeviceUID[6] = { 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01 };
+
+static uint64_t micros(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) (ts.tv_nsec / 1000);
+}
+
+/*
+ * The in-process RPT Device. It answers every GET with a 2 byte ACK,
+ * so the measured rate is the protocol and TCP overhead only.
+ */
+class StandinDevice: public RDMNetClient {
+public:
+	void CopyUID(uint8_t *pUID) override {
+		memcpy(pUID, s_aDeviceUID, 6);
+	}
+
+	void CopyCID(uint8_t *pCID) override {
+		memset(pCID, 0, 16);
+		memcpy(pCID, "standin-device", 14);
+	}
+
+	uint8_t *RPTHandleRdmCommand(const uint8_t *pRdmDataNoSC) override {
+		const struct TRdmMessageNoSc *pRequest = (const struct TRdmMessageNoSc *) pRdmDataNoSC;
+
+		if (memcmp(pRequest->destination_uid, s_aDeviceUID, 6) != 0) {
+			m_aResponse[0] = 0xFF;
+			return m_aResponse;
+		}
+
+		struct TRdmMessage *pResponse = (struct TRdmMessage *) m_aResponse;
+
+		pResponse->start_code = E120_SC_RDM;
+		pResponse->sub_start_code = E120_SC_SUB_MESSAGE;
+		pResponse->message_length = RDM_MESSAGE_MINIMUM_SIZE + 2;
+		memcpy(pResponse->destination_uid, pRequest->source_uid, 6);
+		memcpy(pResponse->source_uid, s_aDeviceUID, 6);
+		pResponse->transaction_number = pRequest->transaction_number;
+		pResponse->slot16.response_type = E120_RESPONSE_TYPE_ACK;
+		pResponse->message_count = 0;
+		memcpy(pResponse->sub_device, pRequest->sub_device, 2);
+		pResponse->command_class = (uint8_t) (pRequest->command_class + 1);
+		memcpy(pResponse->param_id, pRequest->param_id, 2);
+		pResponse->param_data_length = 2;
+		pResponse->param_data[0] = 0x01;
+		pResponse->param_data[1] = 0x00;
+
+		uint16_t nChecksum = 0;
+
+		for (uint32_t i = 0; i < pResponse->message_length; i++) {
+			nChecksum += m_aResponse[i];
+		}
+
+		m_aResponse[pResponse->message_length] = (uint8_t) (nChecksum >> 8);
+		m_aResponse[pResponse->message_length + 1] = (uint8_t) nChecksum;
+
+		return m_aResponse;
+	}
+
+private:
+	uint8_t m_aResponse[sizeof(struct TRdmMessage)];
+};
+
+/*
+ * A single client broker, acting as the controller as well.
+ */
+class Broker {
+public:
+	Broker(void): m_nListen(-1), m_nClient(-1), m_bConnected(false), m_bReading(true), m_nRxLength(0), m_nTxLength(0),
+		m_nSequence(0), m_nOutstanding(0), m_nNotifications(0), m_nStatus(0), m_nLastStatus(0), m_nConnects(0), m_nErrors(0) {
+		memset(m_aClientUID, 0, sizeof(m_aClientUID));
+	}
+
+	~Broker(void) {
+		if (m_nClient >= 0) {
+			close(m_nClient);
+		}
+		if (m_nListen >= 0) {
+			close(m_nListen);
+		}
+	}
+
+	uint16_t Listen(uint16_t nPort) {
+		m_nListen = socket(AF_INET, SOCK_STREAM, 0);
+
+		int nTrue = 1;
+		setsockopt(m_nListen, SOL_SOCKET, SO_REUSEADDR, &nTrue, sizeof(nTrue));
+
+		struct sockaddr_in si;
+		memset(&si, 0, sizeof(si));
+		si.sin_family = AF_INET;
+		si.sin_addr.s_addr = htonl(INADDR_ANY);
+		si.sin_port = htons(nPort);
+
+		if ((bind(m_nListen, (struct sockaddr *) &si, sizeof(si)) < 0) || (listen(m_nListen, 1) < 0)) {
+			perror("bind/listen");
+			exit(EXIT_FAILURE);
+		}
+
+		fcntl(m_nListen, F_SETFL, fcntl(m_nListen, F_GETFL, 0) | O_NONBLOCK);
+
+		socklen_t nLength = sizeof(si);
+		getsockname(m_nListen, (struct sockaddr *) &si, &nLength);
+
+		return ntohs(si.sin_port);
+	}
+
+	void Poll(void) {
+		if (m_nClient < 0) {
+			m_nClient = accept(m_nListen, 0, 0);
+
+			if (m_nClient < 0) {
+				return;
+			}
+
+			int nTrue = 1;
+			setsockopt(m_nClient, IPPROTO_TCP, TCP_NODELAY, &nTrue, sizeof(nTrue));
+			fcntl(m_nClient, F_SETFL, fcntl(m_nClient, F_GETFL, 0) | O_NONBLOCK);
+			m_nRxLength = 0;
+			m_nTxLength = 0;
+		}
+
+		Flush();
+
+		if (!m_bReading) {
+			return;
+		}
+
+		const ssize_t nReceived = recv(m_nClient, &m_aRx[m_nRxLength], sizeof(m_aRx) - m_nRxLength, 0);
+
+		if (nReceived == 0 || ((nReceived < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))) {
+			close(m_nClient);
+			m_nClient = -1;
+			m_bConnected = false;
+			return;
+		}
+
+		if (nReceived > 0) {
+			m_nRxLength += (uint32_t) nReceived;
+		}
+
+		uint32_t nOffset = 0;
+
+		while ((m_nRxLength - nOffset) >= RDMNET_TCP_PREAMBLE_SIZE) {
+			const uint8_t *pBlock = &m_aRx[nOffset];
+			const uint32_t nBlockSize = rdmnet_get32(&pBlock[RDMNET_ACN_PACKET_IDENTIFIER_LENGTH]);
+
+			if (memcmp(pBlock, RDMNET_ACN_PACKET_IDENTIFIER, RDMNET_ACN_PACKET_IDENTIFIER_LENGTH) != 0) {
+				Error("invalid TCP preamble");
+				m_nRxLength = 0;
+				return;
+			}
+
+			if ((m_nRxLength - nOffset) < (RDMNET_TCP_PREAMBLE_SIZE + nBlockSize)) {
+				break;
+			}
+
+			HandleRootLayer(&pBlock[RDMNET_TCP_PREAMBLE_SIZE]);
+			nOffset += RDMNET_TCP_PREAMBLE_SIZE + nBlockSize;
+		}
+
+		m_nRxLength -= nOffset;
+		memmove(m_aRx, &m_aRx[nOffset], m_nRxLength);
+
+		Flush();
+	}
+
+	void SendGet(uint16_t nEndpoint = E133_NULL_ENDPOINT) {
+		uint8_t aRdm[RDM_MESSAGE_MINIMUM_SIZE + 1];
+		struct TRdmMessageNoSc *pRdm = (struct TRdmMessageNoSc *) aRdm;
+
+		pRdm->sub_start_code = E120_SC_SUB_MESSAGE;
+		pRdm->message_length = RDM_MESSAGE_MINIMUM_SIZE;
+		memcpy(pRdm->destination_uid, m_aClientUID, 6);
+		memcpy(pRdm->source_uid, s_aControllerUID, 6);
+		pRdm->transaction_number = (uint8_t) m_nSequence;
+		pRdm->slot16.port_id = 1;
+		pRdm->message_count = 0;
+		pRdm->sub_device[0] = 0;
+		pRdm->sub_device[1] = 0;
+		pRdm->command_class = E120_GET_COMMAND;
+		pRdm->param_id[0] = (uint8_t) (E120_DEVICE_INFO >> 8);
+		pRdm->param_id[1] = (uint8_t) E120_DEVICE_INFO;
+		pRdm->param_data_length = 0;
+
+		uint16_t nChecksum = E120_SC_RDM;
+
+		for (uint32_t i = 0; i < (RDM_MESSAGE_MINIMUM_SIZE - 1); i++) {
+			nChecksum += aRdm[i];
+		}
+
+		aRdm[RDM_MESSAGE_MINIMUM_SIZE - 1] = (uint8_t) (nChecksum >> 8);
+		aRdm[RDM_MESSAGE_MINIMUM_SIZE] = (uint8_t) nChecksum;
+
+		const uint32_t nCommandLength = RDMNET_RDM_COMMAND_HEADER_SIZE + sizeof(aRdm);
+		const uint32_t nRptLength = RDMNET_RPT_HEADER_SIZE + RDMNET_REQUEST_HEADER_SIZE + nCommandLength;
+
+		uint8_t *p = BeginMessage(VECTOR_ROOT_RPT, nRptLength);
+
+		rdmnet_put_flags_length(p, nRptLength);
+		rdmnet_put32(&p[3], VECTOR_RPT_REQUEST);
+		memcpy(&p[RDMNET_RPT_SOURCE_UID], s_aControllerUID, 6);
+		rdmnet_put16(&p[RDMNET_RPT_SOURCE_ENDPOINT], E133_NULL_ENDPOINT);
+		memcpy(&p[RDMNET_RPT_DESTINATION_UID], m_aClientUID, 6);
+		rdmnet_put16(&p[RDMNET_RPT_DESTINATION_ENDPOINT], nEndpoint);
+		rdmnet_put32(&p[RDMNET_RPT_SEQUENCE_NUMBER], m_nSequence);
+		p[RDMNET_RPT_HEADER_SIZE - 1] = 0;
+
+		p += RDMNET_RPT_HEADER_SIZE;
+		rdmnet_put_flags_length(p, RDMNET_REQUEST_HEADER_SIZE + nCommandLength);
+		rdmnet_put32(&p[3], VECTOR_REQUEST_RDM_CMD);
+
+		p += RDMNET_REQUEST_HEADER_SIZE;
+		rdmnet_put_flags_length(p, nCommandLength);
+		p[3] = VECTOR_RDM_CMD_RDM_DATA;
+		memcpy(&p[RDMNET_RDM_COMMAND_HEADER_SIZE], aRdm, sizeof(aRdm));
+
+		m_nSequence++;
+		m_nOutstanding++;
+	}
+
+	void SendDisconnect(void) {
+		uint8_t *p = BeginMessage(VECTOR_ROOT_BROKER, RDMNET_BROKER_HEADER_SIZE + 2);
+
+		rdmnet_put_flags_length(p, RDMNET_BROKER_HEADER_SIZE + 2);
+		rdmnet_put16(&p[3], VECTOR_BROKER_DISCONNECT);
+		rdmnet_put16(&p[RDMNET_BROKER_HEADER_SIZE], E133_DISCONNECT_SHUTDOWN);
+
+		Flush();
+		m_bConnected = false;
+	}
+
+	bool IsConnected(void) const {
+		return m_bConnected;
+	}
+
+	/*
+	 * Without reading, the notifications fill the socket buffers and then the transmit buffer of the client
+	 */
+	void SetReading(bool bReading) {
+		m_bReading = bReading;
+	}
+
+	bool HasRoom(void) const {
+		return (m_nTxLength + REQUEST_MAX) <= sizeof(m_aTx);
+	}
+
+	uint32_t GetOutstanding(void) const {
+		return m_nOutstanding;
+	}
+
+	uint32_t GetNotifications(void) const {
+		return m_nNotifications;
+	}
+
+	uint32_t GetStatus(void) const {
+		return m_nStatus;
+	}
+
+	uint16_t GetLastStatus(void) const {
+		return m_nLastStatus;
+	}
+
+	uint32_t GetConnects(void) const {
+		return m_nConnects;
+	}
+
+	uint32_t GetErrors(void) const {
+		return m_nErrors;
+	}
+
+private:
+	void Error(const char *pMessage) {
+		fprintf(stderr, "Error: %s\n", pMessage);
+		m_nErrors++;
+	}
+
+	uint8_t *BeginMessage(uint32_t nVector, uint32_t nLength) {
+		const uint32_t nRootLength = RDMNET_ROOT_LAYER_HEADER_SIZE + nLength;
+
+		if ((m_nTxLength + RDMNET_TCP_PREAMBLE_SIZE + nRootLength) > sizeof(m_aTx)) {
+			fprintf(stderr, "Broker transmit buffer overflow\n");
+			exit(EXIT_FAILURE);
+		}
+
+		uint8_t *p = &m_aTx[m_nTxLength];
+
+		memcpy(p, RDMNET_ACN_PACKET_IDENTIFIER, RDMNET_ACN_PACKET_IDENTIFIER_LENGTH);
+		rdmnet_put32(&p[RDMNET_ACN_PACKET_IDENTIFIER_LENGTH], nRootLength);
+		p += RDMNET_TCP_PREAMBLE_SIZE;
+		rdmnet_put_flags_length(p, nRootLength);
+		rdmnet_put32(&p[3], nVector);
+		memcpy(&p[7], s_aBrokerCID, 16);
+
+		m_nTxLength += RDMNET_TCP_PREAMBLE_SIZE + nRootLength;
+
+		return &p[RDMNET_ROOT_LAYER_HEADER_SIZE];
+	}
+
+	void Flush(void) {
+		if ((m_nClient < 0) || (m_nTxLength == 0)) {
+			return;
+		}
+
+		const ssize_t nSent = send(m_nClient, m_aTx, m_nTxLength, MSG_NOSIGNAL);
+
+		if (nSent > 0) {
+			m_nTxLength -= (uint32_t) nSent;
+			memmove(m_aTx, &m_aTx[nSent], m_nTxLength);
+		}
+	}
+
+	void HandleRootLayer(const uint8_t *pPdu) {
+		const uint32_t nLength = rdmnet_get_length(pPdu) - RDMNET_ROOT_LAYER_HEADER_SIZE;
+		const uint8_t *pData = &pPdu[RDMNET_ROOT_LAYER_HEADER_SIZE];
+
+		switch (rdmnet_get32(&pPdu[3])) {
+		case VECTOR_ROOT_BROKER:
+			HandleBroker(pData, nLength);
+			break;
+		case VECTOR_ROOT_RPT:
+			HandleRpt(pData);
+			break;
+		default:
+			Error("unknown root vector");
+			break;
+		}
+	}
+
+	void HandleBroker(const uint8_t *pPdu, uint32_t nLength) {
+		const uint16_t nVector = rdmnet_get16(&pPdu[3]);
+
+		if (nVector == VECTOR_BROKER_NULL) {
+			return;
+		}
+
+		if (nVector == VECTOR_BROKER_DISCONNECT) {
+			m_bConnected = false;
+			return;
+		}
+
+		if (nVector != VECTOR_BROKER_CONNECT) {
+			Error("unexpected broker vector");
+			return;
+		}
+
+		const uint8_t *pConnect = &pPdu[RDMNET_BROKER_HEADER_SIZE];
+		const uint8_t *pEntry = &pConnect[RDMNET_CLIENT_CONNECT_SIZE];
+		uint16_t nCode = E133_CONNECT_OK;
+
+		if (nLength != (RDMNET_BROKER_HEADER_SIZE + RDMNET_CLIENT_CONNECT_SIZE + RDMNET_CLIENT_ENTRY_SIZE)) {
+			Error("Client Connect length");
+			nCode = E133_CONNECT_INVALID_CLIENT_ENTRY;
+		} else if (strncmp((const char *) pConnect, E133_DEFAULT_SCOPE, E133_SCOPE_STRING_PADDED_LENGTH) != 0) {
+			nCode = E133_CONNECT_SCOPE_MISMATCH;
+		} else if ((rdmnet_get16(&pConnect[E133_SCOPE_STRING_PADDED_LENGTH]) != E133_VERSION)
+				|| (rdmnet_get32(&pEntry[3]) != E133_CLIENT_PROTOCOL_RPT) || (pEntry[29] != RPT_CLIENT_TYPE_DEVICE)) {
+			Error("Client Entry");
+			nCode = E133_CONNECT_INVALID_CLIENT_ENTRY;
+		}
+
+		memcpy(m_aClientUID, &pEntry[23], 6);
+
+		uint8_t *p = BeginMessage(VECTOR_ROOT_BROKER, RDMNET_BROKER_HEADER_SIZE + RDMNET_CONNECT_REPLY_SIZE);
+
+		rdmnet_put_flags_length(p, RDMNET_BROKER_HEADER_SIZE + RDMNET_CONNECT_REPLY_SIZE);
+		rdmnet_put16(&p[3], VECTOR_BROKER_CONNECT_REPLY);
+		p += RDMNET_BROKER_HEADER_SIZE;
+		rdmnet_put16(p, nCode);
+		rdmnet_put16(&p[2], E133_VERSION);
+		memcpy(&p[4], s_aBrokerUID, 6);
+		memcpy(&p[10], m_aClientUID, 6);
+
+		if (nCode == E133_CONNECT_OK) {
+			printf("Client %.2x%.2x:%.2x%.2x%.2x%.2x connected\n", m_aClientUID[0], m_aClientUID[1], m_aClientUID[2], m_aClientUID[3], m_aClientUID[4], m_aClientUID[5]);
+			m_bConnected = true;
+			m_nConnects++;
+		}
+	}
+
+	void HandleRpt(const uint8_t *pPdu) {
+		const uint32_t nVector = rdmnet_get32(&pPdu[3]);
+		const uint32_t nSequence = rdmnet_get32(&pPdu[RDMNET_RPT_SEQUENCE_NUMBER]);
+
+		if (memcmp(&pPdu[RDMNET_RPT_DESTINATION_UID], s_aControllerUID, 6) != 0) {
+			Error("RPT destination UID");
+		}
+
+		if (nSequence != (m_nSequence - m_nOutstanding)) {
+			Error("RPT sequence number out of order");
+		}
+
+		m_nOutstanding--;
+
+		if (nVector == VECTOR_RPT_STATUS) {
+			m_nLastStatus = rdmnet_get16(&pPdu[RDMNET_RPT_HEADER_SIZE + 3]);
+			m_nStatus++;
+			return;
+		}
+
+		if (nVector != VECTOR_RPT_NOTIFICATION) {
+			Error("unexpected RPT vector");
+			return;
+		}
+
+		const uint8_t *pNotification = &pPdu[RDMNET_RPT_HEADER_SIZE];
+		const uint8_t *pCommand = &pNotification[RDMNET_REQUEST_HEADER_SIZE];
+		const uint8_t *pResponse = &pCommand[rdmnet_get_length(pCommand)];
+		const struct TRdmMessageNoSc *pRdm = (const struct TRdmMessageNoSc *) &pResponse[RDMNET_RDM_COMMAND_HEADER_SIZE];
+
+		if ((rdmnet_get32(&pNotification[3]) != VECTOR_NOTIFICATION_RDM_CMD) || (pCommand[3] != VECTOR_RDM_CMD_RDM_DATA) || (pResponse[3] != VECTOR_RDM_CMD_RDM_DATA)) {
+			Error("Notification PDU");
+			return;
+		}
+
+		if ((pRdm->command_class != E120_GET_COMMAND_RESPONSE) || (pRdm->transaction_number != (uint8_t) nSequence) || (memcmp(pRdm->source_uid, m_aClientUID, 6) != 0)) {
+			Error("RDM response");
+			return;
+		}
+
+		m_nNotifications++;
+	}
+
+private:
+	int m_nListen;
+	int m_nClient;
+	bool m_bConnected;
+	bool m_bReading;
+	uint32_t m_nRxLength;
+	uint32_t m_nTxLength;
+	uint32_t m_nSequence;
+	uint32_t m_nOutstanding;
+	uint32_t m_nNotifications;
+	uint32_t m_nStatus;
+	uint16_t m_nLastStatus;
+	uint32_t m_nConnects;
+	uint32_t m_nErrors;
+	uint8_t m_aClientUID[6];
+	uint8_t m_aRx[BUFFER_SIZE];
+	uint8_t m_aTx[BUFFER_SIZE];
+};
+
+static Broker s_Broker;
+static StandinDevice *s_pDevice;
+
+static void poll(void) {
+	if (s_pDevice != 0) {
+		s_pDevice->Run();
+	}
+	s_Broker.Poll();
+}
+
+static bool wait_for(bool (*pCondition)(void), const char *pWhat) {
+	const uint64_t nStart = micros();
+
+	while (!pCondition()) {
+		poll();
+
+		if ((micros() - nStart) > (TIMEOUT_MILLIS * 1000)) {
+			fprintf(stderr, "Timeout waiting for %s\n", pWhat);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool is_connected(void) {
+	return s_Broker.IsConnected();
+}
+
+static bool is_idle(void) {
+	return s_Broker.GetOutstanding() == 0;
+}
+
+/*
+ * Keeps nWindow requests outstanding until nRequests are answered
+ */
+static bool run_requests(uint32_t nRequests, uint32_t nWindow) {
+	const uint32_t nNotifications = s_Broker.GetNotifications();
+	uint32_t nSent = 0;
+	const uint64_t nStart = micros();
+
+	while (nSent < nRequests) {
+		while ((nSent < nRequests) && (s_Broker.GetOutstanding() < nWindow)) {
+			s_Broker.SendGet();
+			nSent++;
+		}
+
+		poll();
+
+		if ((micros() - nStart) > (TIMEOUT_MILLIS * 1000 * 4)) {
+			fprintf(stderr, "Timeout, window %u\n", nWindow);
+			return false;
+		}
+	}
+
+	if (!wait_for(is_idle, "notifications")) {
+		return false;
+	}
+
+	const uint64_t nElapsed = micros() - nStart;
+	const uint32_t nAnswered = s_Broker.GetNotifications() - nNotifications;
+
+	printf("  window %4u: %6u requests in %7.1f ms, %8.0f requests/s\n", nWindow, nAnswered, (float) nElapsed / 1000.0f, (float) nAnswered * 1000000.0f / (float) nElapsed);
+
+	return nAnswered == nRequests;
+}
+
+/*
+ * The broker stops reading until the client holds back the requests. After the broker
+ * reads again, every request must be answered in sequence order, without a drop.
+ */
+static bool run_flow_control(void) {
+	const struct TRDMNetClientStatistics *pStatistics = s_pDevice->GetStatistics();
+	const uint32_t nFlowControl = pStatistics->nFlowControl;
+	const uint32_t nDropped = pStatistics->nDropped;
+	const uint32_t nNotifications = s_Broker.GetNotifications();
+	uint32_t nSent = 0;
+	const uint64_t nStart = micros();
+
+	s_Broker.SetReading(false);
+
+	while ((pStatistics->nFlowControl == nFlowControl) && (nSent < STALL_REQUESTS_MAX)) {
+		while ((nSent < STALL_REQUESTS_MAX) && s_Broker.HasRoom()) {
+			s_Broker.SendGet();
+			nSent++;
+		}
+
+		poll();
+
+		if ((micros() - nStart) > (TIMEOUT_MILLIS * 1000)) {
+			break;
+		}
+	}
+
+	s_Broker.SetReading(true);
+
+	const bool bIdle = wait_for(is_idle, "notifications");
+	const uint32_t nAnswered = s_Broker.GetNotifications() - nNotifications;
+
+	printf("  stalled broker: %6u requests, %u answered, flow control %u, dropped %u\n", nSent, nAnswered,
+			pStatistics->nFlowControl - nFlowControl, pStatistics->nDropped - nDropped);
+
+	if (pStatistics->nFlowControl == nFlowControl) {
+		fprintf(stderr, "The client did not hold back the requests\n");
+		return false;
+	}
+
+	if (pStatistics->nDropped != nDropped) {
+		fprintf(stderr, "The client dropped notifications\n");
+		return false;
+	}
+
+	return bIdle && (nAnswered == nSent);
+}
+
+int main(int argc, char **argv) {
+	Hardware hw;
+
+	uint16_t nPort = 0;
+	uint32_t nRequests = 10000;
+	bool bExternal = false;
+	int c;
+
+	while ((c = getopt(argc, argv, "l:n:")) != -1) {
+		switch (c) {
+		case 'l':
+			nPort = (uint16_t) atoi(optarg);
+			bExternal = true;
+			break;
+		case 'n':
+			nRequests = (uint32_t) atoi(optarg);
+			break;
+		default:
+			fprintf(stderr, "Usage: %s [-l port] [-n requests]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	nPort = s_Broker.Listen(nPort);
+	printf("Broker stand-in listening on port %u\n", nPort);
+
+	if (!bExternal) {
+		s_pDevice = new StandinDevice;
+		s_pDevice->SetBroker(htonl(INADDR_LOOPBACK), nPort);
+		s_pDevice->Start();
+	} else {
+		while (!s_Broker.IsConnected()) {
+			poll();
+			usleep(1000);
+		}
+	}
+
+	bool bPassed = wait_for(is_connected, "Client Connect");
+
+	if (bPassed) {
+		printf("Pipelined GET DEVICE_INFO\n");
+
+		bPassed &= run_requests(nRequests / 10, 1);
+		bPassed &= run_requests(nRequests, 8);
+		bPassed &= run_requests(nRequests, 32);
+		bPassed &= run_requests(nRequests, 256);
+
+		if (s_pDevice != 0) {
+			printf("Flow control\n");
+			bPassed &= run_flow_control();
+		}
+
+		printf("Unknown endpoint\n");
+		s_Broker.SendGet(1);
+		bPassed &= wait_for(is_idle, "status");
+
+		if (s_Broker.GetLastStatus() != VECTOR_RPT_STATUS_UNKNOWN_ENDPOINT) {
+			fprintf(stderr, "Expected status UNKNOWN_ENDPOINT, got %u\n", s_Broker.GetLastStatus());
+			bPassed = false;
+		}
+
+		printf("Broker disconnect and reconnect\n");
+		s_Broker.SendDisconnect();
+		bPassed &= wait_for(is_connected, "reconnect");
+	}
+
+	if (s_pDevice != 0) {
+		s_pDevice->Print();
+		s_pDevice->Stop();
+		delete s_pDevice;
+	}
+
+	if (s_Broker.GetErrors() != 0) {
+		bPassed = false;
+	}
+
+	printf("%s: %u notifications, %u status, %u connects, %u errors\n", bPassed ? "PASSED" : "FAILED",
+			s_Broker.GetNotifications(), s_Broker.GetStatus(), s_Broker.GetConnects(), s_Broker.GetErrors());
+
+	return bPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -27,6 +27,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
+#include <arpa/inet.h>
 
 #include "hardware.h"
 #include "networklinux.h"
@@ -50,10 +51,29 @@ int main(int argc, char **argv) {
 	FirmwareVersion fw(SOFTWARE_VERSION, __DATE__, __TIME__);
 
 	if (argc < 2) {
-		printf("Usage: %s ip_address|interface_name\n", argv[0]);
+		printf("Usage: %s ip_address|interface_name [broker_ip_address:port]\n", argv[0]);
 		return -1;
 	}
 
+	uint32_t nBrokerIp = 0;
+	int nBrokerPort = 0;
+
+	if (argc > 2) {
+		char *pPort = strchr(argv[2], ':');
+
+		if (pPort != 0) {
+			*pPort++ = '\0';
+			nBrokerPort = atoi(pPort);
+		}
+
+		nBrokerIp = inet_addr(argv[2]);
+
+		if ((nBrokerIp == INADDR_NONE) || (nBrokerPort <= 0) || (nBrokerPort > 0xFFFF)) {
+			fprintf(stderr, "Invalid broker, expected broker_ip_address:port\n");
+			return -1;
+		}
+	}
+
 	fw.Print();
 
 	if (nw.Init(argv[1]) < 0) {
@@ -79,6 +99,10 @@ int main(int argc, char **argv) {
 		rdmDeviceParams.Dump();
 	}
 
+	if (argc > 2) {
+		device.SetBroker(nBrokerIp, (uint16_t) nBrokerPort);
+	}
+
 	device.Init();
 	device.Print();
 	device.Start();
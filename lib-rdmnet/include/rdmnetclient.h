@@ -0,0 +1,143 @@
+/**
+ * @file rdmnetclient.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef RDMNETCLIENT_H_
+#define RDMNETCLIENT_H_
+
+#include <stdint.h>
+
+#include "e133.h"
+
+/*
+ * The bare-metal network stack has no TCP, the broker client is Linux only
+ */
+#if !defined (RDMNET_LLRP_ONLY) && !defined (BARE_METAL)
+ #define RDMNET_BROKER_CLIENT
+#endif
+
+#define RDMNET_CLIENT_RX_BUFFER_SIZE		2048
+#define RDMNET_CLIENT_TX_BUFFER_SIZE		4096
+#define RDMNET_CLIENT_CONNECT_TIMEOUT		5000	///< Milliseconds
+#define RDMNET_CLIENT_RETRY_MIN				1000	///< Milliseconds
+#define RDMNET_CLIENT_RETRY_MAX				30000	///< Milliseconds
+
+enum TRDMNetClientState {
+	RDMNET_CLIENT_STATE_DISCONNECTED,
+	RDMNET_CLIENT_STATE_CONNECTING,		///< TCP connect in progress
+	RDMNET_CLIENT_STATE_CONNECT_SENT,	///< Waiting for the Connect Reply
+	RDMNET_CLIENT_STATE_CONNECTED
+};
+
+struct TRDMNetClientStatistics {
+	uint32_t nConnects;
+	uint32_t nRequests;
+	uint32_t nNotifications;
+	uint32_t nStatus;
+	uint32_t nFlowControl;	///< Parsing held back because the transmit buffer was full
+	uint32_t nDropped;		///< Messages not fitting in the transmit buffer
+};
+
+/*
+ * RPT Device client for an E1.33 broker, next to the LLRP Target.
+ * The broker is static configured (no DNS-SD).
+ *
+ * Requests are pipelined: all complete messages in the receive buffer are
+ * handled in one Run, and their notifications are appended to the transmit
+ * buffer. When the transmit buffer cannot take another notification, the
+ * remaining requests stay in the receive buffer and TCP flow control pushes
+ * back to the broker.
+ */
+class RDMNetClient {
+public:
+	RDMNetClient(void);
+	virtual ~RDMNetClient(void);
+
+	void SetBroker(uint32_t nIp, uint16_t nPort);
+	void SetScope(const char *pScope);
+
+	void Start(void);
+	void Stop(void);
+	void Run(void);
+
+	void Print(void);
+
+	TRDMNetClientState GetState(void) const {
+		return m_tState;
+	}
+
+	bool IsConnected(void) const {
+		return m_tState == RDMNET_CLIENT_STATE_CONNECTED;
+	}
+
+	const struct TRDMNetClientStatistics *GetStatistics(void) const {
+		return &m_tStatistics;
+	}
+
+protected:
+	virtual void CopyUID(uint8_t *pUID)=0;
+	virtual void CopyCID(uint8_t *pCID)=0;
+	virtual uint8_t *RPTHandleRdmCommand(const uint8_t *pRdmDataNoSC)=0;
+
+private:
+	void Connect(void);
+	void Disconnect(void);
+	void Receive(void);
+	void Flush(void);
+
+	bool HandleRootLayer(const uint8_t *pPdu, uint32_t nLength);
+	bool HandleBroker(const uint8_t *pPdu, uint32_t nLength);
+	bool HandleRpt(const uint8_t *pPdu, uint32_t nLength);
+
+	uint8_t *BeginMessage(uint32_t nVector, uint32_t nLength);
+	void PutRptHeader(uint8_t *pRptPdu, const uint8_t *pRequest, uint32_t nVector, uint32_t nLength);
+	void SendConnect(void);
+	void SendNull(void);
+	void SendDisconnect(void);
+	void SendStatus(const uint8_t *pRptPdu, uint16_t nStatusCode);
+	void SendNotification(const uint8_t *pRptPdu, const uint8_t *pCommand, uint32_t nCommandLength, const uint8_t *pResponse);
+
+private:
+	uint32_t m_nBrokerIp;
+	uint16_t m_nBrokerPort;
+	int32_t m_nHandle;
+	TRDMNetClientState m_tState;
+	bool m_bIsStarted;
+	uint32_t m_nMillis;
+	uint32_t m_nStateMillis;
+	uint32_t m_nRetryMillis;
+	uint32_t m_nLastRecvMillis;
+	uint32_t m_nLastSendMillis;
+	uint32_t m_nRxLength;
+	uint32_t m_nTxLength;
+	uint8_t m_aUID[6];
+	uint8_t m_aCID[16];
+	uint8_t m_aBrokerUID[6];
+	char m_aScope[E133_SCOPE_STRING_PADDED_LENGTH];
+	struct TRDMNetClientStatistics m_tStatistics;
+	uint8_t *m_pRxBuffer;
+	uint8_t *m_pTxBuffer;
+};
+
+#endif /* RDMNETCLIENT_H_ */
@@ -30,13 +30,18 @@
 
 #include "rdmdeviceresponder.h"
 #include "llrpdevice.h"
+#include "rdmnetclient.h"
 
 #include "rdmhandler.h"
 
 #include "e131.h"
 #include "e131uuid.h"
 
-class RDMNetDevice: public RDMDeviceResponder, LLRPDevice {
+class RDMNetDevice: public RDMDeviceResponder, LLRPDevice
+#if defined (RDMNET_BROKER_CLIENT)
+	, RDMNetClient
+#endif
+{
 public:
 	RDMNetDevice(RDMPersonality *pRDMPersonality);
 	~RDMNetDevice(void);
@@ -47,10 +52,23 @@ public:
 
 	void Print(void);
 
+#if defined (RDMNET_BROKER_CLIENT)
+	void SetBroker(uint32_t nIp, uint16_t nPort) {
+		RDMNetClient::SetBroker(nIp, nPort);
+	}
+
+	void SetScope(const char *pScope) {
+		RDMNetClient::SetScope(pScope);
+	}
+#endif
+
 	void CopyUID(uint8_t *pUID) override;
 	void CopyCID(uint8_t *pCID) override;
 
 	uint8_t *LLRPHandleRdmCommand(const uint8_t *pRdmDataNoSC) override;
+#if defined (RDMNET_BROKER_CLIENT)
+	uint8_t *RPTHandleRdmCommand(const uint8_t *pRdmDataNoSC) override;
+#endif
 
 private:
 	RDMHandler *m_RDMHandler;
@@ -0,0 +1,98 @@
+/**
+ * @file rdmnetpdu.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef RDMNETPDU_H_
+#define RDMNETPDU_H_
+
+#include <stdint.h>
+
+#include "e133.h"
+
+/*
+ * The broker and RPT PDUs are variable length and are nested, so these are
+ * built and parsed with offsets instead of packed structures.
+ * All multi-byte fields are big-endian.
+ */
+
+#define RDMNET_ACN_PACKET_IDENTIFIER		"ASC-E1.17\0\0\0"
+#define RDMNET_ACN_PACKET_IDENTIFIER_LENGTH	12
+
+#define RDMNET_TCP_PREAMBLE_SIZE			16	///< ACN Packet Identifier + PDU block size
+#define RDMNET_ROOT_LAYER_HEADER_SIZE		23	///< Flags/Length + Vector + CID
+#define RDMNET_BROKER_HEADER_SIZE			5	///< Flags/Length + Vector
+#define RDMNET_RPT_HEADER_SIZE				28	///< Flags/Length + Vector + UIDs + Endpoints + Sequence + Reserved
+#define RDMNET_REQUEST_HEADER_SIZE			7	///< Flags/Length + Vector, also for the Notification PDU
+#define RDMNET_RDM_COMMAND_HEADER_SIZE		4	///< Flags/Length + Vector
+#define RDMNET_STATUS_HEADER_SIZE			5	///< Flags/Length + Vector
+
+#define RDMNET_CLIENT_CONNECT_SIZE			(E133_SCOPE_STRING_PADDED_LENGTH + 2 + E133_DOMAIN_STRING_PADDED_LENGTH + 1)
+#define RDMNET_CLIENT_ENTRY_SIZE			46	///< Flags/Length + Protocol + CID + UID + Type + Binding CID
+#define RDMNET_CONNECT_REPLY_SIZE			16	///< Code + Version + Broker UID + Client UID
+
+/*
+ * RPT PDU header offsets
+ */
+#define RDMNET_RPT_SOURCE_UID				7
+#define RDMNET_RPT_SOURCE_ENDPOINT			13
+#define RDMNET_RPT_DESTINATION_UID			15
+#define RDMNET_RPT_DESTINATION_ENDPOINT		21
+#define RDMNET_RPT_SEQUENCE_NUMBER			23
+
+#define RDMNET_PDU_FLAGS					0xF0
+
+inline static void rdmnet_put16(uint8_t *p, uint16_t n) {
+	p[0] = (uint8_t) (n >> 8);
+	p[1] = (uint8_t) n;
+}
+
+inline static void rdmnet_put32(uint8_t *p, uint32_t n) {
+	p[0] = (uint8_t) (n >> 24);
+	p[1] = (uint8_t) (n >> 16);
+	p[2] = (uint8_t) (n >> 8);
+	p[3] = (uint8_t) n;
+}
+
+inline static uint16_t rdmnet_get16(const uint8_t *p) {
+	return (uint16_t) ((p[0] << 8) | p[1]);
+}
+
+inline static uint32_t rdmnet_get32(const uint8_t *p) {
+	return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | (uint32_t) p[3];
+}
+
+/**
+ * Flags and the 20-bit PDU length, the length includes the Flags/Length field itself
+ */
+inline static void rdmnet_put_flags_length(uint8_t *p, uint32_t nLength) {
+	p[0] = (uint8_t) (RDMNET_PDU_FLAGS | ((nLength >> 16) & 0x0F));
+	p[1] = (uint8_t) (nLength >> 8);
+	p[2] = (uint8_t) nLength;
+}
+
+inline static uint32_t rdmnet_get_length(const uint8_t *p) {
+	return ((uint32_t) (p[0] & 0x0F) << 16) | ((uint32_t) p[1] << 8) | (uint32_t) p[2];
+}
+
+#endif /* RDMNETPDU_H_ */
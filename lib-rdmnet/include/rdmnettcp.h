@@ -0,0 +1,63 @@
+/**
+ * @file rdmnettcp.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef RDMNETTCP_H_
+#define RDMNETTCP_H_
+
+#include <stdint.h>
+
+/*
+ * Non-blocking TCP client transport for the broker connection.
+ * The IP address is in network byte order, as used by Network.
+ * Only a Linux implementation exists, the bare-metal network stack has no TCP.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @return handle, or -1 when the connect could not be started
+ */
+extern int32_t rdmnet_tcp_connect(uint32_t nIp, uint16_t nPort);
+/**
+ * @return 1 when connected, 0 when the connect is in progress, -1 on failure
+ */
+extern int32_t rdmnet_tcp_is_connected(int32_t nHandle);
+/**
+ * @return number of bytes sent, 0 when the send would block, -1 on error
+ */
+extern int32_t rdmnet_tcp_send(int32_t nHandle, const uint8_t *pData, uint32_t nLength);
+/**
+ * @return number of bytes received, 0 when nothing is pending, -1 when the connection is closed
+ */
+extern int32_t rdmnet_tcp_recv(int32_t nHandle, uint8_t *pData, uint32_t nSize);
+extern void rdmnet_tcp_close(int32_t nHandle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RDMNETTCP_H_ */
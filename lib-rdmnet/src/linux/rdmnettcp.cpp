@@ -0,0 +1,153 @@
+/**
+ * @file rdmnettcp.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <assert.h>
+
+#include "rdmnettcp.h"
+
+#include "debug.h"
+
+#ifndef MSG_NOSIGNAL
+ #define MSG_NOSIGNAL 0
+#endif
+
+int32_t rdmnet_tcp_connect(uint32_t nIp, uint16_t nPort) {
+	DEBUG_ENTRY
+
+	const int nSocket = socket(AF_INET, SOCK_STREAM, 0);
+
+	if (nSocket < 0) {
+		perror("socket");
+		DEBUG_EXIT
+		return -1;
+	}
+
+	int nTrue = 1;
+	setsockopt(nSocket, IPPROTO_TCP, TCP_NODELAY, &nTrue, sizeof(nTrue));
+#if defined (SO_NOSIGPIPE)
+	setsockopt(nSocket, SOL_SOCKET, SO_NOSIGPIPE, &nTrue, sizeof(nTrue));
+#endif
+
+	if (fcntl(nSocket, F_SETFL, fcntl(nSocket, F_GETFL, 0) | O_NONBLOCK) < 0) {
+		perror("fcntl");
+		close(nSocket);
+		DEBUG_EXIT
+		return -1;
+	}
+
+	struct sockaddr_in si_other;
+	memset(&si_other, 0, sizeof(si_other));
+	si_other.sin_family = AF_INET;
+	si_other.sin_addr.s_addr = nIp;
+	si_other.sin_port = htons(nPort);
+
+	if ((connect(nSocket, (struct sockaddr*) &si_other, sizeof(si_other)) < 0) && (errno != EINPROGRESS)) {
+		DEBUG_PRINTF("connect: %s", strerror(errno));
+		close(nSocket);
+		DEBUG_EXIT
+		return -1;
+	}
+
+	DEBUG_EXIT
+	return nSocket;
+}
+
+int32_t rdmnet_tcp_is_connected(int32_t nHandle) {
+	assert(nHandle >= 0);
+
+	struct sockaddr_in si_other;
+	socklen_t slen = sizeof(si_other);
+
+	if (getpeername(nHandle, (struct sockaddr*) &si_other, &slen) == 0) {
+		return 1;
+	}
+
+	int nError = 0;
+	socklen_t nErrorLength = sizeof(nError);
+
+	getsockopt(nHandle, SOL_SOCKET, SO_ERROR, &nError, &nErrorLength);
+
+	if ((nError == 0) || (nError == EINPROGRESS) || (nError == EALREADY)) {
+		return 0;
+	}
+
+	DEBUG_PRINTF("connect: %s", strerror(nError));
+	return -1;
+}
+
+int32_t rdmnet_tcp_send(int32_t nHandle, const uint8_t *pData, uint32_t nLength) {
+	assert(nHandle >= 0);
+	assert(pData != 0);
+
+	const ssize_t nSent = send(nHandle, pData, nLength, MSG_NOSIGNAL);
+
+	if (nSent < 0) {
+		if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+			return 0;
+		}
+
+		DEBUG_PRINTF("send: %s", strerror(errno));
+		return -1;
+	}
+
+	return (int32_t) nSent;
+}
+
+int32_t rdmnet_tcp_recv(int32_t nHandle, uint8_t *pData, uint32_t nSize) {
+	assert(nHandle >= 0);
+	assert(pData != 0);
+
+	const ssize_t nReceived = recv(nHandle, pData, nSize, 0);
+
+	if (nReceived < 0) {
+		if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+			return 0;
+		}
+
+		DEBUG_PRINTF("recv: %s", strerror(errno));
+		return -1;
+	}
+
+	if (nReceived == 0) {
+		return -1; // Closed by the peer
+	}
+
+	return (int32_t) nReceived;
+}
+
+void rdmnet_tcp_close(int32_t nHandle) {
+	if (nHandle >= 0) {
+		close(nHandle);
+	}
+}
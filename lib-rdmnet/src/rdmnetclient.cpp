@@ -0,0 +1,653 @@
+/**
+ * @file rdmnetclient.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@raspberrypi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "rdmnetclient.h"
+#include "rdmnetpdu.h"
+#include "rdmnettcp.h"
+
+#include "e133.h"
+#include "rdm.h"
+#include "rdm_e120.h"
+
+#include "hardware.h"
+#include "network.h"
+
+#include "debug.h"
+
+#if defined (RDMNET_BROKER_CLIENT)
+
+#define NOTIFICATION_MAX	(RDMNET_TCP_PREAMBLE_SIZE + RDMNET_ROOT_LAYER_HEADER_SIZE + RDMNET_RPT_HEADER_SIZE + RDMNET_REQUEST_HEADER_SIZE + 2 * (RDMNET_RDM_COMMAND_HEADER_SIZE + 257))
+
+static const char s_aState[4][14] = { "Disconnected", "Connecting", "Connect sent", "Connected" };
+
+RDMNetClient::RDMNetClient(void):
+	m_nBrokerIp(0),
+	m_nBrokerPort(0),
+	m_nHandle(-1),
+	m_tState(RDMNET_CLIENT_STATE_DISCONNECTED),
+	m_bIsStarted(false),
+	m_nMillis(0),
+	m_nStateMillis(0),
+	m_nRetryMillis(0),
+	m_nLastRecvMillis(0),
+	m_nLastSendMillis(0),
+	m_nRxLength(0),
+	m_nTxLength(0),
+	m_pRxBuffer(0),
+	m_pTxBuffer(0)
+{
+	DEBUG_ENTRY
+
+	memset(m_aUID, 0, sizeof(m_aUID));
+	memset(m_aCID, 0, sizeof(m_aCID));
+	memset(m_aBrokerUID, 0, sizeof(m_aBrokerUID));
+	memset(&m_tStatistics, 0, sizeof(m_tStatistics));
+
+	SetScope(E133_DEFAULT_SCOPE);
+
+	m_pRxBuffer = new uint8_t[RDMNET_CLIENT_RX_BUFFER_SIZE];
+	assert(m_pRxBuffer != 0);
+
+	m_pTxBuffer = new uint8_t[RDMNET_CLIENT_TX_BUFFER_SIZE];
+	assert(m_pTxBuffer != 0);
+
+	DEBUG_EXIT
+}
+
+RDMNetClient::~RDMNetClient(void) {
+	DEBUG_ENTRY
+
+	rdmnet_tcp_close(m_nHandle);
+
+	delete[] m_pTxBuffer;
+	m_pTxBuffer = 0;
+
+	delete[] m_pRxBuffer;
+	m_pRxBuffer = 0;
+
+	DEBUG_EXIT
+}
+
+void RDMNetClient::SetBroker(uint32_t nIp, uint16_t nPort) {
+	m_nBrokerIp = nIp;
+	m_nBrokerPort = nPort;
+}
+
+void RDMNetClient::SetScope(const char *pScope) {
+	assert(pScope != 0);
+
+	strncpy(m_aScope, pScope, sizeof(m_aScope) - 1);
+	m_aScope[sizeof(m_aScope) - 1] = '\0';
+}
+
+void RDMNetClient::Start(void) {
+	DEBUG_ENTRY
+
+	CopyUID(m_aUID);
+	CopyCID(m_aCID);
+
+	m_nRetryMillis = 0;
+	m_nStateMillis = Hardware::Get()->Millis();
+	m_bIsStarted = true;
+
+	DEBUG_EXIT
+}
+
+void RDMNetClient::Stop(void) {
+	DEBUG_ENTRY
+
+	if (m_tState == RDMNET_CLIENT_STATE_CONNECTED) {
+		m_nMillis = Hardware::Get()->Millis();
+		SendDisconnect();
+		Flush();
+	}
+
+	m_bIsStarted = false;
+
+	if (m_tState != RDMNET_CLIENT_STATE_DISCONNECTED) {
+		Disconnect();
+	}
+
+	DEBUG_EXIT
+}
+
+void RDMNetClient::Run(void) {
+	if (__builtin_expect((!m_bIsStarted || (m_nBrokerIp == 0)), 0)) {
+		return;
+	}
+
+	m_nMillis = Hardware::Get()->Millis();
+
+	switch (m_tState) {
+	case RDMNET_CLIENT_STATE_DISCONNECTED:
+		if ((m_nMillis - m_nStateMillis) >= m_nRetryMillis) {
+			Connect();
+		}
+		break;
+	case RDMNET_CLIENT_STATE_CONNECTING: {
+		const int32_t nResult = rdmnet_tcp_is_connected(m_nHandle);
+
+		if (nResult > 0) {
+			m_tState = RDMNET_CLIENT_STATE_CONNECT_SENT;
+			m_nStateMillis = m_nMillis;
+			m_nLastRecvMillis = m_nMillis;
+			SendConnect();
+			Flush();
+		} else if ((nResult < 0) || ((m_nMillis - m_nStateMillis) >= RDMNET_CLIENT_CONNECT_TIMEOUT)) {
+			Disconnect();
+		}
+	}
+		break;
+	case RDMNET_CLIENT_STATE_CONNECT_SENT:
+	case RDMNET_CLIENT_STATE_CONNECTED:
+		if (m_nTxLength != 0) {
+			Flush();
+		}
+
+		if (m_tState != RDMNET_CLIENT_STATE_DISCONNECTED) {
+			Receive();
+		}
+
+		if (m_tState == RDMNET_CLIENT_STATE_DISCONNECTED) {
+			break;
+		}
+
+		if ((m_tState == RDMNET_CLIENT_STATE_CONNECT_SENT) && ((m_nMillis - m_nStateMillis) >= RDMNET_CLIENT_CONNECT_TIMEOUT)) {
+			DEBUG_PUTS("No Connect Reply");
+			Disconnect();
+			break;
+		}
+
+		if ((m_nMillis - m_nLastRecvMillis) >= (E133_HEARTBEAT_TIMEOUT * 1000)) {
+			DEBUG_PUTS("Heartbeat timeout");
+			Disconnect();
+			break;
+		}
+
+		if ((m_tState == RDMNET_CLIENT_STATE_CONNECTED) && ((m_nMillis - m_nLastSendMillis) >= (E133_TCP_HEARTBEAT_INTERVAL * 1000))) {
+			SendNull();
+		}
+
+		if (m_nTxLength != 0) {
+			Flush();
+		}
+		break;
+	default:
+		assert(0);
+		break;
+	}
+}
+
+void RDMNetClient::Connect(void) {
+	DEBUG_ENTRY
+
+	m_nHandle = rdmnet_tcp_connect(m_nBrokerIp, m_nBrokerPort);
+	m_nStateMillis = m_nMillis;
+
+	if (m_nHandle < 0) {
+		m_nRetryMillis = (m_nRetryMillis < RDMNET_CLIENT_RETRY_MIN) ? RDMNET_CLIENT_RETRY_MIN : m_nRetryMillis * 2;
+
+		if (m_nRetryMillis > RDMNET_CLIENT_RETRY_MAX) {
+			m_nRetryMillis = RDMNET_CLIENT_RETRY_MAX;
+		}
+
+		DEBUG_EXIT
+		return;
+	}
+
+	m_nRxLength = 0;
+	m_nTxLength = 0;
+	m_tState = RDMNET_CLIENT_STATE_CONNECTING;
+
+	DEBUG_EXIT
+}
+
+/*
+ * A dropped connection is retried with an exponential back-off.
+ * The handlers can override m_nRetryMillis after the call.
+ */
+void RDMNetClient::Disconnect(void) {
+	DEBUG_ENTRY
+
+	rdmnet_tcp_close(m_nHandle);
+	m_nHandle = -1;
+
+	if (m_tState == RDMNET_CLIENT_STATE_CONNECTED) {
+		m_nRetryMillis = RDMNET_CLIENT_RETRY_MIN;
+	} else {
+		m_nRetryMillis = (m_nRetryMillis < RDMNET_CLIENT_RETRY_MIN) ? RDMNET_CLIENT_RETRY_MIN : m_nRetryMillis * 2;
+
+		if (m_nRetryMillis > RDMNET_CLIENT_RETRY_MAX) {
+			m_nRetryMillis = RDMNET_CLIENT_RETRY_MAX;
+		}
+	}
+
+	m_tState = RDMNET_CLIENT_STATE_DISCONNECTED;
+	m_nStateMillis = m_nMillis;
+	m_nRxLength = 0;
+	m_nTxLength = 0;
+
+	DEBUG_EXIT
+}
+
+void RDMNetClient::Flush(void) {
+	const int32_t nSent = rdmnet_tcp_send(m_nHandle, m_pTxBuffer, m_nTxLength);
+
+	if (nSent < 0) {
+		Disconnect();
+		return;
+	}
+
+	if (nSent == 0) {
+		return;
+	}
+
+	m_nLastSendMillis = m_nMillis;
+	m_nTxLength -= (uint32_t) nSent;
+
+	if (m_nTxLength != 0) {
+		memmove(m_pTxBuffer, &m_pTxBuffer[nSent], m_nTxLength);
+	}
+}
+
+void RDMNetClient::Receive(void) {
+	if (m_nRxLength < RDMNET_CLIENT_RX_BUFFER_SIZE) {
+		const int32_t nReceived = rdmnet_tcp_recv(m_nHandle, &m_pRxBuffer[m_nRxLength], RDMNET_CLIENT_RX_BUFFER_SIZE - m_nRxLength);
+
+		if (nReceived < 0) {
+			Disconnect();
+			return;
+		}
+
+		if (nReceived == 0) {
+			return;
+		}
+
+		m_nRxLength += (uint32_t) nReceived;
+		m_nLastRecvMillis = m_nMillis;
+	}
+
+	uint32_t nOffset = 0;
+
+	while ((m_nRxLength - nOffset) >= RDMNET_TCP_PREAMBLE_SIZE) {
+		const uint8_t *pBlock = &m_pRxBuffer[nOffset];
+		const uint32_t nBlockSize = rdmnet_get32(&pBlock[RDMNET_ACN_PACKET_IDENTIFIER_LENGTH]);
+
+		if ((memcmp(pBlock, RDMNET_ACN_PACKET_IDENTIFIER, RDMNET_ACN_PACKET_IDENTIFIER_LENGTH) != 0) || (nBlockSize > (RDMNET_CLIENT_RX_BUFFER_SIZE - RDMNET_TCP_PREAMBLE_SIZE))) {
+			DEBUG_PUTS("Invalid TCP preamble");
+			Disconnect();
+			return;
+		}
+
+		if ((m_nRxLength - nOffset) < (RDMNET_TCP_PREAMBLE_SIZE + nBlockSize)) {
+			break;
+		}
+
+		// Flow control, the block is handled when there is room for its response
+		if ((m_nTxLength + NOTIFICATION_MAX) > RDMNET_CLIENT_TX_BUFFER_SIZE) {
+			m_tStatistics.nFlowControl++;
+			break;
+		}
+
+		const uint8_t *pPdu = &pBlock[RDMNET_TCP_PREAMBLE_SIZE];
+		uint32_t nRemaining = nBlockSize;
+
+		while (nRemaining >= RDMNET_ROOT_LAYER_HEADER_SIZE) {
+			const uint32_t nLength = rdmnet_get_length(pPdu);
+
+			if ((nLength < RDMNET_ROOT_LAYER_HEADER_SIZE) || (nLength > nRemaining) || !HandleRootLayer(pPdu, nLength)) {
+				DEBUG_PUTS("Invalid PDU");
+				Disconnect();
+				return;
+			}
+
+			if (m_tState == RDMNET_CLIENT_STATE_DISCONNECTED) {
+				return;
+			}
+
+			pPdu += nLength;
+			nRemaining -= nLength;
+		}
+
+		nOffset += RDMNET_TCP_PREAMBLE_SIZE + nBlockSize;
+	}
+
+	if (nOffset != 0) {
+		m_nRxLength -= nOffset;
+
+		if (m_nRxLength != 0) {
+			memmove(m_pRxBuffer, &m_pRxBuffer[nOffset], m_nRxLength);
+		}
+	}
+}
+
+bool RDMNetClient::HandleRootLayer(const uint8_t *pPdu, uint32_t nLength) {
+	const uint32_t nVector = rdmnet_get32(&pPdu[3]);
+
+	switch (nVector) {
+	case VECTOR_ROOT_BROKER:
+		return HandleBroker(&pPdu[RDMNET_ROOT_LAYER_HEADER_SIZE], nLength - RDMNET_ROOT_LAYER_HEADER_SIZE);
+		break;
+	case VECTOR_ROOT_RPT:
+		return HandleRpt(&pPdu[RDMNET_ROOT_LAYER_HEADER_SIZE], nLength - RDMNET_ROOT_LAYER_HEADER_SIZE);
+		break;
+	default:
+		DEBUG_PRINTF("Root vector %x not supported", nVector);
+		break;
+	}
+
+	return true;
+}
+
+bool RDMNetClient::HandleBroker(const uint8_t *pPdu, uint32_t nLength) {
+	if ((nLength < RDMNET_BROKER_HEADER_SIZE) || (rdmnet_get_length(pPdu) > nLength)) {
+		return false;
+	}
+
+	const uint32_t nDataLength = rdmnet_get_length(pPdu) - RDMNET_BROKER_HEADER_SIZE;
+	const uint8_t *pData = &pPdu[RDMNET_BROKER_HEADER_SIZE];
+
+	switch (rdmnet_get16(&pPdu[3])) {
+	case VECTOR_BROKER_CONNECT_REPLY:
+		if ((m_tState != RDMNET_CLIENT_STATE_CONNECT_SENT) || (nDataLength < RDMNET_CONNECT_REPLY_SIZE)) {
+			return true;
+		}
+
+		if (rdmnet_get16(pData) != E133_CONNECT_OK) {
+			DEBUG_PRINTF("Connect refused %d", rdmnet_get16(pData));
+			Disconnect();
+			m_nRetryMillis = RDMNET_CLIENT_RETRY_MAX;
+			return true;
+		}
+
+		memcpy(m_aBrokerUID, &pData[4], sizeof(m_aBrokerUID));
+		m_tState = RDMNET_CLIENT_STATE_CONNECTED;
+		m_nStateMillis = m_nMillis;
+		m_tStatistics.nConnects++;
+		break;
+	case VECTOR_BROKER_REDIRECT_V4:
+		if (nDataLength < 6) {
+			return false;
+		}
+
+		memcpy(&m_nBrokerIp, pData, 4);
+		m_nBrokerPort = rdmnet_get16(&pData[4]);
+		Disconnect();
+		m_nRetryMillis = 0;
+		break;
+	case VECTOR_BROKER_DISCONNECT:
+		Disconnect();
+		break;
+	default:
+		// VECTOR_BROKER_NULL only refreshes the heartbeat, client list updates are for controllers
+		break;
+	}
+
+	return true;
+}
+
+bool RDMNetClient::HandleRpt(const uint8_t *pPdu, uint32_t nLength) {
+	if ((nLength < RDMNET_RPT_HEADER_SIZE) || (rdmnet_get_length(pPdu) > nLength) || (rdmnet_get_length(pPdu) < RDMNET_RPT_HEADER_SIZE)) {
+		return false;
+	}
+
+	const uint32_t nVector = rdmnet_get32(&pPdu[3]);
+
+	if (nVector != VECTOR_RPT_REQUEST) {
+		if ((nVector != VECTOR_RPT_STATUS) && (nVector != VECTOR_RPT_NOTIFICATION)) {
+			SendStatus(pPdu, VECTOR_RPT_STATUS_UNKNOWN_VECTOR);
+		}
+		return true;
+	}
+
+	m_tStatistics.nRequests++;
+
+	if (memcmp(&pPdu[RDMNET_RPT_DESTINATION_UID], m_aUID, sizeof(m_aUID)) != 0) {
+		SendStatus(pPdu, VECTOR_RPT_STATUS_UNKNOWN_RPT_UID);
+		return true;
+	}
+
+	if (rdmnet_get16(&pPdu[RDMNET_RPT_DESTINATION_ENDPOINT]) != E133_NULL_ENDPOINT) {
+		SendStatus(pPdu, VECTOR_RPT_STATUS_UNKNOWN_ENDPOINT);
+		return true;
+	}
+
+	const uint8_t *pRequest = &pPdu[RDMNET_RPT_HEADER_SIZE];
+	const uint32_t nRequestLength = rdmnet_get_length(pPdu) - RDMNET_RPT_HEADER_SIZE;
+
+	if ((nRequestLength < (RDMNET_REQUEST_HEADER_SIZE + RDMNET_RDM_COMMAND_HEADER_SIZE)) || (rdmnet_get32(&pRequest[3]) != VECTOR_REQUEST_RDM_CMD)) {
+		SendStatus(pPdu, VECTOR_RPT_STATUS_UNKNOWN_VECTOR);
+		return true;
+	}
+
+	const uint8_t *pCommand = &pRequest[RDMNET_REQUEST_HEADER_SIZE];
+	const uint32_t nCommandLength = rdmnet_get_length(pCommand);
+	const uint8_t *pRdmDataNoSC = &pCommand[RDMNET_RDM_COMMAND_HEADER_SIZE];
+	const uint32_t nRdmLength = nCommandLength - RDMNET_RDM_COMMAND_HEADER_SIZE;
+
+	if ((nCommandLength > (nRequestLength - RDMNET_REQUEST_HEADER_SIZE)) || (pCommand[3] != VECTOR_RDM_CMD_RDM_DATA)
+			|| (nCommandLength < (RDMNET_RDM_COMMAND_HEADER_SIZE + RDM_MESSAGE_MINIMUM_SIZE + 1))
+			|| (((uint32_t) pRdmDataNoSC[1] + 1) != nRdmLength)) {
+		SendStatus(pPdu, VECTOR_RPT_STATUS_INVALID_MESSAGE);
+		return true;
+	}
+
+	const struct TRdmMessageNoSc *pRdmRequest = (const struct TRdmMessageNoSc *) pRdmDataNoSC;
+
+	if ((pRdmRequest->command_class != E120_GET_COMMAND) && (pRdmRequest->command_class != E120_SET_COMMAND)) {
+		SendStatus(pPdu, VECTOR_RPT_STATUS_INVALID_COMMAND_CLASS);
+		return true;
+	}
+
+	const uint8_t *pResponse = RPTHandleRdmCommand(pRdmDataNoSC);
+
+	if ((pRdmRequest->destination_uid[2] == 0xFF) && (pRdmRequest->destination_uid[3] == 0xFF) && (pRdmRequest->destination_uid[4] == 0xFF) && (pRdmRequest->destination_uid[5] == 0xFF)) {
+		SendStatus(pPdu, VECTOR_RPT_STATUS_BROADCAST_COMPLETE);
+		return true;
+	}
+
+	if (pResponse[0] != E120_SC_RDM) {
+		if (memcmp(pRdmRequest->destination_uid, m_aUID, sizeof(m_aUID)) != 0) {
+			SendStatus(pPdu, VECTOR_RPT_STATUS_UNKNOWN_RDM_UID);
+		} else {
+			SendStatus(pPdu, VECTOR_RPT_STATUS_RDM_INVALID_RESPONSE);
+		}
+		return true;
+	}
+
+	SendNotification(pPdu, pRdmDataNoSC, nRdmLength, pResponse);
+
+	return true;
+}
+
+/**
+ * @return the start of the Root Layer PDU data, 0 when the transmit buffer is full
+ */
+uint8_t *RDMNetClient::BeginMessage(uint32_t nVector, uint32_t nLength) {
+	const uint32_t nRootLength = RDMNET_ROOT_LAYER_HEADER_SIZE + nLength;
+
+	if ((m_nTxLength + RDMNET_TCP_PREAMBLE_SIZE + nRootLength) > RDMNET_CLIENT_TX_BUFFER_SIZE) {
+		m_tStatistics.nDropped++;
+		return 0;
+	}
+
+	uint8_t *p = &m_pTxBuffer[m_nTxLength];
+
+	memcpy(p, RDMNET_ACN_PACKET_IDENTIFIER, RDMNET_ACN_PACKET_IDENTIFIER_LENGTH);
+	rdmnet_put32(&p[RDMNET_ACN_PACKET_IDENTIFIER_LENGTH], nRootLength);
+
+	p += RDMNET_TCP_PREAMBLE_SIZE;
+
+	rdmnet_put_flags_length(p, nRootLength);
+	rdmnet_put32(&p[3], nVector);
+	memcpy(&p[7], m_aCID, sizeof(m_aCID));
+
+	m_nTxLength += RDMNET_TCP_PREAMBLE_SIZE + nRootLength;
+
+	return &p[RDMNET_ROOT_LAYER_HEADER_SIZE];
+}
+
+/*
+ * The response goes back to the requesting controller and endpoint,
+ * with the sequence number of the request.
+ */
+void RDMNetClient::PutRptHeader(uint8_t *pRptPdu, const uint8_t *pRequest, uint32_t nVector, uint32_t nLength) {
+	rdmnet_put_flags_length(pRptPdu, nLength);
+	rdmnet_put32(&pRptPdu[3], nVector);
+	memcpy(&pRptPdu[RDMNET_RPT_SOURCE_UID], m_aUID, sizeof(m_aUID));
+	rdmnet_put16(&pRptPdu[RDMNET_RPT_SOURCE_ENDPOINT], E133_NULL_ENDPOINT);
+	memcpy(&pRptPdu[RDMNET_RPT_DESTINATION_UID], &pRequest[RDMNET_RPT_SOURCE_UID], 6);
+	memcpy(&pRptPdu[RDMNET_RPT_DESTINATION_ENDPOINT], &pRequest[RDMNET_RPT_SOURCE_ENDPOINT], 2);
+	memcpy(&pRptPdu[RDMNET_RPT_SEQUENCE_NUMBER], &pRequest[RDMNET_RPT_SEQUENCE_NUMBER], 4);
+	pRptPdu[RDMNET_RPT_HEADER_SIZE - 1] = 0;
+}
+
+void RDMNetClient::SendConnect(void) {
+	DEBUG_ENTRY
+
+	const uint32_t nLength = RDMNET_BROKER_HEADER_SIZE + RDMNET_CLIENT_CONNECT_SIZE + RDMNET_CLIENT_ENTRY_SIZE;
+	uint8_t *p = BeginMessage(VECTOR_ROOT_BROKER, nLength);
+
+	if (p == 0) {
+		DEBUG_EXIT
+		return;
+	}
+
+	rdmnet_put_flags_length(p, nLength);
+	rdmnet_put16(&p[3], VECTOR_BROKER_CONNECT);
+
+	uint8_t *pConnect = &p[RDMNET_BROKER_HEADER_SIZE];
+
+	memset(pConnect, 0, RDMNET_CLIENT_CONNECT_SIZE);
+	memcpy(pConnect, m_aScope, strlen(m_aScope));
+	rdmnet_put16(&pConnect[E133_SCOPE_STRING_PADDED_LENGTH], E133_VERSION);
+	// Search Domain and Connection Flags are 0, no incremental updates
+
+	uint8_t *pEntry = &pConnect[RDMNET_CLIENT_CONNECT_SIZE];
+
+	rdmnet_put_flags_length(pEntry, RDMNET_CLIENT_ENTRY_SIZE);
+	rdmnet_put32(&pEntry[3], E133_CLIENT_PROTOCOL_RPT);
+	memcpy(&pEntry[7], m_aCID, sizeof(m_aCID));
+	memcpy(&pEntry[23], m_aUID, sizeof(m_aUID));
+	pEntry[29] = RPT_CLIENT_TYPE_DEVICE;
+	memset(&pEntry[30], 0, 16);	// Binding CID
+
+	DEBUG_EXIT
+}
+
+void RDMNetClient::SendNull(void) {
+	uint8_t *p = BeginMessage(VECTOR_ROOT_BROKER, RDMNET_BROKER_HEADER_SIZE);
+
+	if (p != 0) {
+		rdmnet_put_flags_length(p, RDMNET_BROKER_HEADER_SIZE);
+		rdmnet_put16(&p[3], VECTOR_BROKER_NULL);
+	}
+}
+
+void RDMNetClient::SendDisconnect(void) {
+	uint8_t *p = BeginMessage(VECTOR_ROOT_BROKER, RDMNET_BROKER_HEADER_SIZE + 2);
+
+	if (p != 0) {
+		rdmnet_put_flags_length(p, RDMNET_BROKER_HEADER_SIZE + 2);
+		rdmnet_put16(&p[3], VECTOR_BROKER_DISCONNECT);
+		rdmnet_put16(&p[RDMNET_BROKER_HEADER_SIZE], E133_DISCONNECT_SHUTDOWN);
+	}
+}
+
+void RDMNetClient::SendStatus(const uint8_t *pRptPdu, uint16_t nStatusCode) {
+	DEBUG_PRINTF("Status %d", nStatusCode);
+
+	const uint32_t nLength = RDMNET_RPT_HEADER_SIZE + RDMNET_STATUS_HEADER_SIZE;
+	uint8_t *p = BeginMessage(VECTOR_ROOT_RPT, nLength);
+
+	if (p == 0) {
+		return;
+	}
+
+	PutRptHeader(p, pRptPdu, VECTOR_RPT_STATUS, nLength);
+
+	uint8_t *pStatus = &p[RDMNET_RPT_HEADER_SIZE];
+
+	rdmnet_put_flags_length(pStatus, RDMNET_STATUS_HEADER_SIZE);
+	rdmnet_put16(&pStatus[3], nStatusCode);
+
+	m_tStatistics.nStatus++;
+}
+
+/*
+ * The Notification has the received command followed by the response
+ */
+void RDMNetClient::SendNotification(const uint8_t *pRptPdu, const uint8_t *pCommand, uint32_t nCommandLength, const uint8_t *pResponse) {
+	const uint32_t nResponseLength = (uint32_t) pResponse[2] + 1;	// RDM Command length without SC
+	const uint32_t nNotificationLength = RDMNET_REQUEST_HEADER_SIZE + 2 * RDMNET_RDM_COMMAND_HEADER_SIZE + nCommandLength + nResponseLength;
+	const uint32_t nLength = RDMNET_RPT_HEADER_SIZE + nNotificationLength;
+
+	uint8_t *p = BeginMessage(VECTOR_ROOT_RPT, nLength);
+
+	if (p == 0) {
+		return;
+	}
+
+	PutRptHeader(p, pRptPdu, VECTOR_RPT_NOTIFICATION, nLength);
+
+	uint8_t *pNotification = &p[RDMNET_RPT_HEADER_SIZE];
+
+	rdmnet_put_flags_length(pNotification, nNotificationLength);
+	rdmnet_put32(&pNotification[3], VECTOR_NOTIFICATION_RDM_CMD);
+
+	uint8_t *pRdmCommand = &pNotification[RDMNET_REQUEST_HEADER_SIZE];
+
+	rdmnet_put_flags_length(pRdmCommand, RDMNET_RDM_COMMAND_HEADER_SIZE + nCommandLength);
+	pRdmCommand[3] = VECTOR_RDM_CMD_RDM_DATA;
+	memcpy(&pRdmCommand[RDMNET_RDM_COMMAND_HEADER_SIZE], pCommand, nCommandLength);
+
+	pRdmCommand += RDMNET_RDM_COMMAND_HEADER_SIZE + nCommandLength;
+
+	rdmnet_put_flags_length(pRdmCommand, RDMNET_RDM_COMMAND_HEADER_SIZE + nResponseLength);
+	pRdmCommand[3] = VECTOR_RDM_CMD_RDM_DATA;
+	memcpy(&pRdmCommand[RDMNET_RDM_COMMAND_HEADER_SIZE], &pResponse[1], nResponseLength);
+
+	m_tStatistics.nNotifications++;
+}
+
+void RDMNetClient::Print(void) {
+	printf("RDMNet broker client\n");
+	printf(" Broker        : " IPSTR ":%d\n", IP2STR(m_nBrokerIp), (int) m_nBrokerPort);
+	printf(" Scope         : %s\n", m_aScope);
+	printf(" State         : %s\n", s_aState[m_tState]);
+	printf(" Connects      : %u\n", (unsigned) m_tStatistics.nConnects);
+	printf(" Requests      : %u\n", (unsigned) m_tStatistics.nRequests);
+	printf(" Notifications : %u\n", (unsigned) m_tStatistics.nNotifications);
+	printf(" Status        : %u\n", (unsigned) m_tStatistics.nStatus);
+	printf(" Flow control  : %u\n", (unsigned) m_tStatistics.nFlowControl);
+	printf(" Dropped       : %u\n", (unsigned) m_tStatistics.nDropped);
+}
+
+#endif
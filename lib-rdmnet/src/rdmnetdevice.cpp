@@ -32,9 +32,11 @@
 #include "rdmnetdevice.h"
 
 #include "llrpdevice.h"
+#include "rdmnetclient.h"
 #include "rdmpersonality.h"
 #include "lightset.h"
 #include "rdmdeviceresponder.h"
+#include "rdmsensors.h"
 #include "rdmhandler.h"
 #include "e131uuid.h"
 
@@ -80,6 +82,9 @@ void RDMNetDevice::Start(void) {
 	DEBUG_ENTRY
 
 	LLRPDevice::Start();
+#if defined (RDMNET_BROKER_CLIENT)
+	RDMNetClient::Start();
+#endif
 
 	DEBUG_EXIT
 }
@@ -87,6 +92,9 @@ void RDMNetDevice::Start(void) {
 void RDMNetDevice::Stop(void) {
 	DEBUG_ENTRY
 
+#if defined (RDMNET_BROKER_CLIENT)
+	RDMNetClient::Stop();
+#endif
 	LLRPDevice::Stop();
 
 	DEBUG_EXIT
@@ -94,6 +102,10 @@ void RDMNetDevice::Stop(void) {
 
 void RDMNetDevice::Run(void) {
 	LLRPDevice::Run();
+	RDMSensors::Get()->Run();
+#if defined (RDMNET_BROKER_CLIENT)
+	RDMNetClient::Run();
+#endif
 }
 
 void RDMNetDevice::Print(void) {
@@ -105,6 +117,9 @@ void RDMNetDevice::Print(void) {
 	printf(" CID : %s\n", uuid_str);
 
 	LLRPDevice::Print();
+#if defined (RDMNET_BROKER_CLIENT)
+	RDMNetClient::Print();
+#endif
 	RDMDeviceResponder::Print();
 }
 
@@ -123,3 +138,14 @@ uint8_t* RDMNetDevice::LLRPHandleRdmCommand(const uint8_t *pRdmDataNoSC) {
 
 	return (uint8_t*) m_pRdmCommand;
 }
+
+#if defined (RDMNET_BROKER_CLIENT)
+/*
+ * The same responder answers both LLRP and the broker
+ */
+uint8_t* RDMNetDevice::RPTHandleRdmCommand(const uint8_t *pRdmDataNoSC) {
+	m_RDMHandler->HandleData(pRdmDataNoSC, (uint8_t*) m_pRdmCommand);
+
+	return (uint8_t*) m_pRdmCommand;
+}
+#endif
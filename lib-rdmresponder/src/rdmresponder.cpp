@@ -28,6 +28,7 @@
 #include <assert.h>
 
 #include "rdmdeviceresponder.h"
+#include "rdmsensors.h"
 #include "dmxreceiver.h"
 
 #include "rdmresponder.h"
@@ -104,6 +105,8 @@ int RDMResponder::Run(void) {
 		}
 	}
 
+	RDMSensors::Get()->Run();
+
 	const uint8_t *pRdmDataIn = (uint8_t *) Rdm::Receive(0);
 
 	if (pRdmDataIn == 0) {
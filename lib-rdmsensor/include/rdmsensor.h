@@ -101,12 +101,39 @@ public:
 	void SetValues(void);
 	void Record(void);
 
+	void Update(int16_t nValue);
+
+	bool IsSampled(void) const {
+		return m_bIsSampled;
+	}
+
+	void Invalidate(void) {
+		m_bIsSampled = false;
+	}
+
 public:
 	virtual bool Initialize(void)=0;
 	virtual int16_t GetValue(void)=0;
 
+	/**
+	 * Sensors with a slow conversion split GetValue, the scheduler in RDMSensors
+	 * calls ReadConversion the returned number of milliseconds after StartConversion.
+	 * The default is an immediate read.
+	 */
+	virtual uint32_t StartConversion(void) {
+		return 0;
+	}
+
+	virtual int16_t ReadConversion(void) {
+		return GetValue();
+	}
+
+private:
+	int16_t GetPresent(void);
+
 private:
 	uint8_t m_nSensor;
+	bool m_bIsSampled;
 	struct TRDMSensorDefintion m_tRDMSensorDefintion;
 	struct TRDMSensorValues m_tRDMSensorValues;
 };
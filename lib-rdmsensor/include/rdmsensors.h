@@ -30,6 +30,15 @@
 
 #include "rdmsensor.h"
 
+#define RDM_SENSORS_SAMPLE_INTERVAL_DEFAULT		1000	///< Milliseconds
+
+/*
+ * Run samples the sensors in the background, round-robin with at most one
+ * I2C transaction per call. A slow conversion is started in one call and
+ * read in a later one, only one conversion is in progress at a time as
+ * sensors can share a device (HTU21D, SI7021, INA219).
+ * With a sample interval of 0, or without Run, the sensors are read on request.
+ */
 class RDMSensors {
 public:
 	RDMSensors(void);
@@ -44,6 +53,9 @@ public:
 	void SetValues(uint8_t nSensor);
 	void SetRecord(uint8_t nSensor);
 
+	void SetSampleInterval(uint8_t nSensor, uint32_t nMillis);
+	void Run(void);
+
 public:
     static void staticCallbackFunction(void *p, const char *s);
 
@@ -56,7 +68,12 @@ private:
 
 private:
 	RDMSensor **m_pRDMSensor;
+	uint32_t *m_pSampleInterval;
+	uint32_t *m_pSampleMillis;	///< Next sample, or the end of the conversion in progress
 	uint8_t m_nCount;
+	uint8_t m_nSampleIndex;
+	int16_t m_nConverting;		///< -1 when no conversion is in progress
+	uint32_t m_nMillis;
 
 	static RDMSensors *s_pThis;
 };
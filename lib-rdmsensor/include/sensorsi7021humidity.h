@@ -38,6 +38,9 @@ public:
 	bool Initialize(void);
 	int16_t GetValue(void);
 
+	uint32_t StartConversion(void);
+	int16_t ReadConversion(void);
+
 private:
 };
 
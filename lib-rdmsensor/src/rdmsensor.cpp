@@ -38,7 +38,7 @@
 #define RDM_SENSOR_RECORDED_SUPPORTED		(1 << 0)	///<
 #define RDM_SENSOR_LOW_HIGH_DETECT			(1 << 1)	///<
 
-RDMSensor::RDMSensor(uint8_t nSensor) : m_nSensor(nSensor) {
+RDMSensor::RDMSensor(uint8_t nSensor) : m_nSensor(nSensor), m_bIsSampled(false) {
 	DEBUG1_ENTRY
 
 	m_tRDMSensorDefintion.sensor = m_nSensor;
@@ -68,14 +68,36 @@ void RDMSensor::SetDescription(const char *pDescription) {
 	m_tRDMSensorDefintion.len = i;
 }
 
+/*
+ * When the sensor is sampled by the RDMSensors scheduler, the values are
+ * answered from memory. Otherwise the sensor is read on request.
+ */
+int16_t RDMSensor::GetPresent(void) {
+	if (m_bIsSampled) {
+		return m_tRDMSensorValues.present;
+	}
+
+	return this->GetValue();
+}
+
+void RDMSensor::Update(int16_t nValue) {
+	m_tRDMSensorValues.present = nValue;
+	m_tRDMSensorValues.lowest_detected = MIN(m_tRDMSensorValues.lowest_detected, nValue);
+	m_tRDMSensorValues.highest_detected = MAX(m_tRDMSensorValues.highest_detected, nValue);
+
+	m_bIsSampled = true;
+}
+
 const struct TRDMSensorValues* RDMSensor::GetValues(void) {
 	DEBUG1_ENTRY
 
-	const uint16_t value = this->GetValue();
+	if (!m_bIsSampled) {
+		const int16_t value = this->GetValue();
 
-	m_tRDMSensorValues.present = value;
-	m_tRDMSensorValues.lowest_detected = MIN(m_tRDMSensorValues.lowest_detected, value);
-	m_tRDMSensorValues.highest_detected = MAX(m_tRDMSensorValues.highest_detected, value);
+		m_tRDMSensorValues.present = value;
+		m_tRDMSensorValues.lowest_detected = MIN(m_tRDMSensorValues.lowest_detected, value);
+		m_tRDMSensorValues.highest_detected = MAX(m_tRDMSensorValues.highest_detected, value);
+	}
 
 	DEBUG1_EXIT
 
@@ -85,7 +107,7 @@ const struct TRDMSensorValues* RDMSensor::GetValues(void) {
 void RDMSensor::SetValues(void) {
 	DEBUG1_ENTRY
 
-	const uint16_t value = this->GetValue();
+	const int16_t value = GetPresent();
 
 	m_tRDMSensorValues.present = value;
 	m_tRDMSensorValues.lowest_detected = value;
@@ -98,7 +120,7 @@ void RDMSensor::SetValues(void) {
 void RDMSensor::Record(void) {
 	DEBUG1_ENTRY
 
-	const uint16_t value = this->GetValue();
+	const int16_t value = GetPresent();
 
 	m_tRDMSensorValues.present = value;
 	m_tRDMSensorValues.recorded = value;
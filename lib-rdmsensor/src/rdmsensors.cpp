@@ -29,6 +29,8 @@
 
 #include "rdmsensors.h"
 
+#include "hardware.h"
+
 #include "readconfigfile.h"
 #include "sscan.h"
 
@@ -70,7 +72,15 @@
 
 RDMSensors *RDMSensors::s_pThis = 0;
 
-RDMSensors::RDMSensors(void): m_pRDMSensor(0), m_nCount(0) {
+RDMSensors::RDMSensors(void):
+	m_pRDMSensor(0),
+	m_pSampleInterval(0),
+	m_pSampleMillis(0),
+	m_nCount(0),
+	m_nSampleIndex(0),
+	m_nConverting(-1),
+	m_nMillis(0)
+{
 	DEBUG_ENTRY
 
 	s_pThis = this;
@@ -87,6 +97,8 @@ RDMSensors::~RDMSensors(void) {
 	}
 
 	delete [] m_pRDMSensor;
+	delete [] m_pSampleInterval;
+	delete [] m_pSampleMillis;
 
 	m_nCount = 0;
 }
@@ -97,6 +109,12 @@ void RDMSensors::Init(void) {
 #if defined (RDM_SENSORS_ENABLE) || defined (RDMSENSOR_CPU_ENABLE)
 	m_pRDMSensor = new RDMSensor*[RDM_SENSORS_MAX];
 	assert(m_pRDMSensor != 0);
+
+	m_pSampleInterval = new uint32_t[RDM_SENSORS_MAX];
+	assert(m_pSampleInterval != 0);
+
+	m_pSampleMillis = new uint32_t[RDM_SENSORS_MAX];
+	assert(m_pSampleMillis != 0);
 #endif
 
 #if defined (RDMSENSOR_CPU_ENABLE)
@@ -127,6 +145,8 @@ bool RDMSensors::Add(RDMSensor *pRDMSensor) {
 		return false;
 	}
 
+	m_pSampleInterval[m_nCount] = RDM_SENSORS_SAMPLE_INTERVAL_DEFAULT;
+	m_pSampleMillis[m_nCount] = 0;
 	m_pRDMSensor[m_nCount++] = pRDMSensor;
 
 	return true;
@@ -170,6 +190,71 @@ void RDMSensors::SetRecord(uint8_t nSensor) {
 	}
 }
 
+void RDMSensors::SetSampleInterval(uint8_t nSensor, uint32_t nMillis) {
+	if (nSensor == 0xFF) {
+		for (uint32_t i = 0; i < m_nCount; i++) {
+			SetSampleInterval(i, nMillis);
+		}
+		return;
+	}
+
+	assert(nSensor < m_nCount);
+
+	m_pSampleInterval[nSensor] = nMillis;
+
+	if (nMillis == 0) {
+		m_pRDMSensor[nSensor]->Invalidate();	// Back to reading on request
+	}
+}
+
+void RDMSensors::Run(void) {
+	const uint32_t nMillis = Hardware::Get()->Millis();
+
+	if (__builtin_expect((nMillis == m_nMillis), 1)) {
+		return;
+	}
+
+	m_nMillis = nMillis;
+
+	if (m_nConverting >= 0) {
+		if ((int32_t) (nMillis - m_pSampleMillis[m_nConverting]) < 0) {
+			return;
+		}
+
+		RDMSensor *pSensor = m_pRDMSensor[m_nConverting];
+		pSensor->Update(pSensor->ReadConversion());
+
+		m_pSampleMillis[m_nConverting] = nMillis + m_pSampleInterval[m_nConverting];
+		m_nConverting = -1;
+		return;
+	}
+
+	for (uint32_t i = 0; i < m_nCount; i++) {
+		const uint32_t nSensor = m_nSampleIndex;
+
+		if (++m_nSampleIndex == m_nCount) {
+			m_nSampleIndex = 0;
+		}
+
+		if ((m_pSampleInterval[nSensor] == 0) || ((int32_t) (nMillis - m_pSampleMillis[nSensor]) < 0)) {
+			continue;
+		}
+
+		RDMSensor *pSensor = m_pRDMSensor[nSensor];
+		const uint32_t nConversionMillis = pSensor->StartConversion();
+
+		if (nConversionMillis == 0) {
+			pSensor->Update(pSensor->ReadConversion());
+			m_pSampleMillis[nSensor] = nMillis + m_pSampleInterval[nSensor];
+		} else {
+			m_pSampleMillis[nSensor] = nMillis + nConversionMillis;
+			m_nConverting = (int16_t) nSensor;
+		}
+
+		return;
+	}
+}
+
 void RDMSensors::staticCallbackFunction(void *p, const char *s) {
 	assert(p != 0);
 	assert(s != 0);
@@ -70,6 +70,21 @@ bool SensorHTU21DHumidity::Initialize(void) {
 int16_t SensorHTU21DHumidity::GetValue(void) {
 	const int16_t nValue = (int16_t) htu21d_get_humidity(&sDeviceInfo);
 
+#ifndef NDEBUG
+	printf("%s\tnValue=%d\n", __FUNCTION__, (int) nValue);
+#endif
+	return nValue;
+}
+
+uint32_t SensorHTU21DHumidity::StartConversion(void) {
+	htu21d_start_humidity(&sDeviceInfo);
+
+	return HTU21D_CONVERSION_MILLIS;
+}
+
+int16_t SensorHTU21DHumidity::ReadConversion(void) {
+	const int16_t nValue = (int16_t) htu21d_read_humidity(&sDeviceInfo);
+
 #ifndef NDEBUG
 	printf("%s\tnValue=%d\n", __FUNCTION__, (int) nValue);
 #endif
@@ -70,6 +70,21 @@ bool SensorHTU21DTemperature::Initialize(void) {
 int16_t SensorHTU21DTemperature::GetValue(void) {
 	const int16_t nValue = (int16_t) htu21d_get_temperature(&sDeviceInfo);
 
+#ifndef NDEBUG
+	printf("%s\tnValue=%d\n", __FUNCTION__, (int) nValue);
+#endif
+	return nValue;
+}
+
+uint32_t SensorHTU21DTemperature::StartConversion(void) {
+	htu21d_start_temperature(&sDeviceInfo);
+
+	return HTU21D_CONVERSION_MILLIS;
+}
+
+int16_t SensorHTU21DTemperature::ReadConversion(void) {
+	const int16_t nValue = (int16_t) htu21d_read_temperature(&sDeviceInfo);
+
 #ifndef NDEBUG
 	printf("%s\tnValue=%d\n", __FUNCTION__, (int) nValue);
 #endif
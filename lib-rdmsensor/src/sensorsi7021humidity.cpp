@@ -70,6 +70,21 @@ bool SensorSI7021Humidity::Initialize(void) {
 int16_t SensorSI7021Humidity::GetValue(void) {
 	const int16_t nValue = (int16_t) si7021_get_humidity(&sDeviceInfo);
 
+#ifndef NDEBUG
+	printf("%s\tnValue=%d\n", __FUNCTION__, (int) nValue);
+#endif
+	return nValue;
+}
+
+uint32_t SensorSI7021Humidity::StartConversion(void) {
+	si7021_start_humidity(&sDeviceInfo);
+
+	return SI7021_CONVERSION_MILLIS;
+}
+
+int16_t SensorSI7021Humidity::ReadConversion(void) {
+	const int16_t nValue = (int16_t) si7021_read_humidity(&sDeviceInfo);
+
 #ifndef NDEBUG
 	printf("%s\tnValue=%d\n", __FUNCTION__, (int) nValue);
 #endif
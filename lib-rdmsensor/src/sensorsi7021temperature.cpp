@@ -70,6 +70,21 @@ bool SensorSI7021Temperature::Initialize(void) {
 int16_t SensorSI7021Temperature::GetValue(void) {
 	const int16_t nValue = (int16_t) si7021_get_temperature(&sDeviceInfo);
 
+#ifndef NDEBUG
+	printf("%s\tnValue=%d\n", __FUNCTION__, (int) nValue);
+#endif
+	return nValue;
+}
+
+uint32_t SensorSI7021Temperature::StartConversion(void) {
+	si7021_start_temperature(&sDeviceInfo);
+
+	return SI7021_CONVERSION_MILLIS;
+}
+
+int16_t SensorSI7021Temperature::ReadConversion(void) {
+	const int16_t nValue = (int16_t) si7021_read_temperature(&sDeviceInfo);
+
 #ifndef NDEBUG
 	printf("%s\tnValue=%d\n", __FUNCTION__, (int) nValue);
 #endif
@@ -45,8 +45,10 @@
 #endif
 
 #include "spiflashstore.h"
+#include "trace.h"
 
 #include "tftpfileserver.h"
+#include "remoteconfigbin.h"
 
 enum TRemoteConfig {
 	REMOTE_CONFIG_ARTNET,
@@ -104,7 +106,9 @@ enum TTxtFile {
 
 enum {
 	REMOTE_CONFIG_DISPLAY_NAME_LENGTH = 24,
-	REMOTE_CONFIG_ID_LENGTH = (32 + REMOTE_CONFIG_DISPLAY_NAME_LENGTH + 2) // +2, comma and \n
+	REMOTE_CONFIG_ID_LENGTH = (32 + REMOTE_CONFIG_DISPLAY_NAME_LENGTH + 2), // +2, comma and \n
+	REMOTE_CONFIG_UDP_PORT = 0x2905,
+	REMOTE_CONFIG_UDP_BUFFER_SIZE = 1024
 };
 
 enum TRemoteConfigHandleMode {
@@ -165,6 +169,16 @@ private:
 	void HandleList(void);
 	void HandleUptime(void);
 	void HandleVersion(void);
+#if defined (E131_BRIDGE)
+	void HandleDiscovery(void);
+#endif
+#if defined (ARTNET_NODE) || defined (E131_BRIDGE)
+	void HandleStats(void);
+	uint32_t StatsLine(uint32_t nLength, const char *pProtocol, uint32_t nPort, uint32_t nUniverse, uint32_t nReceived, uint32_t nSequenceLost, uint32_t nOutOfOrder, uint32_t nMerged, uint32_t nMergeTimeouts, uint32_t nDiscarded, uint32_t nUpdates);
+#endif
+#if defined (ENABLE_TRACE)
+	void HandleTrace(void);
+#endif
 
 	void HandleGet(void);
 	void HandleGetRconfigTxt(uint32_t& nSize);
@@ -211,6 +225,7 @@ private:
 #endif
 
 	void HandleTxtFile(void);
+	void HandleTxtFile(uint32_t i);
 	void HandleTxtFileRconfig(void);
 	void HandleTxtFileNetwork(void);
 
@@ -263,6 +278,13 @@ private:
 	void HandleTftpSet(void);
 	void HandleTftpGet(void);
 
+	bool HandleBin(void);
+	bool IsValidBin(bool bSet);
+	uint32_t HandleBinGet(uint8_t *pReply, uint32_t nLength);
+	uint32_t HandleBinSet(uint32_t nLength);
+	uint32_t GetBinDelay(uint32_t nMaxDelay);
+	void RunBin(void);
+
 public:
 	static RemoteConfig* Get(void) {
 		return s_pThis;
@@ -291,6 +313,12 @@ private:
 	uint16_t m_nBytesReceived;
 	TRemoteConfigHandleMode m_tRemoteConfigHandleMode;
 	uint8_t *m_pStoreBuffer;
+	uint8_t *m_pBinBuffer;
+	uint32_t m_nBinReplyLength;
+	uint32_t m_nBinReplyIp;
+	uint32_t m_nBinReplyMillis;
+	uint32_t m_nBinReplyDelay;
+	uint32_t m_nBinRandom;
 };
 
 #endif /* REMOTECONFIG_H_ */
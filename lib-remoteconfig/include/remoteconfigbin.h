@@ -0,0 +1,104 @@
+/**
+ * @file remoteconfigbin.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef REMOTECONFIGBIN_H_
+#define REMOTECONFIGBIN_H_
+
+#include <stdint.h>
+
+/*
+ * Binary request/response mode, next to the text handlers on the same UDP port.
+ *
+ * A datagram is a TRemoteConfigBinHeader followed by nItems items. An item
+ * addresses one key of the params of a SpiFlashStore: the store id (TStore) and
+ * the index of the key in the key table of the params (PROPERTIES_TABLE), with the
+ * TPropertiesType of the key as known by the sender. Items with another type than
+ * the key of the node are rejected with REMOTE_CONFIG_BIN_STATUS_TYPE, the reply
+ * item has the type of the node. Custom keys have no binary value.
+ *
+ * The value is the field of the key, CHAR without the '\0'.
+ *
+ * SET is not written into the store directly: the value is checked as with a txt
+ * line, the set list is updated by the node and the changed struct is passed on
+ * to the Builder and Load of the params, as with "!store#". Stores without a Builder
+ * are read only.
+ *
+ * Request                   | Reply
+ * --------------------------+---------------------------------------------
+ * GET   items               | items + values
+ * SET   items + values      | items (status only)
+ * QUERY items, nMaxDelay    | TRemoteConfigListBin + items + values, sent
+ *                           | after a random delay in [0, nMaxDelay] ms
+ *
+ * All fields are little endian.
+ *
+ * QUERY is meant to be sent to REMOTE_CONFIG_BIN_MULTICAST_IP (or broadcast),
+ * the random delay spreads the replies of a large installation.
+ */
+
+#define REMOTE_CONFIG_BIN_VERSION		3
+#define REMOTE_CONFIG_BIN_MULTICAST_IP	(239 | (255 << 8) | (41 << 16) | (5 << 24))	// 239.255.41.5
+
+#define REMOTE_CONFIG_BIN_MAX_DELAY		1000	///< Milliseconds, QUERY nMaxDelay is clipped
+
+enum TRemoteConfigBinOpCode {
+	REMOTE_CONFIG_BIN_OP_GET = 0x01,
+	REMOTE_CONFIG_BIN_OP_SET = 0x02,
+	REMOTE_CONFIG_BIN_OP_QUERY = 0x03,
+	REMOTE_CONFIG_BIN_OP_REPLY = 0x80	///< OR'ed with the request opcode
+};
+
+enum TRemoteConfigBinStatus {
+	REMOTE_CONFIG_BIN_STATUS_OK,
+	REMOTE_CONFIG_BIN_STATUS_VERSION,	///< Header only, unsupported version
+	REMOTE_CONFIG_BIN_STATUS_OPCODE,	///< Header only, unknown opcode
+	REMOTE_CONFIG_BIN_STATUS_FORMAT,	///< Header only, items do not match the datagram size
+	REMOTE_CONFIG_BIN_STATUS_STORE,		///< Unknown store, read only store (SET) or no SPI flash store
+	REMOTE_CONFIG_BIN_STATUS_RANGE,		///< SET only, the length or the value is not valid for the key
+	REMOTE_CONFIG_BIN_STATUS_WRITE,		///< Write is disabled
+	REMOTE_CONFIG_BIN_STATUS_NO_SPACE,	///< Does not fit in the reply, item and the remaining items are not handled
+	REMOTE_CONFIG_BIN_STATUS_KEY,		///< Unknown key or custom key
+	REMOTE_CONFIG_BIN_STATUS_TYPE		///< The type of the key differs
+};
+
+struct TRemoteConfigBinHeader {
+	uint8_t aSignature[4];	///< "AvRC"
+	uint8_t nVersion;
+	uint8_t nOpCode;		///< TRemoteConfigBinOpCode
+	uint16_t nSequence;		///< Echoed in the reply
+	uint8_t nItems;
+	uint8_t nStatus;		///< Reply only, TRemoteConfigBinStatus
+	uint16_t nMaxDelay;		///< QUERY only, milliseconds
+}__attribute__((packed));
+
+struct TRemoteConfigBinItem {
+	uint8_t nStore;			///< TStore
+	uint8_t nStatus;		///< Reply only, TRemoteConfigBinStatus
+	uint8_t nKey;			///< Index in the key table of the params
+	uint8_t nType;			///< TPropertiesType of the key
+	uint16_t nLength;		///< The value following the item, 0 in a GET request
+}__attribute__((packed));
+
+#endif /* REMOTECONFIGBIN_H_ */
@@ -30,6 +30,9 @@
 
 #include "remoteconfig.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TRemoteConfigParams {
     uint32_t nSetList;
 	bool bDisabled;
@@ -72,6 +75,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -82,6 +86,7 @@ private:
 private:
 	RemoteConfigParamsStore *m_pRemoteConfigParamsStore;
     struct TRemoteConfigParams m_tRemoteConfigParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* REMOTECONFIGPARAMS_H_ */
@@ -49,6 +49,7 @@
 #include "networkparams.h"
 
 #if defined (ARTNET_NODE)
+ #include "artnetnode.h"
  /* artnet.txt */
  #include "artnetparams.h"
  #include "storeartnet.h"
@@ -56,6 +57,7 @@
  #include "storeartnet4.h"
 #endif
 #if defined (E131_BRIDGE)
+ #include "e131bridge.h"
  /* e131.txt */
  #include "e131params.h"
  #include "storee131.h"
@@ -173,8 +175,23 @@ static const char sGetTFTP[] ALIGNED = "?tftp#";
 static const char sSetTFTP[] ALIGNED = "!tftp#";
 #define SET_TFTP_LENGTH (sizeof(sSetTFTP)/sizeof(sSetTFTP[0]) - 1)
 
-#define UDP_PORT			0x2905
-#define UDP_BUFFER_SIZE		1024
+#if defined (E131_BRIDGE)
+static const char sRequestDiscovery[] ALIGNED = "?discovery#";
+ #define REQUEST_DISCOVERY_LENGTH (sizeof(sRequestDiscovery)/sizeof(sRequestDiscovery[0]) - 1)
+#endif
+
+#if defined (ARTNET_NODE) || defined (E131_BRIDGE)
+static const char sRequestStats[] ALIGNED = "?stats#";
+ #define REQUEST_STATS_LENGTH (sizeof(sRequestStats)/sizeof(sRequestStats[0]) - 1)
+#endif
+
+#if defined (ENABLE_TRACE)
+static const char sRequestTrace[] ALIGNED = "?trace#";
+ #define REQUEST_TRACE_LENGTH (sizeof(sRequestTrace)/sizeof(sRequestTrace[0]) - 1)
+#endif
+
+#define UDP_PORT			REMOTE_CONFIG_UDP_PORT
+#define UDP_BUFFER_SIZE		REMOTE_CONFIG_UDP_BUFFER_SIZE
 #define UDP_DATA_MIN_SIZE	MIN(MIN(MIN(MIN(REQUEST_REBOOT_LENGTH, REQUEST_LIST_LENGTH),REQUEST_GET_LENGTH),REQUEST_UPTIME_LENGTH),SET_DISPLAY_LENGTH)
 
 RemoteConfig *RemoteConfig::s_pThis = 0;
@@ -196,8 +213,13 @@ RemoteConfig::RemoteConfig(TRemoteConfig tRemoteConfig, TRemoteConfigMode tRemot
 	m_nIPAddressFrom(0),
 	m_nBytesReceived(0),
 	m_tRemoteConfigHandleMode(REMOTE_CONFIG_HANDLE_MODE_TXT),
-	m_pStoreBuffer(0)
-
+	m_pStoreBuffer(0),
+	m_pBinBuffer(0),
+	m_nBinReplyLength(0),
+	m_nBinReplyIp(0),
+	m_nBinReplyMillis(0),
+	m_nBinReplyDelay(0),
+	m_nBinRandom(0)
 {
 	assert(tRemoteConfig < REMOTE_CONFIG_LAST);
 	assert(tRemoteConfigMode < REMOTE_CONFIG_MODE_LAST);
@@ -223,9 +245,23 @@ RemoteConfig::RemoteConfig(TRemoteConfig tRemoteConfig, TRemoteConfigMode tRemot
 
 	m_pStoreBuffer = new uint8_t[UDP_BUFFER_SIZE];
 	assert(m_pStoreBuffer != 0);
+
+	m_pBinBuffer = new uint8_t[UDP_BUFFER_SIZE];
+	assert(m_pBinBuffer != 0);
+
+	for (uint32_t i = 0; i < sizeof(m_tRemoteConfigListBin.aMacAddress); i++) {
+		m_nBinRandom = (m_nBinRandom << 5) + m_nBinRandom + m_tRemoteConfigListBin.aMacAddress[i];
+	}
+
+	Network::Get()->JoinGroup(m_nHandle, REMOTE_CONFIG_BIN_MULTICAST_IP);
 }
 
 RemoteConfig::~RemoteConfig(void) {
+	Network::Get()->LeaveGroup(m_nHandle, REMOTE_CONFIG_BIN_MULTICAST_IP);
+
+	delete [] m_pBinBuffer;
+	m_pBinBuffer = 0;
+
 	delete [] m_pStoreBuffer;
 	m_pStoreBuffer = 0;
 
@@ -269,6 +305,10 @@ int RemoteConfig::Run(void) {
 		m_pTFTPFileServer->Run();
 	}
 
+	if (__builtin_expect((m_nBinReplyLength != 0), 0)) {
+		RunBin();
+	}
+
 	m_nBytesReceived = Network::Get()->RecvFrom(m_nHandle, m_pUdpBuffer, (uint16_t) UDP_BUFFER_SIZE, &m_nIPAddressFrom, &nForeignPort);
 
 	if (__builtin_expect((m_nBytesReceived < (int) UDP_DATA_MIN_SIZE), 1)) {
@@ -279,6 +319,10 @@ int RemoteConfig::Run(void) {
 	debug_dump((void *)m_pUdpBuffer, m_nBytesReceived);
 #endif
 
+	if (HandleBin()) {
+		return m_nBytesReceived;
+	}
+
 	if (m_pUdpBuffer[m_nBytesReceived - 1] == '\n') {
 		DEBUG_PUTS("\'\\n\'");
 		m_nBytesReceived--;
@@ -302,6 +346,18 @@ int RemoteConfig::Run(void) {
 			HandleDisplayGet();
 		} else if ((m_nBytesReceived >= GET_TFTP_LENGTH) && (memcmp(m_pUdpBuffer, sGetTFTP, GET_TFTP_LENGTH) == 0)) {
 			HandleTftpGet();
+#if defined (E131_BRIDGE)
+		} else if ((m_nBytesReceived >= REQUEST_DISCOVERY_LENGTH) && (memcmp(m_pUdpBuffer, sRequestDiscovery, REQUEST_DISCOVERY_LENGTH) == 0)) {
+			HandleDiscovery();
+#endif
+#if defined (ARTNET_NODE) || defined (E131_BRIDGE)
+		} else if ((m_nBytesReceived >= REQUEST_STATS_LENGTH) && (memcmp(m_pUdpBuffer, sRequestStats, REQUEST_STATS_LENGTH) == 0)) {
+			HandleStats();
+#endif
+#if defined (ENABLE_TRACE)
+		} else if ((m_nBytesReceived >= REQUEST_TRACE_LENGTH) && (memcmp(m_pUdpBuffer, sRequestTrace, REQUEST_TRACE_LENGTH) == 0)) {
+			HandleTrace();
+#endif
 		} else {
 #ifndef NDEBUG
 			Network::Get()->SendTo(m_nHandle, (const uint8_t *)"?#ERROR#\n", 9, m_nIPAddressFrom, UDP_PORT);
@@ -374,6 +430,149 @@ void RemoteConfig::HandleVersion() {
 	DEBUG_EXIT
 }
 
+#if defined (E131_BRIDGE)
+void RemoteConfig::HandleDiscovery(void) {
+	DEBUG_ENTRY
+
+	if (E131Discovery::Get() == 0) {
+#ifndef NDEBUG
+		Network::Get()->SendTo(m_nHandle, (const uint8_t *)"?discovery#ERROR#\n", 18, m_nIPAddressFrom, UDP_PORT);
+#endif
+		DEBUG_EXIT
+		return;
+	}
+
+	uint32_t nPage = 0;
+
+	// Optional source page, ?discovery#<page>
+	for (uint32_t i = REQUEST_DISCOVERY_LENGTH; (i < m_nBytesReceived) && (m_pUdpBuffer[i] >= '0') && (m_pUdpBuffer[i] <= '9'); i++) {
+		nPage = nPage * 10 + (uint32_t) (m_pUdpBuffer[i] - '0');
+	}
+
+	const uint32_t nLength = E131Discovery::Get()->Export(nPage, (char *) m_pUdpBuffer, UDP_BUFFER_SIZE);
+
+	Network::Get()->SendTo(m_nHandle, (const uint8_t *)m_pUdpBuffer, nLength, m_nIPAddressFrom, UDP_PORT);
+
+	DEBUG_EXIT
+}
+#endif
+
+#if defined (ARTNET_NODE) || defined (E131_BRIDGE)
+/*
+ * One line per enabled output port:
+ * <protocol> <port> <universe> rx lost ooo merged timeout discarded updates
+ * A full buffer is sent and the next lines continue in a new datagram.
+ * ?stats#clear resets the counters after sending.
+ */
+void RemoteConfig::HandleStats(void) {
+	DEBUG_ENTRY
+
+	const bool bClear = (m_nBytesReceived == REQUEST_STATS_LENGTH + 5) && (memcmp(&m_pUdpBuffer[REQUEST_STATS_LENGTH], "clear", 5) == 0);
+
+	uint32_t nLength = 0;
+
+#if defined (ARTNET_NODE)
+	ArtNetNode *pArtNetNode = ArtNetNode::Get();
+
+	if (pArtNetNode != 0) {
+		for (uint32_t i = 0; i < (uint32_t) (ARTNET_MAX_PORTS * pArtNetNode->GetPages()); i++) {
+			uint16_t nAddress;
+
+			if (!pArtNetNode->GetPortAddress((uint8_t) i, nAddress)) {
+				continue;
+			}
+
+			const struct TArtNetPortStats *pStats = pArtNetNode->GetPortStats((uint8_t) i);
+
+			nLength = StatsLine(nLength, "artnet", i, nAddress, pStats->nReceived, pStats->nSequenceLost, pStats->nOutOfOrder, pStats->nMerged, pStats->nMergeTimeouts, pStats->nDiscarded, pStats->nUpdates);
+		}
+
+		if (bClear) {
+			pArtNetNode->ClearPortStats();
+		}
+	}
+#endif
+
+#if defined (E131_BRIDGE)
+	E131Bridge *pE131Bridge = E131Bridge::Get();
+
+	if (pE131Bridge != 0) {
+		for (uint32_t i = 0; i < E131_MAX_PORTS; i++) {
+			uint16_t nUniverse;
+
+			if (!pE131Bridge->GetUniverse((uint8_t) i, nUniverse)) {
+				continue;
+			}
+
+			const struct TE131PortStats *pStats = pE131Bridge->GetPortStats((uint8_t) i);
+
+			nLength = StatsLine(nLength, "e131", i, nUniverse, pStats->nReceived, pStats->nSequenceLost, pStats->nOutOfOrder, pStats->nMerged, pStats->nMergeTimeouts, pStats->nDiscarded, pStats->nUpdates);
+		}
+
+		if (bClear) {
+			pE131Bridge->ClearPortStats();
+		}
+	}
+#endif
+
+	if ((nLength != 0) || bClear) {
+		Network::Get()->SendTo(m_nHandle, (const uint8_t *)m_pUdpBuffer, nLength, m_nIPAddressFrom, UDP_PORT);
+	}
+
+	DEBUG_EXIT
+}
+
+uint32_t RemoteConfig::StatsLine(uint32_t nLength, const char *pProtocol, uint32_t nPort, uint32_t nUniverse, uint32_t nReceived, uint32_t nSequenceLost, uint32_t nOutOfOrder, uint32_t nMerged, uint32_t nMergeTimeouts, uint32_t nDiscarded, uint32_t nUpdates) {
+	char aLine[128];
+
+	const int nLineLength = snprintf(aLine, sizeof(aLine), "%s %u %u %u %u %u %u %u %u %u\n", pProtocol, (unsigned) nPort + 1, (unsigned) nUniverse,
+			(unsigned) nReceived, (unsigned) nSequenceLost, (unsigned) nOutOfOrder, (unsigned) nMerged, (unsigned) nMergeTimeouts, (unsigned) nDiscarded, (unsigned) nUpdates);
+
+	assert(nLineLength > 0);
+
+	if ((nLength + (uint32_t) nLineLength) > UDP_BUFFER_SIZE) {
+		Network::Get()->SendTo(m_nHandle, (const uint8_t *)m_pUdpBuffer, nLength, m_nIPAddressFrom, UDP_PORT);
+		nLength = 0;
+	}
+
+	memcpy(&m_pUdpBuffer[nLength], aLine, (size_t) nLineLength);
+
+	return nLength + (uint32_t) nLineLength;
+}
+#endif
+
+#if defined (ENABLE_TRACE)
+/*
+ * All pages are sent at once with the trace frozen, so that the pages are
+ * one consistent snapshot. ?trace#clear empties the trace afterwards.
+ */
+void RemoteConfig::HandleTrace(void) {
+	DEBUG_ENTRY
+
+	const bool bClear = (m_nBytesReceived == REQUEST_TRACE_LENGTH + 5) && (memcmp(&m_pUdpBuffer[REQUEST_TRACE_LENGTH], "clear", 5) == 0);
+
+	Trace::SetFreeze(true);
+
+	const uint32_t nPages = Trace::GetPages(UDP_BUFFER_SIZE);
+
+	uint32_t nPage = 0;
+
+	// An empty trace is one page without entries
+	do {
+		const uint32_t nLength = Trace::Export(nPage, m_pUdpBuffer, UDP_BUFFER_SIZE);
+		Network::Get()->SendTo(m_nHandle, (const uint8_t *)m_pUdpBuffer, nLength, m_nIPAddressFrom, UDP_PORT);
+	} while (++nPage < nPages);
+
+	if (bClear) {
+		Trace::Clear();
+	}
+
+	Trace::SetFreeze(false);
+
+	DEBUG_EXIT
+}
+#endif
+
 void RemoteConfig::HandleList(void) {
 	DEBUG_ENTRY
 
@@ -802,6 +1001,14 @@ void RemoteConfig::HandleTxtFile(void) {
 		}
 	}
 
+	HandleTxtFile(i);
+
+	DEBUG_EXIT
+}
+
+void RemoteConfig::HandleTxtFile(uint32_t i) {
+	DEBUG_ENTRY
+
 	switch (i) {
 	case TXT_FILE_RCONFIG:
 		HandleTxtFileRconfig();
@@ -0,0 +1,426 @@
+/**
+ * @file remoteconfigbin.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+
+#include "remoteconfig.h"
+#include "remoteconfigbin.h"
+
+#include "hardware.h"
+#include "network.h"
+
+#include "spiflashstore.h"
+#include "propertiesparser.h"
+
+#include "remoteconfigparams.h"
+#include "networkparams.h"
+
+#if defined (ARTNET_NODE)
+ #include "artnetparams.h"
+ #include "artnet4params.h"
+#endif
+#if defined (E131_BRIDGE)
+ #include "e131params.h"
+#endif
+#if defined (OSC_SERVER)
+ #include "oscserverparms.h"
+#endif
+#if defined (DMXSEND)
+ #include "dmxparams.h"
+#endif
+#if defined (PIXEL)
+ #include "ws28xxdmxparams.h"
+ #include "tlc59711dmxparams.h"
+#endif
+#if defined (LTC_READER)
+ #include "ltcparams.h"
+ #include "ltcdisplayparams.h"
+ #include "tcnetparams.h"
+#endif
+#if defined (OSC_CLIENT)
+ #include "oscclientparams.h"
+#endif
+#if defined(DISPLAY_UDF)
+ #include "displayudfparams.h"
+#endif
+#if defined(STEPPER)
+ #include "sparkfundmxparams.h"
+#endif
+#if defined(RDM_RESPONDER)
+ #include "rdmdeviceparams.h"
+#endif
+#if defined(SHOWFILE)
+ #include "showfileparams.h"
+#endif
+
+#include "debug.h"
+
+static const uint8_t s_aSignature[] = {'A', 'v', 'R', 'C'};
+
+/*
+ * The stores with a single params struct and its key table. nTxtFile is the handler
+ * for SET, TXT_FILE_LAST is read only (there is no Builder).
+ */
+struct TRemoteConfigBinStore {
+	uint8_t nStore;
+	uint8_t nTxtFile;
+	uint16_t nParamsSize;
+	const struct TPropertiesTable *pTable;
+};
+
+static const struct TRemoteConfigBinStore s_aStores[] = {
+	{ STORE_RCONFIG, TXT_FILE_RCONFIG, sizeof(struct TRemoteConfigParams), &RemoteConfigParams::PROPERTIES_TABLE },
+	{ STORE_NETWORK, TXT_FILE_NETWORK, sizeof(struct TNetworkParams), &NetworkParams::PROPERTIES_TABLE },
+#if defined (ARTNET_NODE)
+	{ STORE_ARTNET, TXT_FILE_ARTNET, sizeof(struct TArtNetParams), &ArtNetParams::PROPERTIES_TABLE },
+	{ STORE_ARTNET4, TXT_FILE_ARTNET, sizeof(struct TArtNet4Params), &ArtNet4Params::PROPERTIES_TABLE },
+#endif
+#if defined (E131_BRIDGE)
+	{ STORE_E131, TXT_FILE_E131, sizeof(struct TE131Params), &E131Params::PROPERTIES_TABLE },
+#endif
+#if defined (OSC_SERVER)
+	{ STORE_OSC, TXT_FILE_OSC, sizeof(struct TOSCServerParams), &OSCServerParams::PROPERTIES_TABLE },
+#endif
+#if defined (DMXSEND)
+	{ STORE_DMXSEND, TXT_FILE_PARAMS, sizeof(struct TDMXParams), &DMXParams::PROPERTIES_TABLE },
+#endif
+#if defined (PIXEL)
+	{ STORE_WS28XXDMX, TXT_FILE_DEVICES, sizeof(struct TWS28xxDmxParams), &WS28xxDmxParams::PROPERTIES_TABLE },
+	{ STORE_TLC5711DMX, TXT_FILE_DEVICES, sizeof(struct TTLC59711DmxParams), &TLC59711DmxParams::PROPERTIES_TABLE },
+#endif
+#if defined (LTC_READER)
+	{ STORE_LTC, TXT_FILE_LTC, sizeof(struct TLtcParams), &LtcParams::PROPERTIES_TABLE },
+	{ STORE_LTCDISPLAY, TXT_FILE_LTCDISPLAY, sizeof(struct TLtcDisplayParams), &LtcDisplayParams::PROPERTIES_TABLE },
+	{ STORE_TCNET, TXT_FILE_TCNET, sizeof(struct TTCNetParams), &TCNetParams::PROPERTIES_TABLE },
+#endif
+#if defined (OSC_CLIENT)
+	{ STORE_OSC_CLIENT, TXT_FILE_OSC_CLIENT, sizeof(struct TOscClientParams), &OscClientParams::PROPERTIES_TABLE },
+#endif
+#if defined(DISPLAY_UDF)
+	{ STORE_DISPLAYUDF, TXT_FILE_DISPLAY_UDF, sizeof(struct TDisplayUdfParams), &DisplayUdfParams::PROPERTIES_TABLE },
+#endif
+#if defined(STEPPER)
+	{ STORE_SPARKFUN, TXT_FILE_SPARKFUN, sizeof(struct TSparkFunDmxParams), &SparkFunDmxParams::PROPERTIES_TABLE },
+#endif
+#if defined(RDM_RESPONDER)
+	{ STORE_RDMDEVICE, TXT_FILE_LAST, sizeof(struct TRDMDeviceParams), &RDMDeviceParams::PROPERTIES_TABLE },
+#endif
+#if defined(SHOWFILE)
+	{ STORE_SHOW, TXT_FILE_LAST, sizeof(struct TShowFileParams), &ShowFileParams::PROPERTIES_TABLE },
+#endif
+};
+
+static const struct TRemoteConfigBinStore *getStore(uint32_t nStore) {
+	for (uint32_t i = 0; i < sizeof(s_aStores) / sizeof(s_aStores[0]); i++) {
+		if (s_aStores[i].nStore == nStore) {
+			return &s_aStores[i];
+		}
+	}
+
+	return 0;
+}
+
+bool RemoteConfig::HandleBin(void) {
+	if ((m_nBytesReceived < sizeof(struct TRemoteConfigBinHeader)) || (memcmp(m_pUdpBuffer, s_aSignature, sizeof(s_aSignature)) != 0)) {
+		return false;
+	}
+
+	DEBUG_ENTRY
+
+	const struct TRemoteConfigBinHeader *pRequest = (const struct TRemoteConfigBinHeader *) m_pUdpBuffer;
+	const uint8_t nOpCode = pRequest->nOpCode;
+	uint8_t nStatus = REMOTE_CONFIG_BIN_STATUS_OK;
+
+	if (pRequest->nVersion != REMOTE_CONFIG_BIN_VERSION) {
+		nStatus = REMOTE_CONFIG_BIN_STATUS_VERSION;
+	} else if ((nOpCode != REMOTE_CONFIG_BIN_OP_GET) && (nOpCode != REMOTE_CONFIG_BIN_OP_SET) && (nOpCode != REMOTE_CONFIG_BIN_OP_QUERY)) {
+		nStatus = REMOTE_CONFIG_BIN_STATUS_OPCODE;
+	} else if (!IsValidBin(nOpCode == REMOTE_CONFIG_BIN_OP_SET)) {
+		nStatus = REMOTE_CONFIG_BIN_STATUS_FORMAT;
+	}
+
+	uint8_t *pReply = m_pStoreBuffer;
+
+	if ((nStatus == REMOTE_CONFIG_BIN_STATUS_OK) && (nOpCode == REMOTE_CONFIG_BIN_OP_QUERY)) {
+		if (m_nBinReplyLength != 0) {
+			DEBUG_PUTS("Query reply is pending");
+			DEBUG_EXIT
+			return true;
+		}
+		pReply = m_pBinBuffer;
+	}
+
+	if ((nStatus == REMOTE_CONFIG_BIN_STATUS_OK) && (nOpCode == REMOTE_CONFIG_BIN_OP_SET)) {
+		// The params handlers use the UDP and store buffers, the request is moved to the query buffer
+		if (m_nBinReplyLength != 0) {
+			Network::Get()->SendTo(m_nHandle, m_pBinBuffer, m_nBinReplyLength, m_nBinReplyIp, REMOTE_CONFIG_UDP_PORT);
+			m_nBinReplyLength = 0;
+		}
+		memcpy(m_pBinBuffer, m_pUdpBuffer, m_nBytesReceived);
+		pRequest = (const struct TRemoteConfigBinHeader *) m_pBinBuffer;
+		pReply = m_pBinBuffer;
+	}
+
+	struct TRemoteConfigBinHeader *pReplyHeader = (struct TRemoteConfigBinHeader *) pReply;
+	const uint16_t nMaxDelay = pRequest->nMaxDelay;
+
+	if (pReply != (uint8_t *) pRequest) {
+		memcpy(pReplyHeader, pRequest, sizeof(struct TRemoteConfigBinHeader));
+	}
+	pReplyHeader->nVersion = REMOTE_CONFIG_BIN_VERSION;
+	pReplyHeader->nOpCode = nOpCode | REMOTE_CONFIG_BIN_OP_REPLY;
+	pReplyHeader->nStatus = nStatus;
+
+	uint32_t nLength = sizeof(struct TRemoteConfigBinHeader);
+
+	if (nStatus != REMOTE_CONFIG_BIN_STATUS_OK) {
+		DEBUG_PRINTF("nStatus=%d", (int) nStatus);
+		pReplyHeader->nItems = 0;
+		Network::Get()->SendTo(m_nHandle, pReply, nLength, m_nIPAddressFrom, REMOTE_CONFIG_UDP_PORT);
+		DEBUG_EXIT
+		return true;
+	}
+
+	if (nOpCode == REMOTE_CONFIG_BIN_OP_SET) {
+		nLength = HandleBinSet(nLength);
+		Network::Get()->SendTo(m_nHandle, pReply, nLength, m_nIPAddressFrom, REMOTE_CONFIG_UDP_PORT);
+		DEBUG_EXIT
+		return true;
+	}
+
+	if (nOpCode == REMOTE_CONFIG_BIN_OP_QUERY) {
+		memcpy(&pReply[nLength], &m_tRemoteConfigListBin, sizeof(struct TRemoteConfigListBin));
+		nLength += sizeof(struct TRemoteConfigListBin);
+	}
+
+	nLength = HandleBinGet(pReply, nLength);
+
+	if (nOpCode == REMOTE_CONFIG_BIN_OP_QUERY) {
+		m_nBinReplyIp = m_nIPAddressFrom;
+		m_nBinReplyMillis = Hardware::Get()->Millis();
+		m_nBinReplyDelay = GetBinDelay(nMaxDelay);
+		m_nBinReplyLength = nLength;
+		DEBUG_PRINTF("m_nBinReplyDelay=%d", m_nBinReplyDelay);
+	} else {
+		Network::Get()->SendTo(m_nHandle, pReply, nLength, m_nIPAddressFrom, REMOTE_CONFIG_UDP_PORT);
+	}
+
+	DEBUG_EXIT
+	return true;
+}
+
+bool RemoteConfig::IsValidBin(bool bSet) {
+	const struct TRemoteConfigBinHeader *pRequest = (const struct TRemoteConfigBinHeader *) m_pUdpBuffer;
+	uint32_t nOffset = sizeof(struct TRemoteConfigBinHeader);
+
+	for (uint32_t i = 0; i < pRequest->nItems; i++) {
+		if ((nOffset + sizeof(struct TRemoteConfigBinItem)) > m_nBytesReceived) {
+			return false;
+		}
+
+		const struct TRemoteConfigBinItem *pItem = (const struct TRemoteConfigBinItem *) &m_pUdpBuffer[nOffset];
+		nOffset += sizeof(struct TRemoteConfigBinItem);
+
+		if (bSet) {
+			nOffset += pItem->nLength;
+		}
+	}
+
+	return (nOffset == m_nBytesReceived);
+}
+
+/*
+ * pKey is the key of the item, when the status is OK
+ */
+static uint8_t getStatus(const struct TRemoteConfigBinItem *pItem, const struct TRemoteConfigBinStore *&pStore, const struct TPropertiesKey *&pKey) {
+	pStore = getStore(pItem->nStore);
+	pKey = 0;
+
+	if ((pStore == 0) || (!SpiFlashStore::Get()->HaveFlashChip())) {
+		return REMOTE_CONFIG_BIN_STATUS_STORE;
+	}
+
+	assert(pStore->nParamsSize <= SpiFlashStore::Get()->GetStoreSize((TStore) pStore->nStore));
+
+	if ((pItem->nKey >= pStore->pTable->nKeys) || (pStore->pTable->pKeys[pItem->nKey].nType == PROPERTIES_TYPE_CUSTOM)) {
+		return REMOTE_CONFIG_BIN_STATUS_KEY;
+	}
+
+	pKey = &pStore->pTable->pKeys[pItem->nKey];
+
+	if (pItem->nType != pKey->nType) {
+		return REMOTE_CONFIG_BIN_STATUS_TYPE;
+	}
+
+	return REMOTE_CONFIG_BIN_STATUS_OK;
+}
+
+uint32_t RemoteConfig::HandleBinGet(uint8_t *pReply, uint32_t nLength) {
+	const struct TRemoteConfigBinHeader *pRequest = (const struct TRemoteConfigBinHeader *) m_pUdpBuffer;
+	struct TRemoteConfigBinHeader *pReplyHeader = (struct TRemoteConfigBinHeader *) pReply;
+	const uint8_t *pSrc = &m_pUdpBuffer[sizeof(struct TRemoteConfigBinHeader)];
+	uint32_t nItems = 0;
+
+	while ((nItems < pRequest->nItems) && ((nLength + sizeof(struct TRemoteConfigBinItem)) <= REMOTE_CONFIG_UDP_BUFFER_SIZE)) {
+		const struct TRemoteConfigBinItem *pItem = (const struct TRemoteConfigBinItem *) pSrc;
+		pSrc += sizeof(struct TRemoteConfigBinItem);
+
+		struct TRemoteConfigBinItem *pReplyItem = (struct TRemoteConfigBinItem *) &pReply[nLength];
+		memcpy(pReplyItem, pItem, sizeof(struct TRemoteConfigBinItem));
+		nLength += sizeof(struct TRemoteConfigBinItem);
+		nItems++;
+
+		const struct TRemoteConfigBinStore *pStore;
+		const struct TPropertiesKey *pKey;
+		uint8_t nStatus = getStatus(pItem, pStore, pKey);
+		uint32_t nDataLength = 0;
+
+		if (nStatus == REMOTE_CONFIG_BIN_STATUS_OK) {
+			nDataLength = PropertiesParser::GetSize(pKey);
+
+			if ((nLength + nDataLength) > REMOTE_CONFIG_UDP_BUFFER_SIZE) {
+				nStatus = REMOTE_CONFIG_BIN_STATUS_NO_SPACE;
+				nDataLength = 0;
+			} else {
+				SpiFlashStore::Get()->CopyTo((TStore) pItem->nStore, &pReply[nLength], nDataLength, pKey->nOffset);
+
+				if (pKey->nType == PROPERTIES_TYPE_CHAR) {
+					const uint32_t nSize = nDataLength - 1;
+					nDataLength = 0;
+
+					while ((nDataLength < nSize) && (pReply[nLength + nDataLength] != '\0')) {
+						nDataLength++;
+					}
+				}
+
+				nLength += nDataLength;
+			}
+		}
+
+		if (pKey != 0) {
+			pReplyItem->nType = pKey->nType;
+		}
+
+		pReplyItem->nStatus = nStatus;
+		pReplyItem->nLength = nDataLength;
+
+		DEBUG_PRINTF("nStore=%d, nKey=%d, nDataLength=%d, nStatus=%d", (int) pReplyItem->nStore, (int) pReplyItem->nKey, (int) nDataLength, (int) nStatus);
+
+		if (nStatus == REMOTE_CONFIG_BIN_STATUS_NO_SPACE) {
+			break;
+		}
+	}
+
+	pReplyHeader->nItems = nItems;
+
+	return nLength;
+}
+
+/*
+ * The request is in m_pBinBuffer, the reply items (without values) are written in place.
+ * Each value is set in a copy of the params struct in m_pStoreBuffer by the PropertiesParser,
+ * which also updates the set list. The struct is then handled as a "!store#" request:
+ * Builder and Load of the params.
+ */
+uint32_t RemoteConfig::HandleBinSet(uint32_t nLength) {
+	const uint32_t nItems = ((const struct TRemoteConfigBinHeader *) m_pBinBuffer)->nItems;
+	const uint8_t *pSrc = &m_pBinBuffer[sizeof(struct TRemoteConfigBinHeader)];
+
+	for (uint32_t i = 0; i < nItems; i++) {
+		struct TRemoteConfigBinItem tItem;
+		memcpy(&tItem, pSrc, sizeof(struct TRemoteConfigBinItem));
+		const uint8_t *pData = pSrc + sizeof(struct TRemoteConfigBinItem);
+		pSrc = pData + tItem.nLength;
+
+		const struct TRemoteConfigBinStore *pStore;
+		const struct TPropertiesKey *pKey;
+		uint8_t nStatus = getStatus(&tItem, pStore, pKey);
+
+		if (nStatus == REMOTE_CONFIG_BIN_STATUS_OK) {
+			if (pStore->nTxtFile == TXT_FILE_LAST) {
+				nStatus = REMOTE_CONFIG_BIN_STATUS_STORE;
+			} else if (m_bDisableWrite) {
+				nStatus = REMOTE_CONFIG_BIN_STATUS_WRITE;
+			}
+		}
+
+		if (nStatus == REMOTE_CONFIG_BIN_STATUS_OK) {
+			SpiFlashStore::Get()->CopyTo((TStore) tItem.nStore, m_pStoreBuffer, pStore->nParamsSize, 0);
+
+			PropertiesParser parser(pStore->pTable, m_pStoreBuffer);
+
+			if (parser.Set(tItem.nKey, pData, tItem.nLength)) {
+				m_tRemoteConfigHandleMode = REMOTE_CONFIG_HANDLE_MODE_BIN;
+				m_nBytesReceived = pStore->nParamsSize;
+
+				HandleTxtFile(pStore->nTxtFile);
+			} else {
+				nStatus = REMOTE_CONFIG_BIN_STATUS_RANGE;
+			}
+		}
+
+		if (pKey != 0) {
+			tItem.nType = pKey->nType;
+		}
+
+		tItem.nStatus = nStatus;
+		tItem.nLength = 0;
+		memcpy(&m_pBinBuffer[nLength], &tItem, sizeof(struct TRemoteConfigBinItem));
+		nLength += sizeof(struct TRemoteConfigBinItem);
+
+		DEBUG_PRINTF("nStore=%d, nKey=%d, nStatus=%d", (int) tItem.nStore, (int) tItem.nKey, (int) nStatus);
+	}
+
+	((struct TRemoteConfigBinHeader *) m_pBinBuffer)->nItems = nItems;
+
+	return nLength;
+}
+
+uint32_t RemoteConfig::GetBinDelay(uint32_t nMaxDelay) {
+	if (nMaxDelay == 0) {
+		return 0;
+	}
+
+	if (nMaxDelay > REMOTE_CONFIG_BIN_MAX_DELAY) {
+		nMaxDelay = REMOTE_CONFIG_BIN_MAX_DELAY;
+	}
+
+	// Seeded with the MAC address, so that nodes receiving the same query pick different delays
+	m_nBinRandom = (m_nBinRandom * 1103515245) + 12345 + Hardware::Get()->Micros();
+
+	return (m_nBinRandom >> 16) % (nMaxDelay + 1);
+}
+
+void RemoteConfig::RunBin(void) {
+	if ((Hardware::Get()->Millis() - m_nBinReplyMillis) < m_nBinReplyDelay) {
+		return;
+	}
+
+	Network::Get()->SendTo(m_nHandle, m_pBinBuffer, m_nBinReplyLength, m_nBinReplyIp, REMOTE_CONFIG_UDP_PORT);
+
+	m_nBinReplyLength = 0;
+}
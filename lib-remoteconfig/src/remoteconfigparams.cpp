@@ -40,14 +40,27 @@
 #include "remoteconfigconst.h"
 
 #include "readconfigfile.h"
-#include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
 #include "debug.h"
 
 #define BOOL2STRING(b)			(b) ? "Yes" : "No"
 
-RemoteConfigParams::RemoteConfigParams(RemoteConfigParamsStore* pTRemoteConfigParamsStore): m_pRemoteConfigParamsStore(pTRemoteConfigParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TRemoteConfigParams, f)
+
+static const struct TPropertiesKey s_Keys[] = {
+	{ RemoteConfigConst::PARAMS_DISABLE, OFFSET(bDisabled), PROPERTIES_TYPE_BOOL, REMOTE_CONFIG_PARAMS_DISABLED, 0, 0 },
+	{ RemoteConfigConst::PARAMS_DISABLE_WRITE, OFFSET(bDisableWrite), PROPERTIES_TYPE_BOOL, REMOTE_CONFIG_PARAMS_DISABLE_WRITE, 0, 0 },
+	{ RemoteConfigConst::PARAMS_ENABLE_REBOOT, OFFSET(bEnableReboot), PROPERTIES_TYPE_BOOL, REMOTE_CONFIG_PARAMS_ENABLE_REBOOT, 0, 0 },
+	{ RemoteConfigConst::PARAMS_ENABLE_UPTIME, OFFSET(bEnableUptime), PROPERTIES_TYPE_BOOL, REMOTE_CONFIG_PARAMS_ENABLE_UPTIME, 0, 0 },
+	{ RemoteConfigConst::PARAMS_DISPLAY_NAME, OFFSET(aDisplayName), PROPERTIES_TYPE_CHAR, REMOTE_CONFIG_PARAMS_DISPLAY_NAME, 0, REMOTE_CONFIG_DISPLAY_NAME_LENGTH }
+};
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable RemoteConfigParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B1 };
+
+RemoteConfigParams::RemoteConfigParams(RemoteConfigParamsStore* pTRemoteConfigParamsStore): m_pRemoteConfigParamsStore(pTRemoteConfigParamsStore), m_pPropertiesParser(0) {
 	uint8_t *p = (uint8_t *) &m_tRemoteConfigParams;
 
 	for (uint32_t i = 0; i < sizeof(struct TRemoteConfigParams); i++) {
@@ -62,9 +75,16 @@ RemoteConfigParams::~RemoteConfigParams(void) {
 bool RemoteConfigParams::Load(void) {
 	m_tRemoteConfigParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tRemoteConfigParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(RemoteConfigParams::staticCallbackFunction, this);
 
-	if (configfile.Read(RemoteConfigConst::PARAMS_FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(RemoteConfigConst::PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pRemoteConfigParamsStore != 0) {
 			m_pRemoteConfigParamsStore->Update(&m_tRemoteConfigParams);
@@ -85,49 +105,23 @@ void RemoteConfigParams::Load(const char* pBuffer, uint32_t nLength) {
 
 	m_tRemoteConfigParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tRemoteConfigParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(RemoteConfigParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pRemoteConfigParamsStore->Update(&m_tRemoteConfigParams);
 }
 
 void RemoteConfigParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
-	uint8_t value8;
-	uint8_t len;
-
-	if (Sscan::Uint8(pLine, RemoteConfigConst::PARAMS_DISABLE, &value8) == SSCAN_OK) {
-		m_tRemoteConfigParams.bDisabled = (value8 != 0);
-		m_tRemoteConfigParams.nSetList |= REMOTE_CONFIG_PARAMS_DISABLED;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, RemoteConfigConst::PARAMS_DISABLE_WRITE, &value8) == SSCAN_OK) {
-		m_tRemoteConfigParams.bDisableWrite = (value8 != 0);
-		m_tRemoteConfigParams.nSetList |= REMOTE_CONFIG_PARAMS_DISABLE_WRITE;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, RemoteConfigConst::PARAMS_ENABLE_REBOOT, &value8) == SSCAN_OK) {
-		m_tRemoteConfigParams.bEnableReboot = (value8 != 0);
-		m_tRemoteConfigParams.nSetList |= REMOTE_CONFIG_PARAMS_ENABLE_REBOOT;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, RemoteConfigConst::PARAMS_ENABLE_UPTIME, &value8) == SSCAN_OK) {
-		m_tRemoteConfigParams.bEnableUptime = (value8 != 0);
-		m_tRemoteConfigParams.nSetList |= REMOTE_CONFIG_PARAMS_ENABLE_UPTIME;
-		return;
-	}
-
-	len = REMOTE_CONFIG_DISPLAY_NAME_LENGTH - 1;
-	if (Sscan::Char(pLine, RemoteConfigConst::PARAMS_DISPLAY_NAME, (char *) m_tRemoteConfigParams.aDisplayName, &len) == SSCAN_OK) {
-		m_tRemoteConfigParams.aDisplayName[len] = '\0';
-		m_tRemoteConfigParams.nSetList |= REMOTE_CONFIG_PARAMS_DISPLAY_NAME;
-		return;
-	}
+	m_pPropertiesParser->Parse(pLine);
 }
 
 void RemoteConfigParams::Builder(const struct TRemoteConfigParams* pRemoteConfigParams, uint8_t* pBuffer, uint32_t nLength, uint32_t& nSize) {
@@ -30,6 +30,9 @@
 
 #include "showfile.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TShowFileParams {
     uint32_t nSetList;
     uint8_t nFormat;
@@ -101,6 +104,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void HandleOptions(const char *pLine, const char *pKeyword, TShowFileOptions tShowFileOptions);
@@ -115,6 +119,7 @@ private:
 private:
     ShowFileParamsStore *m_pShowFileParamsStore;
     struct TShowFileParams m_tShowFileParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* SHOWFILEPARAMS_H_ */
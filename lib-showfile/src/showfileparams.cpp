@@ -37,6 +37,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
 #include "showfileosc.h"
@@ -50,7 +51,40 @@
 
 #define PROTOCOL2STRING(p)		(p == SHOWFILE_PROTOCOL_SACN) ? "sACN" : "Art-Net"
 
-ShowFileParams::ShowFileParams(ShowFileParamsStore *pShowFileParamsStore): m_pShowFileParamsStore(pShowFileParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TShowFileParams, f)
+
+enum TShowFileParamsKey {
+	KEY_FORMAT,
+	KEY_OSC_PORT_INCOMING,
+	KEY_OSC_PORT_OUTGOING,
+	KEY_SHOW,
+	KEY_PROTOCOL,
+	KEY_SACN_SYNC_UNIVERSE,
+	KEY_ARTNET_DISABLE_UNICAST,
+	KEY_OPTION_AUTO_START,
+	KEY_OPTION_LOOP,
+	KEY_LAST
+};
+
+// Must be in the order of TShowFileParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ ShowFileParamsConst::FORMAT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ OscConst::PARAMS_INCOMING_PORT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ OscConst::PARAMS_OUTGOING_PORT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ShowFileParamsConst::SHOW, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ShowFileParamsConst::PROTOCOL, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ShowFileParamsConst::SACN_SYNC_UNIVERSE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ShowFileParamsConst::ARTNET_DISABLE_UNICAST, OFFSET(nDisableUnicast), PROPERTIES_TYPE_FLAG, SHOWFILE_PARAMS_MASK_ARTNET_UNICAST, 0, 0 },
+	{ ShowFileParamsConst::OPTION_AUTO_START, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ ShowFileParamsConst::OPTION_LOOP, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TShowFileParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable ShowFileParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 6, 0x9E3779B3 };
+
+ShowFileParams::ShowFileParams(ShowFileParamsStore *pShowFileParamsStore): m_pShowFileParamsStore(pShowFileParamsStore), m_pPropertiesParser(0) {
 	DEBUG_ENTRY
 
 	m_tShowFileParams.nSetList = 0;
@@ -75,9 +109,16 @@ ShowFileParams::~ShowFileParams(void) {
 bool ShowFileParams::Load(void) {
 	m_tShowFileParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tShowFileParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(ShowFileParams::staticCallbackFunction, this);
 
-	if (configfile.Read(ShowFileParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(ShowFileParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pShowFileParamsStore != 0) {
 			m_pShowFileParamsStore->Update(&m_tShowFileParams);
@@ -103,10 +144,15 @@ void ShowFileParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tShowFileParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tShowFileParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(ShowFileParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pShowFileParamsStore->Update(&m_tShowFileParams);
 }
 
@@ -129,100 +175,94 @@ void ShowFileParams::HandleOptions(const char *pLine, const char *pKeyword, TSho
 
 void ShowFileParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	char value[16];
 	uint8_t nLength;
 	uint8_t value8;
 	uint16_t value16;
 
-	nLength = SHOWFILECONST_FORMAT_NAME_LENGTH - 1;
-	if (Sscan::Char(pLine, ShowFileParamsConst::FORMAT, value, &nLength) == SSCAN_OK) {
-		value[nLength] = '\0';
-
-		TShowFileFormats tFormat = ShowFile::GetFormat(value);
-
-		if (tFormat != SHOWFILE_FORMAT_UNDEFINED) {
-			m_tShowFileParams.nFormat = tFormat;
-			m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_FORMAT;
-		} else {
-			m_tShowFileParams.nFormat = SHOWFILE_FORMAT_OLA;
-			m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_FORMAT;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_FORMAT:
+		nLength = SHOWFILECONST_FORMAT_NAME_LENGTH - 1;
+		if (Sscan::Char(pLine, ShowFileParamsConst::FORMAT, value, &nLength) == SSCAN_OK) {
+			value[nLength] = '\0';
+			TShowFileFormats tFormat = ShowFile::GetFormat(value);
+			if (tFormat != SHOWFILE_FORMAT_UNDEFINED) {
+				m_tShowFileParams.nFormat = tFormat;
+				m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_FORMAT;
+			} else {
+				m_tShowFileParams.nFormat = SHOWFILE_FORMAT_OLA;
+				m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_FORMAT;
+			}
 		}
-
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, OscConst::PARAMS_INCOMING_PORT, &value16) == SSCAN_OK) {
-		if (value16 > 1023) {
-			m_tShowFileParams.nOscPortIncoming = value16;
-			m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_OSC_PORT_INCOMING;
-		} else {
-			m_tShowFileParams.nOscPortIncoming = OSCSERVER_PORT_DEFAULT_INCOMING;
-			m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_OSC_PORT_INCOMING;
+		break;
+	case KEY_OSC_PORT_INCOMING:
+		if (Sscan::Uint16(pLine, OscConst::PARAMS_INCOMING_PORT, &value16) == SSCAN_OK) {
+			if (value16 > 1023) {
+				m_tShowFileParams.nOscPortIncoming = value16;
+				m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_OSC_PORT_INCOMING;
+			} else {
+				m_tShowFileParams.nOscPortIncoming = OSCSERVER_PORT_DEFAULT_INCOMING;
+				m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_OSC_PORT_INCOMING;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, OscConst::PARAMS_OUTGOING_PORT, &value16) == SSCAN_OK) {
-		if (value16 > 1023) {
-			m_tShowFileParams.nOscPortOutgoing = value16;
-			m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_OSC_PORT_OUTGOING;
-		} else {
-			m_tShowFileParams.nOscPortOutgoing = OSCSERVER_PORT_DEFAULT_OUTGOING;
-			m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_OSC_PORT_OUTGOING;
-		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, ShowFileParamsConst::SHOW, &value8) == SSCAN_OK) {
-		if (value8 < SHOWFILE_FILE_MAX_NUMBER) {
-			m_tShowFileParams.nShow = value8;
-			m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_SHOW;
-		} else {
-			m_tShowFileParams.nShow = 0;
-			m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_SHOW;
+		break;
+	case KEY_OSC_PORT_OUTGOING:
+		if (Sscan::Uint16(pLine, OscConst::PARAMS_OUTGOING_PORT, &value16) == SSCAN_OK) {
+			if (value16 > 1023) {
+				m_tShowFileParams.nOscPortOutgoing = value16;
+				m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_OSC_PORT_OUTGOING;
+			} else {
+				m_tShowFileParams.nOscPortOutgoing = OSCSERVER_PORT_DEFAULT_OUTGOING;
+				m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_OSC_PORT_OUTGOING;
+			}
 		}
-		return;
-	}
-
-	nLength = 6;
-	if (Sscan::Char(pLine, ShowFileParamsConst::PROTOCOL, value, &nLength) == SSCAN_OK) {
-		value[nLength] = '\0';
-
-		if(strcasecmp(value, "artnet") == 0) {
-			m_tShowFileParams.nProtocol = SHOWFILE_PROTOCOL_ARTNET;
-			m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_PROTOCOL;
-		} else {
-			m_tShowFileParams.nProtocol = SHOWFILE_PROTOCOL_SACN;
-			m_tShowFileParams.nSetList &= SHOWFILE_PARAMS_MASK_PROTOCOL;
+		break;
+	case KEY_SHOW:
+		if (Sscan::Uint8(pLine, ShowFileParamsConst::SHOW, &value8) == SSCAN_OK) {
+			if (value8 < SHOWFILE_FILE_MAX_NUMBER) {
+				m_tShowFileParams.nShow = value8;
+				m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_SHOW;
+			} else {
+				m_tShowFileParams.nShow = 0;
+				m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_SHOW;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, ShowFileParamsConst::SACN_SYNC_UNIVERSE, &value16) == SSCAN_OK) {
-		if (value16 > E131_UNIVERSE_MAX) {
-			m_tShowFileParams.nUniverse = DEFAULT_SYNCHRONIZATION_ADDRESS;
-			m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_SACN_UNIVERSE;
-		} else {
-			m_tShowFileParams.nUniverse = value16;
-			m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_SACN_UNIVERSE;
+		break;
+	case KEY_PROTOCOL:
+		nLength = 6;
+		if (Sscan::Char(pLine, ShowFileParamsConst::PROTOCOL, value, &nLength) == SSCAN_OK) {
+			value[nLength] = '\0';
+			if(strcasecmp(value, "artnet") == 0) {
+				m_tShowFileParams.nProtocol = SHOWFILE_PROTOCOL_ARTNET;
+				m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_PROTOCOL;
+			} else {
+				m_tShowFileParams.nProtocol = SHOWFILE_PROTOCOL_SACN;
+				m_tShowFileParams.nSetList &= SHOWFILE_PARAMS_MASK_PROTOCOL;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, ShowFileParamsConst::ARTNET_DISABLE_UNICAST, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
-			m_tShowFileParams.nDisableUnicast = 1;
-			m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_ARTNET_UNICAST;
-		} else {
-			m_tShowFileParams.nDisableUnicast = 0;
-			m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_ARTNET_UNICAST;
+		break;
+	case KEY_SACN_SYNC_UNIVERSE:
+		if (Sscan::Uint16(pLine, ShowFileParamsConst::SACN_SYNC_UNIVERSE, &value16) == SSCAN_OK) {
+			if (value16 > E131_UNIVERSE_MAX) {
+				m_tShowFileParams.nUniverse = DEFAULT_SYNCHRONIZATION_ADDRESS;
+				m_tShowFileParams.nSetList &= ~SHOWFILE_PARAMS_MASK_SACN_UNIVERSE;
+			} else {
+				m_tShowFileParams.nUniverse = value16;
+				m_tShowFileParams.nSetList |= SHOWFILE_PARAMS_MASK_SACN_UNIVERSE;
+			}
 		}
-		return;
+		break;
+	case KEY_OPTION_AUTO_START:
+		HandleOptions(pLine, ShowFileParamsConst::OPTION_AUTO_START, SHOWFILE_OPTION_AUTO_START);
+		break;
+	case KEY_OPTION_LOOP:
+		HandleOptions(pLine, ShowFileParamsConst::OPTION_LOOP, SHOWFILE_OPTION_LOOP);
+		break;
+	default:
+		break;
 	}
-
-	HandleOptions(pLine, ShowFileParamsConst::OPTION_AUTO_START, SHOWFILE_OPTION_AUTO_START);
-	HandleOptions(pLine, ShowFileParamsConst::OPTION_LOOP, SHOWFILE_OPTION_LOOP);
 }
 
 void ShowFileParams::Builder(const struct TShowFileParams *ptShowFileParamss, uint8_t *pBuffer, uint32_t nLength, uint32_t &nSize) {
@@ -39,6 +39,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #ifndef ALIGNED
  #define ALIGNED __attribute__ ((aligned (4)))
@@ -53,10 +54,28 @@ static const char PARAMS_FILE_NAME[] ALIGNED = "spiflash.txt";
 static const char PARAMS_INSTALL_UBOOT[] ALIGNED = "install_uboot";
 static const char PARAMS_INSTALL_UIMAGE[] ALIGNED = "install_uimage";
 
+enum TSpiFlashInstallParamsKey {
+	KEY_INSTALL_UBOOT,
+	KEY_INSTALL_UIMAGE,
+	KEY_LAST
+};
+
+// There is no params struct, all keys are handled in callbackFunction
+static const struct TPropertiesKey s_Keys[] = {
+	{ PARAMS_INSTALL_UBOOT, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_INSTALL_UIMAGE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TSpiFlashInstallParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable SpiFlashInstallParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 4, 0x9E3779B1 };
+
 SpiFlashInstallParams::SpiFlashInstallParams(void):
 		m_nSetList(0),
 		m_bInstalluboot(false),
-		m_bInstalluImage(false) {
+		m_bInstalluImage(false),
+		m_pPropertiesParser(0) {
 }
 
 SpiFlashInstallParams::~SpiFlashInstallParams(void) {
@@ -65,29 +84,39 @@ SpiFlashInstallParams::~SpiFlashInstallParams(void) {
 bool SpiFlashInstallParams::Load(void) {
 	m_nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, 0);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(SpiFlashInstallParams::staticCallbackFunction, this);
-	return configfile.Read(PARAMS_FILE_NAME);
+
+	const bool bHaveFile = configfile.Read(PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	return bHaveFile;
 }
 
 void SpiFlashInstallParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t value8;
 
-	if (Sscan::Uint8(pLine, PARAMS_INSTALL_UBOOT, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_INSTALL_UBOOT:
+		if ((Sscan::Uint8(pLine, PARAMS_INSTALL_UBOOT, &value8) == SSCAN_OK) && (value8 != 0)) {
 			m_bInstalluboot = true;
 			m_nSetList |= INSTALL_UBOOT_MASK;
 		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, PARAMS_INSTALL_UIMAGE, &value8) == SSCAN_OK) {
-		if (value8 != 0) {
+		break;
+	case KEY_INSTALL_UIMAGE:
+		if ((Sscan::Uint8(pLine, PARAMS_INSTALL_UIMAGE, &value8) == SSCAN_OK) && (value8 != 0)) {
 			m_bInstalluImage = true;
 			m_nSetList |= INSTALL_UIMAGE_MASK;
 		}
-		return;
+		break;
+	default:
+		break;
 	}
 }
 
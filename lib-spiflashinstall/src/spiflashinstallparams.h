@@ -29,6 +29,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 class SpiFlashInstallParams {
 public:
 	SpiFlashInstallParams(void);
@@ -47,6 +50,7 @@ public:
 
 public:
 	static void staticCallbackFunction(void *p, const char *s);
+	static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
 	void callbackFunction(const char *pLine);
@@ -58,6 +62,7 @@ private:
 	uint32_t m_nSetList;
 	bool m_bInstalluboot;
 	bool m_bInstalluImage;
+	PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* SPIFLASHINSTALLPARAMS_H_ */
@@ -83,6 +83,9 @@ public:
 	}
 	void Copy(enum TStore tStore, void *pData, uint32_t nDataLength, uint32_t nOffset = 0);
 	void CopyTo(enum TStore tStore, void *pData, uint32_t &nDataLength);
+	void CopyTo(enum TStore tStore, void *pData, uint32_t nDataLength, uint32_t nOffset);
+
+	uint32_t GetStoreSize(enum TStore tStore);
 
 	void UuidUpdate(const uuid_t uuid);
 	void UuidCopyTo(uuid_t uuid);
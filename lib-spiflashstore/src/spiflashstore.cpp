@@ -267,6 +267,31 @@ void SpiFlashStore::CopyTo(enum TStore tStore, void* pData, uint32_t& nDataLengt
 	DEBUG1_EXIT
 }
 
+void SpiFlashStore::CopyTo(enum TStore tStore, void *pData, uint32_t nDataLength, uint32_t nOffset) {
+	DEBUG1_ENTRY
+
+	assert(tStore < STORE_LAST);
+	assert(pData != 0);
+	assert((nDataLength + nOffset) <= s_aStorSize[tStore]);
+
+	const uint8_t *pSrc = (const uint8_t *) &m_aSpiFlashData[GetStoreOffset(tStore)] + nOffset;
+	uint8_t *pDst = (uint8_t *) pData;
+
+	for (uint32_t i = 0; i < nDataLength; i++) {
+		*pDst++ = *pSrc++;
+	}
+
+	DEBUG1_EXIT
+}
+
+uint32_t SpiFlashStore::GetStoreSize(enum TStore tStore) {
+	if (__builtin_expect(((unsigned) tStore >= (unsigned) STORE_LAST), 0)) {
+		return 0;
+	}
+
+	return s_aStorSize[tStore];
+}
+
 bool SpiFlashStore::Flash(void) {
 	if (__builtin_expect((m_tState == STORE_STATE_IDLE), 1)) {
 		return false;
@@ -36,6 +36,9 @@
 
 #include "debug.h"
 
+// The size of STORE_ARTNET in spiflashstore.cpp
+static_assert(sizeof(struct TArtNetParams) <= 144, "struct TArtNetParams does not fit in STORE_ARTNET");
+
 StoreArtNet::StoreArtNet(void) {
 	DEBUG_ENTRY
 
@@ -31,6 +31,9 @@
 #include "tcnet.h"
 #include "tcnetpackets.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TTCNetParams {
 	uint32_t nSetList;
 	uint8_t aNodeName[TCNET_NODE_NAME_LENGTH];
@@ -71,6 +74,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -81,6 +85,7 @@ private:
 private:
 	TCNetParamsStore *m_pTCNetParamsStore;
     struct TTCNetParams	m_tTTCNetParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* TCNETPARAMS_H_ */
@@ -41,9 +41,33 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 #include "propertiesbuilder.h"
 
-TCNetParams::TCNetParams(TCNetParamsStore* pTCNetParamsStore): m_pTCNetParamsStore(pTCNetParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TTCNetParams, f)
+
+enum TTCNetParamsKey {
+	KEY_NODE_NAME,
+	KEY_LAYER,
+	KEY_TIMECODE_TYPE,
+	KEY_USE_TIMECODE,
+	KEY_LAST
+};
+
+// Must be in the order of TTCNetParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ TCNetParamsConst::NODE_NAME, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ TCNetParamsConst::LAYER, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ TCNetParamsConst::TIMECODE_TYPE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ TCNetParamsConst::USE_TIMECODE, OFFSET(nUseTimeCode), PROPERTIES_TYPE_FLAG, TCNET_PARAMS_MASK_USE_TIMECODE, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TTCNetParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable TCNetParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 4, 0x9E3779B5 };
+
+TCNetParams::TCNetParams(TCNetParamsStore* pTCNetParamsStore): m_pTCNetParamsStore(pTCNetParamsStore), m_pPropertiesParser(0) {
 	m_tTTCNetParams.nSetList = 0;
 
 	memset(m_tTTCNetParams.aNodeName, '\0', TCNET_NODE_NAME_LENGTH);
@@ -59,9 +83,16 @@ TCNetParams::~TCNetParams(void) {
 bool TCNetParams::Load(void) {
 	m_tTTCNetParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tTTCNetParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(TCNetParams::staticCallbackFunction, this);
 
-	if (configfile.Read(TCNetParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(TCNetParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pTCNetParamsStore != 0) {
 			m_pTCNetParamsStore->Update(&m_tTTCNetParams);
@@ -86,76 +117,75 @@ void TCNetParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tTTCNetParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tTTCNetParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(TCNetParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pTCNetParamsStore->Update(&m_tTTCNetParams);
 }
 
 void TCNetParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t len;
 	char ch;
 	uint8_t uint8;
 
-	len = TCNET_NODE_NAME_LENGTH;
-	if (Sscan::Char(pLine, TCNetParamsConst::NODE_NAME, (char *) m_tTTCNetParams.aNodeName, &len) == SSCAN_OK) {
-		m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_NODE_NAME;
-		return;
-	}
-
-	len = 1;
-	ch = ' ';
-	if (Sscan::Char(pLine, TCNetParamsConst::LAYER, &ch, &len) == SSCAN_OK) {
-		m_tTTCNetParams.nLayer = (uint8_t) TCNet::GetLayer((uint8_t) ch);
-
-		if (m_tTTCNetParams.nLayer != TCNET_LAYER_UNDEFINED) {
-			m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_LAYER;
-		} else {
-			m_tTTCNetParams.nLayer = TCNET_LAYER_M;
-			m_tTTCNetParams.nSetList &= ~TCNET_PARAMS_MASK_LAYER;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_NODE_NAME:
+		// The node name is not '\0' terminated when it has TCNET_NODE_NAME_LENGTH characters
+		len = TCNET_NODE_NAME_LENGTH;
+		if (Sscan::Char(pLine, TCNetParamsConst::NODE_NAME, (char *) m_tTTCNetParams.aNodeName, &len) == SSCAN_OK) {
+			m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_NODE_NAME;
 		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, TCNetParamsConst::TIMECODE_TYPE, &uint8) == SSCAN_OK) {
-		switch (uint8) {
-		case 24:
-			m_tTTCNetParams.nTimeCodeType = TCNET_TIMECODE_TYPE_FILM;
-			m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
-			break;
-		case 25:
-			m_tTTCNetParams.nTimeCodeType = TCNET_TIMECODE_TYPE_EBU_25FPS;
-			m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
-			break;
-		case 29:
-			m_tTTCNetParams.nTimeCodeType = TCNET_TIMECODE_TYPE_DF;
-			m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
-			break;
-		case 30:
-			m_tTTCNetParams.nTimeCodeType = TCNET_TIMECODE_TYPE_SMPTE_30FPS;
-			m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
-			break;
-		default:
-			m_tTTCNetParams.nSetList &= ~TCNET_PARAMS_MASK_TIMECODE_TYPE;
-			break;
+		break;
+	case KEY_LAYER:
+		len = 1;
+		ch = ' ';
+		if (Sscan::Char(pLine, TCNetParamsConst::LAYER, &ch, &len) == SSCAN_OK) {
+			m_tTTCNetParams.nLayer = (uint8_t) TCNet::GetLayer((uint8_t) ch);
+
+			if (m_tTTCNetParams.nLayer != TCNET_LAYER_UNDEFINED) {
+				m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_LAYER;
+			} else {
+				m_tTTCNetParams.nLayer = TCNET_LAYER_M;
+				m_tTTCNetParams.nSetList &= ~TCNET_PARAMS_MASK_LAYER;
+			}
 		}
-
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, TCNetParamsConst::USE_TIMECODE, &uint8) == SSCAN_OK) {
-		if (uint8 != 0) {
-			m_tTTCNetParams.nUseTimeCode = 1;
-			m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_USE_TIMECODE;
-		} else {
-			m_tTTCNetParams.nUseTimeCode = 0;
-			m_tTTCNetParams.nSetList &= ~TCNET_PARAMS_MASK_USE_TIMECODE;
+		break;
+	case KEY_TIMECODE_TYPE:
+		if (Sscan::Uint8(pLine, TCNetParamsConst::TIMECODE_TYPE, &uint8) == SSCAN_OK) {
+			switch (uint8) {
+			case 24:
+				m_tTTCNetParams.nTimeCodeType = TCNET_TIMECODE_TYPE_FILM;
+				m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
+				break;
+			case 25:
+				m_tTTCNetParams.nTimeCodeType = TCNET_TIMECODE_TYPE_EBU_25FPS;
+				m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
+				break;
+			case 29:
+				m_tTTCNetParams.nTimeCodeType = TCNET_TIMECODE_TYPE_DF;
+				m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
+				break;
+			case 30:
+				m_tTTCNetParams.nTimeCodeType = TCNET_TIMECODE_TYPE_SMPTE_30FPS;
+				m_tTTCNetParams.nSetList |= TCNET_PARAMS_MASK_TIMECODE_TYPE;
+				break;
+			default:
+				m_tTTCNetParams.nSetList &= ~TCNET_PARAMS_MASK_TIMECODE_TYPE;
+				break;
+			}
 		}
-
-		return;
+		break;
+	default:
+		break;
 	}
 }
 
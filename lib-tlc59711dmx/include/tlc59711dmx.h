@@ -30,6 +30,7 @@
 #include <stdbool.h>
 
 #include "lightset.h"
+#include "outputtransform.h"
 
 #include "tlc59711.h"
 #include "tlc59711dmxstore.h"
@@ -67,6 +68,14 @@ public:
 		return m_nSpiSpeedHz;
 	}
 
+	void SetOutputCurve(TOutputTransformCurve tCurve, float fGamma = OUTPUT_TRANSFORM_GAMMA_DEFAULT) {
+		m_OutputTransform.SetCurve(tCurve, fGamma);
+	}
+	void SetOutput16Bit(bool bOutput16Bit);
+	const OutputTransform& GetOutputTransform(void) {
+		return m_OutputTransform;
+	}
+
 	void SetTLC59711DmxStore(TLC59711DmxStore *pTLC59711Store) {
 		m_pTLC59711DmxStore = pTLC59711Store;
 	}
@@ -105,6 +114,9 @@ private:
 	uint32_t m_nSpiSpeedHz;
 	TTLC59711Type m_LEDType;
 	uint8_t m_nLEDCount;
+	uint16_t m_nOutputs;
+	uint16_t *m_pOutput;
+	OutputTransform m_OutputTransform;
 
 	TLC59711DmxStore *m_pTLC59711DmxStore;
 };
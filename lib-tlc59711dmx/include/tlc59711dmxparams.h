@@ -30,19 +30,28 @@
 
 #include "tlc59711dmx.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TTLC59711DmxParams {
     uint32_t nSetList;
 	TTLC59711Type LedType;
 	uint8_t nLedCount;
 	uint16_t nDmxStartAddress;
     uint32_t nSpiSpeedHz;
+    float fOutputGamma;
+    uint8_t nOutputCurve;
+    bool bOutput16Bit;
 };
 
 enum TTLC59711DmxParamsMask {
 	TLC59711DMX_PARAMS_MASK_LED_TYPE = (1 << 0),
 	TLC59711DMX_PARAMS_MASK_LED_COUNT = (1 << 1),
 	TLC59711DMX_PARAMS_MASK_START_ADDRESS = (1 << 2),
-	TLC59711DMX_PARAMS_MASK_SPI_SPEED = (1 << 3)
+	TLC59711DMX_PARAMS_MASK_SPI_SPEED = (1 << 3),
+	TLC59711DMX_PARAMS_MASK_OUTPUT_CURVE = (1 << 4),
+	TLC59711DMX_PARAMS_MASK_OUTPUT_GAMMA = (1 << 5),
+	TLC59711DMX_PARAMS_MASK_OUTPUT_16BIT = (1 << 6)
 };
 
 class TLC59711DmxParamsStore {
@@ -88,6 +97,7 @@ public:
 	static const char *GetLedTypeString(TTLC59711Type tTLC59711Type);
 	static TTLC59711Type GetLedTypeString(const char *pValue);
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *pLine);
@@ -98,6 +108,7 @@ private:
 private:
 	TLC59711DmxParamsStore *m_pLC59711ParamsStore;
     struct TTLC59711DmxParams m_tTLC59711Params;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* TLC59711DMXPARAMS_H_ */
@@ -50,6 +50,9 @@ TLC59711Dmx::TLC59711Dmx(void):
 	m_nSpiSpeedHz(0),
 	m_LEDType(TTLC59711_TYPE_RGB),
 	m_nLEDCount(TLC59711_RGB_CHANNELS),
+	m_nOutputs(0),
+	m_pOutput(0),
+	m_OutputTransform(16),
 	m_pTLC59711DmxStore(0)
 {
 	UpdateMembers();
@@ -58,6 +61,9 @@ TLC59711Dmx::TLC59711Dmx(void):
 TLC59711Dmx::~TLC59711Dmx(void) {
 	delete m_pTLC59711;
 	m_pTLC59711 = 0;
+
+	delete[] m_pOutput;
+	m_pOutput = 0;
 }
 
 void TLC59711Dmx::Start(uint8_t nPort) {
@@ -88,25 +94,24 @@ void TLC59711Dmx::SetData(uint8_t nPort, const uint8_t* pDmxData, uint16_t nLeng
 		Start();
 	}
 
-	uint8_t *p = (uint8_t *)pDmxData + m_nDmxStartAddress - 1;
+	if (__builtin_expect((nLength < m_nDmxStartAddress), 0)) {
+		return;
+	}
 
-	unsigned nDmxAddress = m_nDmxStartAddress;
+	uint32_t nSlots = 1U + nLength - m_nDmxStartAddress;
 
-	for (unsigned i = 0; i < m_nDmxFootprint; i++) {
-		if (nDmxAddress > nLength) {
-			break;
-		}
-
-		const uint16_t nValue = ((uint16_t) *p << 8) | (uint16_t) *p;
+	if (nSlots > m_nDmxFootprint) {
+		nSlots = m_nDmxFootprint;
+	}
 
-		m_pTLC59711->Set((uint8_t) i, nValue);
+	const uint32_t nOutputs = m_OutputTransform.Apply(pDmxData + m_nDmxStartAddress - 1, nSlots, m_pOutput, m_nOutputs);
 
-		p++;
-		nDmxAddress++;
+	if (__builtin_expect((nOutputs == 0), 0)) {
+		return;
 	}
 
-	if (__builtin_expect((nDmxAddress == m_nDmxStartAddress), 0)) {
-		return;
+	for (uint32_t i = 0; i < nOutputs; i++) {
+		m_pTLC59711->Set((uint8_t) i, m_pOutput[i]);
 	}
 
 	if (!m_bBlackout) {
@@ -124,6 +129,11 @@ void TLC59711Dmx::SetLEDCount(uint8_t nLEDCount) {
 	UpdateMembers();
 }
 
+void TLC59711Dmx::SetOutput16Bit(bool bOutput16Bit) {
+	m_OutputTransform.SetResolution(bOutput16Bit ? OUTPUT_TRANSFORM_RESOLUTION_16BIT : OUTPUT_TRANSFORM_RESOLUTION_8BIT);
+	UpdateMembers();
+}
+
 void TLC59711Dmx::SetSpiSpeedHz(uint32_t nSpiSpeedHz) {
 	m_nSpiSpeedHz = nSpiSpeedHz;
 }
@@ -133,16 +143,21 @@ void TLC59711Dmx::Initialize(void) {
 	m_pTLC59711 = new TLC59711(m_nBoardInstances, m_nSpiSpeedHz);
 	assert(m_pTLC59711 != 0);
 	m_pTLC59711->Dump();
+
+	assert(m_pOutput == 0);
+	m_pOutput = new uint16_t[m_nOutputs];
+	assert(m_pOutput != 0);
 }
 
 void TLC59711Dmx::UpdateMembers(void) {
 	if (m_LEDType == TTLC59711_TYPE_RGB) {
-		m_nDmxFootprint = m_nLEDCount * 3;
+		m_nOutputs = m_nLEDCount * 3;
 	} else {
-		m_nDmxFootprint = m_nLEDCount * 4;
+		m_nOutputs = m_nLEDCount * 4;
 	}
 
-	m_nBoardInstances = (uint8_t) ceil((float) m_nDmxFootprint / TLC59711_OUT_CHANNELS);
+	m_nDmxFootprint = m_nOutputs * m_OutputTransform.GetSlotsPerOutput();
+	m_nBoardInstances = (uint8_t) ceil((float) m_nOutputs / TLC59711_OUT_CHANNELS);
 }
 
 void TLC59711Dmx::Blackout(bool bBlackout) {
@@ -190,10 +205,19 @@ bool TLC59711Dmx::GetSlotInfo(uint16_t nSlotOffset, struct TLightSetSlotInfo& tS
 		return false;
 	}
 
+	const uint32_t nSlotsPerOutput = m_OutputTransform.GetSlotsPerOutput();
+	const uint32_t nOutput = nSlotOffset / nSlotsPerOutput;
+
 	if (m_LEDType == TTLC59711_TYPE_RGB) {
-		nIndex = MOD(nSlotOffset, 3);
+		nIndex = MOD(nOutput, 3);
 	} else {
-		nIndex = MOD(nSlotOffset, 4);
+		nIndex = MOD(nOutput, 4);
+	}
+
+	if ((nSlotsPerOutput == 2) && ((nSlotOffset & 0x1) != 0)) {
+		tSlotInfo.nType = 0x01;	// ST_SEC_FINE
+		tSlotInfo.nCategory = nSlotOffset - 1; // Slot offset of the primary slot
+		return true;
 	}
 
 	tSlotInfo.nType = 0x00;	// ST_PRIMARY
@@ -41,9 +41,11 @@
 
 #include "tlc59711dmxparams.h"
 #include "tlc59711dmx.h"
+#include "outputtransform.h"
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #include "devicesparamsconst.h"
 #include "lightsetconst.h"
@@ -51,12 +53,44 @@
 #define TLC59711_TYPES_MAX_NAME_LENGTH 		10
 static const char sLedTypes[TTLC59711_TYPE_UNDEFINED][TLC59711_TYPES_MAX_NAME_LENGTH] ALIGNED = { "TLC59711\0", "TLC59711W" };
 
-TLC59711DmxParams::TLC59711DmxParams(TLC59711DmxParamsStore *pTLC59711ParamsStore): m_pLC59711ParamsStore(pTLC59711ParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TTLC59711DmxParams, f)
+
+enum TTLC59711DmxParamsKey {
+	KEY_LED_TYPE,
+	KEY_LED_COUNT,
+	KEY_DMX_START_ADDRESS,
+	KEY_SPI_SPEED_HZ,
+	KEY_OUTPUT_CURVE,
+	KEY_OUTPUT_GAMMA,
+	KEY_OUTPUT_16BIT,
+	KEY_LAST
+};
+
+// Must be in the order of TTLC59711DmxParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ DevicesParamsConst::LED_TYPE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DevicesParamsConst::LED_COUNT, OFFSET(nLedCount), PROPERTIES_TYPE_UINT8, TLC59711DMX_PARAMS_MASK_LED_COUNT, 1, 170 },
+	{ LightSetConst::PARAMS_DMX_START_ADDRESS, OFFSET(nDmxStartAddress), PROPERTIES_TYPE_UINT16, TLC59711DMX_PARAMS_MASK_START_ADDRESS, 1, DMX_UNIVERSE_SIZE },
+	{ DevicesParamsConst::SPI_SPEED_HZ, OFFSET(nSpiSpeedHz), PROPERTIES_TYPE_UINT32, TLC59711DMX_PARAMS_MASK_SPI_SPEED, 0, 0xFFFFFFFF },
+	{ LightSetConst::PARAMS_OUTPUT_CURVE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LightSetConst::PARAMS_OUTPUT_GAMMA, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ LightSetConst::PARAMS_OUTPUT_16BIT, OFFSET(bOutput16Bit), PROPERTIES_TYPE_FLAG, TLC59711DMX_PARAMS_MASK_OUTPUT_16BIT, 0, 0 }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TTLC59711DmxParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable TLC59711DmxParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B1 };
+
+TLC59711DmxParams::TLC59711DmxParams(TLC59711DmxParamsStore *pTLC59711ParamsStore): m_pLC59711ParamsStore(pTLC59711ParamsStore), m_pPropertiesParser(0) {
 	m_tTLC59711Params.nSetList = 0;
 	m_tTLC59711Params.LedType = TTLC59711_TYPE_RGB;
 	m_tTLC59711Params.nLedCount = 4;
 	m_tTLC59711Params.nDmxStartAddress = 1;
 	m_tTLC59711Params.nSpiSpeedHz = 0;
+	m_tTLC59711Params.fOutputGamma = OUTPUT_TRANSFORM_GAMMA_DEFAULT;
+	m_tTLC59711Params.nOutputCurve = OUTPUT_TRANSFORM_CURVE_LINEAR;
+	m_tTLC59711Params.bOutput16Bit = false;
 }
 
 TLC59711DmxParams::~TLC59711DmxParams(void) {
@@ -66,9 +100,16 @@ TLC59711DmxParams::~TLC59711DmxParams(void) {
 bool TLC59711DmxParams::Load(void) {
 	m_tTLC59711Params.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tTLC59711Params);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(TLC59711DmxParams::staticCallbackFunction, this);
 
-	if (configfile.Read(DevicesParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(DevicesParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pLC59711ParamsStore != 0) {
 			m_pLC59711ParamsStore->Update(&m_tTLC59711Params);
@@ -93,54 +134,62 @@ void TLC59711DmxParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tTLC59711Params.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tTLC59711Params);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(TLC59711DmxParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pLC59711ParamsStore->Update(&m_tTLC59711Params);
 }
 
 void TLC59711DmxParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
-	uint8_t value8;
-	uint16_t value16;
-	uint32_t value32;
+	float fValue;
 	uint8_t len;
 	char buffer[12];
 
-	len = 9;
-	if (Sscan::Char(pLine, DevicesParamsConst::LED_TYPE, buffer, &len) == SSCAN_OK) {
-		buffer[len] = '\0';
-		if (strcasecmp(buffer, sLedTypes[TTLC59711_TYPE_RGB]) == 0) {
-			m_tTLC59711Params.LedType = TTLC59711_TYPE_RGB;
-			m_tTLC59711Params.nSetList |= TLC59711DMX_PARAMS_MASK_LED_TYPE;
-		} else if (strcasecmp(buffer, sLedTypes[TTLC59711_TYPE_RGBW]) == 0) {
-			m_tTLC59711Params.LedType = TTLC59711_TYPE_RGBW;
-			m_tTLC59711Params.nSetList |= TLC59711DMX_PARAMS_MASK_LED_TYPE;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_LED_TYPE:
+		len = 9;
+		if (Sscan::Char(pLine, DevicesParamsConst::LED_TYPE, buffer, &len) == SSCAN_OK) {
+			buffer[len] = '\0';
+			if (strcasecmp(buffer, sLedTypes[TTLC59711_TYPE_RGB]) == 0) {
+				m_tTLC59711Params.LedType = TTLC59711_TYPE_RGB;
+				m_tTLC59711Params.nSetList |= TLC59711DMX_PARAMS_MASK_LED_TYPE;
+			} else if (strcasecmp(buffer, sLedTypes[TTLC59711_TYPE_RGBW]) == 0) {
+				m_tTLC59711Params.LedType = TTLC59711_TYPE_RGBW;
+				m_tTLC59711Params.nSetList |= TLC59711DMX_PARAMS_MASK_LED_TYPE;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, DevicesParamsConst::LED_COUNT, &value8) == SSCAN_OK) {
-		if ((value8 != 0) && (value8 <= 170)) {
-			m_tTLC59711Params.nLedCount = value8;
-			m_tTLC59711Params.nSetList |= TLC59711DMX_PARAMS_MASK_LED_COUNT;
+		break;
+	case KEY_OUTPUT_CURVE:
+		len = 7;
+		if (Sscan::Char(pLine, LightSetConst::PARAMS_OUTPUT_CURVE, buffer, &len) == SSCAN_OK) {
+			buffer[len] = '\0';
+			const TOutputTransformCurve tCurve = OutputTransform::GetCurve(buffer);
+
+			if (tCurve != OUTPUT_TRANSFORM_CURVE_UNDEFINED) {
+				m_tTLC59711Params.nOutputCurve = (uint8_t) tCurve;
+				m_tTLC59711Params.nSetList |= TLC59711DMX_PARAMS_MASK_OUTPUT_CURVE;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &value16) == SSCAN_OK) {
-		if ((value16 != 0) && (value16 <= DMX_UNIVERSE_SIZE)) {
-			m_tTLC59711Params.nDmxStartAddress = value16;
-			m_tTLC59711Params.nSetList |= TLC59711DMX_PARAMS_MASK_START_ADDRESS;
+		break;
+	case KEY_OUTPUT_GAMMA:
+		if (Sscan::Float(pLine, LightSetConst::PARAMS_OUTPUT_GAMMA, &fValue) == SSCAN_OK) {
+			if ((fValue >= 1.0f) && (fValue <= 4.0f)) {
+				m_tTLC59711Params.fOutputGamma = fValue;
+				m_tTLC59711Params.nSetList |= TLC59711DMX_PARAMS_MASK_OUTPUT_GAMMA;
+			}
 		}
-		return;
-	}
-
-	if (Sscan::Uint32(pLine, DevicesParamsConst::SPI_SPEED_HZ, &value32) == SSCAN_OK) {
-		m_tTLC59711Params.nSpiSpeedHz = value32;
-		m_tTLC59711Params.nSetList |= TLC59711DMX_PARAMS_MASK_SPI_SPEED;
+		break;
+	default:
+		break;
 	}
 }
 
@@ -167,6 +216,18 @@ void TLC59711DmxParams::Dump(void) {
 	if(isMaskSet(TLC59711DMX_PARAMS_MASK_SPI_SPEED)) {
 		printf(" %s=%d Hz\n", DevicesParamsConst::SPI_SPEED_HZ, m_tTLC59711Params.nSpiSpeedHz);
 	}
+
+	if(isMaskSet(TLC59711DMX_PARAMS_MASK_OUTPUT_CURVE)) {
+		printf(" %s=%s\n", LightSetConst::PARAMS_OUTPUT_CURVE, OutputTransform::GetCurve((TOutputTransformCurve) m_tTLC59711Params.nOutputCurve));
+	}
+
+	if(isMaskSet(TLC59711DMX_PARAMS_MASK_OUTPUT_GAMMA)) {
+		printf(" %s=%.1f\n", LightSetConst::PARAMS_OUTPUT_GAMMA, m_tTLC59711Params.fOutputGamma);
+	}
+
+	if(isMaskSet(TLC59711DMX_PARAMS_MASK_OUTPUT_16BIT)) {
+		printf(" %s=1\n", LightSetConst::PARAMS_OUTPUT_16BIT);
+	}
 #endif
 }
 
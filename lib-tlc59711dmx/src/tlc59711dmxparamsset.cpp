@@ -31,6 +31,16 @@
 void TLC59711DmxParams::Set(TLC59711Dmx* pTLC59711Dmx) {
 	assert(pTLC59711Dmx != 0);
 
+	if(isMaskSet(TLC59711DMX_PARAMS_MASK_OUTPUT_CURVE)) {
+		pTLC59711Dmx->SetOutputCurve((TOutputTransformCurve) m_tTLC59711Params.nOutputCurve, m_tTLC59711Params.fOutputGamma);
+	} else if (isMaskSet(TLC59711DMX_PARAMS_MASK_OUTPUT_GAMMA)) {
+		pTLC59711Dmx->SetOutputCurve(OUTPUT_TRANSFORM_CURVE_GAMMA, m_tTLC59711Params.fOutputGamma);
+	}
+
+	if(isMaskSet(TLC59711DMX_PARAMS_MASK_OUTPUT_16BIT)) {
+		pTLC59711Dmx->SetOutput16Bit(true);
+	}
+
 	if(isMaskSet(TLC59711DMX_PARAMS_MASK_LED_TYPE)) {
 		pTLC59711Dmx->SetLEDType(m_tTLC59711Params.LedType);
 	}
@@ -34,4 +34,5 @@ void TLC59711Dmx::Print(void) {
 	printf(" Count : %d %s\n", (int) m_nLEDCount, m_LEDType == TTLC59711_TYPE_RGB ? "RGB" : "RGBW");
 	printf(" Clock : %d Hz %s {Default: %d Hz, Maximum %d Hz}\n", (int) m_nSpiSpeedHz, (m_nSpiSpeedHz == 0 ? "Default" : ""), TLC59711_SPI_SPEED_DEFAULT, TLC59711_SPI_SPEED_MAX);
 	printf(" DMX   : StartAddress=%d, FootPrint=%d\n", (int) m_nDmxStartAddress, (int) m_nDmxFootprint);
+	m_OutputTransform.Print();
 }
@@ -28,6 +28,7 @@
 #include <assert.h>
 
 #include "tlc59711dmxparams.h"
+#include "outputtransform.h"
 
 #include "propertiesbuilder.h"
 
@@ -53,6 +54,9 @@ void TLC59711DmxParams::Builder(const struct TTLC59711DmxParams *ptTLC59711Param
 	builder.Add(DevicesParamsConst::LED_COUNT, m_tTLC59711Params.nLedCount, isMaskSet(TLC59711DMX_PARAMS_MASK_LED_COUNT));
 	builder.Add(LightSetConst::PARAMS_DMX_START_ADDRESS, m_tTLC59711Params.nDmxStartAddress, isMaskSet(TLC59711DMX_PARAMS_MASK_START_ADDRESS));
 	builder.Add(DevicesParamsConst::SPI_SPEED_HZ, m_tTLC59711Params.nSpiSpeedHz, isMaskSet(TLC59711DMX_PARAMS_MASK_SPI_SPEED));
+	builder.Add(LightSetConst::PARAMS_OUTPUT_CURVE, OutputTransform::GetCurve((TOutputTransformCurve) m_tTLC59711Params.nOutputCurve), isMaskSet(TLC59711DMX_PARAMS_MASK_OUTPUT_CURVE));
+	builder.Add(LightSetConst::PARAMS_OUTPUT_GAMMA, m_tTLC59711Params.fOutputGamma, isMaskSet(TLC59711DMX_PARAMS_MASK_OUTPUT_GAMMA));
+	builder.Add(LightSetConst::PARAMS_OUTPUT_16BIT, m_tTLC59711Params.bOutput16Bit, isMaskSet(TLC59711DMX_PARAMS_MASK_OUTPUT_16BIT));
 
 	nSize = builder.GetSize();
 
@@ -27,6 +27,9 @@
 
 #include <stdint.h>
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 enum TWidgetParamsMask {
 	WIDGET_PARAMS_MASK_BREAK_TIME = (1 << 0),
 	WIDGET_PARAMS_MASK_MAB_TIME = (1 << 1),
@@ -91,6 +94,7 @@ public:
 
 public:
     static void staticCallbackFunction(void *p, const char *s);
+    static const struct TPropertiesTable PROPERTIES_TABLE;
 
 private:
     void callbackFunction(const char *s);
@@ -99,6 +103,7 @@ private:
 private:
     WidgetParamsStore *m_pWidgetParamsStore;
     struct TWidgetParams m_tWidgetParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* WIDGETPARAMS_H_ */
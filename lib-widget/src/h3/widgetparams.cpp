@@ -38,6 +38,7 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #include "dmx.h"
 #include "widget.h"
@@ -92,7 +93,32 @@ struct _widget_params {
 	uint8_t refresh_rate;			///< DMX output rate in packets per second. Valid range is 1 to 40.
 };
 
-WidgetParams::WidgetParams(WidgetParamsStore* pWidgetParamsStore): m_pWidgetParamsStore(pWidgetParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TWidgetParams, f)
+
+enum TWidgetParamsKey {
+	KEY_BREAK_TIME,
+	KEY_MAB_TIME,
+	KEY_REFRESH_RATE,
+	KEY_WIDGET_MODE,
+	KEY_DMX_SEND_TO_HOST_THROTTLE,
+	KEY_LAST
+};
+
+// Must be in the order of TWidgetParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ DMXUSBPRO_PARAMS_BREAK_TIME, OFFSET(nBreakTime), PROPERTIES_TYPE_UINT8, WIDGET_PARAMS_MASK_BREAK_TIME, WIDGET_MIN_BREAK_TIME, WIDGET_MAX_BREAK_TIME },
+	{ DMXUSBPRO_PARAMS_MAB_TIME, OFFSET(nMabTime), PROPERTIES_TYPE_UINT8, WIDGET_PARAMS_MASK_MAB_TIME, WIDGET_MIN_MAB_TIME, WIDGET_MAX_MAB_TIME },
+	{ DMXUSBPRO_PARAMS_REFRESH_RATE, OFFSET(nRefreshRate), PROPERTIES_TYPE_UINT8, WIDGET_PARAMS_MASK_REFRESH_RATE, 0, 0xFF },
+	{ PARAMS_WIDGET_MODE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ PARAMS_DMX_SEND_TO_HOST_THROTTLE, OFFSET(nThrottle), PROPERTIES_TYPE_UINT8, WIDGET_PARAMS_MASK_THROTTLE, 0, 0xFF }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TWidgetParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable WidgetParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 5, 0x9E3779B1 };
+
+WidgetParams::WidgetParams(WidgetParamsStore* pWidgetParamsStore): m_pWidgetParamsStore(pWidgetParamsStore), m_pPropertiesParser(0) {
 	m_tWidgetParams.nBreakTime = WIDGET_DEFAULT_BREAK_TIME;
 	m_tWidgetParams.nMabTime = WIDGET_DEFAULT_MAB_TIME;
 	m_tWidgetParams.nRefreshRate = WIDGET_DEFAULT_REFRESH_RATE;
@@ -107,9 +133,16 @@ WidgetParams::~WidgetParams(void) {
 bool WidgetParams::Load(void) {
 	m_tWidgetParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tWidgetParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(WidgetParams::staticCallbackFunction, this);
 
-	if (configfile.Read(PARAMS_FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(PARAMS_FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pWidgetParamsStore != 0) {
 			m_pWidgetParamsStore->Update(&m_tWidgetParams);
@@ -125,45 +158,18 @@ bool WidgetParams::Load(void) {
 
 void WidgetParams::callbackFunction(const char* pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t value8;
 
-	if (Sscan::Uint8(pLine, DMXUSBPRO_PARAMS_BREAK_TIME, &value8) == SSCAN_OK) {
-		if ((value8 >= (uint8_t) WIDGET_MIN_BREAK_TIME) && (value8 <= (uint8_t) WIDGET_MAX_BREAK_TIME)) {
-			m_tWidgetParams.nBreakTime = value8;
-			m_tWidgetParams.nSetList |= WIDGET_PARAMS_MASK_BREAK_TIME;
-			return;
+	if (m_pPropertiesParser->Parse(pLine) == KEY_WIDGET_MODE) {
+		if (Sscan::Uint8(pLine, PARAMS_WIDGET_MODE, &value8) == SSCAN_OK) {
+			if (value8 <= (uint8_t) WIDGET_MODE_RDM_SNIFFER) {
+				m_tWidgetParams.tMode = (TWidgetMode) value8;
+				m_tWidgetParams.nSetList |= WIDGET_PARAMS_MASK_MODE;
+			}
 		}
 	}
-
-	if (Sscan::Uint8(pLine, DMXUSBPRO_PARAMS_MAB_TIME, &value8) == SSCAN_OK) {
-		if ((value8 >= (uint8_t) WIDGET_MIN_MAB_TIME) && (value8 <= (uint8_t) WIDGET_MAX_MAB_TIME)) {
-			m_tWidgetParams.nMabTime = value8;
-			m_tWidgetParams.nSetList |= WIDGET_PARAMS_MASK_MAB_TIME;
-			return;
-		}
-	}
-
-	if (Sscan::Uint8(pLine, DMXUSBPRO_PARAMS_REFRESH_RATE, &value8) == SSCAN_OK) {
-		m_tWidgetParams.nRefreshRate = value8;
-		m_tWidgetParams.nSetList |= WIDGET_PARAMS_MASK_REFRESH_RATE;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, PARAMS_WIDGET_MODE, &value8) == SSCAN_OK) {
-		if (value8 <= (uint8_t) WIDGET_MODE_RDM_SNIFFER) {
-			m_tWidgetParams.tMode = (TWidgetMode) value8;
-			m_tWidgetParams.nSetList |= WIDGET_PARAMS_MASK_MODE;
-			return;
-		}
-	}
-
-	if (Sscan::Uint8(pLine, PARAMS_DMX_SEND_TO_HOST_THROTTLE, &value8) == SSCAN_OK) {
-		m_tWidgetParams.nThrottle = value8;
-		m_tWidgetParams.nSetList |= WIDGET_PARAMS_MASK_THROTTLE;
-		return;
-	}
-
 }
 
 void WidgetParams::Set(void) {
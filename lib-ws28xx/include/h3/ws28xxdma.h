@@ -33,6 +33,12 @@
 
 #include "h3_spi.h"
 
+/*
+ * The SPI DMA area holds a back buffer, a front buffer and the blackout frame.
+ * SetLED encodes into the back buffer while the front buffer is clocked out,
+ * Update swaps the buffers. When the area is too small for three frames,
+ * there is a single buffer and SetLED must wait for IsUpdating.
+ */
 class WS28xxDMA: public WS28xx {
 public:
 	WS28xxDMA(TWS28XXType Type, uint16_t nLedCount, TRGBMapping tRGBMapping = RGB_MAPPING_UNDEFINED, uint8_t nT0H = 0, uint8_t nT1H = 0, uint32_t nClockSpeed = WS2801_SPI_SPEED_DEFAULT_HZ);
@@ -43,9 +49,17 @@ public:
 	void Update(void);
 	void Blackout(void);
 
-	bool IsUpdating (void) { // returns TRUE while DMA operation is active
-		return h3_spi_dma_tx_is_active();
+	bool IsUpdating (void) { // returns TRUE while the buffer for SetLED is in use by the DMA
+		return !m_bIsDoubleBuffer && h3_spi_dma_tx_is_active();
+	}
+
+	bool IsDoubleBuffer(void) {
+		return m_bIsDoubleBuffer;
 	}
+
+private:
+	uint8_t *m_pFrontBuffer;
+	bool m_bIsDoubleBuffer;
 };
 
 #endif /* WS28XXDMA_H_ */
@@ -0,0 +1,86 @@
+/**
+ * @file virtualled.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LINUX_VIRTUALLED_H_
+#define LINUX_VIRTUALLED_H_
+
+#include <stdint.h>
+
+#define VIRTUALLED_MAGIC				"VLED"
+#define VIRTUALLED_NAME_DEFAULT			"/ws28xx"
+#define VIRTUALLED_FRAME_SIZE_DEFAULT	(4 * 170 * 24 * 4)	///< WS28xxMulti 4x, 680 LEDs
+#define VIRTUALLED_SLOTS_DEFAULT		64
+
+/*
+ * The shared memory object is a header followed by nSlots frames of
+ * sizeof(struct TVirtualLEDFrame) + nFrameSize bytes.
+ * Frame n is in slot n % nSlots.
+ */
+struct TVirtualLEDHeader {
+	char aMagic[4];
+	uint32_t nFrameSize;
+	uint32_t nSlots;
+	uint32_t nFrames;		///< Total number of frames written
+};
+
+struct TVirtualLEDFrame {
+	uint32_t nSequence;		///< Frame number + 1, 0 while the slot is written
+	uint32_t nLength;		///< Encoded bytes, truncated to nFrameSize
+	uint64_t nTimestamp;	///< CLOCK_MONOTONIC nanoseconds
+};
+
+/*
+ * Records the encoded frames that would go out on the wire, so that
+ * the pixel pipeline can be inspected and timed without hardware.
+ */
+class VirtualLED {
+public:
+	VirtualLED(void);
+	~VirtualLED(void);
+
+	bool Open(const char *pName = VIRTUALLED_NAME_DEFAULT, uint32_t nFrameSize = VIRTUALLED_FRAME_SIZE_DEFAULT, uint32_t nSlots = VIRTUALLED_SLOTS_DEFAULT);
+	void Close(void);
+
+	void Write(const uint8_t *pData, uint32_t nLength);
+
+	uint32_t GetFrames(void) const {
+		return (m_pHeader == 0) ? 0 : __atomic_load_n(&m_pHeader->nFrames, __ATOMIC_ACQUIRE);
+	}
+
+	const struct TVirtualLEDFrame *GetFrame(uint32_t nFrame) const;
+
+	static VirtualLED* Get(void) {
+		return s_pThis;
+	}
+
+private:
+	char m_aName[64];
+	uint32_t m_nSize;
+	struct TVirtualLEDHeader *m_pHeader;
+
+	static VirtualLED *s_pThis;
+};
+
+#endif /* LINUX_VIRTUALLED_H_ */
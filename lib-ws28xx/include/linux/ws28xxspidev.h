@@ -0,0 +1,46 @@
+/**
+ * @file ws28xxspidev.h
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LINUX_WS28XXSPIDEV_H_
+#define LINUX_WS28XXSPIDEV_H_
+
+#include <stdint.h>
+
+/*
+ * Linux (not Raspberry Pi) SPI output through spidev.
+ * Every frame written is also recorded by the VirtualLED sink, when opened.
+ * For the RTZ types the kernel spidev.bufsiz must hold a complete frame.
+ */
+
+#define WS28XX_SPIDEV_DEFAULT	"/dev/spidev0.0"
+
+#define FUNC_PREFIX(x) linux_##x
+
+void linux_spi_set_device(const char *pDevice);	///< 0 disables the spidev output
+void linux_spi_begin(void);
+void linux_spi_set_speed_hz(uint32_t nSpeedHz);
+void linux_spi_writenb(const char *pBuffer, uint32_t nLength);
+
+#endif /* LINUX_WS28XXSPIDEV_H_ */
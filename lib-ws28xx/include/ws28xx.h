@@ -101,6 +101,13 @@ public:
 	void SetLED(uint32_t nLEDIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue);
 	void SetLED(uint32_t nLEDIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite);
 
+	/*
+	 * Sets nCount LEDs from nLEDIndex to the same colour. The first LED is
+	 * encoded, the others are block copies of its wire format.
+	 */
+	void SetLEDGroup(uint32_t nLEDIndex, uint32_t nCount, uint8_t nRed, uint8_t nGreen, uint8_t nBlue);
+	void SetLEDGroup(uint32_t nLEDIndex, uint32_t nCount, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite);
+
 	void Update(void);
 	void Blackout(void);
 
@@ -116,8 +123,20 @@ public:
 	static float ConvertTxH(uint8_t nCode);
 	static uint8_t ConvertTxH(float fTxH);
 
+protected:
+	void GetBufRange(uint32_t nLEDIndex, uint32_t nCount, uint32_t &nOffset, uint32_t &nLength);
+
 private:
 	void SetColorWS28xx(uint32_t nOffset, uint8_t nValue);
+	void Replicate(uint32_t nLEDIndex, uint32_t nCount);
+	void SetDirty(uint32_t nLEDIndex, uint32_t nCount) {
+		if (nLEDIndex < m_nDirtyFirst) {
+			m_nDirtyFirst = nLEDIndex;
+		}
+		if ((nLEDIndex + nCount) > m_nDirtyLast) {
+			m_nDirtyLast = nLEDIndex + nCount;
+		}
+	}
 
 protected:
 	TWS28XXType m_tLEDType;
@@ -131,6 +150,8 @@ protected:
 	uint8_t m_nHighCode;
 	alignas(uint32_t) uint8_t *m_pBuffer;
 	alignas(uint32_t) uint8_t *m_pBlackoutBuffer;
+	uint32_t m_nDirtyFirst;	///< LEDs set since the last Update, [m_nDirtyFirst, m_nDirtyLast)
+	uint32_t m_nDirtyLast;	///< 0 is none
 };
 
 #endif /* WS28XX_H_ */
@@ -36,7 +36,9 @@
 #include "debug.h"
 
 WS28xxDMA::WS28xxDMA(TWS28XXType Type, uint16_t nLEDCount, TRGBMapping tRGBMapping, uint8_t nT0H, uint8_t nT1H, uint32_t nClockSpeed):
-	WS28xx(Type, nLEDCount, tRGBMapping, nT0H, nT1H, nClockSpeed)
+	WS28xx(Type, nLEDCount, tRGBMapping, nT0H, nT1H, nClockSpeed),
+	m_pFrontBuffer(0),
+	m_bIsDoubleBuffer(false)
 {
 	DEBUG_ENTRY
 
@@ -44,7 +46,12 @@ WS28xxDMA::WS28xxDMA(TWS28XXType Type, uint16_t nLEDCount, TRGBMapping tRGBMappi
 }
 
 WS28xxDMA::~WS28xxDMA(void) {
+	while (h3_spi_dma_tx_is_active()) {
+		// wait for completion
+	}
+
 	m_pBlackoutBuffer = 0;
+	m_pFrontBuffer = 0;
 	m_pBuffer = 0;
 }
 
@@ -54,28 +61,48 @@ bool WS28xxDMA::Initialize(void) {
 	m_pBuffer = (uint8_t *)h3_spi_dma_tx_prepare(&nSize);
 	assert(m_pBuffer != 0);
 
-	const uint32_t nSizeHalf = nSize / 2;
+	const uint32_t nSizeThird = (nSize / 3) & ~3;
+	const uint32_t nSizeHalf = (nSize / 2) & ~3;
+
 	assert(m_nBufSize <= nSizeHalf);
 
 	if (m_nBufSize > nSizeHalf) {
 		return false;
 	}
 
-	m_pBlackoutBuffer = m_pBuffer + (nSizeHalf & ~3);
+	m_bIsDoubleBuffer = (m_nBufSize <= nSizeThird);
+
+	if (m_bIsDoubleBuffer) {
+		m_pFrontBuffer = m_pBuffer + nSizeThird;
+		m_pBlackoutBuffer = m_pFrontBuffer + nSizeThird;
+	} else {
+		m_pFrontBuffer = m_pBuffer;
+		m_pBlackoutBuffer = m_pBuffer + nSizeHalf;
+	}
 
-	if (m_tLEDType == APA102) {
+	if ((m_tLEDType == APA102) || (m_tLEDType == P9813)) {
 		memset(m_pBuffer, 0, 4);
+
 		for (uint32_t i = 0; i < m_nLedCount; i++) {
 			SetLED(i, 0, 0, 0);
 		}
-		memset(&m_pBuffer[m_nBufSize - 4], 0xFF, 4);
+
+		memset(&m_pBuffer[m_nBufSize - 4], m_tLEDType == APA102 ? 0xFF : 0, 4);
 	} else {
-		memset(m_pBuffer, m_tLEDType == WS2801 ? 0 : 0xC0, m_nBufSize);
+		memset(m_pBuffer, m_tLEDType == WS2801 ? 0 : m_nLowCode, m_nBufSize);
 	}
 
+	// The blackout frame is encoded once
 	memcpy(m_pBlackoutBuffer, m_pBuffer, m_nBufSize);
 
-	DEBUG_PRINTF("nSize=%x, m_pBuffer=%p, m_pBlackoutBuffer=%p", nSize, m_pBuffer, m_pBlackoutBuffer);
+	if (m_bIsDoubleBuffer) {
+		memcpy(m_pFrontBuffer, m_pBuffer, m_nBufSize);
+	}
+
+	m_nDirtyFirst = m_nLedCount;
+	m_nDirtyLast = 0;
+
+	DEBUG_PRINTF("nSize=%x, m_pBuffer=%p, m_pFrontBuffer=%p, m_pBlackoutBuffer=%p, m_bIsDoubleBuffer=%d", nSize, m_pBuffer, m_pFrontBuffer, m_pBlackoutBuffer, (int) m_bIsDoubleBuffer);
 
 	Blackout();
 
@@ -84,14 +111,45 @@ bool WS28xxDMA::Initialize(void) {
 
 void WS28xxDMA::Update(void) {
 	assert(m_pBuffer != 0);
-	assert(!IsUpdating());
+
+	if (!m_bIsDoubleBuffer) {
+		assert(!IsUpdating());
+		h3_spi_dma_tx_start(m_pBuffer, m_nBufSize);
+		return;
+	}
+
+	while (h3_spi_dma_tx_is_active()) {
+		// wait for the previous frame
+	}
 
 	h3_spi_dma_tx_start(m_pBuffer, m_nBufSize);
+
+	uint8_t *pBuffer = m_pFrontBuffer;
+	m_pFrontBuffer = m_pBuffer;
+	m_pBuffer = pBuffer;
+
+	// SetLED can update a part of the frame only, so the next frame starts as a copy of this one.
+	// The buffers differ in the LEDs set for this frame only.
+	if (m_nDirtyLast != 0) {
+		uint32_t nOffset;
+		uint32_t nLength;
+
+		GetBufRange(m_nDirtyFirst, m_nDirtyLast - m_nDirtyFirst, nOffset, nLength);
+		assert(nOffset + nLength <= m_nBufSize);
+
+		memcpy(&m_pBuffer[nOffset], &m_pFrontBuffer[nOffset], nLength);
+
+		m_nDirtyFirst = m_nLedCount;
+		m_nDirtyLast = 0;
+	}
 }
 
 void WS28xxDMA::Blackout(void) {
 	assert(m_pBlackoutBuffer != 0);
-	assert(!IsUpdating());
+
+	while (h3_spi_dma_tx_is_active()) {
+		// wait for completion
+	}
 
 	h3_spi_dma_tx_start(m_pBlackoutBuffer, m_nBufSize);
 }
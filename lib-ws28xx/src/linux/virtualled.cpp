@@ -0,0 +1,160 @@
+/**
+ * @file virtualled.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <assert.h>
+
+#include "linux/virtualled.h"
+
+#include "debug.h"
+
+VirtualLED *VirtualLED::s_pThis = 0;
+
+VirtualLED::VirtualLED(void): m_nSize(0), m_pHeader(0) {
+	DEBUG_ENTRY
+
+	assert(s_pThis == 0);
+	s_pThis = this;
+
+	m_aName[0] = '\0';
+
+	DEBUG_EXIT
+}
+
+VirtualLED::~VirtualLED(void) {
+	DEBUG_ENTRY
+
+	Close();
+
+	s_pThis = 0;
+
+	DEBUG_EXIT
+}
+
+bool VirtualLED::Open(const char *pName, uint32_t nFrameSize, uint32_t nSlots) {
+	DEBUG_ENTRY
+
+	assert(pName != 0);
+	assert(nFrameSize != 0);
+	assert(nSlots != 0);
+
+	Close();
+
+	const int nFd = shm_open(pName, O_CREAT | O_RDWR, 0644);
+
+	if (nFd < 0) {
+		perror("shm_open");
+		DEBUG_EXIT
+		return false;
+	}
+
+	const uint32_t nSize = sizeof(struct TVirtualLEDHeader) + nSlots * (sizeof(struct TVirtualLEDFrame) + nFrameSize);
+
+	if (ftruncate(nFd, nSize) != 0) {
+		perror("ftruncate");
+		close(nFd);
+		shm_unlink(pName);
+		DEBUG_EXIT
+		return false;
+	}
+
+	void *p = mmap(0, nSize, PROT_READ | PROT_WRITE, MAP_SHARED, nFd, 0);
+
+	close(nFd);
+
+	if (p == MAP_FAILED) {
+		perror("mmap");
+		shm_unlink(pName);
+		DEBUG_EXIT
+		return false;
+	}
+
+	strncpy(m_aName, pName, sizeof(m_aName) - 1);
+	m_aName[sizeof(m_aName) - 1] = '\0';
+	m_nSize = nSize;
+	m_pHeader = (struct TVirtualLEDHeader *) p;
+
+	memset(m_pHeader, 0, nSize);
+	m_pHeader->nFrameSize = nFrameSize;
+	m_pHeader->nSlots = nSlots;
+	memcpy(m_pHeader->aMagic, VIRTUALLED_MAGIC, sizeof(m_pHeader->aMagic));
+
+	DEBUG_PRINTF("%s: nFrameSize=%u, nSlots=%u", m_aName, nFrameSize, nSlots);
+	DEBUG_EXIT
+	return true;
+}
+
+void VirtualLED::Close(void) {
+	if (m_pHeader == 0) {
+		return;
+	}
+
+	munmap(m_pHeader, m_nSize);
+	shm_unlink(m_aName);
+
+	m_pHeader = 0;
+	m_nSize = 0;
+}
+
+const struct TVirtualLEDFrame *VirtualLED::GetFrame(uint32_t nFrame) const {
+	assert(m_pHeader != 0);
+
+	const uint32_t nSlot = nFrame % m_pHeader->nSlots;
+
+	return (const struct TVirtualLEDFrame *) ((uint8_t *) m_pHeader + sizeof(struct TVirtualLEDHeader) + nSlot * (sizeof(struct TVirtualLEDFrame) + m_pHeader->nFrameSize));
+}
+
+/*
+ * A reader copies a slot and accepts it when nSequence is the same,
+ * and not 0, before and after the copy.
+ */
+void VirtualLED::Write(const uint8_t *pData, uint32_t nLength) {
+	assert(pData != 0);
+
+	if (__builtin_expect((m_pHeader == 0), 0)) {
+		return;
+	}
+
+	const uint32_t nFrame = m_pHeader->nFrames;
+	struct TVirtualLEDFrame *pFrame = (struct TVirtualLEDFrame *) GetFrame(nFrame);
+
+	__atomic_store_n(&pFrame->nSequence, 0, __ATOMIC_RELEASE);
+
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	pFrame->nLength = (nLength < m_pHeader->nFrameSize) ? nLength : m_pHeader->nFrameSize;
+	pFrame->nTimestamp = (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+	memcpy((uint8_t *) pFrame + sizeof(struct TVirtualLEDFrame), pData, pFrame->nLength);
+
+	__atomic_store_n(&pFrame->nSequence, nFrame + 1, __ATOMIC_RELEASE);
+	__atomic_store_n(&m_pHeader->nFrames, nFrame + 1, __ATOMIC_RELEASE);
+}
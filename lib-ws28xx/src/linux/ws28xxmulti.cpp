@@ -3,7 +3,7 @@
  *
  */
 /**
- * Stub for testing purpose only
+ * Without the hardware the encoded frames go to the VirtualLED sink
  */
 /* Copyright (C) 2019-2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
@@ -27,12 +27,57 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 #include <assert.h>
 
 #include "ws28xxmulti.h"
 
+#include "linux/virtualled.h"
+
+#if defined (RASPPI)
+ #include "hal_spi.h"
+#endif
+
 #include "debug.h"
 
+#define PULSE	4	// Bits 0-3 are the outputs
+
+#if !defined (RASPPI)
+/*
+ * A virtual 4x board
+ */
+bool WS28xxMulti::IsMCP23017(void) {
+	return true;
+}
+
+bool WS28xxMulti::SetupMCP23017(__attribute__((unused)) uint8_t nT0H, __attribute__((unused)) uint8_t nT1H) {
+	return true;
+}
+
+bool WS28xxMulti::SetupSI5351A(void) {
+	return false;
+}
+
+void WS28xxMulti::SetupHC595(__attribute__((unused)) uint8_t nT0H, __attribute__((unused)) uint8_t nT1H) {
+	// Nothing todo
+}
+
+void WS28xxMulti::SetupSPI(void) {
+	// Nothing todo
+}
+#endif
+
+uint8_t WS28xxMulti::ReverseBits(uint8_t nBits) {
+	uint8_t nReversed = 0;
+
+	for (uint32_t i = 0; i < 8; i++) {
+		nReversed = (nReversed << 1) | (nBits & 0x1);
+		nBits >>= 1;
+	}
+
+	return nReversed;
+}
+
 void WS28xxMulti::SetupGPIO(void) {
 	// Nothing todo
 }
@@ -51,32 +96,52 @@ void WS28xxMulti::SetupBuffers4x(void) {
 	}
 }
 
+void WS28xxMulti::SetupBuffers8x(void) {
+	m_pBuffer8x = new uint8_t[m_nBufSize];
+	assert(m_pBuffer8x != 0);
+
+	m_pBlackoutBuffer8x = new uint8_t[m_nBufSize];
+	assert(m_pBlackoutBuffer8x != 0);
+
+	memset(m_pBuffer8x, 0, m_nBufSize);
+	memset(m_pBlackoutBuffer8x, 0, m_nBufSize);
+}
+
 void WS28xxMulti::Update(void) {
-	Generate800kHz(m_pBuffer4x);
+	if (m_tBoard == WS28XXMULTI_BOARD_8X) {
+		assert(m_pBuffer8x != 0);
+#if defined (RASPPI)
+		FUNC_PREFIX(spi_writenb((char *) m_pBuffer8x, m_nBufSize));
+#endif
+		if (VirtualLED::Get() != 0) {
+			VirtualLED::Get()->Write(m_pBuffer8x, m_nBufSize);
+		}
+	} else {
+		assert(m_pBuffer4x != 0);
+		Generate800kHz(m_pBuffer4x);
+	}
 }
 
 void WS28xxMulti::Blackout(void) {
-	Generate800kHz(m_pBlackoutBuffer4x);
+	if (m_tBoard == WS28XXMULTI_BOARD_8X) {
+		assert(m_pBlackoutBuffer8x != 0);
+#if defined (RASPPI)
+		FUNC_PREFIX(spi_writenb((char *) m_pBlackoutBuffer8x, m_nBufSize));
+#endif
+		if (VirtualLED::Get() != 0) {
+			VirtualLED::Get()->Write(m_pBlackoutBuffer8x, m_nBufSize);
+		}
+	} else {
+		assert(m_pBlackoutBuffer4x != 0);
+		Generate800kHz(m_pBlackoutBuffer4x);
+	}
 }
 
+/*
+ * There is no bit-banged output on Linux, the bit buffer is recorded as is.
+ */
 void WS28xxMulti::Generate800kHz(const uint32_t* pBuffer) {
-	for (uint32_t k = 0; k < m_nBufSize; k = k + SINGLE_RGB) {
-		printf("%.2d ", k / SINGLE_RGB);
-
-		for (uint32_t j = 0; j < 4; j++) {
-
-			for (uint32_t i = 0; i < 24; i++) {
-				bool b = (pBuffer[k + i] & (1 << j)) == 0;
-				printf("%c", '0' + (b ? 0 : 1));
-
-				if ((i != 0) && ((i + 1) % 8 == 0)) {
-					printf("|");
-				}
-			}
-			printf(" ");
-		}
-		printf("\n");
+	if (VirtualLED::Get() != 0) {
+		VirtualLED::Get()->Write((const uint8_t *) pBuffer, m_nBufSize * sizeof(uint32_t));
 	}
-
-	printf("\n");
 }
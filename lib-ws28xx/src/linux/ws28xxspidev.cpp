@@ -0,0 +1,115 @@
+/**
+ * @file ws28xxspidev.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if !defined (RASPPI)
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+#include <assert.h>
+
+#include "linux/ws28xxspidev.h"
+#include "linux/virtualled.h"
+
+#include "debug.h"
+
+static const char *s_pDevice = WS28XX_SPIDEV_DEFAULT;
+static int s_nFd = -1;
+static uint32_t s_nSpeedHz = 0;
+static bool s_bWriteError = false;
+
+void linux_spi_set_device(const char *pDevice) {
+	s_pDevice = pDevice;
+}
+
+void linux_spi_begin(void) {
+	DEBUG_ENTRY
+
+	if ((s_nFd >= 0) || (s_pDevice == 0)) {
+		DEBUG_EXIT
+		return;
+	}
+
+	s_nFd = open(s_pDevice, O_RDWR);
+
+	if (s_nFd < 0) {
+		perror(s_pDevice);
+		DEBUG_EXIT
+		return;
+	}
+
+	const uint8_t nMode = SPI_MODE_0;
+	const uint8_t nBits = 8;
+
+	if ((ioctl(s_nFd, SPI_IOC_WR_MODE, &nMode) < 0) || (ioctl(s_nFd, SPI_IOC_WR_BITS_PER_WORD, &nBits) < 0)) {
+		perror("SPI_IOC_WR_MODE");
+		close(s_nFd);
+		s_nFd = -1;
+	}
+
+	DEBUG_PRINTF("%s: s_nFd=%d", s_pDevice, s_nFd);
+	DEBUG_EXIT
+}
+
+void linux_spi_set_speed_hz(uint32_t nSpeedHz) {
+	s_nSpeedHz = nSpeedHz;
+
+	if (s_nFd >= 0) {
+		if (ioctl(s_nFd, SPI_IOC_WR_MAX_SPEED_HZ, &nSpeedHz) < 0) {
+			perror("SPI_IOC_WR_MAX_SPEED_HZ");
+		}
+	}
+}
+
+void linux_spi_writenb(const char *pBuffer, uint32_t nLength) {
+	assert(pBuffer != 0);
+
+	if (s_nFd >= 0) {
+		struct spi_ioc_transfer tr;
+
+		memset(&tr, 0, sizeof(tr));
+		tr.tx_buf = (unsigned long) pBuffer;
+		tr.len = nLength;
+		tr.speed_hz = s_nSpeedHz;
+		tr.bits_per_word = 8;
+
+		if ((ioctl(s_nFd, SPI_IOC_MESSAGE(1), &tr) < 0) && !s_bWriteError) {
+			perror("SPI_IOC_MESSAGE");	// Once only, typically EMSGSIZE for spidev.bufsiz
+			s_bWriteError = true;
+		}
+	}
+
+	VirtualLED *pVirtualLED = VirtualLED::Get();
+
+	if (pVirtualLED != 0) {
+		pVirtualLED->Write((const uint8_t *) pBuffer, nLength);
+	}
+}
+
+#endif
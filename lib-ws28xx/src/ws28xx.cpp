@@ -38,7 +38,11 @@
 
 #include "rgbmapping.h"
 
-#include "hal_spi.h"
+#if defined (__linux__) && !defined (RASPPI)
+ #include "linux/ws28xxspidev.h"
+#else
+ #include "hal_spi.h"
+#endif
 
 #include "debug.h"
 
@@ -52,7 +56,9 @@ WS28xx::WS28xx(TWS28XXType Type, uint16_t nLedCount, TRGBMapping tRGBMapping, ui
 	m_nLowCode(nT0H),
 	m_nHighCode(nT1H),
 	m_pBuffer(0),
-	m_pBlackoutBuffer(0)
+	m_pBlackoutBuffer(0),
+	m_nDirtyFirst(nLedCount),
+	m_nDirtyLast(0)
 {
 	assert(m_nLedCount > 0);
 
@@ -65,6 +65,10 @@ WS28xxMulti::~WS28xxMulti(void) {
 		delete[] m_pBuffer4x;
 		m_pBuffer4x = 0;
 	} else {
+#if defined (__linux__)
+		delete[] m_pBlackoutBuffer8x;
+		delete[] m_pBuffer8x;
+#endif
 		m_pBlackoutBuffer8x = 0;
 		m_pBuffer8x = 0;
 	}
@@ -72,11 +76,17 @@ WS28xxMulti::~WS28xxMulti(void) {
 
 void WS28xxMulti::Initialize(TWS28XXType tWS28xxType, uint16_t nLedCount, TRGBMapping tRGBMapping, uint8_t nT0H, uint8_t nT1H, bool bUseSI5351A) {
 	DEBUG_ENTRY
-	DEBUG_PRINTF("m_tWS28xxType=%d (%s), m_nLedCount=%d, m_nBufSize=%d", m_tWS28xxType, WS28xx::GetLedTypeString(m_tWS28xxType), m_nLedCount, m_nBufSize);
-	DEBUG_PRINTF("m_tRGBMapping=%d (%s), m_nLowCode=0x%X, m_nHighCode=0x%X", (int) m_tRGBMapping, RGBMapping::ToString(m_tRGBMapping), (int) m_nLowCode, (int) m_nHighCode);
 
 	assert(nLedCount > 0);
 
+	m_tWS28xxType = tWS28xxType;
+	m_tRGBMapping = tRGBMapping;
+	m_nLowCode = nT0H;
+	m_nHighCode = nT1H;
+
+	DEBUG_PRINTF("m_tWS28xxType=%d (%s), m_nLedCount=%d, m_nBufSize=%d", m_tWS28xxType, WS28xx::GetLedTypeString(m_tWS28xxType), m_nLedCount, m_nBufSize);
+	DEBUG_PRINTF("m_tRGBMapping=%d (%s), m_nLowCode=0x%X, m_nHighCode=0x%X", (int) m_tRGBMapping, RGBMapping::ToString(m_tRGBMapping), (int) m_nLowCode, (int) m_nHighCode);
+
 	for (uint32_t i = 0; i < sizeof(s_NotSupported) / sizeof(s_NotSupported[0]) ; i++) {
 		if (tWS28xxType == s_NotSupported[i]) {
 			m_tWS28xxType = WS2812B;
@@ -103,10 +113,10 @@ void WS28xxMulti::Initialize(TWS28XXType tWS28xxType, uint16_t nLedCount, TRGBMa
 
 	if (m_tWS28xxType == SK6812W) {
 		m_nLedCount = nLedCount <= LEDCOUNT_RGBW_MAX ? nLedCount : LEDCOUNT_RGBW_MAX;
-		m_nBufSize = nLedCount * SINGLE_RGBW;
+		m_nBufSize = m_nLedCount * SINGLE_RGBW;
 	} else {
 		m_nLedCount = nLedCount <= LEDCOUNT_RGB_MAX ? nLedCount : LEDCOUNT_RGB_MAX;
-		m_nBufSize = nLedCount * SINGLE_RGB;
+		m_nBufSize = m_nLedCount * SINGLE_RGB;
 	}
 
 	DEBUG_PRINTF("m_tWS28xxType=%d (%s), m_nLedCount=%d, m_nBufSize=%d", m_tWS28xxType, WS28xx::GetLedTypeString(m_tWS28xxType), m_nLedCount, m_nBufSize);
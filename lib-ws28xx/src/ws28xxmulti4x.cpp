@@ -28,14 +28,17 @@
 
 #include "ws28xxmulti.h"
 
-#include "si5351a.h"
-#include "mcp23017.h"
-#include "mcp23x17.h"
+#if !defined (__linux__) || defined (RASPPI)
+ #include "si5351a.h"
+ #include "mcp23017.h"
+ #include "mcp23x17.h"
 
-#include "display.h"
+ #include "display.h"
+#endif
 
 #include "debug.h"
 
+#if !defined (__linux__) || defined (RASPPI)
 bool WS28xxMulti::SetupSI5351A(void) {
 	DEBUG_ENTRY
 
@@ -102,6 +105,7 @@ bool WS28xxMulti::SetupMCP23017(uint8_t nT0H, uint8_t nT1H) {
 	DEBUG_EXIT
 	return true;
 }
+#endif
 
 #define BIT_SET(a,b) 	((a) |= (1<<(b)))
 #define BIT_CLEAR(a,b) 	((a) &= ~(1<<(b)))
@@ -29,11 +29,14 @@
 
 #include "ws28xxmulti.h"
 
-#include "hal_gpio.h"
-#include "hal_spi.h"
+#if !defined (__linux__) || defined (RASPPI)
+ #include "hal_gpio.h"
+ #include "hal_spi.h"
+#endif
 
 #include "debug.h"
 
+#if !defined (__linux__) || defined (RASPPI)
 #define SPI_CS1		GPIO_EXT_26
 
 void WS28xxMulti::SetupHC595(uint8_t nT0H, uint8_t nT1H) {
@@ -67,6 +70,7 @@ void WS28xxMulti::SetupSPI(void) {
 
 	DEBUG_EXIT
 }
+#endif
 
 #define BIT_SET(a,b) 	((a) |= (1<<(b)))
 #define BIT_CLEAR(a,b) 	((a) &= ~(1<<(b)))
@@ -24,17 +24,18 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 #include <assert.h>
 
 #include "ws28xx.h"
 #include "rgbmapping.h"
 
 void WS28xx::SetLED(uint32_t nLEDIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue) {
-	assert(!m_bUpdating);
-
 	assert(m_pBuffer != 0);
 	assert(nLEDIndex < m_nLedCount);
 
+	SetDirty(nLEDIndex, 1);
+
 	if (__builtin_expect((m_bIsRTZProtocol), 1)) {
 		uint32_t nOffset = nLEDIndex * 3;
 		nOffset *= 8;
@@ -119,12 +120,12 @@ void WS28xx::SetLED(uint32_t nLEDIndex, uint8_t nRed, uint8_t nGreen, uint8_t nB
 }
 
 void WS28xx::SetLED(uint32_t nLEDIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite) {
-	assert(!m_bUpdating);
-
 	assert(m_pBuffer != 0);
 	assert(nLEDIndex < m_nLedCount);
 	assert(m_tLEDType == SK6812W);
 
+	SetDirty(nLEDIndex, 1);
+
 	uint32_t nOffset = nLEDIndex * 4;
 
 	if (m_tLEDType == SK6812W) {
@@ -137,6 +138,65 @@ void WS28xx::SetLED(uint32_t nLEDIndex, uint8_t nRed, uint8_t nGreen, uint8_t nB
 	}
 }
 
+void WS28xx::SetLEDGroup(uint32_t nLEDIndex, uint32_t nCount, uint8_t nRed, uint8_t nGreen, uint8_t nBlue) {
+	assert(nCount != 0);
+	assert(nLEDIndex + nCount <= m_nLedCount);
+
+	SetLED(nLEDIndex, nRed, nGreen, nBlue);
+	Replicate(nLEDIndex, nCount);
+}
+
+void WS28xx::SetLEDGroup(uint32_t nLEDIndex, uint32_t nCount, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite) {
+	assert(nCount != 0);
+	assert(nLEDIndex + nCount <= m_nLedCount);
+
+	SetLED(nLEDIndex, nRed, nGreen, nBlue, nWhite);
+	Replicate(nLEDIndex, nCount);
+}
+
+/*
+ * The bytes in the buffer of nCount LEDs from nLEDIndex
+ */
+void WS28xx::GetBufRange(uint32_t nLEDIndex, uint32_t nCount, uint32_t &nOffset, uint32_t &nLength) {
+	uint32_t nLEDSize;
+
+	if (m_bIsRTZProtocol) {
+		nLEDSize = (m_tLEDType == SK6812W) ? 32 : 24;
+		nOffset = nLEDIndex * nLEDSize;
+	} else if (m_tLEDType == WS2801) {
+		nLEDSize = 3;
+		nOffset = nLEDIndex * 3;
+	} else {
+		nLEDSize = 4;
+		nOffset = 4 + (nLEDIndex * 4);
+	}
+
+	nLength = nCount * nLEDSize;
+}
+
+/*
+ * Copies the wire format of LED nLEDIndex to the next nCount - 1 LEDs.
+ * The copied block doubles each time, so there are log2(nCount) memcpy's.
+ */
+void WS28xx::Replicate(uint32_t nLEDIndex, uint32_t nCount) {
+	uint32_t nOffset;
+	uint32_t nTotal;
+
+	GetBufRange(nLEDIndex, nCount, nOffset, nTotal);
+	SetDirty(nLEDIndex, nCount);
+
+	uint8_t *pLED = &m_pBuffer[nOffset];
+	uint32_t nDone = nTotal / nCount;
+
+	assert(nOffset + nTotal <= m_nBufSize);
+
+	while (nDone < nTotal) {
+		const uint32_t nBytes = ((nTotal - nDone) < nDone) ? (nTotal - nDone) : nDone;
+		memcpy(&pLED[nDone], pLED, nBytes);
+		nDone += nBytes;
+	}
+}
+
 void WS28xx::SetColorWS28xx(uint32_t nOffset, uint8_t nValue) {
 	assert(m_tLEDType != WS2801);
 	assert(nOffset + 7 < m_nBufSize);
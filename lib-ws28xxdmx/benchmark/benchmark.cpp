@@ -0,0 +1,338 @@
+/**
+ * @file benchmark.cpp
+ *
+ */
+/* Copyright (C) 2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ws28xxdmx.h"
+#include "ws28xxdmxmulti.h"
+
+#include "linux/virtualled.h"
+#include "linux/ws28xxspidev.h"
+
+#define SINK_NAME	"/ws28xx-benchmark"
+
+enum TSource {
+	SOURCE_ARTNET,		///< One ArtDmx per universe, output after the last universe
+	SOURCE_SACN,		///< One E1.31 data packet per universe, output after the last universe
+	SOURCE_SYNC,		///< As sACN, with a synchronization packet committing the frame
+	SOURCE_LAST
+};
+
+static const char *s_aSourceName[SOURCE_LAST] = { "artnet", "sacn", "sync" };
+
+struct TConfig {
+	const char *pName;
+	bool bMulti;
+	TWS28XXType tType;
+	uint16_t nLedCount;	///< Per output
+	uint8_t nOutputs;
+};
+
+static const struct TConfig s_aConfig[] = {
+		{ "single WS2812B", false, WS2812B, 170, 1 },
+		{ "single WS2812B", false, WS2812B, 680, 1 },
+		{ "single SK6812W", false, SK6812W, 128, 1 },
+		{ "single APA102", false, APA102, 680, 1 },
+		{ "multi WS2812B", true, WS2812B, 170, 4 },
+		{ "multi WS2812B", true, WS2812B, 510, 4 },
+		{ "multi WS2812B", true, WS2812B, 680, 4 },
+		{ "multi SK6812W", true, SK6812W, 512, 4 }
+};
+
+struct TResult {
+	uint32_t nFrames;
+	uint64_t nElapsedNanos;
+	uint64_t nEncodeTotalNanos;
+	uint64_t nEncodeMaxNanos;
+	uint32_t nSinkFrames;
+	uint64_t nSinkIntervalMaxNanos;
+	uint32_t nSinkChecked;
+	uint32_t nSinkMismatch;	///< Frames that differ from the expected wire format
+};
+
+static uint64_t nanos(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+/*
+ * Every slot changes every frame, the worst case for the encoder
+ */
+static uint8_t slot(uint32_t nFrame, uint32_t nUniverse, uint32_t nSlot) {
+	return (uint8_t) (nFrame + (nUniverse * 512) + (nSlot * 7));
+}
+
+static void universe(uint32_t nFrame, uint32_t nUniverse, uint8_t *pDmxData) {
+	for (uint32_t i = 0; i < 512; i++) {
+		pDmxData[i] = slot(nFrame, nUniverse, i);
+	}
+}
+
+static uint32_t leds_per_universe(const struct TConfig *pConfig) {
+	return (pConfig->tType == SK6812W) ? 128 : 170;
+}
+
+static uint32_t channels_per_led(const struct TConfig *pConfig) {
+	return (pConfig->tType == SK6812W) ? 4 : 3;
+}
+
+static uint32_t port_id(const struct TConfig *pConfig, TSource tSource, uint32_t nOutput, uint32_t nUniverse) {
+	const uint32_t nUniverses = (pConfig->nLedCount + leds_per_universe(pConfig) - 1) / leds_per_universe(pConfig);
+
+	return (tSource == SOURCE_ARTNET) ? (nOutput * 4) + nUniverse : (nOutput * nUniverses) + nUniverse;
+}
+
+/*
+ * The colour nColour (R, G, B, W) that LED nLed of output nOutput gets in frame nFrame
+ */
+static uint8_t colour(const struct TConfig *pConfig, TSource tSource, uint32_t nFrame, uint32_t nOutput, uint32_t nLed, uint32_t nColour) {
+	const uint32_t nLedsPerUniverse = leds_per_universe(pConfig);
+	const uint32_t nPortId = port_id(pConfig, tSource, nOutput, nLed / nLedsPerUniverse);
+
+	return slot(nFrame, nPortId, ((nLed % nLedsPerUniverse) * channels_per_led(pConfig)) + nColour);
+}
+
+/*
+ * The wire format of frame nFrame, written out here from the LED data sheets
+ * instead of with lib-ws28xx. WS2812B and SK6812W are GRB(W), MSB first.
+ * A single output has an SPI byte per bit with the T0H/T1H code, the 4x board
+ * has a word per bit with a bit per output and the pulse bit in every other word.
+ */
+static uint32_t s_aExpected[512 * 32];	///< Multi SK6812W 512, the largest frame
+
+static uint32_t expected(const struct TConfig *pConfig, TSource tSource, uint32_t nFrame) {
+	static const uint32_t aOrder[4] = { 1, 0, 2, 3 };	// GRBW
+	const uint32_t nColours = channels_per_led(pConfig);
+
+	if (pConfig->bMulti) {
+		const uint32_t nWords = pConfig->nLedCount * nColours * 8;
+
+		for (uint32_t i = 0; i < nWords; i++) {
+			s_aExpected[i] = (i & 0x1) ? (1 << 4) : 0;
+		}
+
+		for (uint32_t nOutput = 0; nOutput < pConfig->nOutputs; nOutput++) {
+			for (uint32_t nLed = 0; nLed < pConfig->nLedCount; nLed++) {
+				for (uint32_t c = 0; c < nColours; c++) {
+					const uint8_t nValue = colour(pConfig, tSource, nFrame, nOutput, nLed, aOrder[c]);
+
+					for (uint32_t b = 0; b < 8; b++) {
+						if (nValue & (0x80 >> b)) {
+							s_aExpected[(nLed * nColours * 8) + (c * 8) + b] |= (1 << nOutput);
+						}
+					}
+				}
+			}
+		}
+
+		return nWords * sizeof(uint32_t);
+	}
+
+	uint8_t *pExpected = (uint8_t *) s_aExpected;
+
+	if (pConfig->tType == APA102) {
+		uint32_t i = 0;
+
+		memset(&pExpected[i], 0, 4);
+		i += 4;
+
+		for (uint32_t nLed = 0; nLed < pConfig->nLedCount; nLed++) {
+			pExpected[i++] = 0xFF;	// Global brightness
+			pExpected[i++] = colour(pConfig, tSource, nFrame, 0, nLed, 0);
+			pExpected[i++] = colour(pConfig, tSource, nFrame, 0, nLed, 1);
+			pExpected[i++] = colour(pConfig, tSource, nFrame, 0, nLed, 2);
+		}
+
+		memset(&pExpected[i], 0xFF, 4);
+		return i + 4;
+	}
+
+	const uint8_t nLowCode = 0xC0;
+	const uint8_t nHighCode = (pConfig->tType == WS2812B) ? 0xF8 : 0xF0;
+	uint32_t i = 0;
+
+	for (uint32_t nLed = 0; nLed < pConfig->nLedCount; nLed++) {
+		for (uint32_t c = 0; c < nColours; c++) {
+			const uint8_t nValue = colour(pConfig, tSource, nFrame, 0, nLed, aOrder[c]);
+
+			for (uint32_t b = 0; b < 8; b++) {
+				pExpected[i++] = (nValue & (0x80 >> b)) ? nHighCode : nLowCode;
+			}
+		}
+	}
+
+	return i;
+}
+
+static void run(const struct TConfig *pConfig, TSource tSource, uint32_t nFrames, VirtualLED *pVirtualLED, struct TResult *pResult) {
+	const uint32_t nLedsPerUniverse = leds_per_universe(pConfig);
+	const uint32_t nUniverses = (pConfig->nLedCount + nLedsPerUniverse - 1) / nLedsPerUniverse;
+	const uint32_t nChannels = nLedsPerUniverse * channels_per_led(pConfig);
+
+	LightSet *pLightSet;
+
+	if (pConfig->bMulti) {
+		WS28xxDmxMulti *pMulti = new WS28xxDmxMulti(tSource == SOURCE_ARTNET ? WS28XXDMXMULTI_SRC_ARTNET : WS28XXDMXMULTI_SRC_E131);
+		pMulti->SetLEDType(pConfig->tType);
+		pMulti->SetLEDCount(pConfig->nLedCount);
+		pMulti->SetActivePorts(pConfig->nOutputs);
+		pMulti->Initialize();
+		pLightSet = pMulti;
+	} else {
+		WS28xxDmx *pSingle = new WS28xxDmx;
+		pSingle->SetLEDType(pConfig->tType);
+		pSingle->SetLEDCount(pConfig->nLedCount);
+		pLightSet = pSingle;
+	}
+
+	pLightSet->Start(0);
+
+	uint8_t aDmxData[512];
+	const uint32_t nSinkFirst = pVirtualLED->GetFrames();
+
+	memset(pResult, 0, sizeof(struct TResult));
+
+	const uint64_t nStart = nanos();
+
+	for (uint32_t nFrame = 0; nFrame < nFrames; nFrame++) {
+		uint64_t nEncode = 0;
+
+		if (tSource == SOURCE_SYNC) {
+			pLightSet->BeginFrame();
+		}
+
+		for (uint32_t nOutput = 0; nOutput < pConfig->nOutputs; nOutput++) {
+			for (uint32_t nUniverse = 0; nUniverse < nUniverses; nUniverse++) {
+				const uint32_t nPortId = port_id(pConfig, tSource, nOutput, nUniverse);
+
+				universe(nFrame, nPortId, aDmxData);	// The packet is received
+
+				const uint64_t nBegin = nanos();
+				pLightSet->SetData(nPortId, aDmxData, nChannels);
+				nEncode += nanos() - nBegin;
+			}
+		}
+
+		if (tSource == SOURCE_SYNC) {
+			const uint64_t nBegin = nanos();
+			pLightSet->CommitFrame();
+			nEncode += nanos() - nBegin;
+		}
+
+		pResult->nEncodeTotalNanos += nEncode;
+
+		if (nEncode > pResult->nEncodeMaxNanos) {
+			pResult->nEncodeMaxNanos = nEncode;
+		}
+	}
+
+	pResult->nElapsedNanos = nanos() - nStart;
+	pResult->nFrames = nFrames;
+	pResult->nSinkFrames = pVirtualLED->GetFrames() - nSinkFirst;
+
+	/*
+	 * Only the frames still in the sink can be checked for the interval
+	 * and against the expected wire format
+	 */
+	const uint32_t nSinkLast = nSinkFirst + pResult->nSinkFrames;
+	const uint32_t nCheck = (pResult->nSinkFrames < VIRTUALLED_SLOTS_DEFAULT) ? pResult->nSinkFrames : VIRTUALLED_SLOTS_DEFAULT;
+
+	for (uint32_t i = nSinkLast - nCheck + 1; i < nSinkLast; i++) {
+		const uint64_t nInterval = pVirtualLED->GetFrame(i)->nTimestamp - pVirtualLED->GetFrame(i - 1)->nTimestamp;
+
+		if (nInterval > pResult->nSinkIntervalMaxNanos) {
+			pResult->nSinkIntervalMaxNanos = nInterval;
+		}
+	}
+
+	for (uint32_t i = nSinkLast - nCheck; i < nSinkLast; i++) {
+		const struct TVirtualLEDFrame *pFrame = pVirtualLED->GetFrame(i);
+		const uint32_t nLength = expected(pConfig, tSource, i - nSinkFirst);
+		const uint32_t nCompare = (nLength < VIRTUALLED_FRAME_SIZE_DEFAULT) ? nLength : VIRTUALLED_FRAME_SIZE_DEFAULT;
+
+		pResult->nSinkChecked++;
+
+		if ((pFrame->nSequence != i + 1) || (pFrame->nLength != nCompare) || (memcmp((const uint8_t *) pFrame + sizeof(struct TVirtualLEDFrame), s_aExpected, nCompare) != 0)) {
+			pResult->nSinkMismatch++;
+		}
+	}
+
+	pLightSet->Stop(0);
+
+	delete pLightSet;
+}
+
+int main(int argc, char **argv) {
+	const uint32_t nFrames = (argc > 1) ? (uint32_t) atoi(argv[1]) : 1000;
+
+	linux_spi_set_device((argc > 2) ? argv[2] : 0);
+
+	VirtualLED virtualLED;
+
+	if (!virtualLED.Open(SINK_NAME)) {
+		return EXIT_FAILURE;
+	}
+
+	printf("%u frames, every slot changes every frame\n\n", nFrames);
+	printf("%-16s %4s %3s %-6s | %10s | %10s %10s | %8s %12s\n", "output", "leds", "out", "source", "frames/s", "encode us", "max us", "sink", "interval us");
+
+	int nResult = EXIT_SUCCESS;
+
+	for (uint32_t c = 0; c < sizeof(s_aConfig) / sizeof(s_aConfig[0]); c++) {
+		for (uint32_t s = 0; s < SOURCE_LAST; s++) {
+			if (!s_aConfig[c].bMulti && (s == SOURCE_SACN)) {
+				continue;	// WS28xxDmx maps the universes the same for Art-Net and sACN
+			}
+
+			struct TResult tResult;
+
+			run(&s_aConfig[c], (TSource) s, nFrames, &virtualLED, &tResult);
+
+			printf("%-16s %4u %3u %-6s | %10.1f | %10.2f %10.2f | %8u %12.2f\n", s_aConfig[c].pName, (unsigned) s_aConfig[c].nLedCount, (unsigned) s_aConfig[c].nOutputs, s_aSourceName[s],
+					(double) tResult.nFrames * 1e9 / (double) tResult.nElapsedNanos,
+					(double) tResult.nEncodeTotalNanos / 1e3 / (double) tResult.nFrames,
+					(double) tResult.nEncodeMaxNanos / 1e3,
+					tResult.nSinkFrames,
+					(double) tResult.nSinkIntervalMaxNanos / 1e3);
+
+			if (tResult.nSinkFrames != tResult.nFrames) {
+				fprintf(stderr, "%s %s: %u frames, %u in the sink\n", s_aConfig[c].pName, s_aSourceName[s], tResult.nFrames, tResult.nSinkFrames);
+				nResult = EXIT_FAILURE;
+			}
+
+			if (tResult.nSinkMismatch != 0) {
+				fprintf(stderr, "%s %u %s: %u of the last %u frames in the sink differ from the expected pixels\n", s_aConfig[c].pName, (unsigned) s_aConfig[c].nLedCount, s_aSourceName[s], tResult.nSinkMismatch, tResult.nSinkChecked);
+				nResult = EXIT_FAILURE;
+			}
+		}
+	}
+
+	return nResult;
+}
@@ -34,6 +34,9 @@
 
 #include "lightset.h"
 
+#if defined(USE_SPI_DMA)
+ #include "h3/ws28xxdma.h"
+#endif
 #include "ws28xx.h"
 #include "ws28xxdmxstore.h"
 
@@ -51,6 +54,8 @@ public:
 
 	virtual void SetData(uint8_t nPort, const uint8_t*, uint16_t);
 
+	void CommitFrame(void);
+
 	void Blackout(bool bBlackout);
 
 	virtual void SetLEDType(TWS28XXType);
@@ -129,9 +134,14 @@ protected:
 	uint16_t m_nDmxStartAddress;
 	uint16_t m_nDmxFootprint;
 
-	WS28xx* m_pLEDStripe;
+#if defined(USE_SPI_DMA)
+	WS28xxDMA *m_pLEDStripe;
+#else
+	WS28xx *m_pLEDStripe;
+#endif
 	bool m_bIsStarted;
 	bool m_bBlackout;
+	bool m_bIsFramePending;
 
 	WS28xxDmxStore *m_pWS28xxDmxStore;
 
@@ -51,6 +51,8 @@ public:
 
 	void SetData(uint8_t nPort, const uint8_t *pData, uint16_t nLength);
 
+	void CommitFrame(void);
+
 	void Blackout(bool bBlackout);
 
 	virtual void SetLEDType(TWS28XXType tWS28xxMultiType);
@@ -130,6 +132,7 @@ private:
 	uint32_t m_nChannelsPerLed;
 
 	uint32_t m_nPortIdLast;
+	bool m_bIsFramePending;
 	bool m_bUseSI5351A;
 };
 
@@ -35,6 +35,9 @@
 
 #include "rgbmapping.h"
 
+class PropertiesParser;
+struct TPropertiesTable;
+
 struct TWS28xxDmxParams {
     uint32_t nSetList;
 	TWS28XXType tLedType;
@@ -141,6 +144,8 @@ public:
 public:
 	static void staticCallbackFunction(void *p, const char *s);
 
+	static const struct TPropertiesTable PROPERTIES_TABLE;
+
 private:
     void callbackFunction(const char *pLine);
     bool isMaskSet(uint32_t nMask) {
@@ -150,6 +155,7 @@ private:
 private:
     WS28xxDmxParamsStore *m_pWS28xxParamsStore;
     struct TWS28xxDmxParams m_tWS28xxParams;
+    PropertiesParser *m_pPropertiesParser;
 };
 
 #endif /* WS28XXDMXPARAMS_H_ */
@@ -54,6 +54,7 @@ WS28xxDmx::WS28xxDmx(void) :
 	m_pLEDStripe(0),
 	m_bIsStarted(false),
 	m_bBlackout(false),
+	m_bIsFramePending(false),
 	m_pWS28xxDmxStore(0),
 	m_nClockSpeedHz(0),
 	m_nGlobalBrightness(0xFF),
@@ -80,7 +81,11 @@ void WS28xxDmx::Start(uint8_t nPort) {
 	m_bIsStarted = true;
 
 	if (m_pLEDStripe == 0) {
+#if defined(USE_SPI_DMA)
+		m_pLEDStripe = new WS28xxDMA(m_tLedType, m_nLedCount, m_tRGBMapping, m_nLowCode, m_nHighCode, m_nClockSpeedHz);
+#else
 		m_pLEDStripe = new WS28xx(m_tLedType, m_nLedCount, m_tRGBMapping, m_nLowCode, m_nHighCode, m_nClockSpeedHz);
+#endif
 		assert(m_pLEDStripe != 0);
 		m_pLEDStripe->SetGlobalBrightness(m_nGlobalBrightness);
 		m_pLEDStripe->Initialize();
@@ -170,11 +175,33 @@ void WS28xxDmx::SetData(uint8_t nPortId, const uint8_t *pData, uint16_t nLength)
 		}
 	}
 
-	if (nPortId == m_nPortIdLast) {
+	if (m_bIsInFrame) {
+		m_bIsFramePending = true;
+	} else if (nPortId == m_nPortIdLast) {
 		m_pLEDStripe->Update();
 	}
 }
 
+void WS28xxDmx::CommitFrame(void) {
+	LightSet::CommitFrame();
+
+	if (!m_bIsFramePending) {
+		return;
+	}
+
+	m_bIsFramePending = false;
+
+	if (m_bBlackout) {
+		return;
+	}
+
+	while (m_pLEDStripe->IsUpdating()) {
+		// wait for completion
+	}
+
+	m_pLEDStripe->Update();
+}
+
 void WS28xxDmx::SetLEDType(TWS28XXType type) {
 	m_tLedType = type;
 
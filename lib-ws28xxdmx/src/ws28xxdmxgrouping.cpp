@@ -26,6 +26,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 
 #include "ws28xxdmxgrouping.h"
@@ -63,6 +64,8 @@ void WS28xxDmxGrouping::Start(uint8_t nPort) {
 	m_pDmxData = new uint8_t[m_nDmxFootprint];
 	assert(m_pDmxData != 0);
 
+	memset(m_pDmxData, 0, m_nDmxFootprint);
+
 	WS28xxDmx::Start();
 }
 
@@ -75,48 +78,34 @@ void WS28xxDmxGrouping::SetData(uint8_t nPort, const uint8_t* pData, uint16_t nL
 		// wait for completion
 	}
 
-//	const uint8_t *p = pData + m_nDmxStartAddress - 1;
+	/*
+	 * Only the groups with changed DMX data are encoded. Each group is encoded
+	 * once and then replicated with block copies into the pixel buffer.
+	 */
+	const uint32_t nChannels = (m_tLedType == SK6812W) ? 4 : 3;
 	bool bIsChanged = false;
 
-	for (uint32_t i = m_nDmxStartAddress - 1, j = 0; (i < nLength) && (j < m_nDmxFootprint); i++, j++) {
-		if (pData[i] != m_pDmxData[j]) {
-			m_pDmxData[j] = pData[i];
-			bIsChanged = true;
+	for (uint32_t g = 0, d = 0, i = m_nDmxStartAddress - 1; (g < m_nGroups) && (i < nLength); g++, d += nChannels, i += nChannels) {
+		const uint32_t nCompare = ((nLength - i) < nChannels) ? (nLength - i) : nChannels;
+
+		if (memcmp(&pData[i], &m_pDmxData[d], nCompare) == 0) {
+			continue;
 		}
-	}
 
-//	for (uint32_t i = 0; i < m_nDmxFootprint; i++) {
-//		if (p[i] != m_pDmxData[i]) {
-//			m_pDmxData[i] = p[i];
-//			bIsChanged = true;
-//		}
-//	}
+		memcpy(&m_pDmxData[d], &pData[i], nCompare);
+		bIsChanged = true;
 
-	if (bIsChanged) {
-		uint32_t i = 0;
-		uint32_t d = 0;
-
-		if (m_tLedType == SK6812W) {
-			for (uint32_t g = 0; g < m_nGroups; g++) {
-				__builtin_prefetch(&m_pDmxData[d]);
-				for (uint32_t k = 0; k < m_nLEDGroupCount; k++) {
-					m_pLEDStripe->SetLED(k + i, m_pDmxData[d + 0], m_pDmxData[d + 1], m_pDmxData[d + 2], m_pDmxData[d + 3]);
-				}
-				i = i + m_nLEDGroupCount;
-				d = d + 4;
-			}
+		if (nChannels == 4) {
+			m_pLEDStripe->SetLEDGroup(g * m_nLEDGroupCount, m_nLEDGroupCount, m_pDmxData[d + 0], m_pDmxData[d + 1], m_pDmxData[d + 2], m_pDmxData[d + 3]);
 		} else {
-			for (uint32_t g = 0; g < m_nGroups; g++) {
-				__builtin_prefetch(&m_pDmxData[d]);
-				for (uint32_t k = 0; k < m_nLEDGroupCount; k++) {
-					m_pLEDStripe->SetLED(k + i, m_pDmxData[d + 0], m_pDmxData[d + 1], m_pDmxData[d + 2]);
-				}
-				i = i + m_nLEDGroupCount;
-				d = d + 3;
-			}
+			m_pLEDStripe->SetLEDGroup(g * m_nLEDGroupCount, m_nLEDGroupCount, m_pDmxData[d + 0], m_pDmxData[d + 1], m_pDmxData[d + 2]);
 		}
+	}
 
-		if (!m_bBlackout) {
+	if (bIsChanged) {
+		if (m_bIsInFrame) {
+			m_bIsFramePending = true;
+		} else if (!m_bBlackout) {
 			m_pLEDStripe->Update();
 		}
 	}
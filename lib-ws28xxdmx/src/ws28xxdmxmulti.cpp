@@ -57,6 +57,7 @@ WS28xxDmxMulti::WS28xxDmxMulti(TWS28xxDmxMultiSrc tSrc):
 	m_nBeginIndexPortId3(510),
 	m_nChannelsPerLed(3),
 	m_nPortIdLast(3), // -> (m_nActiveOutputs * m_nUniverses) -1;
+	m_bIsFramePending(false),
 	m_bUseSI5351A(false)
 {
 	DEBUG_ENTRY
@@ -131,7 +132,17 @@ void WS28xxDmxMulti::SetData(uint8_t nPortId, const uint8_t* pData, uint16_t nLe
 	uint32_t i = 0;
 	uint32_t beginIndex, endIndex;
 
-	switch (nPortId & ~(uint8_t)m_nUniverses & (uint8_t)0x03) {
+	uint32_t nOutIndex, nUniverse;
+
+	if (m_tSrc == WS28XXDMXMULTI_SRC_E131) {
+		nOutIndex = nPortId / m_nUniverses;
+		nUniverse = nPortId % m_nUniverses;
+	} else {
+		nOutIndex = nPortId / 4;
+		nUniverse = nPortId & 0x03;
+	}
+
+	switch (nUniverse) {
 	case 0:
 		beginIndex = 0;
 		endIndex = MIN(m_nLedCount, (nLength / m_nChannelsPerLed));
@@ -153,17 +164,9 @@ void WS28xxDmxMulti::SetData(uint8_t nPortId, const uint8_t* pData, uint16_t nLe
 		break;
 	}
 
-	uint32_t nOutIndex;
-
-	if (m_tSrc == WS28XXDMXMULTI_SRC_E131) {
-		nOutIndex = nPortId / m_nUniverses;
-	} else {
-		nOutIndex = nPortId / 4;
-	}
-
-	DEBUG_PRINTF("nPort=%d, nLength=%d, nOutIndex=%d, nPortId=%d, beginIndex=%d, endIndex=%d",
+	DEBUG_PRINTF("nPort=%d, nLength=%d, nOutIndex=%d, nUniverse=%d, beginIndex=%d, endIndex=%d",
 			(int ) nPortId, (int ) nLength, (int ) nOutIndex,
-			(int )nPortId & ~m_nUniverses & 0x03, (int)beginIndex, (int)endIndex);
+			(int ) nUniverse, (int)beginIndex, (int)endIndex);
 
 	while (m_pLEDStripe->IsUpdating()) {
 		// wait for completion
@@ -186,11 +189,33 @@ void WS28xxDmxMulti::SetData(uint8_t nPortId, const uint8_t* pData, uint16_t nLe
 		}
 	}
 
-	if (nPortId == m_nPortIdLast) {
+	if (m_bIsInFrame) {
+		m_bIsFramePending = true;
+	} else if (nPortId == m_nPortIdLast) {
 		m_pLEDStripe->Update();
 	}
 }
 
+void WS28xxDmxMulti::CommitFrame(void) {
+	LightSet::CommitFrame();
+
+	if (!m_bIsFramePending) {
+		return;
+	}
+
+	m_bIsFramePending = false;
+
+	if (m_bBlackout) {
+		return;
+	}
+
+	while (m_pLEDStripe->IsUpdating()) {
+		// wait for completion
+	}
+
+	m_pLEDStripe->Update();
+}
+
 void WS28xxDmxMulti::Blackout(bool bBlackout) {
 	m_bBlackout = bBlackout;
 
@@ -54,10 +54,50 @@
 
 #include "readconfigfile.h"
 #include "sscan.h"
+#include "propertiesparser.h"
 
 #include "devicesparamsconst.h"
 
-WS28xxDmxParams::WS28xxDmxParams(WS28xxDmxParamsStore *pWS28XXStripeParamsStore): m_pWS28xxParamsStore(pWS28XXStripeParamsStore) {
+#define OFFSET(f)	__builtin_offsetof(struct TWS28xxDmxParams, f)
+
+enum TWS28xxDmxParamsKey {
+	KEY_LED_TYPE,
+	KEY_LED_COUNT,
+	KEY_LED_RGB_MAPPING,
+	KEY_LED_T0H,
+	KEY_LED_T1H,
+	KEY_ACTIVE_OUT,
+	KEY_USE_SI5351A,
+	KEY_LED_GROUPING,
+	KEY_LED_GROUP_COUNT,
+	KEY_SPI_SPEED_HZ,
+	KEY_GLOBAL_BRIGHTNESS,
+	KEY_DMX_START_ADDRESS,
+	KEY_LAST
+};
+
+// Must be in the order of TWS28xxDmxParamsKey
+static const struct TPropertiesKey s_Keys[] = {
+	{ DevicesParamsConst::LED_TYPE, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DevicesParamsConst::LED_COUNT, OFFSET(nLedCount), PROPERTIES_TYPE_UINT16, WS28XXDMX_PARAMS_MASK_LED_COUNT, 1, 4 * 170 },
+	{ DevicesParamsConst::LED_RGB_MAPPING, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DevicesParamsConst::LED_T0H, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DevicesParamsConst::LED_T1H, 0, PROPERTIES_TYPE_CUSTOM, 0, 0, 0 },
+	{ DevicesParamsConst::ACTIVE_OUT, OFFSET(nActiveOutputs), PROPERTIES_TYPE_UINT8, WS28XXDMX_PARAMS_MASK_ACTIVE_OUT, 0, 0xFF },
+	{ DevicesParamsConst::USE_SI5351A, OFFSET(bUseSI5351A), PROPERTIES_TYPE_BOOL, WS28XXDMX_PARAMS_MASK_USE_SI5351A, 0, 0 },
+	{ DevicesParamsConst::LED_GROUPING, OFFSET(bLedGrouping), PROPERTIES_TYPE_BOOL, WS28XXDMX_PARAMS_MASK_LED_GROUPING, 0, 0 },
+	{ DevicesParamsConst::LED_GROUP_COUNT, OFFSET(nLedGroupCount), PROPERTIES_TYPE_UINT16, WS28XXDMX_PARAMS_MASK_LED_GROUP_COUNT, 1, 4 * 170 },
+	{ DevicesParamsConst::SPI_SPEED_HZ, OFFSET(nSpiSpeedHz), PROPERTIES_TYPE_UINT32, WS28XXDMX_PARAMS_MASK_SPI_SPEED, 0, 0xFFFFFFFF },
+	{ DevicesParamsConst::GLOBAL_BRIGHTNESS, OFFSET(nGlobalBrightness), PROPERTIES_TYPE_UINT8, WS28XXDMX_PARAMS_MASK_GLOBAL_BRIGHTNESS, 0, 0xFF },
+	{ LightSetConst::PARAMS_DMX_START_ADDRESS, OFFSET(nDmxStartAddress), PROPERTIES_TYPE_UINT16, WS28XXDMX_PARAMS_MASK_DMX_START_ADDRESS, 1, DMX_UNIVERSE_SIZE }
+};
+
+static_assert(sizeof(s_Keys) / sizeof(s_Keys[0]) == KEY_LAST, "s_Keys does not match TWS28xxDmxParamsKey");
+
+// nBits and nMultiplier are generated by lib-properties/generator
+const struct TPropertiesTable WS28xxDmxParams::PROPERTIES_TABLE = { s_Keys, sizeof(s_Keys) / sizeof(s_Keys[0]), 6, 0x9E3779B1 };
+
+WS28xxDmxParams::WS28xxDmxParams(WS28xxDmxParamsStore *pWS28XXStripeParamsStore): m_pWS28xxParamsStore(pWS28XXStripeParamsStore), m_pPropertiesParser(0) {
 	m_tWS28xxParams.nSetList = 0;
 	m_tWS28xxParams.tLedType = WS2812B;
 	m_tWS28xxParams.nLedCount = 170;
@@ -79,9 +119,16 @@ WS28xxDmxParams::~WS28xxDmxParams(void) {
 bool WS28xxDmxParams::Load(void) {
 	m_tWS28xxParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tWS28xxParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile configfile(WS28xxDmxParams::staticCallbackFunction, this);
 
-	if (configfile.Read(DevicesParamsConst::FILE_NAME)) {
+	const bool bHaveFile = configfile.Read(DevicesParamsConst::FILE_NAME);
+
+	m_pPropertiesParser = 0;
+
+	if (bHaveFile) {
 		// There is a configuration file
 		if (m_pWS28xxParamsStore != 0) {
 			m_pWS28xxParamsStore->Update(&m_tWS28xxParams);
@@ -106,132 +153,83 @@ void WS28xxDmxParams::Load(const char *pBuffer, uint32_t nLength) {
 
 	m_tWS28xxParams.nSetList = 0;
 
+	PropertiesParser parser(&PROPERTIES_TABLE, &m_tWS28xxParams);
+	m_pPropertiesParser = &parser;
+
 	ReadConfigFile config(WS28xxDmxParams::staticCallbackFunction, this);
 
 	config.Read(pBuffer, nLength);
 
+	m_pPropertiesParser = 0;
+
 	m_pWS28xxParamsStore->Update(&m_tWS28xxParams);
 }
 
 void WS28xxDmxParams::callbackFunction(const char *pLine) {
 	assert(pLine != 0);
+	assert(m_pPropertiesParser != 0);
 
 	uint8_t nValue8;
-	uint16_t nValue16;
-	uint32_t nValue32;
 	uint8_t nLength;
 	float fValue;
 	char cBuffer[16];
 
-	nLength = 7;
-	if (Sscan::Char(pLine, DevicesParamsConst::LED_TYPE, cBuffer, &nLength) == SSCAN_OK) {
-		cBuffer[nLength] = '\0';
-		uint32_t i;
-
-		for (i = 0; i < WS28XX_UNDEFINED; i++) {
-			if (strcasecmp(cBuffer, WS28xxConst::TYPES[i]) == 0) {
-				break;
+	switch (m_pPropertiesParser->Parse(pLine)) {
+	case KEY_LED_TYPE:
+		nLength = 7;
+		if (Sscan::Char(pLine, DevicesParamsConst::LED_TYPE, cBuffer, &nLength) == SSCAN_OK) {
+			cBuffer[nLength] = '\0';
+			uint32_t i;
+
+			for (i = 0; i < WS28XX_UNDEFINED; i++) {
+				if (strcasecmp(cBuffer, WS28xxConst::TYPES[i]) == 0) {
+					break;
+				}
 			}
-		}
-
-		m_tWS28xxParams.tLedType = (TWS28XXType) i;
-		m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_LED_TYPE;
-
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, DevicesParamsConst::LED_COUNT, &nValue16) == SSCAN_OK) {
-		if (nValue16 != 0 && nValue16 <= (4 * 170)) {
-			m_tWS28xxParams.nLedCount = nValue16;
-			m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_LED_COUNT;
-		}
-		return;
-	}
 
-	nLength = 3;
-	if (Sscan::Char(pLine, DevicesParamsConst::LED_RGB_MAPPING, cBuffer, &nLength) == SSCAN_OK) {
-		cBuffer[nLength] = '\0';
-		enum TRGBMapping tMapping;
-
-		if ((tMapping = RGBMapping::FromString(cBuffer)) != RGB_MAPPING_UNDEFINED) {
-			m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_RGB_MAPPING;
-		} else {
-			m_tWS28xxParams.nSetList &= ~WS28XXDMX_PARAMS_MASK_RGB_MAPPING;
+			m_tWS28xxParams.tLedType = (TWS28XXType) i;
+			m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_LED_TYPE;
 		}
+		break;
+	case KEY_LED_RGB_MAPPING:
+		nLength = 3;
+		if (Sscan::Char(pLine, DevicesParamsConst::LED_RGB_MAPPING, cBuffer, &nLength) == SSCAN_OK) {
+			cBuffer[nLength] = '\0';
+			enum TRGBMapping tMapping;
+
+			if ((tMapping = RGBMapping::FromString(cBuffer)) != RGB_MAPPING_UNDEFINED) {
+				m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_RGB_MAPPING;
+			} else {
+				m_tWS28xxParams.nSetList &= ~WS28XXDMX_PARAMS_MASK_RGB_MAPPING;
+			}
 
-		m_tWS28xxParams.nRgbMapping = (uint8_t) tMapping;
-
-		return;
-	}
-
-	if (Sscan::Float(pLine, DevicesParamsConst::LED_T0H, &fValue) == SSCAN_OK) {
-		if ((nValue8 = WS28xx::ConvertTxH(fValue)) != 0) {
-			m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_LOW_CODE;
-		} else {
-			m_tWS28xxParams.nSetList &= ~WS28XXDMX_PARAMS_MASK_LOW_CODE;
-		}
-
-		m_tWS28xxParams.nLowCode = nValue8;
-
-		return;
-	}
-
-	if (Sscan::Float(pLine, DevicesParamsConst::LED_T1H, &fValue) == SSCAN_OK) {
-		if ((nValue8 = WS28xx::ConvertTxH(fValue)) != 0) {
-			m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_HIGH_CODE;
-		} else {
-			m_tWS28xxParams.nSetList &= ~WS28XXDMX_PARAMS_MASK_HIGH_CODE;
+			m_tWS28xxParams.nRgbMapping = (uint8_t) tMapping;
 		}
+		break;
+	case KEY_LED_T0H:
+		if (Sscan::Float(pLine, DevicesParamsConst::LED_T0H, &fValue) == SSCAN_OK) {
+			if ((nValue8 = WS28xx::ConvertTxH(fValue)) != 0) {
+				m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_LOW_CODE;
+			} else {
+				m_tWS28xxParams.nSetList &= ~WS28XXDMX_PARAMS_MASK_LOW_CODE;
+			}
 
-		m_tWS28xxParams.nHighCode = nValue8;
-
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, DevicesParamsConst::ACTIVE_OUT, &nValue8) == SSCAN_OK) {
-		m_tWS28xxParams.nActiveOutputs = nValue8;
-		m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_ACTIVE_OUT;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, DevicesParamsConst::USE_SI5351A, &nValue8) == SSCAN_OK) {
-		m_tWS28xxParams.bUseSI5351A = (nValue8 != 0);
-		m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_USE_SI5351A;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, DevicesParamsConst::LED_GROUPING, &nValue8) == SSCAN_OK) {
-		m_tWS28xxParams.bLedGrouping = (nValue8 != 0);
-		m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_LED_GROUPING;
-		return;
-	}
-
-	if (Sscan::Uint16(pLine, DevicesParamsConst::LED_GROUP_COUNT, &nValue16) == SSCAN_OK) {
-		if (nValue16 != 0 && nValue16 <= (4 * 170)) {
-			m_tWS28xxParams.nLedGroupCount = nValue16;
-			m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_LED_GROUP_COUNT;
+			m_tWS28xxParams.nLowCode = nValue8;
 		}
-		return;
-	}
-
-	if (Sscan::Uint32(pLine, DevicesParamsConst::SPI_SPEED_HZ, &nValue32) == SSCAN_OK) {
-		m_tWS28xxParams.nSpiSpeedHz = nValue32;
-		m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_SPI_SPEED;
-		return;
-	}
-
-	if (Sscan::Uint8(pLine, DevicesParamsConst::GLOBAL_BRIGHTNESS, &nValue8) == SSCAN_OK) {
-		m_tWS28xxParams.nGlobalBrightness = nValue8;
-		m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_GLOBAL_BRIGHTNESS;
-		return;
-	}
+		break;
+	case KEY_LED_T1H:
+		if (Sscan::Float(pLine, DevicesParamsConst::LED_T1H, &fValue) == SSCAN_OK) {
+			if ((nValue8 = WS28xx::ConvertTxH(fValue)) != 0) {
+				m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_HIGH_CODE;
+			} else {
+				m_tWS28xxParams.nSetList &= ~WS28XXDMX_PARAMS_MASK_HIGH_CODE;
+			}
 
-	if (Sscan::Uint16(pLine, LightSetConst::PARAMS_DMX_START_ADDRESS, &nValue16) == SSCAN_OK) {
-		if (nValue16 != 0 && nValue16 <= DMX_UNIVERSE_SIZE) {
-			m_tWS28xxParams.nDmxStartAddress = nValue16;
-			m_tWS28xxParams.nSetList |= WS28XXDMX_PARAMS_MASK_DMX_START_ADDRESS;
+			m_tWS28xxParams.nHighCode = nValue8;
 		}
-		return;
+		break;
+	default:
+		break;
 	}
 }
 
@@ -194,6 +194,7 @@ int main(int argc, char **argv) {
 
 	for (;;) {
 		node.Run();
+		RDMSensors::Get()->Run();
 		identify.Run();
 #if defined (RASPPI)
 		spiFlashStore.Flash();
@@ -302,6 +302,12 @@ void notmain(void) {
 		hw.WatchdogFeed();
 		nw.Run();
 		node.Run();
+		RDMSensors::Get()->Run();
+#if defined (ORANGE_PI_ONE)
+		pSlushDmx->Run();
+#else
+		pSparkFunDmx->Run();
+#endif
 		identify.Run();
 #if defined (ORANGE_PI)
 		remoteConfig.Run();
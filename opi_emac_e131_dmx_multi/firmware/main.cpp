@@ -25,6 +25,7 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <assert.h>
 
 #include "hardware.h"
 #include "networkh3emac.h"
@@ -45,6 +46,7 @@
 // DMX Out
 #include "dmxparams.h"
 #include "h3/dmxsendmulti.h"
+#include "h3/dmxreceivermulti.h"
 #include "storedmxsend.h"
 
 #include "spiflashinstall.h"
@@ -102,31 +104,32 @@ void notmain(void) {
 		e131params.Dump();
 	}
 
+	const TE131PortDir tDirection = e131params.GetDirection();
 	uint16_t nUniverse;
 	bool bIsSetIndividual = false;
 	bool bIsSet;
 
 	nUniverse = e131params.GetUniverse(0, bIsSet);
 	if (bIsSet) {
-		bridge.SetUniverse(0, E131_OUTPUT_PORT, nUniverse);
+		bridge.SetUniverse(0, tDirection, nUniverse);
 		bIsSetIndividual = true;
 	}
 
 	nUniverse = e131params.GetUniverse(1, bIsSet);
 	if (bIsSet) {
-		bridge.SetUniverse(1, E131_OUTPUT_PORT, nUniverse);
+		bridge.SetUniverse(1, tDirection, nUniverse);
 		bIsSetIndividual = true;
 	}
 #if defined (ORANGE_PI_ONE)
 	nUniverse = e131params.GetUniverse(2, bIsSet);
 	if (bIsSet) {
-		bridge.SetUniverse(2, E131_OUTPUT_PORT, nUniverse);
+		bridge.SetUniverse(2, tDirection, nUniverse);
 		bIsSetIndividual = true;
 	}
 #ifndef DO_NOT_USE_UART0
 	nUniverse = e131params.GetUniverse(3, bIsSet);
 	if (bIsSet) {
-		bridge.SetUniverse(3, E131_OUTPUT_PORT, nUniverse);
+		bridge.SetUniverse(3, tDirection, nUniverse);
 		bIsSetIndividual = true;
 	}
 #endif
@@ -134,29 +137,44 @@ void notmain(void) {
 
 	if (!bIsSetIndividual) { // Backwards compatibility
 		nUniverse = e131params.GetUniverse();
-		bridge.SetUniverse(0, E131_OUTPUT_PORT, 0 + nUniverse);
-		bridge.SetUniverse(1, E131_OUTPUT_PORT, 1 + nUniverse);
+		bridge.SetUniverse(0, tDirection, 0 + nUniverse);
+		bridge.SetUniverse(1, tDirection, 1 + nUniverse);
 #if defined (ORANGE_PI_ONE)
-		bridge.SetUniverse(2, E131_OUTPUT_PORT, 2 + nUniverse);
+		bridge.SetUniverse(2, tDirection, 2 + nUniverse);
 #ifndef DO_NOT_USE_UART0
-		bridge.SetUniverse(3, E131_OUTPUT_PORT, 3 + nUniverse);
+		bridge.SetUniverse(3, tDirection, 3 + nUniverse);
 #endif
 #endif
 	}
 
-	DMXSendMulti dmx;
-	DMXParams dmxparams((DMXParamsStore *)&storeDmxSend);
+	DMXSendMulti *pDmxOutput = 0;
+	DMXReceiverMulti *pDmxInput = 0;
 
-	if (dmxparams.Load()) {
-		dmxparams.Dump();
-		dmxparams.Set(&dmx);
-	}
+	if (tDirection == E131_INPUT_PORT) {
+		pDmxInput = new DMXReceiverMulti(DMXRECEIVERMULTI_SRC_E131);
+		assert(pDmxInput != 0);
+
+		bridge.SetE131Dmx(pDmxInput);
+	} else {
+		pDmxOutput = new DMXSendMulti;
+		assert(pDmxOutput != 0);
 
-	bridge.SetDirectUpdate(false);
-	bridge.SetOutput(&dmx);
+		DMXParams dmxparams((DMXParamsStore *)&storeDmxSend);
+
+		if (dmxparams.Load()) {
+			dmxparams.Dump();
+			dmxparams.Set(pDmxOutput);
+		}
+
+		bridge.SetDirectUpdate(false);
+		bridge.SetOutput(pDmxOutput);
+	}
 
 	bridge.Print();
-	dmx.Print();
+
+	if (pDmxOutput != 0) {
+		pDmxOutput->Print();
+	}
 
 	display.SetTitle("Eth sACN E1.31 DMX");
 	display.Set(2, DISPLAY_UDF_LABEL_IP);
@@ -179,7 +197,7 @@ void notmain(void) {
 
 	display.Show(&bridge);
 
-	RemoteConfig remoteConfig(REMOTE_CONFIG_E131, REMOTE_CONFIG_MODE_DMX, bridge.GetActiveOutputPorts());
+	RemoteConfig remoteConfig(REMOTE_CONFIG_E131, REMOTE_CONFIG_MODE_DMX, (tDirection == E131_INPUT_PORT) ? bridge.GetActiveInputPorts() : bridge.GetActiveOutputPorts());
 
 	StoreRemoteConfig storeRemoteConfig;
 